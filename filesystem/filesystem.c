@@ -26,10 +26,15 @@
 #include <stdlib.h>
 #include <string.h>
 #include "filesystem.h"
+#include "filesystem_profiles.h"
 #include "watch.h"
 #include "lfs.h"
 #include "base64.h"
+#include "series_codec.h"
 #include "delay.h"
+#ifdef FILESYSTEM_EXTERNAL_FLASH
+#include "spiflash.h"
+#endif
 
 #ifndef min
 #define min(x, y) ((x) > (y) ? (y) : (x))
@@ -68,19 +73,113 @@ const struct lfs_config watch_lfs_cfg = {
     .sync  = lfs_storage_sync,
 
     // block device configuration
-    .read_size = 16,
+    // see filesystem_profiles.h for the read size, cache size, lookahead size and block cycles.
+    .read_size = FILESYSTEM_READ_SIZE,
     .prog_size = NVMCTRL_PAGE_SIZE,
     .block_size = NVMCTRL_ROW_SIZE,
     .block_count = NVMCTRL_RWWEE_PAGES / 4,
-    .cache_size = NVMCTRL_PAGE_SIZE,
-    .lookahead_size = 16,
-    .block_cycles = 100,
+    .cache_size = FILESYSTEM_CACHE_SIZE,
+    .lookahead_size = FILESYSTEM_LOOKAHEAD_SIZE,
+    .block_cycles = FILESYSTEM_BLOCK_CYCLES,
 };
 
 lfs_t eeprom_filesystem;
 static lfs_file_t file;
 static struct lfs_info info;
 
+#ifdef FILESYSTEM_EXTERNAL_FLASH
+
+int lfs_external_storage_read(const struct lfs_config *cfg, lfs_block_t block, lfs_off_t off, void *buffer, lfs_size_t size);
+int lfs_external_storage_prog(const struct lfs_config *cfg, lfs_block_t block, lfs_off_t off, const void *buffer, lfs_size_t size);
+int lfs_external_storage_erase(const struct lfs_config *cfg, lfs_block_t block);
+int lfs_external_storage_sync(const struct lfs_config *cfg);
+
+int lfs_external_storage_read(const struct lfs_config *cfg, lfs_block_t block, lfs_off_t off, void *buffer, lfs_size_t size) {
+    return !spi_flash_read_data(block * cfg->block_size + off, buffer, size);
+}
+
+int lfs_external_storage_prog(const struct lfs_config *cfg, lfs_block_t block, lfs_off_t off, const void *buffer, lfs_size_t size) {
+    return !spi_flash_program(block * cfg->block_size + off, buffer, size);
+}
+
+int lfs_external_storage_erase(const struct lfs_config *cfg, lfs_block_t block) {
+    return !spi_flash_erase_sector(block * cfg->block_size);
+}
+
+int lfs_external_storage_sync(const struct lfs_config *cfg) {
+    (void) cfg;
+    // spi_flash_program and spi_flash_erase_sector wait for the chip, so there's never anything pending.
+    return 0;
+}
+
+struct lfs_config external_lfs_cfg = {
+    // block device operations
+    .read  = lfs_external_storage_read,
+    .prog  = lfs_external_storage_prog,
+    .erase = lfs_external_storage_erase,
+    .sync  = lfs_external_storage_sync,
+
+    // block device configuration
+    // with a one-page cache, littlefs batches small appends into whole 256-byte page programs.
+    .read_size = 16,
+    .prog_size = SPI_FLASH_PAGE_SIZE,
+    .block_size = SPI_FLASH_SECTOR_SIZE,
+    .block_count = 0, // filled in from the chip's JEDEC ID before mounting
+    .cache_size = SPI_FLASH_PAGE_SIZE,
+    .lookahead_size = 32,
+    .block_cycles = 500,
+};
+
+lfs_t external_filesystem;
+static bool external_filesystem_mounted = false;
+// number of filesystem calls currently using the external flash; we power it down when this drops to zero.
+static uint8_t external_flash_users = 0;
+
+#endif
+
+// Figures out which volume a path lives on. Paths under FILESYSTEM_EXTERNAL_PREFIX go to the external
+// SPI flash with the prefix stripped; everything else goes to the internal 8 KB filesystem.
+// Returns NULL if the path is on a volume that isn't mounted.
+static lfs_t *_filesystem_volume_for_path(char **path) {
+#ifdef FILESYSTEM_EXTERNAL_FLASH
+    size_t prefix_len = strlen(FILESYSTEM_EXTERNAL_PREFIX);
+    if (strncmp(*path, FILESYSTEM_EXTERNAL_PREFIX, prefix_len) == 0 && ((*path)[prefix_len] == '/' || (*path)[prefix_len] == '\0')) {
+        if (!external_filesystem_mounted) return NULL;
+        *path += prefix_len;
+        if (**path == '\0') *path = "/";
+        return &external_filesystem;
+    }
+#else
+    (void) path;
+#endif
+
+    return &eeprom_filesystem;
+}
+
+// The external flash sits on the SPI bus, which (along with every other pin) is switched off when the watch
+// goes to sleep. Bracket any access to a volume with these calls to wake it up and put it back to sleep.
+static void _filesystem_volume_begin(lfs_t *lfs) {
+#ifdef FILESYSTEM_EXTERNAL_FLASH
+    if (lfs == &external_filesystem && external_flash_users++ == 0) {
+        spi_flash_init();
+        spi_flash_command(CMD_WAKE);
+    }
+#else
+    (void) lfs;
+#endif
+}
+
+static void _filesystem_volume_end(lfs_t *lfs) {
+#ifdef FILESYSTEM_EXTERNAL_FLASH
+    if (lfs == &external_filesystem && --external_flash_users == 0) {
+        spi_flash_command(CMD_DEEP_POWER_DOWN);
+        watch_disable_spi();
+    }
+#else
+    (void) lfs;
+#endif
+}
+
 static int _traverse_df_cb(void *p, lfs_block_t block) {
     (void) block;
 	uint32_t *nb = p;
@@ -88,20 +187,33 @@ static int _traverse_df_cb(void *p, lfs_block_t block) {
 	return 0;
 }
 
-int32_t filesystem_get_free_space(void) {
+static int32_t _filesystem_get_free_space(lfs_t *lfs) {
 	int err;
 
 	uint32_t free_blocks = 0;
-	err = lfs_fs_traverse(&eeprom_filesystem, _traverse_df_cb, &free_blocks);
+	_filesystem_volume_begin(lfs);
+	err = lfs_fs_traverse(lfs, _traverse_df_cb, &free_blocks);
+	_filesystem_volume_end(lfs);
 	if(err < 0){
 		return err;
 	}
 
-	uint32_t available = watch_lfs_cfg.block_count * watch_lfs_cfg.block_size - free_blocks * watch_lfs_cfg.block_size;
+	uint32_t available = lfs->cfg->block_count * lfs->cfg->block_size - free_blocks * lfs->cfg->block_size;
 
 	return (int32_t)available;
 }
 
+int32_t filesystem_get_free_space(void) {
+    return _filesystem_get_free_space(&eeprom_filesystem);
+}
+
+int32_t filesystem_get_free_space_for_path(char *path) {
+    lfs_t *lfs = _filesystem_volume_for_path(&path);
+    if (lfs == NULL) return LFS_ERR_NOENT;
+
+    return _filesystem_get_free_space(lfs);
+}
+
 static int filesystem_ls(lfs_t *lfs, const char *path) {
     lfs_dir_t dir;
     int err = lfs_dir_open(lfs, &dir, path);
@@ -139,6 +251,32 @@ static int filesystem_ls(lfs_t *lfs, const char *path) {
     return 0;
 }
 
+#ifdef FILESYSTEM_EXTERNAL_FLASH
+
+static bool _filesystem_init_external(void) {
+    _filesystem_volume_begin(&external_filesystem);
+
+    bool success = false;
+    uint32_t capacity = spi_flash_get_capacity();
+    if (capacity) {
+        external_lfs_cfg.block_count = capacity / SPI_FLASH_SECTOR_SIZE;
+        int err = lfs_mount(&external_filesystem, &external_lfs_cfg);
+        if (err < 0) {
+            printf("Formatting external flash...\r\n");
+            err = lfs_format(&external_filesystem, &external_lfs_cfg);
+            if (err == LFS_ERR_OK) err = lfs_mount(&external_filesystem, &external_lfs_cfg);
+        }
+        success = (err == LFS_ERR_OK);
+    }
+
+    _filesystem_volume_end(&external_filesystem);
+    external_filesystem_mounted = success;
+
+    return success;
+}
+
+#endif
+
 bool filesystem_init(void) {
     int err = lfs_mount(&eeprom_filesystem, &watch_lfs_cfg);
 
@@ -152,6 +290,13 @@ bool filesystem_init(void) {
         printf("Filesystem mounted with %ld bytes free.\r\n", filesystem_get_free_space());
     }
 
+#ifdef FILESYSTEM_EXTERNAL_FLASH
+    // a missing or unformattable external flash chip is not fatal; paths under /ext just won't work.
+    if (!_filesystem_init_external()) {
+        printf("No external flash found.\r\n");
+    }
+#endif
+
     return err == LFS_ERR_OK;
 }
 
@@ -171,17 +316,72 @@ int _filesystem_format(void) {
     return 0;
 }
 
+// files that have an index beside them; see "Index files" in filesystem.h. Paths have their volume prefix stripped.
+static struct {
+    lfs_t *lfs;
+    char path[FILESYSTEM_INDEX_PATH_MAX];
+} indexed_files[FILESYSTEM_INDEXED_FILES_MAX];
+static uint8_t num_indexed_files = 0;
+
+bool filesystem_register_index(char *filename) {
+    lfs_t *lfs = _filesystem_volume_for_path(&filename);
+    if (lfs == NULL) return false;
+
+    char *extension = strrchr(filename, '.');
+    size_t stem_len = extension ? (size_t)(extension - filename) : strlen(filename);
+    if (extension && !strcmp(extension, FILESYSTEM_INDEX_EXTENSION)) return false;
+    if (strlen(filename) >= FILESYSTEM_INDEX_PATH_MAX) return false;
+    if (stem_len + sizeof(FILESYSTEM_INDEX_EXTENSION) > FILESYSTEM_INDEX_PATH_MAX) return false;
+
+    for (uint8_t i = 0; i < num_indexed_files; i++) {
+        if (indexed_files[i].lfs == lfs && !strcmp(indexed_files[i].path, filename)) return true;
+    }
+    if (num_indexed_files == FILESYSTEM_INDEXED_FILES_MAX) return false;
+
+    indexed_files[num_indexed_files].lfs = lfs;
+    strcpy(indexed_files[num_indexed_files].path, filename);
+    num_indexed_files++;
+
+    return true;
+}
+
+// Removes the index derived from a file that just changed, if it has one. The path has already had its volume
+// prefix stripped, and the index lives on the same volume.
+static void _filesystem_invalidate_index(lfs_t *lfs, char *path) {
+    for (uint8_t i = 0; i < num_indexed_files; i++) {
+        if (indexed_files[i].lfs != lfs || strcmp(indexed_files[i].path, path)) continue;
+
+        // registration checked that the index path fits.
+        char index_path[FILESYSTEM_INDEX_PATH_MAX];
+        char *extension = strrchr(path, '.');
+        size_t stem_len = extension ? (size_t)(extension - path) : strlen(path);
+        memcpy(index_path, path, stem_len);
+        strcpy(index_path + stem_len, FILESYSTEM_INDEX_EXTENSION);
+        lfs_remove(lfs, index_path);
+        return;
+    }
+}
+
 bool filesystem_file_exists(char *filename) {
+    lfs_t *lfs = _filesystem_volume_for_path(&filename);
+    if (lfs == NULL) return false;
+
     info.type = 0;
-    lfs_stat(&eeprom_filesystem, filename, &info);
+    _filesystem_volume_begin(lfs);
+    lfs_stat(lfs, filename, &info);
+    _filesystem_volume_end(lfs);
     return info.type == LFS_TYPE_REG;
 }
 
 bool filesystem_rm(char *filename) {
-    info.type = 0;
-    lfs_stat(&eeprom_filesystem, filename, &info);
+    char *path = filename;
+    lfs_t *lfs = _filesystem_volume_for_path(&path);
     if (filesystem_file_exists(filename)) {
-        return lfs_remove(&eeprom_filesystem, filename) == LFS_ERR_OK;
+        _filesystem_volume_begin(lfs);
+        bool success = lfs_remove(lfs, path) == LFS_ERR_OK;
+        if (success) _filesystem_invalidate_index(lfs, path);
+        _filesystem_volume_end(lfs);
+        return success;
     } else {
         printf("rm: %s: No such file\r\n", filename);
         return false;
@@ -200,47 +400,71 @@ bool filesystem_read_file(char *filename, char *buf, int32_t length) {
     memset(buf, 0, length);
     int32_t file_size = filesystem_get_file_size(filename);
     if (file_size > 0) {
-        int err = lfs_file_open(&eeprom_filesystem, &file, filename, LFS_O_RDONLY);
-        if (err < 0) return false;
-        err = lfs_file_read(&eeprom_filesystem, &file, buf, min(length, file_size));
-        if (err < 0) return false;
-        return lfs_file_close(&eeprom_filesystem, &file) == LFS_ERR_OK;
+        lfs_t *lfs = _filesystem_volume_for_path(&filename);
+        bool success = false;
+        _filesystem_volume_begin(lfs);
+        if (lfs_file_open(lfs, &file, filename, LFS_O_RDONLY) == LFS_ERR_OK) {
+            success = lfs_file_read(lfs, &file, buf, min(length, file_size)) >= 0;
+            success = (lfs_file_close(lfs, &file) == LFS_ERR_OK) && success;
+        }
+        _filesystem_volume_end(lfs);
+        return success;
     }
 
     return false;
 }
 
+bool filesystem_read_file_at(char *filename, char *buf, int32_t offset, int32_t length) {
+    lfs_t *lfs = _filesystem_volume_for_path(&filename);
+    if (lfs == NULL) return false;
+
+    bool success = false;
+    _filesystem_volume_begin(lfs);
+    if (lfs_file_open(lfs, &file, filename, LFS_O_RDONLY) == LFS_ERR_OK) {
+        success = lfs_file_seek(lfs, &file, offset, LFS_SEEK_SET) >= 0 &&
+                  lfs_file_read(lfs, &file, buf, length) == length;
+        success = (lfs_file_close(lfs, &file) == LFS_ERR_OK) && success;
+    }
+    _filesystem_volume_end(lfs);
+
+    return success;
+}
+
 bool filesystem_read_line(char *filename, char *buf, int32_t *offset, int32_t length) {
     memset(buf, 0, length + 1);
     int32_t file_size = filesystem_get_file_size(filename);
     if (file_size > 0) {
-        int err = lfs_file_open(&eeprom_filesystem, &file, filename, LFS_O_RDONLY);
-        if (err < 0) return false;
-        err = lfs_file_seek(&eeprom_filesystem, &file, *offset, LFS_SEEK_SET);
-        if (err < 0) return false;
-        err = lfs_file_read(&eeprom_filesystem, &file, buf, min(length - 1, file_size - *offset));
-        if (err < 0) return false;
-        for(int i = 0; i < length; i++) {
-            (*offset)++;
-            if (buf[i] == '\n') {
-                buf[i] = 0;
-                break;
+        lfs_t *lfs = _filesystem_volume_for_path(&filename);
+        bool success = false;
+        _filesystem_volume_begin(lfs);
+        if (lfs_file_open(lfs, &file, filename, LFS_O_RDONLY) == LFS_ERR_OK) {
+            if (lfs_file_seek(lfs, &file, *offset, LFS_SEEK_SET) >= 0 &&
+                lfs_file_read(lfs, &file, buf, min(length - 1, file_size - *offset)) >= 0) {
+                for(int i = 0; i < length; i++) {
+                    (*offset)++;
+                    if (buf[i] == '\n') {
+                        buf[i] = 0;
+                        break;
+                    }
+                }
+                success = true;
             }
+            success = (lfs_file_close(lfs, &file) == LFS_ERR_OK) && success;
         }
-        return lfs_file_close(&eeprom_filesystem, &file) == LFS_ERR_OK;
+        _filesystem_volume_end(lfs);
+        return success;
     }
 
     return false;
 }
 
 static void filesystem_cat(char *filename) {
-    info.type = 0;
-    lfs_stat(&eeprom_filesystem, filename, &info);
     if (filesystem_file_exists(filename)) {
         if (info.size > 0) {
-            char *buf = malloc(info.size + 1);
-            filesystem_read_file(filename, buf, info.size);
-            buf[info.size] = '\0';
+            lfs_size_t size = info.size;
+            char *buf = malloc(size + 1);
+            filesystem_read_file(filename, buf, size);
+            buf[size] = '\0';
             printf("%s\r\n", buf);
             free(buf);
         } else {
@@ -251,38 +475,130 @@ static void filesystem_cat(char *filename) {
     }
 }
 
-bool filesystem_write_file(char *filename, char *text, int32_t length) {
-    if (filesystem_get_free_space() <= 256) {
+static bool _filesystem_write(char *filename, char *text, int32_t length, int flags) {
+    lfs_t *lfs = _filesystem_volume_for_path(&filename);
+    if (lfs == NULL) return false;
+
+    // the internal volume is small enough to walk before every write. On the external flash that walk means reading
+    // megabytes over SPI; there we let littlefs fail the write with LFS_ERR_NOSPC instead.
+    if (lfs == &eeprom_filesystem && _filesystem_get_free_space(lfs) <= (int32_t)lfs->cfg->block_size) {
         printf("No free space!\n");
-        return false;    
+        return false;
     }
 
-    int err = lfs_file_open(&eeprom_filesystem, &file, filename, LFS_O_RDWR | LFS_O_CREAT | LFS_O_TRUNC);
-    if (err < 0) return false;
-    err = lfs_file_write(&eeprom_filesystem, &file, text, length);
-    if (err < 0) return false;
-    return lfs_file_close(&eeprom_filesystem, &file) == LFS_ERR_OK;
+    bool success = false;
+    _filesystem_volume_begin(lfs);
+    if (lfs_file_open(lfs, &file, filename, flags) == LFS_ERR_OK) {
+        success = lfs_file_write(lfs, &file, text, length) >= 0;
+        success = (lfs_file_close(lfs, &file) == LFS_ERR_OK) && success;
+        _filesystem_invalidate_index(lfs, filename);
+    }
+    _filesystem_volume_end(lfs);
+
+    return success;
+}
+
+bool filesystem_write_file(char *filename, char *text, int32_t length) {
+    return _filesystem_write(filename, text, length, LFS_O_RDWR | LFS_O_CREAT | LFS_O_TRUNC);
+}
+
+bool filesystem_write_file_at(char *filename, char *text, int32_t offset, int32_t length) {
+    lfs_t *lfs = _filesystem_volume_for_path(&filename);
+    if (lfs == NULL) return false;
+
+    bool success = false;
+    _filesystem_volume_begin(lfs);
+    if (lfs_file_open(lfs, &file, filename, LFS_O_WRONLY) == LFS_ERR_OK) {
+        success = lfs_file_size(lfs, &file) >= offset &&
+                  lfs_file_seek(lfs, &file, offset, LFS_SEEK_SET) >= 0 &&
+                  lfs_file_write(lfs, &file, text, length) == length;
+        success = (lfs_file_close(lfs, &file) == LFS_ERR_OK) && success;
+        _filesystem_invalidate_index(lfs, filename);
+    }
+    _filesystem_volume_end(lfs);
+
+    return success;
 }
 
 bool filesystem_append_file(char *filename, char *text, int32_t length) {
-    if (filesystem_get_free_space() <= 256) {
-        printf("No free space!\n");
-        return false;    
+    return _filesystem_write(filename, text, length, LFS_O_WRONLY | LFS_O_CREAT | LFS_O_APPEND);
+}
+
+// longest frame header: a three-byte count, the channel byte, and a two-byte payload length.
+#define SERIES_FRAME_HEADER_MAX 6
+#define SERIES_FRAME_MAX_PAYLOAD SERIES_CODEC_MAX_ENCODED_SIZE(FILESYSTEM_SERIES_MAX_VALUES)
+
+bool filesystem_append_series(char *filename, const int16_t *values, uint16_t count, uint8_t channels) {
+    if (count == 0 || count > FILESYSTEM_SERIES_MAX_VALUES) return false;
+    if (channels == 0 || channels > SERIES_CODEC_MAX_CHANNELS) return false;
+
+    // encode the payload first, then slide the header in right in front of it.
+    uint8_t frame[SERIES_FRAME_HEADER_MAX + SERIES_FRAME_MAX_PAYLOAD];
+    uint8_t header[SERIES_FRAME_HEADER_MAX];
+    series_codec_state_t state;
+    series_codec_init(&state, channels);
+    size_t payload_length = series_codec_encode(&state, values, count, frame + SERIES_FRAME_HEADER_MAX);
+
+    size_t header_length = series_codec_put_varint(header, count);
+    header[header_length++] = channels;
+    header_length += series_codec_put_varint(header + header_length, payload_length);
+    uint8_t *start = frame + SERIES_FRAME_HEADER_MAX - header_length;
+    memcpy(start, header, header_length);
+
+    return _filesystem_write(filename, (char *)start, header_length + payload_length, LFS_O_WRONLY | LFS_O_CREAT | LFS_O_APPEND);
+}
+
+int32_t filesystem_read_series(char *filename, int32_t *offset, int16_t *values, uint8_t *channels) {
+    int32_t file_size = filesystem_get_file_size(filename);
+    if (file_size < 0) return -1;
+    if (*offset >= file_size) return 0;
+
+    uint8_t buf[SERIES_FRAME_HEADER_MAX + SERIES_FRAME_MAX_PAYLOAD];
+    lfs_t *lfs = _filesystem_volume_for_path(&filename);
+    int32_t result = -1;
+    _filesystem_volume_begin(lfs);
+    if (lfs_file_open(lfs, &file, filename, LFS_O_RDONLY) == LFS_ERR_OK) {
+        lfs_ssize_t available = -1;
+        if (lfs_file_seek(lfs, &file, *offset, LFS_SEEK_SET) >= 0) {
+            available = lfs_file_read(lfs, &file, buf, min((int32_t)sizeof(buf), file_size - *offset));
+        }
+        lfs_file_close(lfs, &file);
+
+        uint16_t count = 0;
+        uint16_t payload_length = 0;
+        size_t header = available > 0 ? series_codec_get_varint(buf, available, &count) : 0;
+        if (header && header < (size_t)available) {
+            uint8_t frame_channels = buf[header++];
+            size_t n = series_codec_get_varint(buf + header, available - header, &payload_length);
+            header += n;
+            if (n && count <= FILESYSTEM_SERIES_MAX_VALUES && frame_channels && frame_channels <= SERIES_CODEC_MAX_CHANNELS &&
+                header + payload_length <= (size_t)available) {
+                series_codec_state_t state;
+                series_codec_init(&state, frame_channels);
+                if (series_codec_decode(&state, buf + header, payload_length, values, count) == count) {
+                    if (channels != NULL) *channels = frame_channels;
+                    *offset += header + payload_length;
+                    result = count;
+                }
+            }
+        }
     }
+    _filesystem_volume_end(lfs);
 
-    int err = lfs_file_open(&eeprom_filesystem, &file, filename, LFS_O_WRONLY | LFS_O_CREAT | LFS_O_APPEND);
-    if (err < 0) return false;
-    err = lfs_file_write(&eeprom_filesystem, &file, text, length);
-    if (err < 0) return false;
-    return lfs_file_close(&eeprom_filesystem, &file) == LFS_ERR_OK;
+    return result;
 }
 
 int filesystem_cmd_ls(int argc, char *argv[]) {
-    if (argc >= 2) {
-        filesystem_ls(&eeprom_filesystem, argv[1]);
-    } else {
-        filesystem_ls(&eeprom_filesystem, "/");
+    char *path = (argc >= 2) ? argv[1] : "/";
+    lfs_t *lfs = _filesystem_volume_for_path(&path);
+    if (lfs == NULL) {
+        printf("ls: %s: No such volume\r\n", argv[1]);
+        return 1;
     }
+
+    _filesystem_volume_begin(lfs);
+    filesystem_ls(lfs, path);
+    _filesystem_volume_end(lfs);
     return 0;
 }
 
@@ -294,15 +610,14 @@ int filesystem_cmd_cat(int argc, char *argv[]) {
 
 int filesystem_cmd_b64encode(int argc, char *argv[]) {
     (void) argc;
-    info.type = 0;
-    lfs_stat(&eeprom_filesystem, argv[1], &info);
     if (filesystem_file_exists(argv[1])) {
         if (info.size > 0) {
-            char *buf = malloc(info.size + 1);
-            filesystem_read_file(argv[1], buf, info.size);
+            lfs_size_t size = info.size;
+            char *buf = malloc(size + 1);
+            filesystem_read_file(argv[1], buf, size);
             // print a base 64 encoding of the file, 12 bytes at a time
-            for (lfs_size_t i = 0; i < info.size; i += 12) {
-                lfs_size_t len = min(12, info.size - i);
+            for (lfs_size_t i = 0; i < size; i += 12) {
+                lfs_size_t len = min(12, size - i);
                 char base64_line[17];
                 b64_encode((unsigned char *)buf + i, len, (unsigned char *)base64_line);
                 printf("%s\n", base64_line);
@@ -322,6 +637,11 @@ int filesystem_cmd_df(int argc, char *argv[]) {
     (void) argc;
     (void) argv;
     printf("free space: %ld bytes\r\n", filesystem_get_free_space());
+#ifdef FILESYSTEM_EXTERNAL_FLASH
+    if (external_filesystem_mounted) {
+        printf("%s free space: %ld bytes\r\n", FILESYSTEM_EXTERNAL_PREFIX, filesystem_get_free_space_for_path(FILESYSTEM_EXTERNAL_PREFIX));
+    }
+#endif
     return 0;
 }
 
@@ -352,7 +672,10 @@ int filesystem_cmd_echo(int argc, char *argv[]) {
         line[line_len] = '\0';
     }
 
-    if (strchr(argv[3], '/')) {
+    // the only directory we support is the external volume's mount point.
+    char *path = argv[3];
+    if (_filesystem_volume_for_path(&path) != &eeprom_filesystem && path[0] == '/') path++;
+    if (strchr(path, '/')) {
         printf("subdirectories are not supported\r\n");
         return -2;
     }
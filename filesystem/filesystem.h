@@ -28,16 +28,42 @@
 #include <stdbool.h>
 #include "watch.h"
 
-/** @brief Initializes and mounts the tiny 8kb filesystem, formatting it if need be.
-  * @return true if the filesystem was mounted successfully.
+// Volumes:
+// By default, every file lives on the tiny 8kb filesystem in the SAM L22's RWWEE area. If you build with
+// SPI_FLASH=1 (for sensor boards with an SPI flash chip on A3), a second, much larger filesystem is mounted
+// on that chip. Any path that starts with FILESYSTEM_EXTERNAL_PREFIX, e.g. "/ext/accel.bin", lives there;
+// all other paths are unchanged. Keep settings on the internal volume, and put high-volume logs on /ext.
+#define FILESYSTEM_EXTERNAL_PREFIX "/ext"
+
+// Index files:
+// A face that parses a text file can keep what it learned in a binary index beside it, named after the
+// file with its extension replaced by FILESYSTEM_INDEX_EXTENSION (e.g. "totp_uris.idx" for "totp_uris.txt").
+// The face registers the file with filesystem_register_index, and from then on, whenever the file is written,
+// appended to or removed through these functions (including from the shell), its index is removed. So the face
+// only has to check that the index exists to know it's current, and rebuild it if not. Other files are left
+// alone. Paths too long for FILESYSTEM_INDEX_PATH_MAX, with either extension and the terminator, can't have an
+// index, and at most FILESYSTEM_INDEXED_FILES_MAX files can be registered.
+#define FILESYSTEM_INDEX_EXTENSION ".idx"
+#define FILESYSTEM_INDEX_PATH_MAX 32
+#define FILESYSTEM_INDEXED_FILES_MAX 4
+
+/** @brief Initializes and mounts the tiny 8kb filesystem, formatting it if need be. If the watch was built
+  *        with external flash support, it also mounts (or formats) the external volume.
+  * @return true if the internal filesystem was mounted successfully.
   */
 bool filesystem_init(void);
 
-/** @brief Gets the space available on the filesystem.
+/** @brief Gets the space available on the internal filesystem.
   * @return the free space in bytes
   */
 int32_t filesystem_get_free_space(void);
 
+/** @brief Gets the space available on the volume that holds a given path.
+  * @param path any path on the volume, e.g. "/" or FILESYSTEM_EXTERNAL_PREFIX
+  * @return the free space in bytes, or a negative number if the volume is not mounted.
+  */
+int32_t filesystem_get_free_space_for_path(char *path);
+
 /** @brief Checks for the existence of a file on the filesystem.
   * @param filename the file you wish to check
   * @return true if the file exists; false otherwise
@@ -50,6 +76,14 @@ bool filesystem_file_exists(char *filename);
   */
 bool filesystem_rm(char *filename);
 
+/** @brief Asks the filesystem to remove a file's index whenever the file changes; see "Index files" above.
+  *        Registering the same file again does nothing.
+  * @param filename the file the index is derived from, e.g. "totp_uris.txt"
+  * @return true if the file is registered; false if its volume isn't mounted, the path is too long, or there
+  *         are already FILESYSTEM_INDEXED_FILES_MAX files registered.
+  */
+bool filesystem_register_index(char *filename);
+
 /** @brief Gets the size of a file on the filesystem.
   * @param filename the file whose size you wish to determine
   * @return the file's size in bytes, or -1 if the file does not exist.
@@ -69,6 +103,15 @@ int32_t filesystem_get_file_size(char *filename);
   */
 bool filesystem_read_file(char *filename, char *buf, int32_t length);
 
+/** @brief Reads part of a file from the filesystem into a buffer
+  * @param filename the file you wish to read
+  * @param buf A buffer of at least length bytes
+  * @param offset The offset into the file to start reading from
+  * @param length The number of bytes to read
+  * @return true if all length bytes were read; false otherwise
+  */
+bool filesystem_read_file_at(char *filename, char *buf, int32_t offset, int32_t length);
+
 /** @brief Reads a line from a file into a buffer
   * @param filename the file you wish to read
   * @param buf A buffer of at least length + 1 bytes; the file will be read into this buffer,
@@ -88,6 +131,17 @@ bool filesystem_read_line(char *filename, char *buf, int32_t *offset, int32_t le
   */
 bool filesystem_write_file(char *filename, char *text, int32_t length);
 
+/** @brief Overwrites part of an existing file on the filesystem, in place
+  * @param filename the file you wish to write
+  * @param text The contents to write
+  * @param offset The offset into the file to start writing at; must not be past the end of the file
+  * @param length The number of bytes to write
+  * @return true if the write was successful; false otherwise
+  * @note littlefs rewrites everything from the block containing offset to the end of the file, so
+  *       keep the most frequently updated data at the end of the file.
+  */
+bool filesystem_write_file_at(char *filename, char *text, int32_t offset, int32_t length);
+
 /** @brief Appends text to file on the filesystem
   * @param filename the file you wish to write
   * @param text The contents to write
@@ -96,6 +150,35 @@ bool filesystem_write_file(char *filename, char *text, int32_t length);
   */
 bool filesystem_append_file(char *filename, char *text, int32_t length);
 
+// Compressed series:
+// Logs of 16-bit samples can be stored compressed with lib/series_codec (delta + zigzag + varint). Each call
+// to filesystem_append_series writes one self-contained frame:
+//   varint value count | channel count (1 byte) | varint payload length | payload
+// Every frame starts its deltas from zero, so no codec state has to survive between appends or reboots; the
+// price is that the first sample of each frame is stored in full, so append in batches where you can.
+// utils/series_codec/decode_series.py decodes these files on a computer.
+#define FILESYSTEM_SERIES_MAX_VALUES 96
+
+/** @brief Appends a batch of samples to a file as one compressed frame.
+  * @param filename the file you wish to write
+  * @param values the samples to write, with channels interleaved (x0, y0, z0, x1, y1, z1...)
+  * @param count the number of values, at most FILESYSTEM_SERIES_MAX_VALUES
+  * @param channels the number of interleaved channels, 1 to SERIES_CODEC_MAX_CHANNELS
+  * @return true if the write was successful; false otherwise
+  */
+bool filesystem_append_series(char *filename, const int16_t *values, uint16_t count, uint8_t channels);
+
+/** @brief Reads and decompresses one frame written by filesystem_append_series.
+  * @param filename the file you wish to read
+  * @param offset Pointer to an int representing the offset into the file. Start at 0; this will be
+  *               updated to reflect the offset of the next frame.
+  * @param values A buffer of at least FILESYSTEM_SERIES_MAX_VALUES samples
+  * @param channels If not NULL, receives the frame's channel count
+  * @return the number of values decoded, 0 at the end of the file, or -1 if the file could not be read
+  *         or the frame is corrupt.
+  */
+int32_t filesystem_read_series(char *filename, int32_t *offset, int16_t *values, uint8_t *channels);
+
 int filesystem_cmd_ls(int argc, char *argv[]);
 int filesystem_cmd_cat(int argc, char *argv[]);
 int filesystem_cmd_b64encode(int argc, char *argv[]);
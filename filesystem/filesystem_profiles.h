@@ -0,0 +1,67 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 Second Movement contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+// littlefs configuration profiles for the 8 KB RWWEE filesystem.
+// Select one at build time with `make FS_PROFILE=LOW_WEAR` (or BALANCED, FAST_MOUNT).
+// Use utils/lfs_bench to compare them against representative workloads before changing the default.
+//
+// Some constraints to keep in mind when adding a profile:
+//  * prog_size is always one RWWEE page (64 bytes), since that's the unit the NVM controller writes.
+//  * cache_size must be a multiple of both read_size and prog_size, and a factor of the block size (256).
+//  * lookahead_size must be a multiple of 8; with only 32 blocks, 8 bytes already covers the whole device.
+//  * RAM cost is roughly cache_size * (2 + number of open files), plus lookahead_size.
+
+#define FILESYSTEM_PROFILE_BALANCED 0
+#define FILESYSTEM_PROFILE_LOW_WEAR 1
+#define FILESYSTEM_PROFILE_FAST_MOUNT 2
+
+#ifndef FILESYSTEM_PROFILE
+#define FILESYSTEM_PROFILE FILESYSTEM_PROFILE_BALANCED
+#endif
+
+#if FILESYSTEM_PROFILE == FILESYSTEM_PROFILE_BALANCED
+// The original configuration: small reads, one page of cache.
+#define FILESYSTEM_READ_SIZE 16
+#define FILESYSTEM_CACHE_SIZE NVMCTRL_PAGE_SIZE
+#define FILESYSTEM_LOOKAHEAD_SIZE 16
+#define FILESYSTEM_BLOCK_CYCLES 100
+#elif FILESYSTEM_PROFILE == FILESYSTEM_PROFILE_LOW_WEAR
+// Relocate metadata pairs less often. Every relocation costs an erase plus a full rewrite of the pair,
+// which on a 32-block device is a large share of total erases for append-heavy logs.
+#define FILESYSTEM_READ_SIZE 16
+#define FILESYSTEM_CACHE_SIZE (NVMCTRL_PAGE_SIZE * 2)
+#define FILESYSTEM_LOOKAHEAD_SIZE 8
+#define FILESYSTEM_BLOCK_CYCLES 500
+#elif FILESYSTEM_PROFILE == FILESYSTEM_PROFILE_FAST_MOUNT
+// Cache a whole block, so that mount and directory traversal fetch each metadata block only once.
+// Costs an extra 576 bytes of RAM over BALANCED.
+#define FILESYSTEM_READ_SIZE NVMCTRL_PAGE_SIZE
+#define FILESYSTEM_CACHE_SIZE NVMCTRL_ROW_SIZE
+#define FILESYSTEM_LOOKAHEAD_SIZE 8
+#define FILESYSTEM_BLOCK_CYCLES 100
+#else
+#error "Unknown FILESYSTEM_PROFILE"
+#endif
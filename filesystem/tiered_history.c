@@ -0,0 +1,309 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 Second Movement contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <string.h>
+#include "tiered_history.h"
+#include "watch_utility.h"
+
+#define TIERED_HISTORY_MAGIC 0x31485354 // "TSH1"
+#define SAMPLE_MISSING INT16_MIN
+
+typedef struct {
+    uint32_t magic;
+    uint8_t sample_minutes;
+    uint8_t reserved;
+    uint16_t hours;
+    uint16_t days;
+    uint16_t reserved2;
+} tiered_history_header_t;
+
+typedef struct {
+    uint16_t tag;
+    int16_t value;
+} tiered_history_sample_record_t;
+
+typedef struct {
+    uint16_t tag;
+    uint16_t count;
+    int16_t min;
+    int16_t max;
+    int32_t sum;
+} tiered_history_aggregate_record_t;
+
+static uint16_t _tiered_history_samples_per_day(const tiered_history_config_t *config) {
+    return (24 * 60) / config->sample_minutes;
+}
+
+static int32_t _tiered_history_daily_offset(const tiered_history_config_t *config, uint32_t day) {
+    return sizeof(tiered_history_header_t) + (day % config->days) * sizeof(tiered_history_aggregate_record_t);
+}
+
+static int32_t _tiered_history_hourly_offset(const tiered_history_config_t *config, uint32_t hour) {
+    return sizeof(tiered_history_header_t) + config->days * sizeof(tiered_history_aggregate_record_t) +
+           (hour % config->hours) * sizeof(tiered_history_aggregate_record_t);
+}
+
+static int32_t _tiered_history_sample_offset(const tiered_history_config_t *config, uint32_t sample) {
+    return sizeof(tiered_history_header_t) + (config->days + config->hours) * sizeof(tiered_history_aggregate_record_t) +
+           (sample % _tiered_history_samples_per_day(config)) * sizeof(tiered_history_sample_record_t);
+}
+
+static int32_t _tiered_history_file_size(const tiered_history_config_t *config) {
+    return _tiered_history_sample_offset(config, 0) + _tiered_history_samples_per_day(config) * sizeof(tiered_history_sample_record_t);
+}
+
+static bool _tiered_history_create(const tiered_history_config_t *config) {
+    tiered_history_header_t header = {
+        .magic = TIERED_HISTORY_MAGIC,
+        .sample_minutes = config->sample_minutes,
+        .hours = config->hours,
+        .days = config->days,
+    };
+    if (!filesystem_write_file(config->filename, (char *)&header, sizeof(header))) return false;
+
+    // empty aggregates have a count of zero, and empty samples hold SAMPLE_MISSING.
+    union {
+        tiered_history_aggregate_record_t aggregates[8];
+        tiered_history_sample_record_t samples[24];
+    } chunk;
+    memset(&chunk, 0, sizeof(chunk));
+    int32_t remaining = (config->days + config->hours) * sizeof(tiered_history_aggregate_record_t);
+    while (remaining > 0) {
+        int32_t length = remaining < (int32_t)sizeof(chunk) ? remaining : (int32_t)sizeof(chunk);
+        if (!filesystem_append_file(config->filename, (char *)&chunk, length)) return false;
+        remaining -= length;
+    }
+    for (uint8_t i = 0; i < 24; i++) chunk.samples[i].value = SAMPLE_MISSING;
+    remaining = _tiered_history_samples_per_day(config) * sizeof(tiered_history_sample_record_t);
+    while (remaining > 0) {
+        int32_t length = remaining < (int32_t)sizeof(chunk) ? remaining : (int32_t)sizeof(chunk);
+        if (!filesystem_append_file(config->filename, (char *)&chunk, length)) return false;
+        remaining -= length;
+    }
+
+    return true;
+}
+
+static void _tiered_history_accumulate(tiered_history_accumulator_t *acc, int16_t min, int16_t max, int32_t sum, uint16_t count) {
+    if (count == 0) return;
+    if (acc->count == 0 || min < acc->min) acc->min = min;
+    if (acc->count == 0 || max > acc->max) acc->max = max;
+    acc->sum += sum;
+    acc->count += count;
+}
+
+static void _tiered_history_reset(tiered_history_accumulator_t *acc, uint32_t index) {
+    memset(acc, 0, sizeof(tiered_history_accumulator_t));
+    acc->index = index;
+}
+
+static bool _tiered_history_read_aggregate(tiered_history_t *history, int32_t offset, uint32_t index, tiered_history_aggregate_record_t *record) {
+    if (!filesystem_read_file_at(history->config->filename, (char *)record, offset, sizeof(tiered_history_aggregate_record_t))) return false;
+    return record->count != 0 && record->tag == (uint16_t)index;
+}
+
+static bool _tiered_history_read_sample(tiered_history_t *history, uint32_t index, int16_t *value) {
+    tiered_history_sample_record_t record;
+    if (!filesystem_read_file_at(history->config->filename, (char *)&record, _tiered_history_sample_offset(history->config, index), sizeof(record))) return false;
+    if (record.value == SAMPLE_MISSING || record.tag != (uint16_t)index) return false;
+    *value = record.value;
+    return true;
+}
+
+static void _tiered_history_write_aggregate(tiered_history_t *history, int32_t offset, tiered_history_accumulator_t *acc) {
+    tiered_history_aggregate_record_t record = {
+        .tag = (uint16_t)acc->index,
+        .count = acc->count,
+        .min = acc->min,
+        .max = acc->max,
+        .sum = acc->sum,
+    };
+    filesystem_write_file_at(history->config->filename, (char *)&record, offset, sizeof(record));
+}
+
+static void _tiered_history_close_day(tiered_history_t *history) {
+    if (history->day.count) {
+        _tiered_history_write_aggregate(history, _tiered_history_daily_offset(history->config, history->day.index), &history->day);
+    }
+}
+
+static void _tiered_history_close_hour(tiered_history_t *history) {
+    if (history->hour.count == 0) return;
+    _tiered_history_write_aggregate(history, _tiered_history_hourly_offset(history->config, history->hour.index), &history->hour);
+
+    // roll the hour up into its day. normally that's the running day, but if no sample has arrived since the
+    // hour ended, the running day may be a different one.
+    uint32_t day = history->hour.index / 24;
+    if (history->day.index != day) {
+        _tiered_history_close_day(history);
+        _tiered_history_reset(&history->day, day);
+    }
+    _tiered_history_accumulate(&history->day, history->hour.min, history->hour.max, history->hour.sum, history->hour.count);
+}
+
+bool tiered_history_init(tiered_history_t *history, const tiered_history_config_t *config, watch_date_time_t now) {
+    memset(history, 0, sizeof(tiered_history_t));
+    history->config = config;
+    if (config->sample_minutes == 0 || 60 % config->sample_minutes || config->hours == 0 || config->days == 0) return false;
+
+    tiered_history_header_t header;
+    bool valid = filesystem_get_file_size(config->filename) == _tiered_history_file_size(config) &&
+                 filesystem_read_file_at(config->filename, (char *)&header, 0, sizeof(header)) &&
+                 header.magic == TIERED_HISTORY_MAGIC &&
+                 header.sample_minutes == config->sample_minutes &&
+                 header.hours == config->hours &&
+                 header.days == config->days;
+    if (!valid && !_tiered_history_create(config)) return false;
+    history->ready = true;
+
+    // rebuild the running aggregates: this hour from its samples, and today from its hours.
+    uint32_t timestamp = watch_utility_date_time_to_unix_time(now, 0);
+    uint32_t hour = timestamp / 3600;
+    uint32_t day = timestamp / 86400;
+    _tiered_history_reset(&history->hour, hour);
+    _tiered_history_reset(&history->day, day);
+    if (!valid) return true;
+
+    uint32_t first_sample = hour * (60 / config->sample_minutes);
+    uint32_t last_sample = timestamp / (config->sample_minutes * 60);
+    for (uint32_t i = first_sample; i <= last_sample; i++) {
+        int16_t value;
+        if (_tiered_history_read_sample(history, i, &value)) _tiered_history_accumulate(&history->hour, value, value, value, 1);
+    }
+    for (uint32_t i = day * 24; i < hour && hour - i <= config->hours; i++) {
+        tiered_history_aggregate_record_t record;
+        if (_tiered_history_read_aggregate(history, _tiered_history_hourly_offset(config, i), i, &record)) {
+            _tiered_history_accumulate(&history->day, record.min, record.max, record.sum, record.count);
+        }
+    }
+
+    return true;
+}
+
+bool tiered_history_wants_sample(tiered_history_t *history, watch_date_time_t now) {
+    return history->ready && now.unit.minute % history->config->sample_minutes == 0;
+}
+
+void tiered_history_add_sample(tiered_history_t *history, watch_date_time_t now, int16_t value) {
+    if (!history->ready) return;
+    if (value == SAMPLE_MISSING) value++;
+
+    uint32_t timestamp = watch_utility_date_time_to_unix_time(now, 0);
+    uint32_t hour = timestamp / 3600;
+    uint32_t day = timestamp / 86400;
+
+    if (history->hour.index != hour) {
+        _tiered_history_close_hour(history);
+        _tiered_history_reset(&history->hour, hour);
+    }
+    if (history->day.index != day) {
+        _tiered_history_close_day(history);
+        _tiered_history_reset(&history->day, day);
+    }
+    _tiered_history_accumulate(&history->hour, value, value, value, 1);
+
+    uint32_t sample = timestamp / (history->config->sample_minutes * 60);
+    tiered_history_sample_record_t record = {
+        .tag = (uint16_t)sample,
+        .value = value,
+    };
+    filesystem_write_file_at(history->config->filename, (char *)&record, _tiered_history_sample_offset(history->config, sample), sizeof(record));
+}
+
+uint16_t tiered_history_get_capacity(tiered_history_t *history, tiered_history_tier_t tier) {
+    // an unusable history still has the current period, so faces can always use this as a modulus.
+    if (!history->ready) return 1;
+    switch (tier) {
+        case TIERED_HISTORY_SAMPLES:
+            return _tiered_history_samples_per_day(history->config);
+        case TIERED_HISTORY_HOURLY:
+            return history->config->hours + 1;
+        case TIERED_HISTORY_DAILY:
+            return history->config->days + 1;
+        default:
+            return 0;
+    }
+}
+
+static void _tiered_history_make_entry(tiered_history_entry_t *entry, int16_t min, int16_t max, int32_t sum, uint16_t count) {
+    entry->min = min;
+    entry->max = max;
+    entry->sum = sum;
+    entry->count = count;
+    entry->mean = sum / count;
+}
+
+bool tiered_history_get(tiered_history_t *history, tiered_history_tier_t tier, watch_date_time_t now, uint16_t back, tiered_history_entry_t *entry) {
+    memset(entry, 0, sizeof(tiered_history_entry_t));
+    if (!history->ready || back >= tiered_history_get_capacity(history, tier)) return false;
+
+    uint32_t timestamp = watch_utility_date_time_to_unix_time(now, 0);
+    uint32_t period;
+    tiered_history_accumulator_t *running;
+    int32_t offset;
+    switch (tier) {
+        case TIERED_HISTORY_SAMPLES:
+        {
+            period = history->config->sample_minutes * 60;
+            uint32_t index = timestamp / period - back;
+            entry->timestamp = index * period;
+            int16_t value;
+            if (!_tiered_history_read_sample(history, index, &value)) return false;
+            _tiered_history_make_entry(entry, value, value, value, 1);
+            return true;
+        }
+        case TIERED_HISTORY_HOURLY:
+            period = 3600;
+            running = &history->hour;
+            offset = _tiered_history_hourly_offset(history->config, timestamp / period - back);
+            break;
+        case TIERED_HISTORY_DAILY:
+            period = 86400;
+            running = &history->day;
+            offset = _tiered_history_daily_offset(history->config, timestamp / period - back);
+            break;
+        default:
+            return false;
+    }
+
+    uint32_t index = timestamp / period - back;
+    entry->timestamp = index * period;
+    if (running->index == index) {
+        tiered_history_accumulator_t current = *running;
+        // the running day doesn't include the hour in progress until that hour ends.
+        if (tier == TIERED_HISTORY_DAILY && history->hour.index / 24 == index) {
+            _tiered_history_accumulate(&current, history->hour.min, history->hour.max, history->hour.sum, history->hour.count);
+        }
+        if (current.count == 0) return false;
+        _tiered_history_make_entry(entry, current.min, current.max, current.sum, current.count);
+        return true;
+    }
+
+    // the current period is never on flash; its slot still holds the oldest entry in the ring.
+    tiered_history_aggregate_record_t record;
+    if (back == 0 || !_tiered_history_read_aggregate(history, offset, index, &record)) return false;
+    _tiered_history_make_entry(entry, record.min, record.max, record.sum, record.count);
+
+    return true;
+}
@@ -0,0 +1,135 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 Second Movement contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "watch.h"
+#include "filesystem.h"
+
+// Tiered sensor history:
+// Keeps a long record of one sensor in a fixed amount of flash, by keeping less detail the older it gets:
+//  * every sample for the last day (samples are taken every sample_minutes minutes);
+//  * hourly minimum, mean and maximum for the last `hours` hours;
+//  * daily minimum, mean and maximum for the last `days` days.
+// Rollups are incremental: each new sample is folded into a running hourly aggregate in RAM, which is written
+// out and folded into a running daily aggregate when the hour ends, and likewise for the day. Nothing is ever
+// recomputed from older data, so the cost of a sample doesn't grow with the length of the history.
+//
+// Each history lives in one file of fixed size, laid out as a header, then the daily, hourly and sample rings.
+// Every record sits at a slot determined by its own timestamp and carries a tag derived from it, so there are
+// no head pointers to update and gaps (watch off, battery out) simply read back as missing data. The sample
+// ring, which changes most often, is last in the file so that littlefs only has to rewrite the tail.
+//
+// Faces call tiered_history_add_sample from their background task, and ask for that background task when
+// tiered_history_wants_sample says so. All times are local times.
+
+#ifdef FILESYSTEM_EXTERNAL_FLASH
+// with external flash there's plenty of room: a month of hourly data, and a year of daily data.
+#define TIERED_HISTORY_PATH(name) FILESYSTEM_EXTERNAL_PREFIX "/" name
+#define TIERED_HISTORY_DEFAULT_HOURS (24 * 31)
+#define TIERED_HISTORY_DEFAULT_DAYS (366)
+#else
+// the internal filesystem is only 8 KB, and has to hold settings, steps.bin and sleep.bin (about 1 KB each) too.
+// As many hours and days as the old in-RAM logs kept: with half-hourly samples, one of these is 804 bytes, and
+// with 15 minute samples 996 bytes, four littlefs blocks either way.
+#define TIERED_HISTORY_PATH(name) name
+#define TIERED_HISTORY_DEFAULT_HOURS (36)
+#define TIERED_HISTORY_DEFAULT_DAYS (14)
+#endif
+
+typedef enum {
+    TIERED_HISTORY_SAMPLES = 0,
+    TIERED_HISTORY_HOURLY,
+    TIERED_HISTORY_DAILY,
+    TIERED_HISTORY_NUM_TIERS
+} tiered_history_tier_t;
+
+typedef struct {
+    char *filename;             // where to keep this history; use TIERED_HISTORY_PATH("name.hst").
+    uint8_t sample_minutes;     // minutes between samples; must divide 60.
+    uint16_t hours;             // number of hourly aggregates to keep, not counting the current hour.
+    uint16_t days;              // number of daily aggregates to keep, not counting today.
+} tiered_history_config_t;
+
+// A running aggregate. Don't manipulate directly.
+typedef struct {
+    uint32_t index;             // the hour or day number (local time / 3600 or / 86400) being aggregated
+    int32_t sum;
+    int16_t min;
+    int16_t max;
+    uint16_t count;
+} tiered_history_accumulator_t;
+
+typedef struct {
+    const tiered_history_config_t *config;
+    tiered_history_accumulator_t hour;
+    tiered_history_accumulator_t day;
+    bool ready;                 // false if the history file could not be created
+} tiered_history_t;
+
+typedef struct {
+    uint32_t timestamp;         // start of the period, in local seconds since 1970
+    int16_t min;
+    int16_t mean;
+    int16_t max;
+    int32_t sum;                // sum of all samples in the period; useful for counters like active minutes
+    uint16_t count;             // number of samples in the period
+} tiered_history_entry_t;
+
+/** @brief Opens a history, creating its file if it doesn't exist or was made with a different configuration.
+  *        The running aggregates for the current hour and day are rebuilt from what's on flash.
+  * @param history the history to initialize
+  * @param config the configuration; must remain valid for as long as the history is used
+  * @param now the current local time
+  * @return true if the history is ready to use
+  */
+bool tiered_history_init(tiered_history_t *history, const tiered_history_config_t *config, watch_date_time_t now);
+
+/** @brief Checks whether it's time for a sample. Call from your advise function.
+  * @param now the current local time
+  */
+bool tiered_history_wants_sample(tiered_history_t *history, watch_date_time_t now);
+
+/** @brief Records a sample, and rolls up the previous hour and day if they have ended.
+  * @param now the current local time
+  * @param value the sample
+  */
+void tiered_history_add_sample(tiered_history_t *history, watch_date_time_t now, int16_t value);
+
+/** @brief Gets the number of entries that tiered_history_get can return for a tier, including the current one.
+  */
+uint16_t tiered_history_get_capacity(tiered_history_t *history, tiered_history_tier_t tier);
+
+/** @brief Looks up an entry in the history.
+  * @param tier which tier to look in
+  * @param now the current local time
+  * @param back how far back to look: 0 is the current period (the latest sample, this hour or today, with
+  *             today and this hour including the samples taken so far), 1 the one before, and so on.
+  * @param entry receives the entry
+  * @return true if there is data for that period; false if it's missing or out of range. If the period is in
+  *         range but missing, entry->timestamp is still set, and its count is zero.
+  */
+bool tiered_history_get(tiered_history_t *history, tiered_history_tier_t tier, watch_date_time_t now, uint16_t back, tiered_history_entry_t *entry);
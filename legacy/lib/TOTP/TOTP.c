@@ -4,18 +4,12 @@
 #include "sha512.h"
 #include <stdio.h>
 
-uint8_t* _hmacKey;
-uint8_t _keyLength;
 uint8_t _timeZoneOffset;
-uint32_t _timeStep;
-hmac_alg _algorithm;
+totp_key _key;
 
 // Init the library with the private key, its length, the timeStep duration and the algorithm that should be used
 void TOTP(uint8_t* hmacKey, uint8_t keyLength, uint32_t timeStep, hmac_alg algorithm) {
-    _hmacKey = hmacKey;
-    _keyLength = keyLength;
-    _timeStep = timeStep;
-    _algorithm = algorithm;
+    prepareKey(&_key, hmacKey, keyLength, timeStep, algorithm);
 }
 
 void setTimezone(uint8_t timezone){
@@ -30,7 +24,7 @@ static uint32_t TimeStruct2Timestamp(struct tm time){
 
 // Generate a code, using the timestamp provided
 uint32_t getCodeFromTimestamp(uint32_t timeStamp) {
-    uint32_t steps = timeStamp / _timeStep;
+    uint32_t steps = timeStamp / _key.timeStep;
     return getCodeFromSteps(steps);
 }
 
@@ -41,6 +35,35 @@ uint32_t getCodeFromTimeStruct(struct tm time) {
 
 // Generate a code, using the number of steps provided
 uint32_t getCodeFromSteps(uint32_t steps) {
+    return getCodeFromKey(&_key, steps);
+}
+
+// Hash the key-padded blocks for a private key once, for any number of codes afterwards
+void prepareKey(totp_key* key, const uint8_t* hmacKey, uint8_t keyLength, uint32_t timeStep, hmac_alg algorithm) {
+    key->algorithm = algorithm;
+    key->timeStep = timeStep;
+
+    switch(algorithm){
+        case SHA1:
+            HMAC_SHA1_precompute(&key->inner.sha1, &key->outer.sha1, hmacKey, keyLength);
+            break;
+        case SHA224:
+            HMAC_SHA256_precompute(&key->inner.sha256, &key->outer.sha256, hmacKey, keyLength, 1);
+            break;
+        case SHA256:
+            HMAC_SHA256_precompute(&key->inner.sha256, &key->outer.sha256, hmacKey, keyLength, 0);
+            break;
+        case SHA384:
+            HMAC_SHA512_precompute(&key->inner.sha512, &key->outer.sha512, hmacKey, keyLength, 1);
+            break;
+        case SHA512:
+            HMAC_SHA512_precompute(&key->inner.sha512, &key->outer.sha512, hmacKey, keyLength, 0);
+            break;
+    }
+}
+
+// Generate a code from a prepared key, using the number of steps provided
+uint32_t getCodeFromKey(const totp_key* key, uint32_t steps) {
     // STEP 0, map the number of steps in a 8-bytes array (counter value)
     uint8_t _byteArray[8];
     _byteArray[0] = 0x00;
@@ -52,18 +75,66 @@ uint32_t getCodeFromSteps(uint32_t steps) {
     _byteArray[6] = (uint8_t)((steps >> 8) & 0XFF);
     _byteArray[7] = (uint8_t)((steps & 0XFF));
 
-    switch(_algorithm){
+    // STEP 1, get the HMAC hash from counter and key
+    uint8_t hash[SHA512_DIGEST_LENGTH];
+    uint8_t digest_length;
+    switch(key->algorithm){
         case SHA1:
-            return(TOTP_HMAC_SHA1(_hmacKey, _keyLength, _byteArray, 8));
+            HMAC_SHA1_finish(&key->inner.sha1, &key->outer.sha1, _byteArray, 8, hash);
+            digest_length = SHA1_DIGEST_LENGTH;
+            break;
         case SHA224:
-            return(TOTP_HMAC_SHA256(_hmacKey, _keyLength, _byteArray, 8, 1));
+            HMAC_SHA256_finish(&key->inner.sha256, &key->outer.sha256, _byteArray, 8, hash);
+            digest_length = SHA224_DIGEST_LENGTH;
+            break;
         case SHA256:
-            return(TOTP_HMAC_SHA256(_hmacKey, _keyLength, _byteArray, 8, 0));
+            HMAC_SHA256_finish(&key->inner.sha256, &key->outer.sha256, _byteArray, 8, hash);
+            digest_length = SHA256_DIGEST_LENGTH;
+            break;
         case SHA384:
-            return(TOTP_HMAC_SHA512(_hmacKey, _keyLength, _byteArray, 8, 1));
+            HMAC_SHA512_finish(&key->inner.sha512, &key->outer.sha512, _byteArray, 8, hash);
+            digest_length = SHA384_DIGEST_LENGTH;
+            break;
         case SHA512:
-            return(TOTP_HMAC_SHA512(_hmacKey, _keyLength, _byteArray, 8, 0));
+            HMAC_SHA512_finish(&key->inner.sha512, &key->outer.sha512, _byteArray, 8, hash);
+            digest_length = SHA512_DIGEST_LENGTH;
+            break;
         default:
             return(0);
     }
+
+    // STEP 2, apply dynamic truncation to obtain a 4-bytes string
+    uint32_t truncated_hash = 0;
+    uint8_t _offset = hash[digest_length - 1] & 0xF;
+    uint8_t j;
+    for (j = 0; j < 4; ++j) {
+        truncated_hash <<= 8;
+        truncated_hash  |= hash[_offset + j];
+    }
+
+    // STEP 3, compute the OTP value
+    truncated_hash &= 0x7FFFFFFF;
+    truncated_hash %= 1000000;
+
+    return truncated_hash;
+}
+
+int codesAreCurrent(const totp_codes* codes, uint32_t timeStamp, uint32_t timeStep) {
+    return codes->steps != 0 && codes->steps == timeStamp / timeStep;
+}
+
+// Bring a pair of cached codes up to date: on rolling over to the next step, the next code becomes the current one
+// and only the new next code has to be generated; after a longer gap, both are.
+void updateCodes(const totp_key* key, totp_codes* codes, uint32_t timeStamp) {
+    uint32_t steps = timeStamp / key->timeStep;
+
+    if (codes->steps != 0 && steps == codes->steps) return;
+
+    if (codes->steps != 0 && steps == codes->steps + 1) {
+        codes->current = codes->next;
+    } else {
+        codes->current = getCodeFromKey(key, steps);
+    }
+    codes->next = getCodeFromKey(key, steps + 1);
+    codes->steps = steps;
 }
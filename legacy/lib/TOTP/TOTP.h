@@ -3,6 +3,9 @@
 
 #include <inttypes.h>
 #include "time.h"
+#include "sha1.h"
+#include "sha256.h"
+#include "sha512.h"
 
 typedef enum __attribute__ ((__packed__)) {
     SHA1,
@@ -12,10 +15,36 @@ typedef enum __attribute__ ((__packed__)) {
     SHA512
 } hmac_alg;
 
+// A secret, prepared for generating codes: the hash states after the key-padded HMAC blocks, so that each code
+// only costs two compression-function calls. The secret itself isn't kept.
+typedef struct {
+    hmac_alg algorithm;
+    uint32_t timeStep;
+    union {
+        mbedtls_sha1_context sha1;
+        mbedtls_sha256_context sha256;
+        mbedtls_sha512_context sha512;
+    } inner, outer;
+} totp_key;
+
+// The codes for one time step and the next, so that a code can be shown for a whole step and the next one
+// is ready the moment the step rolls over.
+typedef struct {
+    uint32_t steps;     // the time step of current; 0 until the first updateCodes
+    uint32_t current;
+    uint32_t next;
+} totp_codes;
+
 void TOTP(uint8_t* hmacKey, uint8_t keyLength, uint32_t timeStep, hmac_alg algorithm);
 void setTimezone(uint8_t timezone);
 uint32_t getCodeFromTimestamp(uint32_t timeStamp);
 uint32_t getCodeFromTimeStruct(struct tm time);
 uint32_t getCodeFromSteps(uint32_t steps);
 
+void prepareKey(totp_key* key, const uint8_t* hmacKey, uint8_t keyLength, uint32_t timeStep, hmac_alg algorithm);
+uint32_t getCodeFromKey(const totp_key* key, uint32_t steps);
+// Returns true if the codes are already current for the timestamp; otherwise the caller has to updateCodes.
+int codesAreCurrent(const totp_codes* codes, uint32_t timeStamp, uint32_t timeStep);
+void updateCodes(const totp_key* key, totp_codes* codes, uint32_t timeStamp);
+
 #endif // TOTP_H_
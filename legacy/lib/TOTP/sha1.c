@@ -332,14 +332,13 @@ void mbedtls_sha1( const unsigned char *input, size_t ilen, unsigned char output
 }
 
 /*
-* Compute HMAC_SHA1 using key, key length, text to hash, size of the text, and output buffer
+* Hash the key-padded blocks for HMAC_SHA1 once, so that each message afterwards only costs the blocks of the message
+* itself: one compression for the inner hash of a short message, and one for the outer hash.
 */
-void HMAC_SHA1(const uint8_t* key, size_t key_length, const uint8_t *in, size_t n, uint8_t out[SHA1_DIGEST_LENGTH]){
-
+void HMAC_SHA1_precompute(mbedtls_sha1_context *inner, mbedtls_sha1_context *outer, const uint8_t* key, size_t key_length){
   uint8_t i;
   uint8_t k_ipad[SHA1_BLOCK_LENGTH]; /* inner padding - key XORd with ipad */
   uint8_t k_opad[SHA1_BLOCK_LENGTH]; /* outer padding - key XORd with opad */
-  uint8_t buffer[SHA1_BLOCK_LENGTH + SHA1_DIGEST_LENGTH];
 
   /* start out by storing key in pads */
   memset(k_ipad, 0, sizeof(k_ipad));
@@ -360,18 +359,39 @@ void HMAC_SHA1(const uint8_t* key, size_t key_length, const uint8_t *in, size_t
       k_ipad[i] ^= HMAC_IPAD;
       k_opad[i] ^= HMAC_OPAD;
   }
-  
+
+  mbedtls_sha1_starts(inner);
+  mbedtls_sha1_update(inner, k_ipad, SHA1_BLOCK_LENGTH);
+  mbedtls_sha1_starts(outer);
+  mbedtls_sha1_update(outer, k_opad, SHA1_BLOCK_LENGTH);
+}
+
+/*
+* Compute HMAC_SHA1 from the states HMAC_SHA1_precompute left, using text to hash, size of the text and output buffer
+*/
+void HMAC_SHA1_finish(const mbedtls_sha1_context *inner, const mbedtls_sha1_context *outer, const uint8_t *in, size_t n, uint8_t out[SHA1_DIGEST_LENGTH]){
+  mbedtls_sha1_context ctx;
+  const size_t digest_length = SHA1_DIGEST_LENGTH;
+
   // perform inner SHA1
-  memcpy(buffer, k_ipad, SHA1_BLOCK_LENGTH);
-  memcpy(buffer + SHA1_BLOCK_LENGTH, in, n);
-  mbedtls_sha1(buffer, SHA1_BLOCK_LENGTH + n, out);
-  
-  memset(buffer, 0, SHA1_BLOCK_LENGTH + n);
+  ctx = *inner;
+  mbedtls_sha1_update(&ctx, in, n);
+  mbedtls_sha1_finish(&ctx, out);
 
   // perform outer SHA1
-  memcpy(buffer, k_opad, SHA1_BLOCK_LENGTH);
-  memcpy(buffer + SHA1_BLOCK_LENGTH, out, SHA1_DIGEST_LENGTH);
-  mbedtls_sha1(buffer, SHA1_BLOCK_LENGTH + SHA1_DIGEST_LENGTH, out);
+  ctx = *outer;
+  mbedtls_sha1_update(&ctx, out, digest_length);
+  mbedtls_sha1_finish(&ctx, out);
+}
+
+/*
+* Compute HMAC_SHA1 using key, key length, text to hash, size of the text, and output buffer
+*/
+void HMAC_SHA1(const uint8_t* key, size_t key_length, const uint8_t *in, size_t n, uint8_t out[SHA1_DIGEST_LENGTH]){
+  mbedtls_sha1_context inner, outer;
+
+  HMAC_SHA1_precompute(&inner, &outer, key, key_length);
+  HMAC_SHA1_finish(&inner, &outer, in, n, out);
 }
 /*
 * Compute TOTP_HMAC_SHA1 using key, key length, text to hash, size of the text
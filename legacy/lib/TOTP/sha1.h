@@ -91,6 +91,8 @@ void mbedtls_sha1_process( mbedtls_sha1_context *ctx, const unsigned char data[S
  * \param output   SHA-1 checksum result
  */
 void mbedtls_sha1( const unsigned char *input, size_t ilen, unsigned char output[SHA1_DIGEST_LENGTH] );
+void HMAC_SHA1_precompute(mbedtls_sha1_context *inner, mbedtls_sha1_context *outer, const uint8_t* key, size_t key_length);
+void HMAC_SHA1_finish(const mbedtls_sha1_context *inner, const mbedtls_sha1_context *outer, const uint8_t *in, size_t n, uint8_t out[SHA1_DIGEST_LENGTH]);
 void HMAC_SHA1(const uint8_t* key, size_t key_length, const uint8_t *in, size_t n, uint8_t out[SHA1_DIGEST_LENGTH]);
 uint32_t TOTP_HMAC_SHA1(const uint8_t* key, size_t key_length, const uint8_t *in, size_t n);
 
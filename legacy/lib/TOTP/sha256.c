@@ -296,18 +296,13 @@ void mbedtls_sha256( const unsigned char *input, size_t ilen,
 }
 
 /*
-* Compute HMAC_SHA224/256 using key, key length, text to hash, size of the text, output buffer and a switch for SHA224
+* Hash the key-padded blocks for HMAC_SHA256 once, so that each message afterwards only costs the blocks of the message
+* itself: one compression for the inner hash of a short message, and one for the outer hash.
 */
-void HMAC_SHA256(const uint8_t* key, size_t key_length, const uint8_t *in, size_t n, uint8_t* out, int is224){
-  int digest_length = SHA256_DIGEST_LENGTH;
-  if (is224 == 1) {
-    digest_length = SHA224_DIGEST_LENGTH;
-  }
-  
+void HMAC_SHA256_precompute(mbedtls_sha256_context *inner, mbedtls_sha256_context *outer, const uint8_t* key, size_t key_length, int is224){
   uint8_t i;
   uint8_t k_ipad[SHA256_BLOCK_LENGTH]; /* inner padding - key XORd with ipad */
   uint8_t k_opad[SHA256_BLOCK_LENGTH]; /* outer padding - key XORd with opad */
-  uint8_t buffer[SHA256_BLOCK_LENGTH + digest_length];
 
   /* start out by storing key in pads */
   memset(k_ipad, 0, sizeof(k_ipad));
@@ -328,20 +323,40 @@ void HMAC_SHA256(const uint8_t* key, size_t key_length, const uint8_t *in, size_
       k_ipad[i] ^= HMAC_IPAD;
       k_opad[i] ^= HMAC_OPAD;
   }
-  
+
+  mbedtls_sha256_starts(inner, is224);
+  mbedtls_sha256_update(inner, k_ipad, SHA256_BLOCK_LENGTH);
+  mbedtls_sha256_starts(outer, is224);
+  mbedtls_sha256_update(outer, k_opad, SHA256_BLOCK_LENGTH);
+}
+
+/*
+* Compute HMAC_SHA256 from the states HMAC_SHA256_precompute left, using text to hash, size of the text and output buffer
+*/
+void HMAC_SHA256_finish(const mbedtls_sha256_context *inner, const mbedtls_sha256_context *outer, const uint8_t *in, size_t n, uint8_t* out){
+  mbedtls_sha256_context ctx;
+  const size_t digest_length = inner->is224 ? SHA224_DIGEST_LENGTH : SHA256_DIGEST_LENGTH;
+
   // perform inner SHA256
-  memcpy(buffer, k_ipad, SHA256_BLOCK_LENGTH);
-  memcpy(buffer + SHA256_BLOCK_LENGTH, in, n);
-  mbedtls_sha256(buffer, SHA256_BLOCK_LENGTH + n, out, is224);
-  
-  memset(buffer, 0, SHA256_BLOCK_LENGTH + n);
+  ctx = *inner;
+  mbedtls_sha256_update(&ctx, in, n);
+  mbedtls_sha256_finish(&ctx, out);
 
   // perform outer SHA256
-  memcpy(buffer, k_opad, SHA256_BLOCK_LENGTH);
-  memcpy(buffer + SHA256_BLOCK_LENGTH, out, digest_length);
-  mbedtls_sha256(buffer, SHA256_BLOCK_LENGTH + digest_length, out, is224);
+  ctx = *outer;
+  mbedtls_sha256_update(&ctx, out, digest_length);
+  mbedtls_sha256_finish(&ctx, out);
 }
 
+/*
+* Compute HMAC_SHA224/256 using key, key length, text to hash, size of the text, output buffer and a switch for SHA224
+*/
+void HMAC_SHA256(const uint8_t* key, size_t key_length, const uint8_t *in, size_t n, uint8_t* out, int is224){
+  mbedtls_sha256_context inner, outer;
+
+  HMAC_SHA256_precompute(&inner, &outer, key, key_length, is224);
+  HMAC_SHA256_finish(&inner, &outer, in, n, out);
+}
 /*
 * Compute TOTP_HMAC_SHA224/256 using key, key length, text to hash, size of the text and a switch for SHA224
 */
@@ -106,6 +106,8 @@ void mbedtls_sha256_process( mbedtls_sha256_context *ctx, const unsigned char da
  */
 void mbedtls_sha256( const unsigned char *input, size_t ilen,
            unsigned char* output, int is224 );
+void HMAC_SHA256_precompute(mbedtls_sha256_context *inner, mbedtls_sha256_context *outer, const uint8_t* key, size_t key_length, int is224);
+void HMAC_SHA256_finish(const mbedtls_sha256_context *inner, const mbedtls_sha256_context *outer, const uint8_t *in, size_t n, uint8_t* out);
 void HMAC_SHA256(const uint8_t* key, size_t key_length, const uint8_t *in, size_t n, uint8_t* out, int is224);
 uint32_t TOTP_HMAC_SHA256(const uint8_t* key, size_t key_length, const uint8_t *in, size_t n, int is224);
 
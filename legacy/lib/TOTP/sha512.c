@@ -346,18 +346,13 @@ void mbedtls_sha512( const unsigned char *input, size_t ilen,
 }
 
 /*
-* Compute HMAC_SHA384/512 using key, key length, text to hash, size of the text, output buffer and a switch for SHA384
+* Hash the key-padded blocks for HMAC_SHA512 once, so that each message afterwards only costs the blocks of the message
+* itself: one compression for the inner hash of a short message, and one for the outer hash.
 */
-void HMAC_SHA512(const uint8_t* key, size_t key_length, const uint8_t *in, size_t n, uint8_t* out, int is384){
-  int digest_length = SHA512_DIGEST_LENGTH;
-  if (is384 == 1) {
-    digest_length = SHA384_DIGEST_LENGTH;
-  }
-
+void HMAC_SHA512_precompute(mbedtls_sha512_context *inner, mbedtls_sha512_context *outer, const uint8_t* key, size_t key_length, int is384){
   uint8_t i;
   uint8_t k_ipad[SHA512_BLOCK_LENGTH]; /* inner padding - key XORd with ipad */
   uint8_t k_opad[SHA512_BLOCK_LENGTH]; /* outer padding - key XORd with opad */
-  uint8_t buffer[SHA512_BLOCK_LENGTH + digest_length];
 
   /* start out by storing key in pads */
   memset(k_ipad, 0, sizeof(k_ipad));
@@ -378,20 +373,40 @@ void HMAC_SHA512(const uint8_t* key, size_t key_length, const uint8_t *in, size_
       k_ipad[i] ^= HMAC_IPAD;
       k_opad[i] ^= HMAC_OPAD;
   }
-  
+
+  mbedtls_sha512_starts(inner, is384);
+  mbedtls_sha512_update(inner, k_ipad, SHA512_BLOCK_LENGTH);
+  mbedtls_sha512_starts(outer, is384);
+  mbedtls_sha512_update(outer, k_opad, SHA512_BLOCK_LENGTH);
+}
+
+/*
+* Compute HMAC_SHA512 from the states HMAC_SHA512_precompute left, using text to hash, size of the text and output buffer
+*/
+void HMAC_SHA512_finish(const mbedtls_sha512_context *inner, const mbedtls_sha512_context *outer, const uint8_t *in, size_t n, uint8_t* out){
+  mbedtls_sha512_context ctx;
+  const size_t digest_length = inner->is384 ? SHA384_DIGEST_LENGTH : SHA512_DIGEST_LENGTH;
+
   // perform inner SHA512
-  memcpy(buffer, k_ipad, SHA512_BLOCK_LENGTH);
-  memcpy(buffer + SHA512_BLOCK_LENGTH, in, n);
-  mbedtls_sha512(buffer, SHA512_BLOCK_LENGTH + n, out, is384);
-  
-  memset(buffer, 0, SHA512_BLOCK_LENGTH + n);
+  ctx = *inner;
+  mbedtls_sha512_update(&ctx, in, n);
+  mbedtls_sha512_finish(&ctx, out);
 
   // perform outer SHA512
-  memcpy(buffer, k_opad, SHA512_BLOCK_LENGTH);
-  memcpy(buffer + SHA512_BLOCK_LENGTH, out, digest_length);
-  mbedtls_sha512(buffer, SHA512_BLOCK_LENGTH + digest_length, out, is384);
+  ctx = *outer;
+  mbedtls_sha512_update(&ctx, out, digest_length);
+  mbedtls_sha512_finish(&ctx, out);
 }
 
+/*
+* Compute HMAC_SHA384/512 using key, key length, text to hash, size of the text, output buffer and a switch for SHA384
+*/
+void HMAC_SHA512(const uint8_t* key, size_t key_length, const uint8_t *in, size_t n, uint8_t* out, int is384){
+  mbedtls_sha512_context inner, outer;
+
+  HMAC_SHA512_precompute(&inner, &outer, key, key_length, is384);
+  HMAC_SHA512_finish(&inner, &outer, in, n, out);
+}
 /*
 * Compute TOTP_HMAC_SHA384/512 using key, key length, text to hash, size of the text and a switch for SHA384
 */
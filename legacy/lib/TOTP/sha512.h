@@ -113,6 +113,8 @@ int mbedtls_sha512_self_test( int verbose );
 
 /* Internal use */
 void mbedtls_sha512_process( mbedtls_sha512_context *ctx, const unsigned char data[SHA512_BLOCK_LENGTH] );
+void HMAC_SHA512_precompute(mbedtls_sha512_context *inner, mbedtls_sha512_context *outer, const uint8_t* key, size_t key_length, int is384);
+void HMAC_SHA512_finish(const mbedtls_sha512_context *inner, const mbedtls_sha512_context *outer, const uint8_t *in, size_t n, uint8_t* out);
 void HMAC_SHA512(const uint8_t* key, size_t key_length, const uint8_t *in, size_t n, uint8_t* out, int is384);
 uint32_t TOTP_HMAC_SHA512(const uint8_t* key, size_t key_length, const uint8_t *in, size_t n, int is384);
 
@@ -666,6 +666,155 @@ int16_t SCL_getAIMove(
   uint8_t *resultTo,
   char *resultProm);
 
+#ifndef SCL_SEARCH_TT_SIZE
+  /**
+    Number of entries in the transposition table of SCL_Search, must be a power
+    of two. Each entry takes 8 bytes.
+  */
+  #define SCL_SEARCH_TT_SIZE 128
+#endif
+
+#ifndef SCL_SEARCH_MOVE_STACK_SIZE
+  /**
+    Number of moves SCL_Search can hold for all positions on the current search
+    path together (including the root), 3 bytes each. If a position's moves
+    don't fit, it is evaluated statically instead.
+  */
+  #define SCL_SEARCH_MOVE_STACK_SIZE 384
+#endif
+
+#ifndef SCL_SEARCH_MAX_PLY
+  /**
+    Maximum distance from the root SCL_Search will go, including extensions.
+  */
+  #define SCL_SEARCH_MAX_PLY 16
+#endif
+
+/**
+  Transposition table entry of SCL_Search, for internal use.
+*/
+typedef struct
+{
+  uint16_t check;          ///< upper 16 bits of the position hash
+  int16_t score;
+  uint8_t depth;
+  uint8_t bound;           ///< SCL_SEARCH_BOUND_* (0 = empty entry)
+  uint8_t squareFrom;      ///< best or refuting move
+  uint8_t squareTo;
+} SCL_SearchTTEntry;
+
+/**
+  Move on the move stack of SCL_Search, for internal use.
+*/
+typedef struct
+{
+  uint8_t squareFrom;
+  uint8_t squareTo;
+  uint8_t order;           ///< higher is searched first
+} SCL_SearchMove;
+
+/**
+  Position on the current search path of SCL_Search, for internal use.
+*/
+typedef struct
+{
+  SCL_MoveUndo undo;       ///< undoes the move being searched
+  uint16_t moveStart;      ///< this position's moves on the move stack
+  uint16_t moveIndex;      ///< the move being searched
+  uint16_t moveEnd;
+  int16_t alpha;
+  int16_t beta;
+  int16_t alphaOriginal;
+  int16_t bestScore;
+  uint32_t hash;           ///< 0 if the result shouldn't be stored in the table
+  int8_t depth;
+  uint8_t bestFrom;
+  uint8_t bestTo;
+} SCL_SearchFrame;
+
+/**
+  State of an interruptible AI search, see SCL_searchInit. Unlike
+  SCL_getAIMove, which searches to a fixed depth in one call, this searches
+  with iterative deepening (depth 1, 2, 3, ...) in slices of a given number of
+  nodes, so that a program can search for as long as it has time, keep
+  responding in between and take the best move found so far whenever it wants.
+  A transposition table (with Zobrist hashing), killer moves and the history
+  heuristic make each new depth cheap and improve move ordering (and therefore
+  alpha-beta pruning). The search keeps its own stack instead of recursing, so a
+  slice that runs out of nodes stops where it is and the next one continues from
+  there.
+
+  The struct is a few kilobytes (mostly the table and the move stack, see
+  SCL_SEARCH_TT_SIZE and SCL_SEARCH_MOVE_STACK_SIZE), so on small platforms you
+  may want to allocate it only while searching.
+*/
+typedef struct
+{
+  SCL_Board board;
+  SCL_StaticEvaluationFunction evalFunc;
+  uint8_t maxDepth;
+  uint8_t extensionExtraDepth;
+  uint8_t depth;           ///< depth of the iteration in progress
+  uint8_t completedDepth;  ///< depth of the last completed iteration, 0 if none
+  uint8_t done;
+  uint8_t ply;             ///< depth of the search stack, 0 between root moves
+  uint8_t rootMoveCount;   ///< root moves are at the bottom of the move stack
+  uint8_t rootIndex;       ///< root move being searched in this iteration
+  SCL_MoveUndo rootUndo;
+  uint8_t iterationBest;   ///< index of the best root move in this iteration
+  int16_t iterationScore;
+  uint8_t bestFrom;        ///< best move of the last completed iteration
+  uint8_t bestTo;
+  int16_t bestScore;
+  uint16_t moveStackTop;
+  uint32_t nodes;          ///< positions searched so far
+  uint32_t nodeLimit;
+  SCL_SearchFrame frames[SCL_SEARCH_MAX_PLY];
+  uint16_t killers[SCL_SEARCH_MAX_PLY][2];
+  uint16_t history[6][SCL_BOARD_SQUARES];
+  SCL_SearchMove moveStack[SCL_SEARCH_MOVE_STACK_SIZE];
+  SCL_SearchTTEntry tt[SCL_SEARCH_TT_SIZE];
+} SCL_Search;
+
+/**
+  Computes a 32 bit Zobrist hash of the position, i.e. an XOR of pseudorandom
+  keys of each piece on its square, the castling/en passant state and the side
+  to move. Unlike SCL_boardHash32 this ignores the move counters, so the same
+  position reached by different move orders hashes the same.
+*/
+uint32_t SCL_boardZobrist32(const SCL_Board board);
+
+/**
+  Prepares a search for the best move for the player to move on given board
+  (the board is copied). maxDepth is the deepest iteration that will be
+  searched, extensionExtraDepth is how far beyond the nominal depth captures
+  and check evasions are followed (similar to SCL_getAIMove). The repetition
+  move (see SCL_gameGetRepetiotionMove) is only played if it's the only legal
+  move. evalFunc is ignored if SCL_EVALUATION_FUNCTION is defined.
+*/
+void SCL_searchInit(SCL_Search *search, const SCL_Board board,
+  uint8_t maxDepth, uint8_t extensionExtraDepth,
+  SCL_StaticEvaluationFunction evalFunc,
+  uint8_t repetitionMoveFrom, uint8_t repetitionMoveTo);
+
+/**
+  Continues the search for at most nodeBudget positions (slightly more may be
+  visited as the search unwinds). Returns 1 if the search is finished, i.e.
+  maxDepth has been completed, a forced mate was found or there is no choice to
+  make, 0 if calling this again would search more.
+*/
+uint8_t SCL_searchStep(SCL_Search *search, uint16_t nodeBudget);
+
+/**
+  Gets the best move found so far: the best move of the last completed
+  iteration, or of the iteration in progress if it has already found a better
+  one. Returns the move's score (with the same semantics as the value of an
+  evaluation function), or 0 with both squares 0 if the player to move has no
+  legal move.
+*/
+int16_t SCL_searchGetMove(SCL_Search *search, uint8_t *resultFrom,
+  uint8_t *resultTo, char *resultProm);
+
 /**
   Prints given chessboard using given format and an abstract printing function.
 */
@@ -3008,6 +3157,574 @@ board,i,iteratedSquare,'q',moveStr));
   return bestScore;
 }
 
+uint32_t _SCL_zobristKey(uint16_t index)
+{
+  /* The keys are computed rather than stored, so that they don't take 3 KB of
+     memory: this is a strong enough integer mix of the piece and square. */
+  uint32_t x = index * 0x9e3779b9 + 0x7f4a7c15;
+
+  x ^= x >> 16;
+  x *= 0x85ebca6b;
+  x ^= x >> 13;
+  x *= 0xc2b2ae35;
+  x ^= x >> 16;
+
+  return x;
+}
+
+uint32_t SCL_boardZobrist32(const SCL_Board board)
+{
+  uint32_t result = 0;
+
+  for (uint8_t i = 0; i < SCL_BOARD_SQUARES; ++i)
+    if (board[i] != '.')
+      result ^= _SCL_zobristKey(i * 64 + (board[i] & 0x3f)); // unique per piece
+
+  result ^= _SCL_zobristKey(4096 + (uint8_t) board[SCL_BOARD_ENPASSANT_CASTLE_BYTE]);
+
+  if (!SCL_boardWhitesTurn((char *) board))
+    result ^= _SCL_zobristKey(4096 + 256);
+
+  return result;
+}
+
+#define _SCL_SEARCH_BOUND_EXACT 1
+#define _SCL_SEARCH_BOUND_LOWER 2
+#define _SCL_SEARCH_BOUND_UPPER 3
+
+#define _SCL_SEARCH_INFINITY (SCL_EVALUATION_MAX_SCORE + 1)
+// scores beyond this are mates, counted in ply from the root
+#define _SCL_SEARCH_MATE_LIMIT (SCL_EVALUATION_MAX_SCORE - SCL_SEARCH_MAX_PLY - 1)
+
+#define _SCL_SEARCH_ORDER_TT 255
+#define _SCL_SEARCH_ORDER_CAPTURE 160
+#define _SCL_SEARCH_ORDER_KILLER 150
+
+/**
+  Pawn 1, knight 2, bishop 3, rook 4, queen 5, king 6.
+*/
+uint8_t _SCL_pieceRank(char piece)
+{
+  switch (piece | 0x20) // to lowercase
+  {
+    case 'p': return 1;
+    case 'n': return 2;
+    case 'b': return 3;
+    case 'r': return 4;
+    case 'q': return 5;
+    default: return 6;
+  }
+}
+
+/**
+  Static evaluation from the point of view of the player to move, with a mate
+  turned into a mate ply moves from the root.
+*/
+int16_t _SCL_searchEvaluate(SCL_Search *search, uint8_t ply)
+{
+#ifndef SCL_EVALUATION_FUNCTION
+  int16_t value = search->evalFunc(search->board);
+#else
+  int16_t value = SCL_EVALUATION_FUNCTION(search->board);
+#endif
+
+  if (value >= SCL_EVALUATION_MAX_SCORE)
+    value = SCL_EVALUATION_MAX_SCORE - ply;
+  else if (value <= -1 * SCL_EVALUATION_MAX_SCORE)
+    value = -1 * (SCL_EVALUATION_MAX_SCORE - ply);
+
+  return SCL_boardWhitesTurn(search->board) ? value : -1 * value;
+}
+
+/**
+  Pushes the legal moves of the player to move (only captures if capturesOnly)
+  to the move stack and assigns them an order. Returns the number of moves
+  pushed, or -1 (with nothing pushed) if they don't fit.
+*/
+int16_t _SCL_searchGenerateMoves(SCL_Search *search, uint8_t ply,
+  uint8_t capturesOnly, uint16_t ttMove)
+{
+  uint16_t start = search->moveStackTop;
+  uint16_t top = start;
+  uint8_t whitesTurn = SCL_boardWhitesTurn(search->board);
+  const char *b = search->board;
+
+  for (uint8_t i = 0; i < SCL_BOARD_SQUARES; ++i, ++b)
+  {
+    char s = *b;
+
+    if (s == '.' || SCL_pieceIsWhite(s) != whitesTurn)
+      continue;
+
+    SCL_SquareSet moves;
+
+    SCL_squareSetClear(moves);
+    SCL_boardGetMoves(search->board,i,moves);
+
+    SCL_SQUARE_SET_ITERATE_BEGIN(moves)
+
+      char taken = search->board[iteratedSquare];
+
+      if (!capturesOnly || taken != '.')
+      {
+        if (top >= SCL_SEARCH_MOVE_STACK_SIZE)
+          return -1;
+
+        uint16_t move = (((uint16_t) i) << 8) | iteratedSquare;
+        uint8_t order;
+
+        if (move == ttMove)
+          order = _SCL_SEARCH_ORDER_TT;
+        else if (taken != '.') // most valuable victim, least valuable attacker
+          order = _SCL_SEARCH_ORDER_CAPTURE + _SCL_pieceRank(taken) * 16 -
+            _SCL_pieceRank(s);
+        else if (ply < SCL_SEARCH_MAX_PLY && move == search->killers[ply][0])
+          order = _SCL_SEARCH_ORDER_KILLER;
+        else if (ply < SCL_SEARCH_MAX_PLY && move == search->killers[ply][1])
+          order = _SCL_SEARCH_ORDER_KILLER - 1;
+        else
+        {
+          uint16_t h =
+            search->history[_SCL_pieceRank(s) - 1][iteratedSquare] >> 5;
+
+          order = h > 127 ? 127 : h;
+        }
+
+        search->moveStack[top].squareFrom = i;
+        search->moveStack[top].squareTo = iteratedSquare;
+        search->moveStack[top].order = order;
+        top++;
+      }
+
+    SCL_SQUARE_SET_ITERATE_END
+  }
+
+  search->moveStackTop = top;
+
+  return top - start;
+}
+
+/**
+  Moves the highest ordered of the moves from index on to index.
+*/
+void _SCL_searchPickMove(SCL_Search *search, uint16_t index, uint16_t end)
+{
+  uint16_t best = index;
+
+  for (uint16_t i = index + 1; i < end; ++i)
+    if (search->moveStack[i].order > search->moveStack[best].order)
+      best = i;
+
+  if (best != index)
+  {
+    SCL_SearchMove m = search->moveStack[index];
+    search->moveStack[index] = search->moveStack[best];
+    search->moveStack[best] = m;
+  }
+}
+
+void _SCL_searchRewardQuietMove(SCL_Search *search, uint8_t ply, int8_t depth,
+  uint8_t squareFrom, uint8_t squareTo)
+{
+  uint16_t move = (((uint16_t) squareFrom) << 8) | squareTo;
+
+  if (ply < SCL_SEARCH_MAX_PLY && search->killers[ply][0] != move)
+  {
+    search->killers[ply][1] = search->killers[ply][0];
+    search->killers[ply][0] = move;
+  }
+
+  uint16_t *h =
+    &(search->history[_SCL_pieceRank(search->board[squareFrom]) - 1][squareTo]);
+
+  *h += depth * depth;
+
+  if (*h > 60000) // age everything rather than overflow
+    for (uint8_t p = 0; p < 6; ++p)
+      for (uint8_t s = 0; s < SCL_BOARD_SQUARES; ++s)
+        search->history[p][s] /= 2;
+}
+
+/**
+  Enters the current position at given ply in a negamax alpha-beta search;
+  scores are from the point of view of the player to move. At depth 0 and below
+  only captures are searched (quiescence), unless the player is in check, down
+  to -extensionExtraDepth. Returns 1 with the position's score if it's known
+  without searching any moves, otherwise sets up the ply's frame and returns 0.
+*/
+uint8_t _SCL_searchEnter(SCL_Search *search, uint8_t ply, int8_t depth,
+  int16_t alpha, int16_t beta, int16_t *score)
+{
+#if SCL_COUNT_EVALUATED_POSITIONS
+  SCL_positionsEvaluated++;
+#endif
+
+#if SCL_CALL_WDT_RESET
+  wdt_reset();
+#endif
+
+  search->nodes++;
+
+  if (ply >= SCL_SEARCH_MAX_PLY)
+  {
+    *score = _SCL_searchEvaluate(search,ply);
+    return 1;
+  }
+
+  int8_t horizon = -1 * (int8_t) search->extensionExtraDepth;
+  uint8_t inCheck =
+    SCL_boardCheck(search->board,SCL_boardWhitesTurn(search->board));
+  uint8_t capturesOnly = depth <= 0 && !(inCheck && depth > horizon);
+  int16_t alphaOriginal = alpha;
+  int16_t bestScore = -1 * _SCL_SEARCH_INFINITY;
+  uint16_t ttMove = 0;
+  uint32_t hash = 0;
+
+  if (capturesOnly)
+  {
+    // stand pat: the player doesn't have to capture
+    bestScore = _SCL_searchEvaluate(search,ply);
+
+    if (bestScore >= beta || depth <= horizon)
+    {
+      *score = bestScore;
+      return 1;
+    }
+
+    if (bestScore > alpha)
+      alpha = bestScore;
+  }
+  else
+  {
+    hash = SCL_boardZobrist32(search->board) | 1; // 0 means "don't store"
+
+    SCL_SearchTTEntry *entry = &(search->tt[hash & (SCL_SEARCH_TT_SIZE - 1)]);
+
+    if (entry->bound != 0 && entry->check == (hash >> 16))
+    {
+      ttMove = (((uint16_t) entry->squareFrom) << 8) | entry->squareTo;
+
+      if (depth > 0 && entry->depth >= depth)
+      {
+        int16_t s = entry->score;
+
+        if (s > _SCL_SEARCH_MATE_LIMIT)
+          s -= ply;
+        else if (s < -1 * _SCL_SEARCH_MATE_LIMIT)
+          s += ply;
+
+        if (entry->bound == _SCL_SEARCH_BOUND_EXACT ||
+          (entry->bound == _SCL_SEARCH_BOUND_LOWER && s >= beta) ||
+          (entry->bound == _SCL_SEARCH_BOUND_UPPER && s <= alpha))
+        {
+          *score = s;
+          return 1;
+        }
+      }
+    }
+
+    if (depth <= 0)
+      hash = 0;
+  }
+
+  uint16_t start = search->moveStackTop;
+  int16_t count = _SCL_searchGenerateMoves(search,ply,capturesOnly,ttMove);
+
+  if (count < 0) // out of move stack
+  {
+    *score = _SCL_searchEvaluate(search,ply);
+    return 1;
+  }
+
+  if (count == 0)
+  {
+    search->moveStackTop = start;
+
+    if (capturesOnly)
+      *score = bestScore;
+    else // mate (sooner is better) or stalemate
+      *score = inCheck ? -1 * (SCL_EVALUATION_MAX_SCORE - ply) : 0;
+
+    return 1;
+  }
+
+  SCL_SearchFrame *frame = &(search->frames[ply]);
+
+  frame->moveStart = start;
+  frame->moveIndex = start;
+  frame->moveEnd = start + count;
+  frame->alpha = alpha;
+  frame->beta = beta;
+  frame->alphaOriginal = alphaOriginal;
+  frame->bestScore = bestScore;
+  frame->hash = hash;
+  frame->depth = depth;
+  frame->bestFrom = 0;
+  frame->bestTo = 0;
+
+  return 0;
+}
+
+/**
+  Finishes the position at given ply once its moves are searched or cut off:
+  stores the result in the transposition table and returns the score.
+*/
+int16_t _SCL_searchLeave(SCL_Search *search, uint8_t ply)
+{
+  SCL_SearchFrame *frame = &(search->frames[ply]);
+  int16_t bestScore = frame->bestScore;
+  uint32_t hash = frame->hash;
+
+  search->moveStackTop = frame->moveStart;
+
+  if (hash != 0)
+  {
+    SCL_SearchTTEntry *entry = &(search->tt[hash & (SCL_SEARCH_TT_SIZE - 1)]);
+
+    if (entry->check != (hash >> 16) || frame->depth >= entry->depth)
+    {
+      int16_t score = bestScore;
+
+      if (score > _SCL_SEARCH_MATE_LIMIT)
+        score += ply;
+      else if (score < -1 * _SCL_SEARCH_MATE_LIMIT)
+        score -= ply;
+
+      entry->check = hash >> 16;
+      entry->score = score;
+      entry->depth = frame->depth;
+      entry->bound = bestScore <= frame->alphaOriginal ?
+        _SCL_SEARCH_BOUND_UPPER : (bestScore >= frame->beta ?
+        _SCL_SEARCH_BOUND_LOWER : _SCL_SEARCH_BOUND_EXACT);
+      entry->squareFrom = frame->bestFrom;
+      entry->squareTo = frame->bestTo;
+    }
+  }
+
+  return bestScore;
+}
+
+/**
+  Takes back the move being searched at given ply and accounts for its score
+  (from the point of view of the player at that ply).
+*/
+void _SCL_searchMoveDone(SCL_Search *search, uint8_t ply, int16_t score)
+{
+  SCL_SearchFrame *frame = &(search->frames[ply]);
+  SCL_SearchMove *move = &(search->moveStack[frame->moveIndex]);
+
+  SCL_boardUndoMove(search->board,frame->undo);
+
+  frame->moveIndex++;
+
+  if (score > frame->bestScore)
+  {
+    frame->bestScore = score;
+    frame->bestFrom = move->squareFrom;
+    frame->bestTo = move->squareTo;
+
+    if (score > frame->alpha)
+    {
+      frame->alpha = score;
+
+      if (score >= frame->beta)
+      {
+        if (search->board[move->squareTo] == '.')
+          _SCL_searchRewardQuietMove(search,ply,frame->depth,
+            move->squareFrom,move->squareTo);
+
+        frame->moveIndex = frame->moveEnd; // cutoff
+      }
+    }
+  }
+}
+
+/**
+  Continues the search below the root move in progress until it's finished
+  (returns 1 with its score from the point of view of the player who's now to
+  move at the root's child) or the node limit is reached (returns 0).
+*/
+uint8_t _SCL_searchRun(SCL_Search *search, int16_t *result)
+{
+  while (1)
+  {
+    uint8_t ply = search->ply;
+    SCL_SearchFrame *frame = &(search->frames[ply]);
+    int16_t score;
+
+    if (frame->moveIndex >= frame->moveEnd)
+    {
+      score = _SCL_searchLeave(search,ply);
+
+      if (ply == 1)
+      {
+        search->ply = 0;
+        *result = score;
+        return 1;
+      }
+
+      search->ply--;
+      _SCL_searchMoveDone(search,ply - 1,-1 * score);
+      continue;
+    }
+
+    if (search->nodes >= search->nodeLimit)
+      return 0;
+
+    _SCL_searchPickMove(search,frame->moveIndex,frame->moveEnd);
+
+    SCL_SearchMove *move = &(search->moveStack[frame->moveIndex]);
+
+    frame->undo =
+      SCL_boardMakeMove(search->board,move->squareFrom,move->squareTo,'q');
+
+    if (_SCL_searchEnter(search,ply + 1,frame->depth - 1,-1 * frame->beta,
+      -1 * frame->alpha,&score))
+      _SCL_searchMoveDone(search,ply,-1 * score);
+    else
+      search->ply = ply + 1;
+  }
+}
+
+void SCL_searchInit(SCL_Search *search, const SCL_Board board,
+  uint8_t maxDepth, uint8_t extensionExtraDepth,
+  SCL_StaticEvaluationFunction evalFunc,
+  uint8_t repetitionMoveFrom, uint8_t repetitionMoveTo)
+{
+  uint8_t *p = (uint8_t *) search;
+
+  for (uint16_t i = 0; i < sizeof(SCL_Search); ++i)
+    p[i] = 0;
+
+  SCL_boardCopy(board,search->board);
+  search->evalFunc = evalFunc;
+  search->maxDepth = maxDepth > SCL_SEARCH_MAX_PLY ?
+    SCL_SEARCH_MAX_PLY : maxDepth;
+  search->extensionExtraDepth = extensionExtraDepth;
+  search->depth = 1;
+
+  int16_t count = _SCL_searchGenerateMoves(search,0,0,0);
+
+  if (count < 0) // can't happen with a sane SCL_SEARCH_MOVE_STACK_SIZE
+    count = 0;
+
+  if (count > 1)
+    for (uint8_t i = 0; i < count; ++i)
+      if (search->moveStack[i].squareFrom == repetitionMoveFrom &&
+        search->moveStack[i].squareTo == repetitionMoveTo)
+      {
+        search->moveStack[i] = search->moveStack[count - 1];
+        count--;
+        break;
+      }
+
+  search->rootMoveCount = count;
+  search->moveStackTop = count;
+
+  if (count > 0)
+  {
+    // until an iteration completes, the first move is the best we have
+    search->bestFrom = search->moveStack[0].squareFrom;
+    search->bestTo = search->moveStack[0].squareTo;
+  }
+
+  search->done = count <= 1 || search->maxDepth == 0;
+}
+
+uint8_t SCL_searchStep(SCL_Search *search, uint16_t nodeBudget)
+{
+  search->nodeLimit = search->nodes + nodeBudget;
+
+  while (!search->done)
+  {
+    int16_t score;
+
+    if (search->ply == 0)
+    {
+      if (search->rootIndex == search->rootMoveCount)
+      {
+        // iteration complete: remember its best move and search it first next
+        SCL_SearchMove best = search->moveStack[search->iterationBest];
+
+        for (uint8_t i = search->iterationBest; i > 0; --i)
+          search->moveStack[i] = search->moveStack[i - 1];
+
+        search->moveStack[0] = best;
+        search->bestFrom = best.squareFrom;
+        search->bestTo = best.squareTo;
+        search->bestScore = search->iterationScore;
+        search->completedDepth = search->depth;
+        search->rootIndex = 0;
+        search->iterationBest = 0;
+
+        if (search->depth >= search->maxDepth ||
+          search->bestScore > _SCL_SEARCH_MATE_LIMIT ||
+          search->bestScore < -1 * _SCL_SEARCH_MATE_LIMIT)
+          search->done = 1;
+        else
+          search->depth++;
+
+        continue;
+      }
+
+      if (search->nodes >= search->nodeLimit)
+        return 0;
+
+      SCL_SearchMove *move = &(search->moveStack[search->rootIndex]);
+      int16_t alpha = search->rootIndex == 0 ?
+        -1 * _SCL_SEARCH_INFINITY : search->iterationScore;
+
+      search->rootUndo =
+        SCL_boardMakeMove(search->board,move->squareFrom,move->squareTo,'q');
+
+      if (!_SCL_searchEnter(search,1,search->depth - 1,
+        -1 * _SCL_SEARCH_INFINITY,-1 * alpha,&score))
+      {
+        search->ply = 1;
+        continue;
+      }
+    }
+    else if (!_SCL_searchRun(search,&score))
+      return 0; // out of nodes, the next step continues from here
+
+    SCL_boardUndoMove(search->board,search->rootUndo);
+    score *= -1;
+
+    if (search->rootIndex == 0 || score > search->iterationScore)
+    {
+      search->iterationScore = score;
+      search->iterationBest = search->rootIndex;
+    }
+
+    search->rootIndex++;
+  }
+
+  return 1;
+}
+
+int16_t SCL_searchGetMove(SCL_Search *search, uint8_t *resultFrom,
+  uint8_t *resultTo, char *resultProm)
+{
+  int8_t valueMultiply = SCL_boardWhitesTurn(search->board) ? 1 : -1;
+
+  *resultProm = 'q';
+
+  /* A move that beat the previous best (always searched first) in the
+     iteration in progress is better at a greater depth. */
+  if (search->rootIndex > 0 && search->iterationBest != 0 &&
+    search->completedDepth > 0)
+  {
+    *resultFrom = search->moveStack[search->iterationBest].squareFrom;
+    *resultTo = search->moveStack[search->iterationBest].squareTo;
+    return search->iterationScore * valueMultiply;
+  }
+
+  *resultFrom = search->bestFrom;
+  *resultTo = search->bestTo;
+
+  return search->bestScore * valueMultiply;
+}
+
 uint8_t SCL_boardToFEN(SCL_Board board, char *string)
 {
   uint8_t square = 56;
@@ -0,0 +1,255 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 Second Movement contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include <stdbool.h>
+#include "vsop87a_fixed.h"
+
+// sines and cosines are Q2.30 fixed point.
+#define ONE (1L << 30)
+#define MUL(a, b) ((int32_t)(((int64_t)(a) * (b)) >> 30))
+
+#define HALF_TURN ((uint32_t)1 << 31)
+#define QUARTER_TURN ((int32_t)1 << 30)
+
+// how each frequency's cosine and sine are found; see vsop87a_fixed_frequency_t.
+#define VSOP87A_FIXED_OP_ZERO 0         // a constant term
+#define VSOP87A_FIXED_OP_BASE 1         // computed with the CORDIC from rates[a]
+#define VSOP87A_FIXED_OP_SUM 2          // frequency a + frequency b
+#define VSOP87A_FIXED_OP_DIFFERENCE 3   // frequency a - frequency b
+// set on frequencies and terms that micro precision needs.
+#define VSOP87A_FIXED_MICRO 0x80
+
+#define VSOP87A_FIXED_X 0
+#define VSOP87A_FIXED_Y 1
+#define VSOP87A_FIXED_Z 2
+#define VSOP87A_FIXED_MAX_POWER 5
+#define VSOP87A_FIXED_SERIES(coordinate, power) (VSOP87A_FIXED_##coordinate * (VSOP87A_FIXED_MAX_POWER + 1) + (power))
+
+typedef struct {
+    uint8_t op;
+    uint8_t a;
+    uint8_t b;
+} vsop87a_fixed_frequency_t;
+
+typedef struct {
+    int32_t a_cos;      // A cos B, in units of 2^-VSOP87A_FIXED_AMPLITUDE_BITS AU
+    int32_t a_sin;      // A sin B, likewise
+    uint8_t frequency;  // index into the body's frequencies
+    uint8_t series;     // VSOP87A_FIXED_SERIES, which coordinate and power of t the term belongs to
+} vsop87a_fixed_term_t;
+
+typedef struct {
+    const int64_t *rates;  // binary angle units (2^32 per revolution) per day, in 48.16 fixed point
+    const vsop87a_fixed_frequency_t *frequencies;
+    const vsop87a_fixed_term_t *terms;
+    uint8_t num_frequencies;
+    uint16_t num_terms;
+    uint8_t max_power;
+} vsop87a_fixed_series_t;
+
+#include "vsop87a_fixed_tables.h"
+
+#if (1L << VSOP87A_FIXED_AMPLITUDE_BITS) != VSOP87A_FIXED_AU
+#error "vsop87a_fixed_tables.h is out of date; regenerate it with utils/vsop87_fixed/vsop87_tables.py."
+#endif
+
+// J2000.0, 2000-01-01 12:00, as a UNIX timestamp.
+#define J2000_UNIX_TIME 946728000L
+// converts days as 16.16 fixed point to millennia as Q2.30: 2^46 / 365250.
+#define MILLENNIA_PER_DAY 192659122LL
+// the Moon is found from the Earth and the Earth-Moon barycenter, like vsop87a_milli_getMoon does: 1 + 1 / 0.01230073677,
+// the Earth-Moon mass ratio, in 16.16 fixed point.
+#define MOON_FACTOR ((int64_t)((1 + 1 / 0.01230073677) * 65536 + 0.5))
+
+// 1/K, where K is the gain of the CORDIC, so rotations come out with unit length.
+#define CORDIC_INVERSE_GAIN 652032874
+
+// atan(2^-i) as binary angles.
+static const int32_t _cordic_atan[] = {
+    536870912, 316933406, 167458907, 85004756, 42667331, 21354465, 10679838, 5340245,
+    2670163, 1335087, 667544, 333772, 166886, 83443, 41722, 20861,
+    10430, 5215, 2608, 1304, 652, 326, 163, 81,
+    41, 20, 10, 5, 3, 1
+};
+
+#define CORDIC_STEPS (sizeof(_cordic_atan) / sizeof(_cordic_atan[0]))
+
+// how long each body's cached position stays valid, in minutes; about as long as it takes to move 0.002 AU.
+static const uint16_t _vsop87a_fixed_cache_minutes[VSOP87A_FIXED_NUM_BODIES] = {
+    60,     // Mercury
+    120,    // Venus
+    120,    // Earth
+    120,    // Moon
+    180,    // Mars
+    360,    // Jupiter
+    480,    // Saturn
+    720,    // Uranus
+    720,    // Neptune
+    120,    // Earth-Moon barycenter
+};
+
+static struct {
+    int32_t days;
+    int32_t position[3];
+    vsop87a_fixed_precision_t precision;
+    bool valid;
+} _vsop87a_fixed_cache[VSOP87A_FIXED_NUM_BODIES];
+
+// the cosine and sine of every frequency of the body being evaluated.
+static int32_t _vsop87a_fixed_cos[VSOP87A_FIXED_MAX_FREQUENCIES];
+static int32_t _vsop87a_fixed_sin[VSOP87A_FIXED_MAX_FREQUENCIES];
+
+/// Computes the cosine and sine of a binary angle, in Q2.30.
+static void _cordic_rotate(uint32_t angle, int32_t *cos_out, int32_t *sin_out) {
+    int32_t x = CORDIC_INVERSE_GAIN;
+    int32_t y = 0;
+    int32_t z = (int32_t)angle;
+    bool flip = false;
+
+    // the CORDIC only converges within about 99 degrees of zero; rotate the rest by half a turn.
+    if (z > QUARTER_TURN || z < -QUARTER_TURN) {
+        z = (int32_t)((uint32_t)z + HALF_TURN);
+        flip = true;
+    }
+
+    for (uint8_t i = 0; i < CORDIC_STEPS; i++) {
+        int32_t dx = y >> i;
+        int32_t dy = x >> i;
+        if (z >= 0) {
+            x -= dx;
+            y += dy;
+            z -= _cordic_atan[i];
+        } else {
+            x += dx;
+            y -= dy;
+            z += _cordic_atan[i];
+        }
+    }
+
+    *cos_out = flip ? -x : x;
+    *sin_out = flip ? -y : y;
+}
+
+/// Fills in _vsop87a_fixed_cos and _vsop87a_fixed_sin for a body's frequencies at a time.
+static void _vsop87a_fixed_frequencies(const vsop87a_fixed_series_t *series, int32_t days, bool micro) {
+    // whole days and the fraction are multiplied separately, so that the product fits in 64 bits.
+    int32_t whole_days = days >> 16;
+    int32_t fraction = days & 0xFFFF;
+
+    for (uint8_t i = 0; i < series->num_frequencies; i++) {
+        const vsop87a_fixed_frequency_t *frequency = &series->frequencies[i];
+        if (micro && !(frequency->op & VSOP87A_FIXED_MICRO)) continue;
+
+        int32_t cos_a = _vsop87a_fixed_cos[frequency->a];
+        int32_t sin_a = _vsop87a_fixed_sin[frequency->a];
+        int32_t cos_b = _vsop87a_fixed_cos[frequency->b];
+        int32_t sin_b = _vsop87a_fixed_sin[frequency->b];
+
+        switch (frequency->op & ~VSOP87A_FIXED_MICRO) {
+            case VSOP87A_FIXED_OP_ZERO:
+                _vsop87a_fixed_cos[i] = ONE;
+                _vsop87a_fixed_sin[i] = 0;
+                break;
+            case VSOP87A_FIXED_OP_BASE:
+                {
+                    int64_t rate = series->rates[frequency->a];
+                    uint32_t angle = (uint32_t)((rate * whole_days + ((rate * fraction) >> 16)) >> 16);
+                    _cordic_rotate(angle, &_vsop87a_fixed_cos[i], &_vsop87a_fixed_sin[i]);
+                }
+                break;
+            case VSOP87A_FIXED_OP_SUM:
+                _vsop87a_fixed_cos[i] = MUL(cos_a, cos_b) - MUL(sin_a, sin_b);
+                _vsop87a_fixed_sin[i] = MUL(sin_a, cos_b) + MUL(cos_a, sin_b);
+                break;
+            case VSOP87A_FIXED_OP_DIFFERENCE:
+                _vsop87a_fixed_cos[i] = MUL(cos_a, cos_b) + MUL(sin_a, sin_b);
+                _vsop87a_fixed_sin[i] = MUL(sin_a, cos_b) - MUL(cos_a, sin_b);
+                break;
+        }
+    }
+}
+
+/// Evaluates one body's series; the Moon isn't one of them.
+static void _vsop87a_fixed_evaluate_series(const vsop87a_fixed_series_t *series, int32_t days, bool micro, int32_t position[3]) {
+    int32_t sums[3][VSOP87A_FIXED_MAX_POWER + 1] = {{0}};
+
+    _vsop87a_fixed_frequencies(series, days, micro);
+
+    for (uint16_t i = 0; i < series->num_terms; i++) {
+        const vsop87a_fixed_term_t *term = &series->terms[i];
+        if (micro && !(term->series & VSOP87A_FIXED_MICRO)) continue;
+
+        uint8_t index = term->series & ~VSOP87A_FIXED_MICRO;
+        int64_t value = (int64_t)term->a_cos * _vsop87a_fixed_cos[term->frequency] -
+                        (int64_t)term->a_sin * _vsop87a_fixed_sin[term->frequency];
+        sums[index / (VSOP87A_FIXED_MAX_POWER + 1)][index % (VSOP87A_FIXED_MAX_POWER + 1)] += (int32_t)(value >> 30);
+    }
+
+    // each coordinate is the sum of its series times increasing powers of t; Horner's method, with t in Q2.30.
+    int32_t t = (int32_t)(((int64_t)days * MILLENNIA_PER_DAY) >> 32);
+    for (uint8_t coordinate = 0; coordinate < 3; coordinate++) {
+        int32_t result = sums[coordinate][series->max_power];
+        for (int8_t power = series->max_power - 1; power >= 0; power--) {
+            result = sums[coordinate][power] + MUL(result, t);
+        }
+        position[coordinate] = result;
+    }
+}
+
+int32_t vsop87a_fixed_days_since_j2000(uint32_t unix_time) {
+    return (int32_t)((((int64_t)unix_time - J2000_UNIX_TIME) * 65536) / 86400);
+}
+
+void vsop87a_fixed_evaluate(vsop87a_fixed_body_t body, int32_t days, vsop87a_fixed_precision_t precision, int32_t position[3]) {
+    bool micro = precision == VSOP87A_FIXED_PRECISION_MICRO;
+
+    if (body == VSOP87A_FIXED_MOON) {
+        int32_t earth[3];
+        int32_t emb[3];
+        vsop87a_fixed_evaluate(VSOP87A_FIXED_EARTH, days, precision, earth);
+        vsop87a_fixed_evaluate(VSOP87A_FIXED_EMB, days, precision, emb);
+        for (uint8_t i = 0; i < 3; i++) {
+            position[i] = earth[i] + (int32_t)(((int64_t)(emb[i] - earth[i]) * MOON_FACTOR) >> 16);
+        }
+        return;
+    }
+
+    // the tables skip the Moon.
+    _vsop87a_fixed_evaluate_series(&_vsop87a_fixed_series[body < VSOP87A_FIXED_MOON ? body : body - 1], days, micro, position);
+}
+
+void vsop87a_fixed_get_position(vsop87a_fixed_body_t body, int32_t days, vsop87a_fixed_precision_t precision, int32_t position[3]) {
+    int32_t window = (int32_t)_vsop87a_fixed_cache_minutes[body] * 65536 / 1440;
+    int32_t age = days - _vsop87a_fixed_cache[body].days;
+
+    if (!_vsop87a_fixed_cache[body].valid || _vsop87a_fixed_cache[body].precision != precision || age > window || age < -window) {
+        vsop87a_fixed_evaluate(body, days, precision, _vsop87a_fixed_cache[body].position);
+        _vsop87a_fixed_cache[body].days = days;
+        _vsop87a_fixed_cache[body].precision = precision;
+        _vsop87a_fixed_cache[body].valid = true;
+    }
+
+    for (uint8_t i = 0; i < 3; i++) position[i] = _vsop87a_fixed_cache[body].position[i];
+}
@@ -0,0 +1,89 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 Second Movement contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#ifndef VSOP87A_FIXED_H_
+#define VSOP87A_FIXED_H_
+
+#include <stdint.h>
+
+// Fixed-point VSOP87A:
+// Evaluates the same truncated series as vsop87a_milli.c and vsop87a_micro.c, in integer math only, so that finding
+// a planet doesn't take thousands of soft-double cosines. Each term's phase is folded into its amplitude ahead of
+// time (A cos(B + Ct) = A cos B cos Ct - A sin B sin Ct), so only one cosine and sine are needed per distinct
+// frequency; and most frequencies are the sum or difference of two others, so those come from the angle addition
+// formulas instead of a CORDIC. The tables live in vsop87a_fixed_tables.h, generated by
+// utils/vsop87_fixed/vsop87_tables.py; utils/vsop87_fixed/vsop87_bench.c checks the results against the double
+// precision versions.
+//
+// Times are days since J2000.0 as 16.16 fixed point, which covers 1911 to 2088. Positions are heliocentric
+// ecliptic rectangular coordinates, like the double precision versions, in units of VSOP87A_FIXED_AU.
+
+// one astronomical unit in a position.
+#define VSOP87A_FIXED_AU (1L << 24)
+
+typedef enum {
+    VSOP87A_FIXED_MERCURY = 0,
+    VSOP87A_FIXED_VENUS,
+    VSOP87A_FIXED_EARTH,
+    VSOP87A_FIXED_MOON,
+    VSOP87A_FIXED_MARS,
+    VSOP87A_FIXED_JUPITER,
+    VSOP87A_FIXED_SATURN,
+    VSOP87A_FIXED_URANUS,
+    VSOP87A_FIXED_NEPTUNE,
+    VSOP87A_FIXED_EMB,      // the Earth-Moon barycenter
+    VSOP87A_FIXED_NUM_BODIES
+} vsop87a_fixed_body_t;
+
+typedef enum {
+    VSOP87A_FIXED_PRECISION_MICRO = 0,  // only the terms in vsop87a_micro.c; smaller and faster, less accurate
+    VSOP87A_FIXED_PRECISION_MILLI,      // every term in vsop87a_milli.c
+} vsop87a_fixed_precision_t;
+
+/** @brief Converts a UNIX timestamp to days since J2000.0, as 16.16 fixed point.
+  * @param unix_time Seconds since 1970, UTC. Like the double precision versions' callers, this ignores the
+  *                  minute or so between UTC and the dynamical time VSOP87 expects.
+  */
+int32_t vsop87a_fixed_days_since_j2000(uint32_t unix_time);
+
+/** @brief Computes a body's position.
+  * @param body The body to find.
+  * @param days Days since J2000.0 as 16.16 fixed point; see vsop87a_fixed_days_since_j2000.
+  * @param precision Which set of terms to evaluate.
+  * @param position Receives the X, Y and Z coordinates, in units of VSOP87A_FIXED_AU.
+  */
+void vsop87a_fixed_evaluate(vsop87a_fixed_body_t body, int32_t days, vsop87a_fixed_precision_t precision, int32_t position[3]);
+
+/** @brief Computes a body's position, or returns the one computed last if it's recent enough.
+  * @details Each body keeps its last position, which is reused at the same precision for as long as the body
+  *          can't have moved more than about 0.002 AU: an hour for Mercury, up to half a day for the outer planets.
+  * @param body The body to find.
+  * @param days Days since J2000.0 as 16.16 fixed point; see vsop87a_fixed_days_since_j2000.
+  * @param precision Which set of terms to evaluate.
+  * @param position Receives the X, Y and Z coordinates, in units of VSOP87A_FIXED_AU.
+  */
+void vsop87a_fixed_get_position(vsop87a_fixed_body_t body, int32_t days, vsop87a_fixed_precision_t precision, int32_t position[3]);
+
+#endif // VSOP87A_FIXED_H_
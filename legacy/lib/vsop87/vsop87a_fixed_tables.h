@@ -0,0 +1,2204 @@
+// Generated by utils/vsop87_fixed/vsop87_tables.py from vsop87a_milli.c and vsop87a_micro.c; do not edit.
+// VSOP87-Multilang http://www.astrogreg.com/vsop87-multilang/index.html
+// Greg Miller (gmiller@gregmiller.net) 2019.  Released as Public Domain
+
+#ifndef VSOP87A_FIXED_TABLES_H_
+#define VSOP87A_FIXED_TABLES_H_
+
+#define VSOP87A_FIXED_AMPLITUDE_BITS 24
+
+// mercury: 42 terms (27 at micro precision) over 7 frequencies, 1 of them computed directly
+static const int64_t _vsop87a_fixed_mercury_rates[] = {
+    3199697133774LL,
+};
+static const vsop87a_fixed_frequency_t _vsop87a_fixed_mercury_frequencies[] = {
+    { VSOP87A_FIXED_OP_ZERO | VSOP87A_FIXED_MICRO, 0, 0 },
+    { VSOP87A_FIXED_OP_BASE | VSOP87A_FIXED_MICRO, 0, 0 },
+    { VSOP87A_FIXED_OP_SUM | VSOP87A_FIXED_MICRO, 1, 1 },
+    { VSOP87A_FIXED_OP_SUM | VSOP87A_FIXED_MICRO, 2, 1 },
+    { VSOP87A_FIXED_OP_SUM | VSOP87A_FIXED_MICRO, 2, 2 },
+    { VSOP87A_FIXED_OP_SUM | VSOP87A_FIXED_MICRO, 3, 2 },
+    { VSOP87A_FIXED_OP_SUM, 3, 3 },
+};
+static const vsop87a_fixed_term_t _vsop87a_fixed_mercury_terms[] = {
+    { -1956836, -5987570, 1, VSOP87A_FIXED_SERIES(X, 0) | VSOP87A_FIXED_MICRO },  // 0.37546291728 * cos(4.39651506942 + 26087.90314157420 * t)
+    { 253457, 589691, 2, VSOP87A_FIXED_SERIES(X, 0) | VSOP87A_FIXED_MICRO },  // 0.03825746672 * cos(1.16485604339 + 52175.80628314840 * t)
+    { -440505, 0, 0, VSOP87A_FIXED_SERIES(X, 0) | VSOP87A_FIXED_MICRO },  // 0.02625615963 * cos(3.14159265359 + 0.00000000000 * t)
+    { -46684, -86192, 3, VSOP87A_FIXED_SERIES(X, 0) | VSOP87A_FIXED_MICRO },  // 0.00584261333 * cos(4.21599394757 + 78263.70942472259 * t)
+    { 9824, 14767, 4, VSOP87A_FIXED_SERIES(X, 0) | VSOP87A_FIXED_MICRO },  // 0.00105716695 * cos(0.98379033182 + 104351.61256629678 * t)
+    { -2210, -2746, 5, VSOP87A_FIXED_SERIES(X, 0) | VSOP87A_FIXED_MICRO },  // 0.00021011730 * cos(4.03469353923 + 130439.51570787099 * t)
+    { 517, 535, 6, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00004433373 * cos(0.80236674527 + 156527.41884944518 * t)
+    { 53494, 0, 0, VSOP87A_FIXED_SERIES(X, 1) | VSOP87A_FIXED_MICRO },  // 0.00318848034 * cos(0.00000000000 + 0.00000000000 * t)
+    { 16487, -6341, 2, VSOP87A_FIXED_SERIES(X, 1) | VSOP87A_FIXED_MICRO },  // 0.00105289019 * cos(5.91600475006 + 52175.80628314840 * t)
+    { -4860, 2403, 3, VSOP87A_FIXED_SERIES(X, 1) | VSOP87A_FIXED_MICRO },  // 0.00032316001 * cos(2.68247273347 + 78263.70942472259 * t)
+    { 1796, -907, 1, VSOP87A_FIXED_SERIES(X, 1) | VSOP87A_FIXED_MICRO },  // 0.00011992889 * cos(5.81575112963 + 26087.90314157420 * t)
+    { 1256, -771, 4, VSOP87A_FIXED_SERIES(X, 1) },  // 0.00008783200 * cos(5.73285747425 + 104351.61256629678 * t)
+    { -313, 234, 5, VSOP87A_FIXED_SERIES(X, 1) },  // 0.00002329042 * cos(2.50023793407 + 130439.51570787099 * t)
+    { -87, -233, 2, VSOP87A_FIXED_SERIES(X, 2) },  // 0.00001484185 * cos(4.35401210269 + 52175.80628314840 * t)
+    { 204, 0, 0, VSOP87A_FIXED_SERIES(X, 2) },  // 0.00001214995 * cos(0.00000000000 + 0.00000000000 * t)
+    { -6075998, 1904764, 1, VSOP87A_FIXED_SERIES(Y, 0) | VSOP87A_FIXED_MICRO },  // 0.37953642888 * cos(2.83780617820 + 26087.90314157420 * t)
+    { -1950541, 0, 0, VSOP87A_FIXED_SERIES(Y, 0) | VSOP87A_FIXED_MICRO },  // 0.11626131831 * cos(3.14159265359 + 0.00000000000 * t)
+    { 596813, -249084, 2, VSOP87A_FIXED_SERIES(Y, 0) | VSOP87A_FIXED_MICRO },  // 0.03854668215 * cos(5.88780608966 + 52175.80628314840 * t)
+    { -87157, 46109, 3, VSOP87A_FIXED_SERIES(Y, 0) | VSOP87A_FIXED_MICRO },  // 0.00587711268 * cos(2.65498896201 + 78263.70942472259 * t)
+    { 14931, -9733, 4, VSOP87A_FIXED_SERIES(Y, 0) | VSOP87A_FIXED_MICRO },  // 0.00106235493 * cos(5.70550616735 + 104351.61256629678 * t)
+    { -2778, 2195, 5, VSOP87A_FIXED_SERIES(Y, 0) | VSOP87A_FIXED_MICRO },  // 0.00021100828 * cos(2.47291315849 + 130439.51570787099 * t)
+    { 541, -514, 6, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00004450056 * cos(5.52354907071 + 156527.41884944518 * t)
+    { -6418, -16910, 2, VSOP87A_FIXED_SERIES(Y, 1) | VSOP87A_FIXED_MICRO },  // 0.00107803852 * cos(4.34964793883 + 52175.80628314840 * t)
+    { -13531, 0, 0, VSOP87A_FIXED_SERIES(Y, 1) | VSOP87A_FIXED_MICRO },  // 0.00080651544 * cos(3.14159265359 + 0.00000000000 * t)
+    { 2403, 4935, 3, VSOP87A_FIXED_SERIES(Y, 1) | VSOP87A_FIXED_MICRO },  // 0.00032715354 * cos(1.11763734425 + 78263.70942472259 * t)
+    { -769, -1272, 4, VSOP87A_FIXED_SERIES(Y, 1) },  // 0.00008858158 * cos(4.16852401867 + 104351.61256629678 * t)
+    { 684, 1878, 1, VSOP87A_FIXED_SERIES(Y, 1) | VSOP87A_FIXED_MICRO },  // 0.00011914709 * cos(1.22139986340 + 26087.90314157420 * t)
+    { 233, 317, 5, VSOP87A_FIXED_SERIES(Y, 1) },  // 0.00002344469 * cos(0.93615372641 + 130439.51570787099 * t)
+    { 774, 0, 0, VSOP87A_FIXED_SERIES(Y, 2) },  // 0.00004612157 * cos(0.00000000000 + 0.00000000000 * t)
+    { -250, 86, 2, VSOP87A_FIXED_SERIES(Y, 2) },  // 0.00001575670 * cos(2.81172733349 + 52175.80628314840 * t)
+    { -316734, 705172, 1, VSOP87A_FIXED_SERIES(Z, 0) | VSOP87A_FIXED_MICRO },  // 0.04607665326 * cos(1.99295081967 + 26087.90314157420 * t)
+    { -118906, 0, 0, VSOP87A_FIXED_SERIES(Z, 0) | VSOP87A_FIXED_MICRO },  // 0.00708734365 * cos(3.14159265359 + 0.00000000000 * t)
+    { 25489, -74473, 2, VSOP87A_FIXED_SERIES(Z, 0) | VSOP87A_FIXED_MICRO },  // 0.00469171617 * cos(5.04215742764 + 52175.80628314840 * t)
+    { -2835, 11678, 3, VSOP87A_FIXED_SERIES(Z, 0) | VSOP87A_FIXED_MICRO },  // 0.00071626395 * cos(1.80894256071 + 78263.70942472259 * t)
+    { 318, -2151, 4, VSOP87A_FIXED_SERIES(Z, 0) | VSOP87A_FIXED_MICRO },  // 0.00012957446 * cos(4.85922032010 + 104351.61256629678 * t)
+    { -24, 431, 5, VSOP87A_FIXED_SERIES(Z, 0) },  // 0.00002575002 * cos(1.62646731545 + 130439.51570787099 * t)
+    { -13098, -12695, 1, VSOP87A_FIXED_SERIES(Z, 1) | VSOP87A_FIXED_MICRO },  // 0.00108722177 * cos(3.91134750825 + 26087.90314157420 * t)
+    { -9702, 0, 0, VSOP87A_FIXED_SERIES(Z, 1) | VSOP87A_FIXED_MICRO },  // 0.00057826621 * cos(3.14159265359 + 0.00000000000 * t)
+    { -604, 394, 2, VSOP87A_FIXED_SERIES(Z, 1) },  // 0.00004297352 * cos(2.56373047177 + 52175.80628314840 * t)
+    { 408, 21, 3, VSOP87A_FIXED_SERIES(Z, 1) },  // 0.00002435833 * cos(0.05112640506 + 78263.70942472259 * t)
+    { 109, -139, 1, VSOP87A_FIXED_SERIES(Z, 2) },  // 0.00001053118 * cos(5.37979214357 + 26087.90314157420 * t)
+    { 199, 0, 0, VSOP87A_FIXED_SERIES(Z, 2) },  // 0.00001185024 * cos(0.00000000000 + 0.00000000000 * t)
+};
+
+// venus: 30 terms (14 at micro precision) over 8 frequencies, 5 of them computed directly
+static const int64_t _vsop87a_fixed_venus_rates[] = {
+    193462141605LL,
+    288580459975LL,
+    770623061555LL,
+    1252665663135LL,
+    2216750866294LL,
+};
+static const vsop87a_fixed_frequency_t _vsop87a_fixed_venus_frequencies[] = {
+    { VSOP87A_FIXED_OP_ZERO | VSOP87A_FIXED_MICRO, 0, 0 },
+    { VSOP87A_FIXED_OP_BASE, 0, 0 },
+    { VSOP87A_FIXED_OP_BASE, 1, 0 },
+    { VSOP87A_FIXED_OP_BASE, 2, 0 },
+    { VSOP87A_FIXED_OP_BASE | VSOP87A_FIXED_MICRO, 3, 0 },
+    { VSOP87A_FIXED_OP_BASE, 4, 0 },
+    { VSOP87A_FIXED_OP_SUM | VSOP87A_FIXED_MICRO, 4, 4 },
+    { VSOP87A_FIXED_OP_SUM, 6, 4 },
+};
+static const vsop87a_fixed_term_t _vsop87a_fixed_venus_terms[] = {
+    { -12107972, -413839, 4, VSOP87A_FIXED_SERIES(X, 0) | VSOP87A_FIXED_MICRO },  // 0.72211281391 * cos(3.17575836361 + 10213.28554621100 * t)
+    { 81612, 0, 0, VSOP87A_FIXED_SERIES(X, 0) | VSOP87A_FIXED_MICRO },  // 0.00486448018 * cos(0.00000000000 + 0.00000000000 * t)
+    { -25044, -32488, 6, VSOP87A_FIXED_SERIES(X, 0) | VSOP87A_FIXED_MICRO },  // 0.00244500474 * cos(4.05566613861 + 20426.57109242200 * t)
+    { 444, 153, 2, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00002800281 * cos(0.33147492492 + 2352.86615377180 * t)
+    { -151, -290, 1, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00001949669 * cos(4.23196016801 + 1577.34354244780 * t)
+    { 46, -203, 7, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00001241717 * cos(4.93573787058 + 30639.85663863300 * t)
+    { -188, 51, 5, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00001162258 * cos(2.87958246189 + 18073.70493865020 * t)
+    { -32, 173, 3, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00001046690 * cos(1.75434920413 + 6283.07584999140 * t)
+    { -5681, 0, 0, VSOP87A_FIXED_SERIES(X, 1) | VSOP87A_FIXED_MICRO },  // 0.00033862636 * cos(3.14159265359 + 0.00000000000 * t)
+    { 1735, 2313, 6, VSOP87A_FIXED_SERIES(X, 1) | VSOP87A_FIXED_MICRO },  // 0.00017234992 * cos(0.92721124604 + 20426.57109242200 * t)
+    { -637, 888, 4, VSOP87A_FIXED_SERIES(X, 1) },  // 0.00006510416 * cos(2.19289889733 + 10213.28554621100 * t)
+    { -423900, 12126685, 4, VSOP87A_FIXED_SERIES(Y, 0) | VSOP87A_FIXED_MICRO },  // 0.72324820731 * cos(1.60573808356 + 10213.28554621100 * t)
+    { -92192, 0, 0, VSOP87A_FIXED_SERIES(Y, 0) | VSOP87A_FIXED_MICRO },  // 0.00549506273 * cos(3.14159265359 + 0.00000000000 * t)
+    { -32559, 25058, 6, VSOP87A_FIXED_SERIES(Y, 0) | VSOP87A_FIXED_MICRO },  // 0.00244884790 * cos(2.48564954004 + 20426.57109242200 * t)
+    { 152, -443, 2, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00002789807 * cos(5.04214523606 + 2352.86615377180 * t)
+    { 288, -149, 1, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00001933868 * cos(5.80597990261 + 1577.34354244780 * t)
+    { -203, -46, 7, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00001243658 * cos(3.36573697344 + 30639.85663863300 * t)
+    { 50, 189, 5, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00001164480 * cos(1.30970620277 + 18073.70493865020 * t)
+    { 172, 32, 3, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00001041872 * cos(0.18129136925 + 6283.07584999140 * t)
+    { 6582, 0, 0, VSOP87A_FIXED_SERIES(Y, 1) | VSOP87A_FIXED_MICRO },  // 0.00039231430 * cos(0.00000000000 + 0.00000000000 * t)
+    { 2317, -1743, 6, VSOP87A_FIXED_SERIES(Y, 1) | VSOP87A_FIXED_MICRO },  // 0.00017282326 * cos(5.63824735900 + 20426.57109242200 * t)
+    { -894, -451, 4, VSOP87A_FIXED_SERIES(Y, 1) },  // 0.00005968075 * cos(3.60854944086 + 10213.28554621100 * t)
+    { -337, 0, 0, VSOP87A_FIXED_SERIES(Y, 2) },  // 0.00002007155 * cos(3.14159265359 + 0.00000000000 * t)
+    { 693098, 189613, 4, VSOP87A_FIXED_SERIES(Z, 0) | VSOP87A_FIXED_MICRO },  // 0.04282990302 * cos(0.26703856476 + 10213.28554621100 * t)
+    { -5971, 0, 0, VSOP87A_FIXED_SERIES(Z, 0) | VSOP87A_FIXED_MICRO },  // 0.00035588343 * cos(3.14159265359 + 0.00000000000 * t)
+    { 1001, 2218, 6, VSOP87A_FIXED_SERIES(Z, 0) | VSOP87A_FIXED_MICRO },  // 0.00014501879 * cos(1.14696911390 + 20426.57109242200 * t)
+    { -10945, 33153, 4, VSOP87A_FIXED_SERIES(Z, 1) | VSOP87A_FIXED_MICRO },  // 0.00208096402 * cos(1.88967278742 + 10213.28554621100 * t)
+    { -179, -114, 6, VSOP87A_FIXED_SERIES(Z, 1) },  // 0.00001264989 * cos(3.71037501321 + 20426.57109242200 * t)
+    { 229, 0, 0, VSOP87A_FIXED_SERIES(Z, 1) },  // 0.00001364144 * cos(0.00000000000 + 0.00000000000 * t)
+    { -1502, -314, 4, VSOP87A_FIXED_SERIES(Z, 2) },  // 0.00009148044 * cos(3.34791005272 + 10213.28554621100 * t)
+};
+
+// earth: 38 terms (13 at micro precision) over 11 frequencies, 8 of them computed directly
+static const int64_t _vsop87a_fixed_earth_rates[] = {
+    64966917947LL,
+    193462141605LL,
+    288580459975LL,
+    640689225661LL,
+    770190948954LL,
+    770623061555LL,
+    771055174156LL,
+    10302264239150LL,
+};
+static const vsop87a_fixed_frequency_t _vsop87a_fixed_earth_frequencies[] = {
+    { VSOP87A_FIXED_OP_ZERO | VSOP87A_FIXED_MICRO, 0, 0 },
+    { VSOP87A_FIXED_OP_BASE, 0, 0 },
+    { VSOP87A_FIXED_OP_BASE, 1, 0 },
+    { VSOP87A_FIXED_OP_BASE, 2, 0 },
+    { VSOP87A_FIXED_OP_BASE, 3, 0 },
+    { VSOP87A_FIXED_OP_BASE, 4, 0 },
+    { VSOP87A_FIXED_OP_BASE | VSOP87A_FIXED_MICRO, 5, 0 },
+    { VSOP87A_FIXED_OP_BASE, 6, 0 },
+    { VSOP87A_FIXED_OP_SUM | VSOP87A_FIXED_MICRO, 6, 6 },
+    { VSOP87A_FIXED_OP_SUM | VSOP87A_FIXED_MICRO, 8, 6 },
+    { VSOP87A_FIXED_OP_BASE, 7, 0 },
+};
+static const vsop87a_fixed_term_t _vsop87a_fixed_earth_terms[] = {
+    { -3047478, 16495204, 6, VSOP87A_FIXED_SERIES(X, 0) | VSOP87A_FIXED_MICRO },  // 0.99982928844 * cos(1.75348568475 + 6283.07584999140 * t)
+    { -19492, 138771, 8, VSOP87A_FIXED_SERIES(X, 0) | VSOP87A_FIXED_MICRO },  // 0.00835257300 * cos(1.71034539450 + 12566.15169998280 * t)
+    { 94144, 0, 0, VSOP87A_FIXED_SERIES(X, 0) | VSOP87A_FIXED_MICRO },  // 0.00561144206 * cos(0.00000000000 + 0.00000000000 * t)
+    { -169, 1748, 9, VSOP87A_FIXED_SERIES(X, 0) | VSOP87A_FIXED_MICRO },  // 0.00010466628 * cos(1.66722645223 + 18849.22754997420 * t)
+    { 409, 324, 10, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00003110838 * cos(0.66875185215 + 83996.84731811189 * t)
+    { 357, 236, 1, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00002552498 * cos(0.58310207301 + 529.69096509460 * t)
+    { 165, 318, 2, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00002137256 * cos(1.09235189672 + 1577.34354244780 * t)
+    { 252, 136, 5, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00001709103 * cos(0.49540223397 + 6279.55273164240 * t)
+    { 284, -37, 7, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00001707882 * cos(6.15315547484 + 6286.59896834040 * t)
+    { -229, -79, 3, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00001445242 * cos(3.47272783760 + 2352.86615377180 * t)
+    { -156, -95, 4, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00001091006 * cos(3.68984782465 + 5223.69391980220 * t)
+    { 20704, 0, 0, VSOP87A_FIXED_SERIES(X, 1) | VSOP87A_FIXED_MICRO },  // 0.00123403056 * cos(0.00000000000 + 0.00000000000 * t)
+    { 8303, -2392, 8, VSOP87A_FIXED_SERIES(X, 1) | VSOP87A_FIXED_MICRO },  // 0.00051500156 * cos(6.00266267204 + 12566.15169998280 * t)
+    { 205, -69, 9, VSOP87A_FIXED_SERIES(X, 1) },  // 0.00001290726 * cos(5.95943124583 + 18849.22754997420 * t)
+    { -77, 162, 6, VSOP87A_FIXED_SERIES(X, 1) },  // 0.00001068627 * cos(2.01554176551 + 6283.07584999140 * t)
+    { -695, 0, 0, VSOP87A_FIXED_SERIES(X, 2) },  // 0.00004143217 * cos(3.14159265359 + 0.00000000000 * t)
+    { -112, -347, 8, VSOP87A_FIXED_SERIES(X, 2) },  // 0.00002175695 * cos(4.39999849572 + 12566.15169998280 * t)
+    { 16496333, 3047167, 6, VSOP87A_FIXED_SERIES(Y, 0) | VSOP87A_FIXED_MICRO },  // 0.99989211030 * cos(0.18265890456 + 6283.07584999140 * t)
+    { -409817, 0, 0, VSOP87A_FIXED_SERIES(Y, 0) | VSOP87A_FIXED_MICRO },  // 0.02442699036 * cos(3.14159265359 + 0.00000000000 * t)
+    { 138777, 19490, 8, VSOP87A_FIXED_SERIES(Y, 0) | VSOP87A_FIXED_MICRO },  // 0.00835292314 * cos(0.13952878991 + 12566.15169998280 * t)
+    { 1748, 169, 9, VSOP87A_FIXED_SERIES(Y, 0) | VSOP87A_FIXED_MICRO },  // 0.00010466965 * cos(0.09641690558 + 18849.22754997420 * t)
+    { 324, -409, 10, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00003110838 * cos(5.38114091484 + 83996.84731811189 * t)
+    { 239, -359, 1, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00002570338 * cos(5.30103973360 + 529.69096509460 * t)
+    { -320, 166, 2, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00002147473 * cos(2.66253538905 + 1577.34354244780 * t)
+    { 136, -252, 5, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00001709219 * cos(5.20780401071 + 6279.55273164240 * t)
+    { -37, -284, 7, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00001707987 * cos(4.58232858766 + 6286.59896834040 * t)
+    { -78, 229, 3, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00001440265 * cos(1.90068164664 + 2352.86615377180 * t)
+    { 101, -161, 4, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00001135092 * cos(5.27313415220 + 5223.69391980220 * t)
+    { 15611, 0, 0, VSOP87A_FIXED_SERIES(Y, 1) | VSOP87A_FIXED_MICRO },  // 0.00093046324 * cos(0.00000000000 + 0.00000000000 * t)
+    { -2393, -8303, 8, VSOP87A_FIXED_SERIES(Y, 1) | VSOP87A_FIXED_MICRO },  // 0.00051506609 * cos(4.43180499286 + 12566.15169998280 * t)
+    { -69, -205, 9, VSOP87A_FIXED_SERIES(Y, 1) },  // 0.00001290800 * cos(4.38860548540 + 18849.22754997420 * t)
+    { 852, 0, 0, VSOP87A_FIXED_SERIES(Y, 2) },  // 0.00005080208 * cos(0.00000000000 + 0.00000000000 * t)
+    { -348, 112, 8, VSOP87A_FIXED_SERIES(Y, 2) },  // 0.00002178016 * cos(2.82957544235 + 12566.15169998280 * t)
+    { -13, -171, 6, VSOP87A_FIXED_SERIES(Y, 2) },  // 0.00001020487 * cos(4.63746718598 + 6283.07584999140 * t)
+    { -36816, -10274, 6, VSOP87A_FIXED_SERIES(Z, 1) | VSOP87A_FIXED_MICRO },  // 0.00227822442 * cos(3.41372504278 + 6283.07584999140 * t)
+    { 911, 0, 0, VSOP87A_FIXED_SERIES(Z, 1) },  // 0.00005429282 * cos(0.00000000000 + 0.00000000000 * t)
+    { -311, -72, 8, VSOP87A_FIXED_SERIES(Z, 1) },  // 0.00001903183 * cos(3.37061270964 + 12566.15169998280 * t)
+    { 695, -1476, 6, VSOP87A_FIXED_SERIES(Z, 2) },  // 0.00009721989 * cos(5.15233725915 + 6283.07584999140 * t)
+};
+
+// mars: 109 terms (37 at micro precision) over 36 frequencies, 12 of them computed directly
+static const int64_t _vsop87a_fixed_mars_rates[] = {
+    48833216610LL,
+    64966917947LL,
+    214827385243LL,
+    312061705862LL,
+    386246893196LL,
+    409296026481LL,
+    409719883433LL,
+    409726022912LL,
+    409730255253LL,
+    409736394732LL,
+    410160251684LL,
+    433209384970LL,
+};
+static const vsop87a_fixed_frequency_t _vsop87a_fixed_mars_frequencies[] = {
+    { VSOP87A_FIXED_OP_ZERO | VSOP87A_FIXED_MICRO, 0, 0 },
+    { VSOP87A_FIXED_OP_BASE | VSOP87A_FIXED_MICRO, 0, 0 },
+    { VSOP87A_FIXED_OP_BASE | VSOP87A_FIXED_MICRO, 1, 0 },
+    { VSOP87A_FIXED_OP_SUM | VSOP87A_FIXED_MICRO, 1, 1 },
+    { VSOP87A_FIXED_OP_SUM | VSOP87A_FIXED_MICRO, 2, 2 },
+    { VSOP87A_FIXED_OP_SUM | VSOP87A_FIXED_MICRO, 3, 1 },
+    { VSOP87A_FIXED_OP_SUM | VSOP87A_FIXED_MICRO, 4, 2 },
+    { VSOP87A_FIXED_OP_BASE | VSOP87A_FIXED_MICRO, 2, 0 },
+    { VSOP87A_FIXED_OP_SUM, 7, 2 },
+    { VSOP87A_FIXED_OP_BASE | VSOP87A_FIXED_MICRO, 3, 0 },
+    { VSOP87A_FIXED_OP_SUM, 7, 4 },
+    { VSOP87A_FIXED_OP_SUM | VSOP87A_FIXED_MICRO, 9, 1 },
+    { VSOP87A_FIXED_OP_BASE, 4, 0 },
+    { VSOP87A_FIXED_OP_BASE | VSOP87A_FIXED_MICRO, 5, 0 },
+    { VSOP87A_FIXED_OP_BASE, 6, 0 },
+    { VSOP87A_FIXED_OP_BASE, 7, 0 },
+    { VSOP87A_FIXED_OP_SUM | VSOP87A_FIXED_MICRO, 7, 6 },
+    { VSOP87A_FIXED_OP_BASE, 8, 0 },
+    { VSOP87A_FIXED_OP_BASE, 9, 0 },
+    { VSOP87A_FIXED_OP_BASE | VSOP87A_FIXED_MICRO, 10, 0 },
+    { VSOP87A_FIXED_OP_BASE, 11, 0 },
+    { VSOP87A_FIXED_OP_SUM, 9, 5 },
+    { VSOP87A_FIXED_OP_SUM, 8, 6 },
+    { VSOP87A_FIXED_OP_SUM | VSOP87A_FIXED_MICRO, 11, 5 },
+    { VSOP87A_FIXED_OP_SUM, 10, 8 },
+    { VSOP87A_FIXED_OP_SUM, 10, 10 },
+    { VSOP87A_FIXED_OP_SUM | VSOP87A_FIXED_MICRO, 11, 11 },
+    { VSOP87A_FIXED_OP_SUM, 16, 10 },
+    { VSOP87A_FIXED_OP_SUM, 16, 11 },
+    { VSOP87A_FIXED_OP_SUM, 16, 13 },
+    { VSOP87A_FIXED_OP_SUM | VSOP87A_FIXED_MICRO, 16, 16 },
+    { VSOP87A_FIXED_OP_SUM, 19, 16 },
+    { VSOP87A_FIXED_OP_SUM, 24, 22 },
+    { VSOP87A_FIXED_OP_SUM | VSOP87A_FIXED_MICRO, 26, 23 },
+    { VSOP87A_FIXED_OP_SUM | VSOP87A_FIXED_MICRO, 30, 30 },
+    { VSOP87A_FIXED_OP_SUM, 33, 30 },
+};
+static const vsop87a_fixed_term_t _vsop87a_fixed_mars_terms[] = {
+    { 25383049, -2013321, 16, VSOP87A_FIXED_SERIES(X, 0) | VSOP87A_FIXED_MICRO },  // 1.51769936383 * cos(6.20403346548 + 3340.61242669980 * t)
+    { -3272051, 0, 0, VSOP87A_FIXED_SERIES(X, 0) | VSOP87A_FIXED_MICRO },  // 0.19502945246 * cos(3.14159265359 + 0.00000000000 * t)
+    { 1146826, 303489, 30, VSOP87A_FIXED_SERIES(X, 0) | VSOP87A_FIXED_MICRO },  // 0.07070919655 * cos(0.25870338558 + 6681.22485339960 * t)
+    { 68585, 46589, 33, VSOP87A_FIXED_SERIES(X, 0) | VSOP87A_FIXED_MICRO },  // 0.00494196914 * cos(0.59669127768 + 10021.83728009940 * t)
+    { 4080, 5525, 34, VSOP87A_FIXED_SERIES(X, 0) | VSOP87A_FIXED_MICRO },  // 0.00040938237 * cos(0.93473307419 + 13362.44970679920 * t)
+    { -818, 3439, 13, VSOP87A_FIXED_SERIES(X, 0) | VSOP87A_FIXED_MICRO },  // 0.00021067199 * cos(1.80435656154 + 3337.08930835080 * t)
+    { 1348, 3263, 19, VSOP87A_FIXED_SERIES(X, 0) | VSOP87A_FIXED_MICRO },  // 0.00021041626 * cos(1.17895619474 + 3344.13554504880 * t)
+    { 229, -1894, 4, VSOP87A_FIXED_SERIES(X, 0) | VSOP87A_FIXED_MICRO },  // 0.00011370375 * cos(4.83265211109 + 1059.38193018920 * t)
+    { 1834, 1337, 2, VSOP87A_FIXED_SERIES(X, 0) | VSOP87A_FIXED_MICRO },  // 0.00013527976 * cos(0.63010765169 + 529.69096509460 * t)
+    { -1010, -521, 15, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00006774107 * cos(3.61785048282 + 3340.59517304760 * t)
+    { 915, -674, 17, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00006774060 * cos(5.64862211431 + 3340.62968035200 * t)
+    { -405, 1319, 8, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00008226069 * cos(1.86843519535 + 2281.23049651060 * t)
+    { 389, 831, 11, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00005469046 * cos(1.13324429003 + 2942.46342329160 * t)
+    { -223, 777, 21, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00004817134 * cos(1.85091045536 + 3738.76143010800 * t)
+    { -229, -796, 25, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00004937579 * cos(4.43241440654 + 5621.84292321040 * t)
+    { -610, 641, 27, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00005276260 * cos(2.33148083116 + 6151.53388830500 * t)
+    { 601, -103, 3, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00003636667 * cos(6.11397592106 + 796.29800681640 * t)
+    { 184, 598, 35, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00003725823 * cos(1.27280182943 + 16703.06213349900 * t)
+    { 219, 586, 1, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00003729746 * cos(1.21398323637 + 398.14900340820 * t)
+    { -391, 68, 9, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00002368513 * cos(2.96841895360 + 2544.31441988340 * t)
+    { 324, 239, 12, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00002397865 * cos(0.63553674054 + 3149.16416058820 * t)
+    { -270, 270, 20, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00002274646 * cos(2.35708328853 + 3532.06069281140 * t)
+    { -179, 279, 29, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00001977579 * cos(2.14087826110 + 6677.70173505060 * t)
+    { -47, 371, 14, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00002229176 * cos(1.69588962513 + 3340.54511639700 * t)
+    { 105, 359, 18, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00002229117 * cos(1.28739323821 + 3340.67973700260 * t)
+    { -46, 363, 28, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00002182206 * cos(1.69655112969 + 6283.07584999140 * t)
+    { 41, -374, 32, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00002241010 * cos(4.82218655311 + 8962.45534991020 * t)
+    { -281, -1, 26, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00001677693 * cos(3.14442612046 + 5884.92684658320 * t)
+    { 266, 65, 23, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00001630482 * cos(0.24117974845 + 4136.91043351620 * t)
+    { 17, 328, 31, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00001958162 * cos(1.51914544555 + 6684.74797174860 * t)
+    { -132, 190, 7, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00001378470 * cos(2.18011900021 + 1751.53953141600 * t)
+    { -1, -216, 5, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00001289804 * cos(4.70970778621 + 1194.44701022460 * t)
+    { -75, 235, 22, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00001468124 * cos(1.87869730543 + 3870.30339179440 * t)
+    { 196, 91, 10, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00001290170 * cos(0.43596325296 + 2810.92146160520 * t)
+    { 36, -261, 6, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00001572540 * cos(4.84809921789 + 1589.07289528380 * t)
+    { -144526, 0, 0, VSOP87A_FIXED_SERIES(X, 1) | VSOP87A_FIXED_MICRO },  // 0.00861441374 * cos(3.14159265359 + 0.00000000000 * t)
+    { 34660, -85959, 30, VSOP87A_FIXED_SERIES(X, 1) | VSOP87A_FIXED_MICRO },  // 0.00552437949 * cos(5.09565872891 + 6681.22485339960 * t)
+    { 8546, -9729, 33, VSOP87A_FIXED_SERIES(X, 1) | VSOP87A_FIXED_MICRO },  // 0.00077184977 * cos(5.43315636209 + 10021.83728009940 * t)
+    { 2598, -2245, 16, VSOP87A_FIXED_SERIES(X, 1) | VSOP87A_FIXED_MICRO },  // 0.00020467294 * cos(5.57051812369 + 3340.61242669980 * t)
+    { 1402, -788, 34, VSOP87A_FIXED_SERIES(X, 1) },  // 0.00009589581 * cos(5.77107234791 + 13362.44970679920 * t)
+    { 439, -26, 19, VSOP87A_FIXED_SERIES(X, 1) },  // 0.00002620610 * cos(6.22441295122 + 3344.13554504880 * t)
+    { -437, 44, 13, VSOP87A_FIXED_SERIES(X, 1) },  // 0.00002620537 * cos(3.04172154436 + 3337.08930835080 * t)
+    { 192, -34, 35, VSOP87A_FIXED_SERIES(X, 1) },  // 0.00001163612 * cos(6.10909257097 + 16703.06213349900 * t)
+    { 9450, 0, 0, VSOP87A_FIXED_SERIES(X, 2) | VSOP87A_FIXED_MICRO },  // 0.00056323939 * cos(0.00000000000 + 0.00000000000 * t)
+    { -3415, -1453, 30, VSOP87A_FIXED_SERIES(X, 2) | VSOP87A_FIXED_MICRO },  // 0.00022122528 * cos(3.54372113272 + 6681.22485339960 * t)
+    { -718, -727, 33, VSOP87A_FIXED_SERIES(X, 2) },  // 0.00006091409 * cos(3.93272649649 + 10021.83728009940 * t)
+    { -213, -118, 16, VSOP87A_FIXED_SERIES(X, 2) },  // 0.00001451998 * cos(3.64655666460 + 3340.61242669980 * t)
+    { -78, -173, 34, VSOP87A_FIXED_SERIES(X, 2) },  // 0.00001130613 * cos(4.28827023222 + 13362.44970679920 * t)
+    { -2038786, -25345509, 16, VSOP87A_FIXED_SERIES(Y, 0) | VSOP87A_FIXED_MICRO },  // 1.51558976277 * cos(4.63212206588 + 3340.61242669980 * t)
+    { 302558, -1145967, 30, VSOP87A_FIXED_SERIES(Y, 0) | VSOP87A_FIXED_MICRO },  // 0.07064550239 * cos(4.97051892902 + 6681.22485339960 * t)
+    { 1452149, 0, 0, VSOP87A_FIXED_SERIES(Y, 0) | VSOP87A_FIXED_MICRO },  // 0.08655481102 * cos(0.00000000000 + 0.00000000000 * t)
+    { 46538, -68554, 33, VSOP87A_FIXED_SERIES(Y, 0) | VSOP87A_FIXED_MICRO },  // 0.00493872848 * cos(5.30877806694 + 10021.83728009940 * t)
+    { 5522, -4079, 34, VSOP87A_FIXED_SERIES(Y, 0) | VSOP87A_FIXED_MICRO },  // 0.00040917422 * cos(5.64698263703 + 13362.44970679920 * t)
+    { 3435, 813, 13, VSOP87A_FIXED_SERIES(Y, 0) | VSOP87A_FIXED_MICRO },  // 0.00021036784 * cos(0.23240270955 + 3337.08930835080 * t)
+    { 3257, -1350, 19, VSOP87A_FIXED_SERIES(Y, 0) | VSOP87A_FIXED_MICRO },  // 0.00021012921 * cos(5.89022773653 + 3344.13554504880 * t)
+    { -1894, -228, 4, VSOP87A_FIXED_SERIES(Y, 0) | VSOP87A_FIXED_MICRO },  // 0.00011370034 * cos(3.26131408801 + 1059.38193018920 * t)
+    { 1317, -1806, 2, VSOP87A_FIXED_SERIES(Y, 0) | VSOP87A_FIXED_MICRO },  // 0.00013324177 * cos(5.34259389724 + 529.69096509460 * t)
+    { -674, -913, 17, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00006764653 * cos(4.07671230062 + 3340.62968035200 * t)
+    { -519, 1009, 15, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00006764700 * cos(2.04594066912 + 3340.59517304760 * t)
+    { -1345, -391, 8, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00008346220 * cos(3.42464704002 + 2281.23049651060 * t)
+    { 809, -409, 11, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00005400042 * cos(5.81507793194 + 2942.46342329160 * t)
+    { 776, 222, 21, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00004809528 * cos(0.27875310553 + 3738.76143010800 * t)
+    { -780, 232, 25, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00004849523 * cos(2.85190987550 + 5621.84292321040 * t)
+    { 641, 607, 27, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00005263268 * cos(0.75811089992 + 6151.53388830500 * t)
+    { -108, -596, 3, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00003609527 * cos(4.53244488294 + 796.29800681640 * t)
+    { 597, -183, 35, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00003724293 * cos(5.98516013322 + 16703.06213349900 * t)
+    { 602, -213, 1, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00003805073 * cos(5.94234296399 + 398.14900340820 * t)
+    { 238, -324, 12, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00002394490 * cos(5.34678816191 + 3149.16416058820 * t)
+    { 271, 263, 20, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00002251027 * cos(0.76938193892 + 3532.06069281140 * t)
+    { 279, 179, 29, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00001975769 * cos(0.56949816579 + 6677.70173505060 * t)
+    { 358, -105, 18, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00002226030 * cos(5.99867316288 + 3340.67973700260 * t)
+    { 371, 46, 14, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00002226089 * cos(0.12398424247 + 3340.54511639700 * t)
+    { 363, 45, 28, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00002177591 * cos(0.12334436516 + 6283.07584999140 * t)
+    { -4, 284, 26, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00001690439 * cos(1.58331163985 + 5884.92684658320 * t)
+    { -373, -40, 32, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00002234121 * cos(3.24909113765 + 8962.45534991020 * t)
+    { 65, -265, 23, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00001628395 * cos(4.95250906888 + 4136.91043351620 * t)
+    { 328, -17, 31, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00001956411 * cos(6.23095843554 + 6684.74797174860 * t)
+    { 195, 208, 9, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00001697214 * cos(0.81869636263 + 2544.31441988340 * t)
+    { -193, -130, 7, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00001385946 * cos(3.73437191158 + 1751.53953141600 * t)
+    { 112, -214, 10, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00001439619 * cos(5.19505958438 + 2810.92146160520 * t)
+    { -215, 2, 5, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00001281890 * cos(3.13035275682 + 1194.44701022460 * t)
+    { 235, 74, 22, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00001469783 * cos(0.30415060688 + 3870.30339179440 * t)
+    { -261, -36, 6, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00001571880 * cos(3.27679498650 + 1589.07289528380 * t)
+    { -248, 93, 24, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00001575854 * cos(2.78266835243 + 5092.15195811580 * t)
+    { -239465, 0, 0, VSOP87A_FIXED_SERIES(Y, 1) | VSOP87A_FIXED_MICRO },  // 0.01427324210 * cos(3.14159265359 + 0.00000000000 * t)
+    { -85869, -34266, 30, VSOP87A_FIXED_SERIES(Y, 1) | VSOP87A_FIXED_MICRO },  // 0.00551063753 * cos(3.52128320402 + 6681.22485339960 * t)
+    { -9730, -8521, 33, VSOP87A_FIXED_SERIES(Y, 1) | VSOP87A_FIXED_MICRO },  // 0.00077091913 * cos(3.86082685753 + 10021.83728009940 * t)
+    { 2499, 5739, 16, VSOP87A_FIXED_SERIES(Y, 1) | VSOP87A_FIXED_MICRO },  // 0.00037310491 * cos(1.16016958445 + 3340.61242669980 * t)
+    { -789, -1401, 34, VSOP87A_FIXED_SERIES(Y, 1) },  // 0.00009582122 * cos(4.19942354479 + 13362.44970679920 * t)
+    { 43, 437, 13, VSOP87A_FIXED_SERIES(Y, 1) },  // 0.00002617695 * cos(1.47284555520 + 3337.08930835080 * t)
+    { -27, -437, 19, VSOP87A_FIXED_SERIES(Y, 1) },  // 0.00002611572 * cos(4.65030772498 + 3344.13554504880 * t)
+    { -34, -192, 35, VSOP87A_FIXED_SERIES(Y, 1) },  // 0.00001162955 * cos(4.53778503576 + 16703.06213349900 * t)
+    { -5939, 0, 0, VSOP87A_FIXED_SERIES(Y, 2) | VSOP87A_FIXED_MICRO },  // 0.00035396765 * cos(3.14159265359 + 0.00000000000 * t)
+    { -1407, 3403, 30, VSOP87A_FIXED_SERIES(Y, 2) | VSOP87A_FIXED_MICRO },  // 0.00021950759 * cos(1.96291594946 + 6681.22485339960 * t)
+    { -723, 719, 33, VSOP87A_FIXED_SERIES(Y, 2) },  // 0.00006075990 * cos(2.35864321001 + 10021.83728009940 * t)
+    { 347, -256, 16, VSOP87A_FIXED_SERIES(Y, 2) },  // 0.00002571425 * cos(5.64795745327 + 3340.61242669980 * t)
+    { -173, 78, 34, VSOP87A_FIXED_SERIES(Y, 2) },  // 0.00001129099 * cos(2.71576248963 + 13362.44970679920 * t)
+    { 243, 0, 0, VSOP87A_FIXED_SERIES(Y, 3) },  // 0.00001448778 * cos(0.00000000000 + 0.00000000000 * t)
+    { -666588, -481471, 16, VSOP87A_FIXED_SERIES(Z, 0) | VSOP87A_FIXED_MICRO },  // 0.04901207220 * cos(3.76712324286 + 3340.61242669980 * t)
+    { 110842, 0, 0, VSOP87A_FIXED_SERIES(Z, 0) | VSOP87A_FIXED_MICRO },  // 0.00660669541 * cos(0.00000000000 + 0.00000000000 * t)
+    { -21850, -31466, 30, VSOP87A_FIXED_SERIES(Z, 0) | VSOP87A_FIXED_MICRO },  // 0.00228333904 * cos(4.10544022266 + 6681.22485339960 * t)
+    { -711, -2581, 33, VSOP87A_FIXED_SERIES(Z, 0) | VSOP87A_FIXED_MICRO },  // 0.00015958402 * cos(4.44367058261 + 10021.83728009940 * t)
+    { 15, -221, 34, VSOP87A_FIXED_SERIES(Z, 0) },  // 0.00001321976 * cos(4.78186604114 + 13362.44970679920 * t)
+    { 54171, -12850, 16, VSOP87A_FIXED_SERIES(Z, 1) | VSOP87A_FIXED_MICRO },  // 0.00331842958 * cos(6.05027773492 + 3340.61242669980 * t)
+    { -8041, 0, 0, VSOP87A_FIXED_SERIES(Z, 1) | VSOP87A_FIXED_MICRO },  // 0.00047930411 * cos(3.14159265359 + 0.00000000000 * t)
+    { -68, 1659, 30, VSOP87A_FIXED_SERIES(Z, 1) },  // 0.00009896501 * cos(1.61155844715 + 6681.22485339960 * t)
+    { -250, 138, 33, VSOP87A_FIXED_SERIES(Z, 1) },  // 0.00001700147 * cos(2.63703242065 + 10021.83728009940 * t)
+    { 1160, 1985, 16, VSOP87A_FIXED_SERIES(Z, 2) | VSOP87A_FIXED_MICRO },  // 0.00013705360 * cos(1.04212852598 + 3340.61242669980 * t)
+    { -995, 0, 0, VSOP87A_FIXED_SERIES(Z, 2) },  // 0.00005931596 * cos(3.14159265359 + 0.00000000000 * t)
+};
+
+// jupiter: 264 terms (110 at micro precision) over 57 frequencies, 7 of them computed directly
+static const int64_t _vsop87a_fixed_jupiter_rates[] = {
+    872480852LL,
+    9172008394LL,
+    11771910397LL,
+    64484636965LL,
+    64576718076LL,
+    64666708443LL,
+    65267127450LL,
+};
+static const vsop87a_fixed_frequency_t _vsop87a_fixed_jupiter_frequencies[] = {
+    { VSOP87A_FIXED_OP_ZERO | VSOP87A_FIXED_MICRO, 0, 0 },
+    { VSOP87A_FIXED_OP_BASE | VSOP87A_FIXED_MICRO, 0, 0 },
+    { VSOP87A_FIXED_OP_SUM | VSOP87A_FIXED_MICRO, 1, 1 },
+    { VSOP87A_FIXED_OP_BASE, 1, 0 },
+    { VSOP87A_FIXED_OP_BASE | VSOP87A_FIXED_MICRO, 2, 0 },
+    { VSOP87A_FIXED_OP_SUM | VSOP87A_FIXED_MICRO, 4, 1 },
+    { VSOP87A_FIXED_OP_SUM | VSOP87A_FIXED_MICRO, 4, 2 },
+    { VSOP87A_FIXED_OP_SUM | VSOP87A_FIXED_MICRO, 5, 2 },
+    { VSOP87A_FIXED_OP_SUM | VSOP87A_FIXED_MICRO, 5, 5 },
+    { VSOP87A_FIXED_OP_SUM | VSOP87A_FIXED_MICRO, 6, 5 },
+    { VSOP87A_FIXED_OP_SUM | VSOP87A_FIXED_MICRO, 6, 6 },
+    { VSOP87A_FIXED_OP_SUM | VSOP87A_FIXED_MICRO, 8, 5 },
+    { VSOP87A_FIXED_OP_SUM | VSOP87A_FIXED_MICRO, 8, 6 },
+    { VSOP87A_FIXED_OP_SUM | VSOP87A_FIXED_MICRO, 8, 7 },
+    { VSOP87A_FIXED_OP_SUM | VSOP87A_FIXED_MICRO, 9, 8 },
+    { VSOP87A_FIXED_OP_SUM | VSOP87A_FIXED_MICRO, 9, 9 },
+    { VSOP87A_FIXED_OP_SUM | VSOP87A_FIXED_MICRO, 10, 9 },
+    { VSOP87A_FIXED_OP_SUM | VSOP87A_FIXED_MICRO, 11, 8 },
+    { VSOP87A_FIXED_OP_SUM | VSOP87A_FIXED_MICRO, 11, 9 },
+    { VSOP87A_FIXED_OP_BASE | VSOP87A_FIXED_MICRO, 3, 0 },
+    { VSOP87A_FIXED_OP_BASE | VSOP87A_FIXED_MICRO, 4, 0 },
+    { VSOP87A_FIXED_OP_BASE, 5, 0 },
+    { VSOP87A_FIXED_OP_SUM | VSOP87A_FIXED_MICRO, 11, 10 },
+    { VSOP87A_FIXED_OP_BASE, 6, 0 },
+    { VSOP87A_FIXED_OP_SUM | VSOP87A_FIXED_MICRO, 19, 1 },
+    { VSOP87A_FIXED_OP_SUM | VSOP87A_FIXED_MICRO, 20, 1 },
+    { VSOP87A_FIXED_OP_SUM | VSOP87A_FIXED_MICRO, 12, 10 },
+    { VSOP87A_FIXED_OP_SUM | VSOP87A_FIXED_MICRO, 13, 10 },
+    { VSOP87A_FIXED_OP_SUM | VSOP87A_FIXED_MICRO, 12, 11 },
+    { VSOP87A_FIXED_OP_SUM | VSOP87A_FIXED_MICRO, 12, 12 },
+    { VSOP87A_FIXED_OP_SUM, 13, 12 },
+    { VSOP87A_FIXED_OP_SUM | VSOP87A_FIXED_MICRO, 14, 12 },
+    { VSOP87A_FIXED_OP_SUM | VSOP87A_FIXED_MICRO, 14, 13 },
+    { VSOP87A_FIXED_OP_SUM, 14, 14 },
+    { VSOP87A_FIXED_OP_SUM | VSOP87A_FIXED_MICRO, 15, 14 },
+    { VSOP87A_FIXED_OP_SUM, 15, 15 },
+    { VSOP87A_FIXED_OP_SUM, 17, 15 },
+    { VSOP87A_FIXED_OP_SUM | VSOP87A_FIXED_MICRO, 17, 16 },
+    { VSOP87A_FIXED_OP_SUM, 18, 16 },
+    { VSOP87A_FIXED_OP_SUM, 18, 18 },
+    { VSOP87A_FIXED_OP_SUM | VSOP87A_FIXED_MICRO, 20, 19 },
+    { VSOP87A_FIXED_OP_SUM | VSOP87A_FIXED_MICRO, 22, 22 },
+    { VSOP87A_FIXED_OP_SUM | VSOP87A_FIXED_MICRO, 25, 24 },
+    { VSOP87A_FIXED_OP_SUM, 28, 22 },
+    { VSOP87A_FIXED_OP_SUM | VSOP87A_FIXED_MICRO, 28, 26 },
+    { VSOP87A_FIXED_OP_SUM, 28, 27 },
+    { VSOP87A_FIXED_OP_SUM, 29, 29 },
+    { VSOP87A_FIXED_OP_SUM, 30, 29 },
+    { VSOP87A_FIXED_OP_SUM, 31, 29 },
+    { VSOP87A_FIXED_OP_SUM, 31, 30 },
+    { VSOP87A_FIXED_OP_SUM, 32, 31 },
+    { VSOP87A_FIXED_OP_SUM, 33, 32 },
+    { VSOP87A_FIXED_OP_SUM | VSOP87A_FIXED_MICRO, 34, 32 },
+    { VSOP87A_FIXED_OP_SUM, 35, 32 },
+    { VSOP87A_FIXED_OP_SUM, 34, 34 },
+    { VSOP87A_FIXED_OP_SUM, 36, 35 },
+    { VSOP87A_FIXED_OP_SUM | VSOP87A_FIXED_MICRO, 41, 41 },
+};
+static const vsop87a_fixed_term_t _vsop87a_fixed_jupiter_terms[] = {
+    { 71983962, 49188865, 22, VSOP87A_FIXED_SERIES(X, 0) | VSOP87A_FIXED_MICRO },  // 5.19663470114 * cos(0.59945082355 + 529.69096509460 * t)
+    { -6150971, 0, 0, VSOP87A_FIXED_SERIES(X, 0) | VSOP87A_FIXED_MICRO },  // 0.36662642320 * cos(3.14159265359 + 0.00000000000 * t)
+    { 1230564, 1717588, 41, VSOP87A_FIXED_SERIES(X, 0) | VSOP87A_FIXED_MICRO },  // 0.12593937922 * cos(0.94911583701 + 1059.38193018920 * t)
+    { 187319, 168227, 18, VSOP87A_FIXED_SERIES(X, 0) | VSOP87A_FIXED_MICRO },  // 0.01500672056 * cos(0.73175134610 + 522.57741809380 * t)
+    { -220163, -113440, 26, VSOP87A_FIXED_SERIES(X, 0) | VSOP87A_FIXED_MICRO },  // 0.01476224578 * cos(3.61736921122 + 536.80451209540 * t)
+    { 20629, 73976, 52, VSOP87A_FIXED_SERIES(X, 0) | VSOP87A_FIXED_MICRO },  // 0.00457752736 * cos(1.29883700755 + 1589.07289528380 * t)
+    { 22531, -45324, 1, VSOP87A_FIXED_SERIES(X, 0) | VSOP87A_FIXED_MICRO },  // 0.00301689798 * cos(5.17372551148 + 7.11354700080 * t)
+    { -27670, 58547, 5, VSOP87A_FIXED_SERIES(X, 0) | VSOP87A_FIXED_MICRO },  // 0.00385975375 * cos(2.01229910687 + 103.09277421860 * t)
+    { 10036, -30966, 15, VSOP87A_FIXED_SERIES(X, 0) | VSOP87A_FIXED_MICRO },  // 0.00194025405 * cos(5.02580363996 + 426.59819087600 * t)
+    { 24944, -4106, 6, VSOP87A_FIXED_SERIES(X, 0) | VSOP87A_FIXED_MICRO },  // 0.00150678793 * cos(6.12003027739 + 110.20632121940 * t)
+    { 18218, -16088, 29, VSOP87A_FIXED_SERIES(X, 0) | VSOP87A_FIXED_MICRO },  // 0.00144867641 * cos(5.55980577080 + 632.78373931320 * t)
+    { 14409, 17306, 9, VSOP87A_FIXED_SERIES(X, 0) | VSOP87A_FIXED_MICRO },  // 0.00134226996 * cos(0.87648567011 + 213.29909543800 * t)
+    { 17293, -1560, 40, VSOP87A_FIXED_SERIES(X, 0) | VSOP87A_FIXED_MICRO },  // 0.00103494641 * cos(6.19324769120 + 1052.26838318840 * t)
+    { 19157, 300, 44, VSOP87A_FIXED_SERIES(X, 0) | VSOP87A_FIXED_MICRO },  // 0.00114201562 * cos(0.01567084269 + 1162.47470440780 * t)
+    { -8256, -8840, 42, VSOP87A_FIXED_SERIES(X, 0) | VSOP87A_FIXED_MICRO },  // 0.00072095575 * cos(3.96117430643 + 1066.49547719000 * t)
+    { -2514, -9658, 37, VSOP87A_FIXED_SERIES(X, 0) | VSOP87A_FIXED_MICRO },  // 0.00059486083 * cos(4.45769374358 + 949.17560896980 * t)
+    { -10948, -3374, 34, VSOP87A_FIXED_SERIES(X, 0) | VSOP87A_FIXED_MICRO },  // 0.00068284021 * cos(3.44051122631 + 846.08283475120 * t)
+    { 982, 7839, 14, VSOP87A_FIXED_SERIES(X, 0) | VSOP87A_FIXED_MICRO },  // 0.00047092251 * cos(1.44612636451 + 419.48464387520 * t)
+    { -5080, 769, 8, VSOP87A_FIXED_SERIES(X, 0) | VSOP87A_FIXED_MICRO },  // 0.00030623417 * cos(2.99132321427 + 206.18554843720 * t)
+    { 620, -4422, 13, VSOP87A_FIXED_SERIES(X, 0) | VSOP87A_FIXED_MICRO },  // 0.00026613459 * cos(4.85169906494 + 323.50541665740 * t)
+    { -258, 3300, 56, VSOP87A_FIXED_SERIES(X, 0) | VSOP87A_FIXED_MICRO },  // 0.00019727457 * cos(1.64891626213 + 2118.76386037840 * t)
+    { -1027, 2567, 12, VSOP87A_FIXED_SERIES(X, 0) | VSOP87A_FIXED_MICRO },  // 0.00016481594 * cos(1.95150056568 + 316.39186965660 * t)
+    { 1722, 2082, 17, VSOP87A_FIXED_SERIES(X, 0) | VSOP87A_FIXED_MICRO },  // 0.00016101974 * cos(0.87973155980 + 515.46387109300 * t)
+    { -1157, 2084, 32, VSOP87A_FIXED_SERIES(X, 0) | VSOP87A_FIXED_MICRO },  // 0.00014209487 * cos(2.07769621413 + 742.99006053260 * t)
+    { 2548, -64, 31, VSOP87A_FIXED_SERIES(X, 0) | VSOP87A_FIXED_MICRO },  // 0.00015192516 * cos(6.25820127906 + 735.87651353180 * t)
+    { -1807, -639, 27, VSOP87A_FIXED_SERIES(X, 0) | VSOP87A_FIXED_MICRO },  // 0.00011423199 * cos(3.48146108929 + 543.91805909620 * t)
+    { -1671, -1169, 19, VSOP87A_FIXED_SERIES(X, 0) | VSOP87A_FIXED_MICRO },  // 0.00012155285 * cos(3.75229924999 + 525.75881183150 * t)
+    { 1677, 1113, 25, VSOP87A_FIXED_SERIES(X, 0) | VSOP87A_FIXED_MICRO },  // 0.00011996271 * cos(0.58568573729 + 533.62311835770 * t)
+    { -1344, -462, 30, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00008468556 * cos(3.47248751739 + 639.89728631400 * t)
+    { 1041, -906, 50, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00008223302 * cos(5.56680447143 + 1478.86657406440 * t)
+    { 1353, 545, 54, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00008694124 * cos(0.38262009411 + 1692.16566950240 * t)
+    { 1191, -368, 38, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00007427517 * cos(5.98380751196 + 956.28915597060 * t)
+    { 755, 1010, 46, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00007516470 * cos(0.92896448412 + 1265.56747862640 * t)
+    { 1272, 182, 51, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00007655867 * cos(0.14178789086 + 1581.95934828300 * t)
+    { 401, 797, 20, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00005318791 * cos(1.10494016349 + 526.50957135690 * t)
+    { -872, -79, 24, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00005218492 * cos(3.23235129224 + 532.87235883230 * t)
+    { 309, -919, 2, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00005777311 * cos(5.03726165628 + 14.22709400160 * t)
+    { -633, -448, 49, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00004622685 * cos(3.75817086099 + 1375.77379984580 * t)
+    { -260, -608, 53, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00003939864 * cos(4.30892687511 + 1596.18644228460 * t)
+    { -420, 641, 4, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00004569444 * cos(2.15087281710 + 95.97922721780 * t)
+    { -373, -326, 11, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00002952712 * cos(3.85988483947 + 309.27832265580 * t)
+    { 462, -129, 7, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00002857935 * cos(6.01118473739 + 117.31986822020 * t)
+    { -186, -365, 16, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00002440094 * cos(4.23995765702 + 433.71173787680 * t)
+    { -300, -278, 10, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00002438257 * cos(3.88808463822 + 220.41264243880 * t)
+    { -448, -20, 45, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00002675112 * cos(3.18723449094 + 1169.58825140860 * t)
+    { 380, -126, 39, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00002386425 * cos(5.96354994324 + 1045.15483618760 * t)
+    { 272, 156, 43, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00001870097 * cos(0.52019313301 + 1155.36115740700 * t)
+    { 304, -116, 28, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00001939060 * cos(5.91883412864 + 625.67019231240 * t)
+    { -79, -262, 36, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00001631500 * cos(4.41910383466 + 942.06206196900 * t)
+    { 211, -121, 35, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00001451667 * cos(5.76112706040 + 853.19638175200 * t)
+    { 50, 223, 48, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00001361286 * cos(1.34792748837 + 1368.66025284500 * t)
+    { -101, 260, 33, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00001663331 * cos(1.94010629194 + 838.96928775040 * t)
+    { 190, -192, 3, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00001611229 * cos(5.49324974845 + 74.78159856730 * t)
+    { 173, 15, 55, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00001033570 * cos(0.08907208789 + 1795.25844372100 * t)
+    { 77, 165, 21, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00001088284 * cos(1.13406104190 + 527.24328453980 * t)
+    { -181, -12, 23, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00001080643 * cos(3.20528362573 + 532.13864564940 * t)
+    { -148040, 0, 0, VSOP87A_FIXED_SERIES(X, 1) | VSOP87A_FIXED_MICRO },  // 0.00882389251 * cos(3.14159265359 + 0.00000000000 * t)
+    { 105980, 11343, 41, VSOP87A_FIXED_SERIES(X, 1) | VSOP87A_FIXED_MICRO },  // 0.00635297172 * cos(0.10662156868 + 1059.38193018920 * t)
+    { -76197, 65709, 18, VSOP87A_FIXED_SERIES(X, 1) | VSOP87A_FIXED_MICRO },  // 0.00599720482 * cos(2.42996678275 + 522.57741809380 * t)
+    { -33407, 93028, 26, VSOP87A_FIXED_SERIES(X, 1) | VSOP87A_FIXED_MICRO },  // 0.00589157060 * cos(1.91556314637 + 536.80451209540 * t)
+    { -12989, -4378, 1, VSOP87A_FIXED_SERIES(X, 1) | VSOP87A_FIXED_MICRO },  // 0.00081697204 * cos(3.46668108797 + 7.11354700080 * t)
+    { 6955, 3421, 52, VSOP87A_FIXED_SERIES(X, 1) | VSOP87A_FIXED_MICRO },  // 0.00046201898 * cos(0.45714214032 + 1589.07289528380 * t)
+    { -953, 5370, 40, VSOP87A_FIXED_SERIES(X, 1) | VSOP87A_FIXED_MICRO },  // 0.00032508590 * cos(1.74648849928 + 1052.26838318840 * t)
+    { -3263, -4656, 22, VSOP87A_FIXED_SERIES(X, 1) | VSOP87A_FIXED_MICRO },  // 0.00033891193 * cos(4.10113482752 + 529.69096509460 * t)
+    { -3671, 3739, 42, VSOP87A_FIXED_SERIES(X, 1) | VSOP87A_FIXED_MICRO },  // 0.00031234303 * cos(2.34698051502 + 1066.49547719000 * t)
+    { -1211, -3352, 6, VSOP87A_FIXED_SERIES(X, 1) | VSOP87A_FIXED_MICRO },  // 0.00021244363 * cos(4.36576178953 + 110.20632121940 * t)
+    { -1978, -2317, 15, VSOP87A_FIXED_SERIES(X, 1) | VSOP87A_FIXED_MICRO },  // 0.00018156701 * cos(4.00572238779 + 426.59819087600 * t)
+    { 2176, 673, 29, VSOP87A_FIXED_SERIES(X, 1) | VSOP87A_FIXED_MICRO },  // 0.00013577576 * cos(0.30008010246 + 632.78373931320 * t)
+    { -1824, 1161, 17, VSOP87A_FIXED_SERIES(X, 1) | VSOP87A_FIXED_MICRO },  // 0.00012889505 * cos(2.57489294062 + 515.46387109300 * t)
+    { -319, 1497, 27, VSOP87A_FIXED_SERIES(X, 1) },  // 0.00009125875 * cos(1.78082469962 + 543.91805909620 * t)
+    { 1347, -165, 37, VSOP87A_FIXED_SERIES(X, 1) },  // 0.00008085991 * cos(6.16136518902 + 949.17560896980 * t)
+    { -1198, -37, 13, VSOP87A_FIXED_SERIES(X, 1) },  // 0.00007142547 * cos(3.17267801203 + 323.50541665740 * t)
+    { 27, -720, 8, VSOP87A_FIXED_SERIES(X, 1) },  // 0.00004292240 * cos(4.74970626655 + 206.18554843720 * t)
+    { 303, 672, 31, VSOP87A_FIXED_SERIES(X, 1) },  // 0.00004393977 * cos(1.14770788063 + 735.87651353180 * t)
+    { -554, 136, 20, VSOP87A_FIXED_SERIES(X, 1) },  // 0.00003399164 * cos(2.90091450747 + 526.50957135690 * t)
+    { 75, 554, 24, VSOP87A_FIXED_SERIES(X, 1) },  // 0.00003333344 * cos(1.43691652967 + 532.87235883230 * t)
+    { -638, -126, 2, VSOP87A_FIXED_SERIES(X, 1) },  // 0.00003873467 * cos(3.33648870101 + 14.22709400160 * t)
+    { -43, 509, 19, VSOP87A_FIXED_SERIES(X, 1) },  // 0.00003044408 * cos(1.65428048669 + 525.75881183150 * t)
+    { -452, 223, 25, VSOP87A_FIXED_SERIES(X, 1) },  // 0.00003001874 * cos(2.68376982746 + 533.62311835770 * t)
+    { -426, 246, 14, VSOP87A_FIXED_SERIES(X, 1) },  // 0.00002933359 * cos(2.61899855005 + 419.48464387520 * t)
+    { -366, -183, 12, VSOP87A_FIXED_SERIES(X, 1) },  // 0.00002438199 * cos(3.60655644537 + 316.39186965660 * t)
+    { 87, -462, 5, VSOP87A_FIXED_SERIES(X, 1) },  // 0.00002804218 * cos(4.89742591320 + 103.09277421860 * t)
+    { 347, 362, 56, VSOP87A_FIXED_SERIES(X, 1) },  // 0.00002990245 * cos(0.80692155639 + 2118.76386037840 * t)
+    { 122, -309, 38, VSOP87A_FIXED_SERIES(X, 1) },  // 0.00001977572 * cos(5.08915489088 + 956.28915597060 * t)
+    { -290, 113, 53, VSOP87A_FIXED_SERIES(X, 1) },  // 0.00001853679 * cos(2.76941001747 + 1596.18644228460 * t)
+    { 222, 198, 32, VSOP87A_FIXED_SERIES(X, 1) },  // 0.00001772800 * cos(0.72631739446 + 742.99006053260 * t)
+    { -232, -197, 4, VSOP87A_FIXED_SERIES(X, 1) },  // 0.00001812965 * cos(3.84602148747 + 95.97922721780 * t)
+    { -99, -237, 7, VSOP87A_FIXED_SERIES(X, 1) },  // 0.00001532945 * cos(4.31556714501 + 117.31986822020 * t)
+    { -91, 306, 51, VSOP87A_FIXED_SERIES(X, 1) },  // 0.00001904067 * cos(1.85937873703 + 1581.95934828300 * t)
+    { 24, 257, 30, VSOP87A_FIXED_SERIES(X, 1) },  // 0.00001539212 * cos(1.47899172821 + 639.89728631400 * t)
+    { 42, 271, 39, VSOP87A_FIXED_SERIES(X, 1) },  // 0.00001632362 * cos(1.41504212408 + 1045.15483618760 * t)
+    { -145, 93, 16, VSOP87A_FIXED_SERIES(X, 1) },  // 0.00001023812 * cos(2.57182697715 + 433.71173787680 * t)
+    { -143, 105, 46, VSOP87A_FIXED_SERIES(X, 1) },  // 0.00001055422 * cos(2.50844222977 + 1265.56747862640 * t)
+    { -11332, -17419, 18, VSOP87A_FIXED_SERIES(X, 2) | VSOP87A_FIXED_MICRO },  // 0.00123864644 * cos(4.13563277513 + 522.57741809380 * t)
+    { 19933, 4281, 26, VSOP87A_FIXED_SERIES(X, 2) | VSOP87A_FIXED_MICRO },  // 0.00121521296 * cos(0.21155109275 + 536.80451209540 * t)
+    { 14320, 0, 0, VSOP87A_FIXED_SERIES(X, 2) | VSOP87A_FIXED_MICRO },  // 0.00085355503 * cos(0.00000000000 + 0.00000000000 * t)
+    { 7201, -10863, 22, VSOP87A_FIXED_SERIES(X, 2) | VSOP87A_FIXED_MICRO },  // 0.00077685547 * cos(5.29776154458 + 529.69096509460 * t)
+    { 2773, -6370, 41, VSOP87A_FIXED_SERIES(X, 2) | VSOP87A_FIXED_MICRO },  // 0.00041410887 * cos(5.12291589939 + 1059.38193018920 * t)
+    { -302, 1892, 1, VSOP87A_FIXED_SERIES(X, 2) | VSOP87A_FIXED_MICRO },  // 0.00011423070 * cos(1.72917878238 + 7.11354700080 * t)
+    { 872, 799, 42, VSOP87A_FIXED_SERIES(X, 2) },  // 0.00007051587 * cos(0.74163703419 + 1066.49547719000 * t)
+    { -845, -451, 40, VSOP87A_FIXED_SERIES(X, 2) },  // 0.00005711029 * cos(3.63172846494 + 1052.26838318840 * t)
+    { -373, -797, 17, VSOP87A_FIXED_SERIES(X, 2) },  // 0.00005242644 * cos(4.27482379441 + 515.46387109300 * t)
+    { 519, -436, 52, VSOP87A_FIXED_SERIES(X, 2) },  // 0.00004039540 * cos(5.58417732117 + 1589.07289528380 * t)
+    { 620, 48, 27, VSOP87A_FIXED_SERIES(X, 2) },  // 0.00003706457 * cos(0.07769981349 + 543.91805909620 * t)
+    { -218, 183, 6, VSOP87A_FIXED_SERIES(X, 2) },  // 0.00001698817 * cos(2.44284418066 + 110.20632121940 * t)
+    { -135, 134, 15, VSOP87A_FIXED_SERIES(X, 2) },  // 0.00001134598 * cos(2.35807061809 + 426.59819087600 * t)
+    { -13, 221, 2, VSOP87A_FIXED_SERIES(X, 2) },  // 0.00001322673 * cos(1.63142549980 + 14.22709400160 * t)
+    { 2613, -1173, 18, VSOP87A_FIXED_SERIES(X, 3) | VSOP87A_FIXED_MICRO },  // 0.00017071323 * cos(5.86133022278 + 522.57741809380 * t)
+    { 174, -2799, 26, VSOP87A_FIXED_SERIES(X, 3) | VSOP87A_FIXED_MICRO },  // 0.00016713548 * cos(4.77458794485 + 536.80451209540 * t)
+    { 562, 0, 0, VSOP87A_FIXED_SERIES(X, 3) },  // 0.00003348610 * cos(0.00000000000 + 0.00000000000 * t)
+    { -273, -123, 41, VSOP87A_FIXED_SERIES(X, 3) },  // 0.00001787838 * cos(3.56550298031 + 1059.38193018920 * t)
+    { 230, -71, 17, VSOP87A_FIXED_SERIES(X, 3) },  // 0.00001435449 * cos(5.98502036587 + 515.46387109300 * t)
+    { 119, -137, 42, VSOP87A_FIXED_SERIES(X, 3) },  // 0.00001080194 * cos(5.42530305914 + 1066.49547719000 * t)
+    { -11, -170, 27, VSOP87A_FIXED_SERIES(X, 3) },  // 0.00001014206 * cos(4.64773902077 + 543.91805909620 * t)
+    { 180, -11, 1, VSOP87A_FIXED_SERIES(X, 3) },  // 0.00001073175 * cos(6.22314467964 + 7.11354700080 * t)
+    { 71, 287, 18, VSOP87A_FIXED_SERIES(X, 4) },  // 0.00001762402 * cos(1.32863039757 + 522.57741809380 * t)
+    { -287, 31, 26, VSOP87A_FIXED_SERIES(X, 4) },  // 0.00001717846 * cos(3.03331531843 + 536.80451209540 * t)
+    { 49189093, -71954660, 22, VSOP87A_FIXED_SERIES(Y, 0) | VSOP87A_FIXED_MICRO },  // 5.19520046589 * cos(5.31203162731 + 529.69096509460 * t)
+    { 1717561, -1230292, 41, VSOP87A_FIXED_SERIES(Y, 0) | VSOP87A_FIXED_MICRO },  // 0.12592862602 * cos(5.66160227728 + 1059.38193018920 * t)
+    { -1570963, 0, 0, VSOP87A_FIXED_SERIES(Y, 0) | VSOP87A_FIXED_MICRO },  // 0.09363670616 * cos(3.14159265359 + 0.00000000000 * t)
+    { 168175, -189076, 18, VSOP87A_FIXED_SERIES(Y, 0) | VSOP87A_FIXED_MICRO },  // 0.01508275299 * cos(5.43934968102 + 522.57741809380 * t)
+    { -113457, 220075, 26, VSOP87A_FIXED_SERIES(Y, 0) | VSOP87A_FIXED_MICRO },  // 0.01475809370 * cos(2.04679566495 + 536.80451209540 * t)
+    { 73977, -20625, 52, VSOP87A_FIXED_SERIES(Y, 0) | VSOP87A_FIXED_MICRO },  // 0.00457750806 * cos(6.01129093501 + 1589.07289528380 * t)
+    { -45025, -22752, 1, VSOP87A_FIXED_SERIES(Y, 0) | VSOP87A_FIXED_MICRO },  // 0.00300686679 * cos(3.60948050740 + 7.11354700080 * t)
+    { -58737, -24039, 5, VSOP87A_FIXED_SERIES(Y, 0) | VSOP87A_FIXED_MICRO },  // 0.00378285578 * cos(3.53006782383 + 103.09277421860 * t)
+    { -30677, -10007, 15, VSOP87A_FIXED_SERIES(Y, 0) | VSOP87A_FIXED_MICRO },  // 0.00192333128 * cos(3.45690564771 + 426.59819087600 * t)
+    { -2196, -24414, 6, VSOP87A_FIXED_SERIES(Y, 0) | VSOP87A_FIXED_MICRO },  // 0.00146104656 * cos(4.62267224431 + 110.20632121940 * t)
+    { -15282, -17721, 29, VSOP87A_FIXED_SERIES(Y, 0) | VSOP87A_FIXED_MICRO },  // 0.00139480058 * cos(4.00075307706 + 632.78373931320 * t)
+    { 17569, -13673, 9, VSOP87A_FIXED_SERIES(Y, 0) | VSOP87A_FIXED_MICRO },  // 0.00132696764 * cos(5.62184581859 + 213.29909543800 * t)
+    { -2328, -16954, 40, VSOP87A_FIXED_SERIES(Y, 0) | VSOP87A_FIXED_MICRO },  // 0.00101999807 * cos(4.57594598884 + 1052.26838318840 * t)
+    { 334, -19130, 44, VSOP87A_FIXED_SERIES(Y, 0) | VSOP87A_FIXED_MICRO },  // 0.00114043110 * cos(4.72982262969 + 1162.47470440780 * t)
+    { -8841, 8254, 42, VSOP87A_FIXED_SERIES(Y, 0) | VSOP87A_FIXED_MICRO },  // 0.00072091178 * cos(2.39048659148 + 1066.49547719000 * t)
+    { -9608, 2416, 37, VSOP87A_FIXED_SERIES(Y, 0) | VSOP87A_FIXED_MICRO },  // 0.00059051769 * cos(2.89529070968 + 949.17560896980 * t)
+    { -3331, 10977, 34, VSOP87A_FIXED_SERIES(Y, 0) | VSOP87A_FIXED_MICRO },  // 0.00068374489 * cos(1.86537074374 + 846.08283475120 * t)
+    { -951, -4910, 8, VSOP87A_FIXED_SERIES(Y, 0) | VSOP87A_FIXED_MICRO },  // 0.00029807369 * cos(4.52105772740 + 206.18554843720 * t)
+    { -3395, -2982, 14, VSOP87A_FIXED_SERIES(Y, 0) | VSOP87A_FIXED_MICRO },  // 0.00026933579 * cos(3.86233956827 + 419.48464387520 * t)
+    { -4422, -625, 13, VSOP87A_FIXED_SERIES(Y, 0) | VSOP87A_FIXED_MICRO },  // 0.00026619714 * cos(3.28203174951 + 323.50541665740 * t)
+    { -2783, -2125, 31, VSOP87A_FIXED_SERIES(Y, 0) | VSOP87A_FIXED_MICRO },  // 0.00020873780 * cos(3.79369881757 + 735.87651353180 * t)
+    { 3300, 259, 56, VSOP87A_FIXED_SERIES(Y, 0) | VSOP87A_FIXED_MICRO },  // 0.00019727397 * cos(0.07818534532 + 2118.76386037840 * t)
+    { 2895, 1182, 12, VSOP87A_FIXED_SERIES(Y, 0) | VSOP87A_FIXED_MICRO },  // 0.00018639846 * cos(0.38751972138 + 316.39186965660 * t)
+    { 2075, -1795, 17, VSOP87A_FIXED_SERIES(Y, 0) | VSOP87A_FIXED_MICRO },  // 0.00016355726 * cos(5.56997881604 + 515.46387109300 * t)
+    { 2176, 1126, 32, VSOP87A_FIXED_SERIES(Y, 0) | VSOP87A_FIXED_MICRO },  // 0.00014606858 * cos(0.47759399145 + 742.99006053260 * t)
+    { -639, 1806, 27, VSOP87A_FIXED_SERIES(Y, 0) | VSOP87A_FIXED_MICRO },  // 0.00011419853 * cos(1.91089341468 + 543.91805909620 * t)
+    { -1169, 1670, 19, VSOP87A_FIXED_SERIES(Y, 0) | VSOP87A_FIXED_MICRO },  // 0.00012153427 * cos(2.18151972499 + 525.75881183150 * t)
+    { 1110, -1677, 25, VSOP87A_FIXED_SERIES(Y, 0) | VSOP87A_FIXED_MICRO },  // 0.00011988875 * cos(5.29687602089 + 533.62311835770 * t)
+    { -477, 1334, 30, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00008443107 * cos(1.91435801697 + 639.89728631400 * t)
+    { -892, -1039, 50, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00008163163 * cos(4.00303742375 + 1478.86657406440 * t)
+    { 548, -1359, 54, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00008732789 * cos(5.09607066097 + 1692.16566950240 * t)
+    { -369, -1188, 38, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00007414115 * cos(4.41141990461 + 956.28915597060 * t)
+    { 988, -811, 46, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00007619486 * cos(5.59554151997 + 1265.56747862640 * t)
+    { 158, -1296, 51, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00007779184 * cos(4.83346300662 + 1581.95934828300 * t)
+    { 798, -401, 20, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00005322882 * cos(5.81740472645 + 526.50957135690 * t)
+    { -80, 872, 24, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00005217025 * cos(1.66178643542 + 532.87235883230 * t)
+    { -917, -312, 2, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00005772132 * cos(3.46915716927 + 14.22709400160 * t)
+    { -437, 621, 49, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00004528355 * cos(2.18377558038 + 1375.77379984580 * t)
+    { -608, 259, 53, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00003939875 * cos(2.73830531054 + 1596.18644228460 * t)
+    { -645, -414, 4, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00004567181 * cos(3.71300776935 + 95.97922721780 * t)
+    { 29, -542, 28, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00003235419 * cos(4.76600347062 + 625.67019231240 * t)
+    { 407, -334, 11, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00003140740 * cos(5.59566796922 + 309.27832265580 * t)
+    { -127, -462, 7, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00002855423 * cos(4.44478286006 + 117.31986822020 * t)
+    { -366, 186, 16, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00002445625 * cos(2.67036952230 + 433.71173787680 * t)
+    { -157, -344, 33, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00002253545 * cos(4.28462825722 + 838.96928775040 * t)
+    { -21, 448, 45, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00002672262 * cos(1.61857897069 + 1169.58825140860 * t)
+    { -280, 295, 10, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00002423639 * cos(2.32942339839 + 220.41264243880 * t)
+    { -43, -394, 43, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00002362662 * cos(4.60417580207 + 1155.36115740700 * t)
+    { -150, -375, 39, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00002409581 * cos(4.33196301609 + 1045.15483618760 * t)
+    { -123, -212, 35, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00001458169 * cos(4.18761881277 + 853.19638175200 * t)
+    { -239, -26, 36, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00001432195 * cos(3.24824554500 + 942.06206196900 * t)
+    { -197, -194, 3, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00001646568 * cos(3.91965876562 + 74.78159856730 * t)
+    { 22, -175, 55, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00001050270 * cos(4.83706014327 + 1795.25844372100 * t)
+    { 10, 168, 47, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00001002355 * cos(1.50931939870 + 1272.68102562720 * t)
+    { 165, -77, 21, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00001087727 * cos(5.84673086939 + 527.24328453980 * t)
+    { -12, 181, 23, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00001079512 * cos(1.63448507346 + 532.13864564940 * t)
+    { -284340, 0, 0, VSOP87A_FIXED_SERIES(Y, 1) | VSOP87A_FIXED_MICRO },  // 0.01694798253 * cos(3.14159265359 + 0.00000000000 * t)
+    { 11337, -105907, 41, VSOP87A_FIXED_SERIES(Y, 1) | VSOP87A_FIXED_MICRO },  // 0.00634859798 * cos(4.81903199650 + 1059.38193018920 * t)
+    { 65948, 76310, 18, VSOP87A_FIXED_SERIES(Y, 1) | VSOP87A_FIXED_MICRO },  // 0.00601160431 * cos(0.85811249940 + 522.57741809380 * t)
+    { 92987, 33408, 26, VSOP87A_FIXED_SERIES(Y, 1) | VSOP87A_FIXED_MICRO },  // 0.00588928504 * cos(0.34491576890 + 536.80451209540 * t)
+    { -4521, 12849, 1, VSOP87A_FIXED_SERIES(Y, 1) | VSOP87A_FIXED_MICRO },  // 0.00081187145 * cos(1.90914316532 + 7.11354700080 * t)
+    { -2639, 7411, 22, VSOP87A_FIXED_SERIES(Y, 1) | VSOP87A_FIXED_MICRO },  // 0.00046888090 * cos(1.91294535618 + 529.69096509460 * t)
+    { 3421, -6954, 52, VSOP87A_FIXED_SERIES(Y, 1) | VSOP87A_FIXED_MICRO },  // 0.00046194129 * cos(5.16955994561 + 1589.07289528380 * t)
+    { 5369, 957, 40, VSOP87A_FIXED_SERIES(Y, 1) | VSOP87A_FIXED_MICRO },  // 0.00032503453 * cos(0.17640743623 + 1052.26838318840 * t)
+    { 3739, 3671, 42, VSOP87A_FIXED_SERIES(Y, 1) | VSOP87A_FIXED_MICRO },  // 0.00031231694 * cos(0.77623645597 + 1066.49547719000 * t)
+    { -3237, 430, 6, VSOP87A_FIXED_SERIES(Y, 1) | VSOP87A_FIXED_MICRO },  // 0.00019462096 * cos(3.00957119470 + 110.20632121940 * t)
+    { -2321, 1863, 15, VSOP87A_FIXED_SERIES(Y, 1) | VSOP87A_FIXED_MICRO },  // 0.00017738615 * cos(2.46531787101 + 426.59819087600 * t)
+    { 698, -2190, 29, VSOP87A_FIXED_SERIES(Y, 1) | VSOP87A_FIXED_MICRO },  // 0.00013701692 * cos(5.02070197804 + 632.78373931320 * t)
+    { 1200, 1828, 17, VSOP87A_FIXED_SERIES(Y, 1) | VSOP87A_FIXED_MICRO },  // 0.00013034616 * cos(0.98979834442 + 515.46387109300 * t)
+    { 1497, 319, 27, VSOP87A_FIXED_SERIES(Y, 1) },  // 0.00009122660 * cos(0.21022587969 + 543.91805909620 * t)
+    { -178, -1349, 37, VSOP87A_FIXED_SERIES(Y, 1) },  // 0.00008109050 * cos(4.58123811601 + 949.17560896980 * t)
+    { -40, 1198, 13, VSOP87A_FIXED_SERIES(Y, 1) },  // 0.00007145229 * cos(1.60381236094 + 323.50541665740 * t)
+    { 661, -65, 8, VSOP87A_FIXED_SERIES(Y, 1) },  // 0.00003957592 * cos(6.18550697817 + 206.18554843720 * t)
+    { 664, -303, 31, VSOP87A_FIXED_SERIES(Y, 1) },  // 0.00004347346 * cos(5.85522835488 + 735.87651353180 * t)
+    { 136, 554, 20, VSOP87A_FIXED_SERIES(Y, 1) },  // 0.00003401735 * cos(1.33033225252 + 526.50957135690 * t)
+    { 554, -74, 24, VSOP87A_FIXED_SERIES(Y, 1) },  // 0.00003331887 * cos(6.14951835712 + 532.87235883230 * t)
+    { -128, 636, 2, VSOP87A_FIXED_SERIES(Y, 1) },  // 0.00003866147 * cos(1.76877582038 + 14.22709400160 * t)
+    { 278, 439, 14, VSOP87A_FIXED_SERIES(Y, 1) },  // 0.00003094257 * cos(1.00670454701 + 419.48464387520 * t)
+    { 509, 42, 19, VSOP87A_FIXED_SERIES(Y, 1) },  // 0.00003044205 * cos(0.08329779827 + 525.75881183150 * t)
+    { 223, 452, 25, VSOP87A_FIXED_SERIES(Y, 1) },  // 0.00003001484 * cos(1.11280606283 + 533.62311835770 * t)
+    { -488, -106, 5, VSOP87A_FIXED_SERIES(Y, 1) },  // 0.00002977284 * cos(3.35507028507 + 103.09277421860 * t)
+    { -188, 346, 12, VSOP87A_FIXED_SERIES(Y, 1) },  // 0.00002347100 * cos(2.06781775390 + 316.39186965660 * t)
+    { 362, -347, 56, VSOP87A_FIXED_SERIES(Y, 1) },  // 0.00002990192 * cos(5.51944830506 + 2118.76386037840 * t)
+    { 181, -257, 32, VSOP87A_FIXED_SERIES(Y, 1) },  // 0.00001875464 * cos(5.32657356489 + 742.99006053260 * t)
+    { 113, 290, 53, VSOP87A_FIXED_SERIES(Y, 1) },  // 0.00001854067 * cos(1.19908734197 + 1596.18644228460 * t)
+    { -307, -122, 38, VSOP87A_FIXED_SERIES(Y, 1) },  // 0.00001968401 * cos(3.51896739844 + 956.28915597060 * t)
+    { 193, -234, 4, VSOP87A_FIXED_SERIES(Y, 1) },  // 0.00001808627 * cos(5.40287543026 + 95.97922721780 * t)
+    { -237, 98, 7, VSOP87A_FIXED_SERIES(Y, 1) },  // 0.00001530472 * cos(2.75094722237 + 117.31986822020 * t)
+    { 302, 93, 51, VSOP87A_FIXED_SERIES(Y, 1) },  // 0.00001885393 * cos(0.29905973710 + 1581.95934828300 * t)
+    { 254, -17, 30, VSOP87A_FIXED_SERIES(Y, 1) },  // 0.00001516541 * cos(6.21684203571 + 639.89728631400 * t)
+    { 270, -52, 39, VSOP87A_FIXED_SERIES(Y, 1) },  // 0.00001636913 * cos(6.09270756447 + 1045.15483618760 * t)
+    { 211, 15, 28, VSOP87A_FIXED_SERIES(Y, 1) },  // 0.00001260123 * cos(0.07143173954 + 625.67019231240 * t)
+    { 93, 145, 16, VSOP87A_FIXED_SERIES(Y, 1) },  // 0.00001028165 * cos(1.00301485824 + 433.71173787680 * t)
+    { 96, 145, 46, VSOP87A_FIXED_SERIES(Y, 1) },  // 0.00001035933 * cos(0.98273794152 + 1265.56747862640 * t)
+    { -17444, 11345, 18, VSOP87A_FIXED_SERIES(Y, 2) | VSOP87A_FIXED_MICRO },  // 0.00124032509 * cos(2.56495576833 + 522.57741809380 * t)
+    { 4280, -19922, 26, VSOP87A_FIXED_SERIES(Y, 2) | VSOP87A_FIXED_MICRO },  // 0.00121455991 * cos(4.92398766380 + 536.80451209540 * t)
+    { -10467, -7434, 22, VSOP87A_FIXED_SERIES(Y, 2) | VSOP87A_FIXED_MICRO },  // 0.00076523263 * cos(3.75913371793 + 529.69096509460 * t)
+    { -12909, 0, 0, VSOP87A_FIXED_SERIES(Y, 2) | VSOP87A_FIXED_MICRO },  // 0.00076943042 * cos(3.14159265359 + 0.00000000000 * t)
+    { -6362, -2770, 41, VSOP87A_FIXED_SERIES(Y, 2) | VSOP87A_FIXED_MICRO },  // 0.00041357600 * cos(3.55228440457 + 1059.38193018920 * t)
+    { 1860, 349, 1, VSOP87A_FIXED_SERIES(Y, 2) | VSOP87A_FIXED_MICRO },  // 0.00011277667 * cos(0.18559902389 + 7.11354700080 * t)
+    { 799, -872, 42, VSOP87A_FIXED_SERIES(Y, 2) },  // 0.00007051103 * cos(5.45404368570 + 1066.49547719000 * t)
+    { -451, 847, 40, VSOP87A_FIXED_SERIES(Y, 2) },  // 0.00005719440 * cos(2.05970000230 + 1052.26838318840 * t)
+    { -800, 383, 17, VSOP87A_FIXED_SERIES(Y, 2) },  // 0.00005286157 * cos(2.69490465064 + 515.46387109300 * t)
+    { -436, -519, 52, VSOP87A_FIXED_SERIES(Y, 2) },  // 0.00004039038 * cos(4.01341034637 + 1589.07289528380 * t)
+    { 48, -620, 27, VSOP87A_FIXED_SERIES(Y, 2) },  // 0.00003704528 * cos(4.79029292271 + 543.91805909620 * t)
+    { 20, 214, 6, VSOP87A_FIXED_SERIES(Y, 2) },  // 0.00001280283 * cos(1.47574006861 + 110.20632121940 * t)
+    { 111, 139, 15, VSOP87A_FIXED_SERIES(Y, 2) },  // 0.00001059783 * cos(0.89610748176 + 426.59819087600 * t)
+    { 221, 13, 2, VSOP87A_FIXED_SERIES(Y, 2) },  // 0.00001320627 * cos(0.05786048417 + 14.22709400160 * t)
+    { -1173, -2616, 18, VSOP87A_FIXED_SERIES(Y, 3) | VSOP87A_FIXED_MICRO },  // 0.00017085516 * cos(4.29096904063 + 522.57741809380 * t)
+    { -2797, -174, 26, VSOP87A_FIXED_SERIES(Y, 3) | VSOP87A_FIXED_MICRO },  // 0.00016701353 * cos(3.20365737109 + 536.80451209540 * t)
+    { 672, 0, 0, VSOP87A_FIXED_SERIES(Y, 3) },  // 0.00004006038 * cos(0.00000000000 + 0.00000000000 * t)
+    { -122, 273, 41, VSOP87A_FIXED_SERIES(Y, 3) },  // 0.00001782451 * cos(1.99283071153 + 1059.38193018920 * t)
+    { -72, -231, 17, VSOP87A_FIXED_SERIES(Y, 3) },  // 0.00001443816 * cos(4.40866555269 + 515.46387109300 * t)
+    { -137, -118, 42, VSOP87A_FIXED_SERIES(Y, 3) },  // 0.00001079405 * cos(3.85450799252 + 1066.49547719000 * t)
+    { -170, 11, 27, VSOP87A_FIXED_SERIES(Y, 3) },  // 0.00001013157 * cos(3.07729621279 + 543.91805909620 * t)
+    { -2, -177, 1, VSOP87A_FIXED_SERIES(Y, 3) },  // 0.00001055565 * cos(4.70184773789 + 7.11354700080 * t)
+    { 287, -71, 18, VSOP87A_FIXED_SERIES(Y, 4) },  // 0.00001762645 * cos(6.04159386554 + 522.57741809380 * t)
+    { 31, 286, 26, VSOP87A_FIXED_SERIES(Y, 4) },  // 0.00001716045 * cos(1.46206285710 + 536.80451209540 * t)
+    { -1813727, -803126, 22, VSOP87A_FIXED_SERIES(Z, 0) | VSOP87A_FIXED_MICRO },  // 0.11823100489 * cos(3.55844646343 + 529.69096509460 * t)
+    { 144122, 0, 0, VSOP87A_FIXED_SERIES(Z, 0) | VSOP87A_FIXED_MICRO },  // 0.00859031952 * cos(0.00000000000 + 0.00000000000 * t)
+    { -34631, -33348, 41, VSOP87A_FIXED_SERIES(Z, 0) | VSOP87A_FIXED_MICRO },  // 0.00286562094 * cos(3.90812238338 + 1059.38193018920 * t)
+    { -6373, -3156, 18, VSOP87A_FIXED_SERIES(Z, 0) | VSOP87A_FIXED_MICRO },  // 0.00042388592 * cos(3.60144191032 + 522.57741809380 * t)
+    { 5332, 1667, 26, VSOP87A_FIXED_SERIES(Z, 0) | VSOP87A_FIXED_MICRO },  // 0.00033295491 * cos(0.30297050585 + 536.80451209540 * t)
+    { -768, -1570, 52, VSOP87A_FIXED_SERIES(Z, 0) | VSOP87A_FIXED_MICRO },  // 0.00010416160 * cos(4.25764593061 + 1589.07289528380 * t)
+    { 632, -1078, 5, VSOP87A_FIXED_SERIES(Z, 0) },  // 0.00007449294 * cos(5.24213104150 + 103.09277421860 * t)
+    { -207, 1141, 1, VSOP87A_FIXED_SERIES(Z, 0) },  // 0.00006910102 * cos(1.75032945752 + 7.11354700080 * t)
+    { -99, 882, 15, VSOP87A_FIXED_SERIES(Z, 0) },  // 0.00005292012 * cos(1.68231447192 + 426.59819087600 * t)
+    { -611, -388, 9, VSOP87A_FIXED_SERIES(Z, 0) },  // 0.00004313598 * cos(3.70673689841 + 213.29909543800 * t)
+    { -578, 263, 6, VSOP87A_FIXED_SERIES(Z, 0) },  // 0.00003784265 * cos(2.71522544491 + 110.20632121940 * t)
+    { -358, 527, 29, VSOP87A_FIXED_SERIES(Z, 0) },  // 0.00003798016 * cos(2.16715743175 + 632.78373931320 * t)
+    { -406, 71, 40, VSOP87A_FIXED_SERIES(Z, 0) },  // 0.00002455385 * cos(2.96904135659 + 1052.26838318840 * t)
+    { -409, 59, 44, VSOP87A_FIXED_SERIES(Z, 0) },  // 0.00002461547 * cos(2.99889460411 + 1162.47470440780 * t)
+    { -301, 148, 14, VSOP87A_FIXED_SERIES(Z, 0) },  // 0.00002001451 * cos(2.68535838309 + 419.48464387520 * t)
+    { 363, -6, 34, VSOP87A_FIXED_SERIES(Z, 0) },  // 0.00002163471 * cos(6.26718259854 + 846.08283475120 * t)
+    { 220, 164, 42, VSOP87A_FIXED_SERIES(Z, 0) },  // 0.00001633653 * cos(0.64194743493 + 1066.49547719000 * t)
+    { 95, 224, 37, VSOP87A_FIXED_SERIES(Z, 0) },  // 0.00001450672 * cos(1.17108416193 + 949.17560896980 * t)
+    { 2991, 68230, 22, VSOP87A_FIXED_SERIES(Z, 1) | VSOP87A_FIXED_MICRO },  // 0.00407072175 * cos(1.52699353482 + 529.69096509460 * t)
+    { -2917, 1760, 41, VSOP87A_FIXED_SERIES(Z, 1) | VSOP87A_FIXED_MICRO },  // 0.00020307341 * cos(2.59878269248 + 1059.38193018920 * t)
+    { 342, -2396, 26, VSOP87A_FIXED_SERIES(Z, 1) | VSOP87A_FIXED_MICRO },  // 0.00014424953 * cos(4.85400155025 + 536.80451209540 * t)
+    { 2596, 0, 0, VSOP87A_FIXED_SERIES(Z, 1) | VSOP87A_FIXED_MICRO },  // 0.00015474611 * cos(0.00000000000 + 0.00000000000 * t)
+    { 1445, -1573, 18, VSOP87A_FIXED_SERIES(Z, 1) | VSOP87A_FIXED_MICRO },  // 0.00012730364 * cos(5.45536715732 + 522.57741809380 * t)
+    { 351, 34, 1, VSOP87A_FIXED_SERIES(Z, 1) },  // 0.00002100882 * cos(0.09538864287 + 7.11354700080 * t)
+    { -206, 0, 52, VSOP87A_FIXED_SERIES(Z, 1) },  // 0.00001230425 * cos(3.14222500244 + 1589.07289528380 * t)
+    { -4765, 613, 22, VSOP87A_FIXED_SERIES(Z, 2) | VSOP87A_FIXED_MICRO },  // 0.00028635326 * cos(3.01374166973 + 529.69096509460 * t)
+    { -523, 5, 26, VSOP87A_FIXED_SERIES(Z, 2) },  // 0.00003114752 * cos(3.13228646176 + 536.80451209540 * t)
+    { 230, 326, 18, VSOP87A_FIXED_SERIES(Z, 2) },  // 0.00002379765 * cos(0.95574345340 + 522.57741809380 * t)
+    { -102, 195, 41, VSOP87A_FIXED_SERIES(Z, 2) },  // 0.00001310111 * cos(2.05263704913 + 1059.38193018920 * t)
+};
+
+// saturn: 435 terms (179 at micro precision) over 96 frequencies, 10 of them computed directly
+static const int64_t _vsop87a_fixed_saturn_rates[] = {
+    182071478LL,
+    390199870LL,
+    482280981LL,
+    1172690355LL,
+    4677039936LL,
+    6462484728LL,
+    11771910397LL,
+    26097329898LL,
+    26155353539LL,
+    26167173159LL,
+};
+static const vsop87a_fixed_frequency_t _vsop87a_fixed_saturn_frequencies[] = {
+    { VSOP87A_FIXED_OP_ZERO | VSOP87A_FIXED_MICRO, 0, 0 },
+    { VSOP87A_FIXED_OP_BASE, 0, 0 },
+    { VSOP87A_FIXED_OP_BASE | VSOP87A_FIXED_MICRO, 1, 0 },
+    { VSOP87A_FIXED_OP_BASE | VSOP87A_FIXED_MICRO, 2, 0 },
+    { VSOP87A_FIXED_OP_SUM | VSOP87A_FIXED_MICRO, 3, 2 },
+    { VSOP87A_FIXED_OP_BASE, 3, 0 },
+    { VSOP87A_FIXED_OP_SUM | VSOP87A_FIXED_MICRO, 4, 3 },
+    { VSOP87A_FIXED_OP_SUM, 6, 1 },
+    { VSOP87A_FIXED_OP_SUM | VSOP87A_FIXED_MICRO, 4, 4 },
+    { VSOP87A_FIXED_OP_BASE, 4, 0 },
+    { VSOP87A_FIXED_OP_BASE | VSOP87A_FIXED_MICRO, 5, 0 },
+    { VSOP87A_FIXED_OP_SUM | VSOP87A_FIXED_MICRO, 10, 6 },
+    { VSOP87A_FIXED_OP_SUM | VSOP87A_FIXED_MICRO, 11, 6 },
+    { VSOP87A_FIXED_OP_SUM, 9, 9 },
+    { VSOP87A_FIXED_OP_SUM | VSOP87A_FIXED_MICRO, 12, 6 },
+    { VSOP87A_FIXED_OP_BASE | VSOP87A_FIXED_MICRO, 6, 0 },
+    { VSOP87A_FIXED_OP_SUM | VSOP87A_FIXED_MICRO, 15, 4 },
+    { VSOP87A_FIXED_OP_SUM | VSOP87A_FIXED_MICRO, 15, 8 },
+    { VSOP87A_FIXED_OP_SUM | VSOP87A_FIXED_MICRO, 16, 8 },
+    { VSOP87A_FIXED_OP_SUM | VSOP87A_FIXED_MICRO, 11, 11 },
+    { VSOP87A_FIXED_OP_SUM, 19, 5 },
+    { VSOP87A_FIXED_OP_SUM | VSOP87A_FIXED_MICRO, 12, 11 },
+    { VSOP87A_FIXED_OP_SUM | VSOP87A_FIXED_MICRO, 12, 12 },
+    { VSOP87A_FIXED_OP_SUM | VSOP87A_FIXED_MICRO, 17, 11 },
+    { VSOP87A_FIXED_OP_SUM | VSOP87A_FIXED_MICRO, 16, 15 },
+    { VSOP87A_FIXED_OP_SUM, 20, 11 },
+    { VSOP87A_FIXED_OP_SUM | VSOP87A_FIXED_MICRO, 19, 12 },
+    { VSOP87A_FIXED_OP_SUM, 19, 13 },
+    { VSOP87A_FIXED_OP_SUM | VSOP87A_FIXED_MICRO, 16, 16 },
+    { VSOP87A_FIXED_OP_SUM | VSOP87A_FIXED_MICRO, 26, 4 },
+    { VSOP87A_FIXED_OP_SUM | VSOP87A_FIXED_MICRO, 24, 6 },
+    { VSOP87A_FIXED_OP_SUM, 27, 4 },
+    { VSOP87A_FIXED_OP_SUM, 31, 1 },
+    { VSOP87A_FIXED_OP_BASE, 7, 0 },
+    { VSOP87A_FIXED_OP_BASE, 8, 0 },
+    { VSOP87A_FIXED_OP_SUM | VSOP87A_FIXED_MICRO, 17, 16 },
+    { VSOP87A_FIXED_OP_BASE, 9, 0 },
+    { VSOP87A_FIXED_OP_SUM, 32, 1 },
+    { VSOP87A_FIXED_OP_SUM, 33, 1 },
+    { VSOP87A_FIXED_OP_SUM, 28, 5 },
+    { VSOP87A_FIXED_OP_SUM | VSOP87A_FIXED_MICRO, 26, 8 },
+    { VSOP87A_FIXED_OP_SUM | VSOP87A_FIXED_MICRO, 28, 6 },
+    { VSOP87A_FIXED_OP_SUM | VSOP87A_FIXED_MICRO, 17, 17 },
+    { VSOP87A_FIXED_OP_SUM, 20, 14 },
+    { VSOP87A_FIXED_OP_SUM | VSOP87A_FIXED_MICRO, 21, 14 },
+    { VSOP87A_FIXED_OP_SUM, 22, 13 },
+    { VSOP87A_FIXED_OP_SUM | VSOP87A_FIXED_MICRO, 18, 17 },
+    { VSOP87A_FIXED_OP_SUM, 18, 18 },
+    { VSOP87A_FIXED_OP_SUM | VSOP87A_FIXED_MICRO, 21, 19 },
+    { VSOP87A_FIXED_OP_SUM | VSOP87A_FIXED_MICRO, 21, 21 },
+    { VSOP87A_FIXED_OP_SUM, 22, 21 },
+    { VSOP87A_FIXED_OP_SUM | VSOP87A_FIXED_MICRO, 24, 17 },
+    { VSOP87A_FIXED_OP_SUM | VSOP87A_FIXED_MICRO, 24, 18 },
+    { VSOP87A_FIXED_OP_SUM | VSOP87A_FIXED_MICRO, 23, 22 },
+    { VSOP87A_FIXED_OP_SUM, 35, 18 },
+    { VSOP87A_FIXED_OP_SUM, 26, 21 },
+    { VSOP87A_FIXED_OP_SUM, 25, 22 },
+    { VSOP87A_FIXED_OP_SUM | VSOP87A_FIXED_MICRO, 26, 22 },
+    { VSOP87A_FIXED_OP_SUM, 35, 22 },
+    { VSOP87A_FIXED_OP_SUM, 56, 9 },
+    { VSOP87A_FIXED_OP_SUM | VSOP87A_FIXED_MICRO, 28, 28 },
+    { VSOP87A_FIXED_OP_SUM | VSOP87A_FIXED_MICRO, 29, 28 },
+    { VSOP87A_FIXED_OP_SUM | VSOP87A_FIXED_MICRO, 30, 29 },
+    { VSOP87A_FIXED_OP_SUM, 35, 29 },
+    { VSOP87A_FIXED_OP_SUM, 35, 30 },
+    { VSOP87A_FIXED_OP_SUM | VSOP87A_FIXED_MICRO, 35, 35 },
+    { VSOP87A_FIXED_OP_SUM, 40, 35 },
+    { VSOP87A_FIXED_OP_SUM, 41, 35 },
+    { VSOP87A_FIXED_OP_SUM | VSOP87A_FIXED_MICRO, 41, 40 },
+    { VSOP87A_FIXED_OP_SUM, 42, 41 },
+    { VSOP87A_FIXED_OP_SUM, 42, 42 },
+    { VSOP87A_FIXED_OP_SUM | VSOP87A_FIXED_MICRO, 48, 44 },
+    { VSOP87A_FIXED_OP_SUM | VSOP87A_FIXED_MICRO, 51, 35 },
+    { VSOP87A_FIXED_OP_SUM | VSOP87A_FIXED_MICRO, 51, 42 },
+    { VSOP87A_FIXED_OP_SUM, 51, 46 },
+    { VSOP87A_FIXED_OP_SUM, 52, 51 },
+    { VSOP87A_FIXED_OP_SUM, 55, 50 },
+    { VSOP87A_FIXED_OP_SUM | VSOP87A_FIXED_MICRO, 52, 52 },
+    { VSOP87A_FIXED_OP_SUM | VSOP87A_FIXED_MICRO, 53, 52 },
+    { VSOP87A_FIXED_OP_SUM | VSOP87A_FIXED_MICRO, 53, 53 },
+    { VSOP87A_FIXED_OP_SUM, 57, 57 },
+    { VSOP87A_FIXED_OP_SUM | VSOP87A_FIXED_MICRO, 60, 53 },
+    { VSOP87A_FIXED_OP_SUM, 60, 54 },
+    { VSOP87A_FIXED_OP_SUM, 62, 62 },
+    { VSOP87A_FIXED_OP_SUM, 64, 63 },
+    { VSOP87A_FIXED_OP_SUM | VSOP87A_FIXED_MICRO, 65, 65 },
+    { VSOP87A_FIXED_OP_SUM, 67, 66 },
+    { VSOP87A_FIXED_OP_SUM, 72, 62 },
+    { VSOP87A_FIXED_OP_SUM, 72, 65 },
+    { VSOP87A_FIXED_OP_SUM, 73, 72 },
+    { VSOP87A_FIXED_OP_SUM | VSOP87A_FIXED_MICRO, 73, 73 },
+    { VSOP87A_FIXED_OP_SUM, 74, 73 },
+    { VSOP87A_FIXED_OP_SUM, 75, 73 },
+    { VSOP87A_FIXED_OP_SUM, 81, 77 },
+    { VSOP87A_FIXED_OP_SUM, 81, 81 },
+    { VSOP87A_FIXED_OP_SUM, 84, 83 },
+};
+static const vsop87a_fixed_term_t _vsop87a_fixed_saturn_terms[] = {
+    { 102412362, 122484770, 35, VSOP87A_FIXED_SERIES(X, 0) | VSOP87A_FIXED_MICRO },  // 9.51638335797 * cos(0.87441380794 + 213.29909543800 * t)
+    { 4397287, 547669, 65, VSOP87A_FIXED_SERIES(X, 0) | VSOP87A_FIXED_MICRO },  // 0.26412374238 * cos(0.12390892620 + 426.59819087600 * t)
+    { -587722, -970062, 28, VSOP87A_FIXED_SERIES(X, 0) | VSOP87A_FIXED_MICRO },  // 0.06760430339 * cos(4.16767145778 + 206.18554843720 * t)
+    { 812456, 758320, 42, VSOP87A_FIXED_SERIES(X, 0) | VSOP87A_FIXED_MICRO },  // 0.06624260115 * cos(0.75094737780 + 220.41264243880 * t)
+    { 712159, 0, 0, VSOP87A_FIXED_SERIES(X, 0) | VSOP87A_FIXED_MICRO },  // 0.04244797817 * cos(0.00000000000 + 0.00000000000 * t)
+    { -171017, 352698, 4, VSOP87A_FIXED_SERIES(X, 0) | VSOP87A_FIXED_MICRO },  // 0.02336340488 * cos(2.02227784673 + 7.11354700080 * t)
+    { -119373, 173520, 17, VSOP87A_FIXED_SERIES(X, 0) | VSOP87A_FIXED_MICRO },  // 0.01255372247 * cos(2.17338917731 + 110.20632121940 * t)
+    { -187159, -2859, 62, VSOP87A_FIXED_SERIES(X, 0) | VSOP87A_FIXED_MICRO },  // 0.01115684467 * cos(3.15686878377 + 419.48464387520 * t)
+    { 149277, -107849, 78, VSOP87A_FIXED_SERIES(X, 0) | VSOP87A_FIXED_MICRO },  // 0.01097683232 * cos(5.65753337256 + 639.89728631400 * t)
+    { -109235, 50110, 52, VSOP87A_FIXED_SERIES(X, 0) | VSOP87A_FIXED_MICRO },  // 0.00716328481 * cos(2.71149993708 + 316.39186965660 * t)
+    { 20831, -82871, 16, VSOP87A_FIXED_SERIES(X, 0) | VSOP87A_FIXED_MICRO },  // 0.00509313365 * cos(4.95865624780 + 103.09277421860 * t)
+    { 54734, 48018, 73, VSOP87A_FIXED_SERIES(X, 0) | VSOP87A_FIXED_MICRO },  // 0.00433994439 * cos(0.72012820974 + 529.69096509460 * t)
+    { 62561, 86, 68, VSOP87A_FIXED_SERIES(X, 0) | VSOP87A_FIXED_MICRO },  // 0.00372894461 * cos(0.00137195497 + 433.71173787680 * t)
+    { 8663, 13943, 53, VSOP87A_FIXED_SERIES(X, 0) | VSOP87A_FIXED_MICRO },  // 0.00097843523 * cos(1.01485750417 + 323.50541665740 * t)
+    { 10665, -8314, 6, VSOP87A_FIXED_SERIES(X, 0) | VSOP87A_FIXED_MICRO },  // 0.00080600536 * cos(5.62103979796 + 11.04570026390 * t)
+    { 11437, 8172, 46, VSOP87A_FIXED_SERIES(X, 0) | VSOP87A_FIXED_MICRO },  // 0.00083782316 * cos(0.62038893702 + 227.52618943960 * t)
+    { -9021, 8566, 77, VSOP87A_FIXED_SERIES(X, 0) | VSOP87A_FIXED_MICRO },  // 0.00074150224 * cos(2.38206066655 + 632.78373931320 * t)
+    { 7434, 9139, 29, VSOP87A_FIXED_SERIES(X, 0) | VSOP87A_FIXED_MICRO },  // 0.00070219382 * cos(0.88789752415 + 209.36694217490 * t)
+    { -7393, -8876, 41, VSOP87A_FIXED_SERIES(X, 0) | VSOP87A_FIXED_MICRO },  // 0.00068855792 * cos(4.01788097627 + 217.23124870110 * t)
+    { -9940, 4732, 26, VSOP87A_FIXED_SERIES(X, 0) | VSOP87A_FIXED_MICRO },  // 0.00065620467 * cos(2.69728593339 + 202.25339517410 * t)
+    { -5448, 8123, 44, VSOP87A_FIXED_SERIES(X, 0) | VSOP87A_FIXED_MICRO },  // 0.00058297911 * cos(2.16155251399 + 224.34479570190 * t)
+    { 1773, -8888, 85, VSOP87A_FIXED_SERIES(X, 0) | VSOP87A_FIXED_MICRO },  // 0.00054022837 * cos(4.90928184374 + 853.19638175200 * t)
+    { -2343, 7274, 8, VSOP87A_FIXED_SERIES(X, 0) | VSOP87A_FIXED_MICRO },  // 0.00045550446 * cos(1.88235037830 + 14.22709400160 * t)
+    { -1988, -6118, 24, VSOP87A_FIXED_SERIES(X, 0) | VSOP87A_FIXED_MICRO },  // 0.00038345667 * cos(4.39815501478 + 199.07200143640 * t)
+    { 5833, -4674, 11, VSOP87A_FIXED_SERIES(X, 0) | VSOP87A_FIXED_MICRO },  // 0.00044551703 * cos(5.60763553535 + 63.73589830340 * t)
+    { 3924, 1558, 40, VSOP87A_FIXED_SERIES(X, 0) | VSOP87A_FIXED_MICRO },  // 0.00025165185 * cos(0.37800582257 + 216.48048917570 * t)
+    { -741, -4052, 30, VSOP87A_FIXED_SERIES(X, 0) | VSOP87A_FIXED_MICRO },  // 0.00024554499 * cos(4.53150598095 + 210.11770170030 * t)
+    { 3853, -1513, 72, VSOP87A_FIXED_SERIES(X, 0) | VSOP87A_FIXED_MICRO },  // 0.00024673219 * cos(5.90891573850 + 522.57741809380 * t)
+    { 3221, -2601, 61, VSOP87A_FIXED_SERIES(X, 0) | VSOP87A_FIXED_MICRO },  // 0.00024677050 * cos(5.60389382420 + 415.55249061210 * t)
+    { -292, 4267, 18, VSOP87A_FIXED_SERIES(X, 0) | VSOP87A_FIXED_MICRO },  // 0.00025491374 * cos(1.63922423181 + 117.31986822020 * t)
+    { -433, -5226, 81, VSOP87A_FIXED_SERIES(X, 0) | VSOP87A_FIXED_MICRO },  // 0.00031253049 * cos(4.62976601833 + 735.87651353180 * t)
+    { 2874, -2668, 79, VSOP87A_FIXED_SERIES(X, 0) | VSOP87A_FIXED_MICRO },  // 0.00023372467 * cos(5.53491987276 + 647.01083331480 * t)
+    { 3849, 732, 22, VSOP87A_FIXED_SERIES(X, 0) | VSOP87A_FIXED_MICRO },  // 0.00023355468 * cos(0.18791490124 + 149.56319713460 * t)
+    { 2959, -2927, 12, VSOP87A_FIXED_SERIES(X, 0) | VSOP87A_FIXED_MICRO },  // 0.00024805815 * cos(5.50327676733 + 74.78159856730 * t)
+    { -80, -2470, 49, VSOP87A_FIXED_SERIES(X, 0) | VSOP87A_FIXED_MICRO },  // 0.00014731703 * cos(4.67981909838 + 277.03499374140 * t)
+    { 1073, 1787, 90, VSOP87A_FIXED_SERIES(X, 0) | VSOP87A_FIXED_MICRO },  // 0.00012427525 * cos(1.02995545746 + 1059.38193018920 * t)
+    { 1106, 1249, 3, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00009943329 * cos(0.84628387596 + 3.93215326310 * t)
+    { -1024, -1810, 71, VSOP87A_FIXED_SERIES(X, 0) | VSOP87A_FIXED_MICRO },  // 0.00012393514 * cos(4.19747622821 + 490.33408917940 * t)
+    { 1643, -1171, 57, VSOP87A_FIXED_SERIES(X, 0) | VSOP87A_FIXED_MICRO },  // 0.00012026472 * cos(5.66372282839 + 351.81659230870 * t)
+    { -1087, 849, 82, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00008222014 * cos(2.47875301104 + 742.99006053260 * t)
+    { -562, -1417, 89, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00009087093 * cos(4.33505326762 + 1052.26838318840 * t)
+    { 814, -780, 83, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00006717741 * cos(5.51897460997 + 838.96928775040 * t)
+    { -811, 660, 84, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00006232999 * cos(2.45837758015 + 846.08283475120 * t)
+    { -689, 984, 15, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00007161671 * cos(2.18152751738 + 95.97922721780 * t)
+    { 709, 789, 51, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00006321101 * cos(0.83915408770 + 309.27832265580 * t)
+    { 1011, -126, 70, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00006074958 * cos(6.15905897331 + 440.82528487760 * t)
+    { -804, -397, 60, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00005343894 * cos(3.60046273598 + 412.37109687440 * t)
+    { 787, 213, 74, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00004860582 * cos(0.26461045175 + 536.80451209540 * t)
+    { 543, -803, 9, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00005775802 * cos(5.30717695229 + 38.13303563780 * t)
+    { -144, -859, 31, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00005194178 * cos(4.54584467686 + 210.85141488320 * t)
+    { 813, 294, 39, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00005152474 * cos(0.34669517150 + 215.74677599280 * t)
+    { 611, -179, 63, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00003792540 * cos(5.99766568983 + 422.66603761290 * t)
+    { -528, -346, 32, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00003762834 * cos(3.72112920226 + 212.33588759150 * t)
+    { 245, 579, 38, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00003747433 * cos(1.16965137714 + 214.26230328450 * t)
+    { 346, 391, 34, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00003114576 * cos(0.84631897292 + 213.25091132820 * t)
+    { -324, -410, 36, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00003113641 * cos(4.04410367190 + 213.34727954780 * t)
+    { 501, 21, 75, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00002990421 * cos(0.04148806852 + 625.67019231240 * t)
+    { 654, -218, 20, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00004111695 * cos(5.96153153046 + 137.03302416240 * t)
+    { 314, -386, 21, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00002966450 * cos(5.39568820046 + 138.51749687070 * t)
+    { 353, 317, 54, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00002827527 * cos(0.73252555642 + 330.61896365820 * t)
+    { 84, 558, 69, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00003363323 * cos(1.42089586686 + 437.64389113990 * t)
+    { 202, 440, 14, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00002886599 * cos(1.14057922619 + 85.82729883120 * t)
+    { 283, -340, 50, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00002634075 * cos(5.40645201521 + 288.08069400530 * t)
+    { 258, 375, 27, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00002713354 * cos(0.96812639712 + 203.73786788240 * t)
+    { 462, -263, 13, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00003169390 * cos(5.76640408988 + 76.26607127560 * t)
+    { 309, -312, 19, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00002618634 * cos(5.49334837098 + 127.47179660680 * t)
+    { 159, -393, 76, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00002527746 * cos(5.09752068381 + 628.85158605010 * t)
+    { -265, -426, 91, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00002989778 * cos(4.15673836604 + 1066.49547719000 * t)
+    { 32, 419, 5, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00002507415 * cos(1.49447138038 + 9.56122755560 * t)
+    { 221, -351, 92, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00002470181 * cos(5.27435870056 + 1155.36115740700 * t)
+    { -274, -301, 43, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00002427626 * cos(3.97311214231 + 222.86032299360 * t)
+    { -321, -415, 93, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00003128325 * cos(4.05483976553 + 1368.66025284500 * t)
+    { -333, -198, 67, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00002309076 * cos(3.67821438247 + 430.53034413910 * t)
+    { -360, -46, 55, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00002162629 * cos(3.26951119901 + 340.77089204480 * t)
+    { -96, 479, 2, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00002912676 * cos(1.76893577106 + 3.18139373770 * t)
+    { -322, -142, 64, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00002095366 * cos(3.55759089756 + 423.41679713830 * t)
+    { 358, -158, 59, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00002335270 * cos(5.86791072516 + 388.46515523820 * t)
+    { -46, -270, 7, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00001634262 * cos(4.54357767539 + 12.53017297220 * t)
+    { -161, 222, 33, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00001635975 * cos(2.19968869780 + 212.77783057620 * t)
+    { -247, 119, 37, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00001632759 * cos(2.69164822165 + 213.82036029980 * t)
+    { -225, -112, 10, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00001498689 * cos(3.60168057129 + 52.69019803950 * t)
+    { 230, -86, 66, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00001461217 * cos(5.92456743836 + 429.77958461370 * t)
+    { -152, 292, 1, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00001963947 * cos(2.05086487180 + 1.48447270830 * t)
+    { 19, -257, 86, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00001538425 * cos(4.78544077085 + 860.30992875280 * t)
+    { 202, -146, 88, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00001485856 * cos(5.65501463408 + 949.17560896980 * t)
+    { 154, -182, 56, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00001418116 * cos(5.41419993599 + 350.33211960040 * t)
+    { 189, 37, 87, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00001147607 * cos(0.19147238521 + 942.06206196900 * t)
+    { 166, 86, 47, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00001111703 * cos(0.47907488492 + 234.63973644040 * t)
+    { 50, -164, 94, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00001019566 * cos(5.00707811029 + 1471.75302706360 * t)
+    { 38, 165, 48, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00001009190 * cos(1.34289487761 + 265.98929347750 * t)
+    { 164, -81, 58, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00001089450 * cos(5.82690672710 + 362.86229257260 * t)
+    { 77, 166, 23, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00001092244 * cos(1.13561107749 + 173.94221952280 * t)
+    { -156, -120, 95, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00001173456 * cos(3.79591687208 + 1685.05212250160 * t)
+    { -178, -60, 80, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00001118369 * cos(3.46624149583 + 703.63318461740 * t)
+    { -159, -110, 25, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00001150595 * cos(3.74707160019 + 200.76892246580 * t)
+    { 78, 150, 45, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00001007761 * cos(1.08964371328 + 225.82926841020 * t)
+    { 1270892, 0, 0, VSOP87A_FIXED_SERIES(X, 1) | VSOP87A_FIXED_MICRO },  // 0.07575103962 * cos(0.00000000000 + 0.00000000000 * t)
+    { -218928, -469003, 65, VSOP87A_FIXED_SERIES(X, 1) | VSOP87A_FIXED_MICRO },  // 0.03085041716 * cos(4.27565749128 + 426.59819087600 * t)
+    { 413853, -190248, 28, VSOP87A_FIXED_SERIES(X, 1) | VSOP87A_FIXED_MICRO },  // 0.02714918399 * cos(5.85229412397 + 206.18554843720 * t)
+    { 257845, -360769, 42, VSOP87A_FIXED_SERIES(X, 1) | VSOP87A_FIXED_MICRO },  // 0.02643100909 * cos(5.33291950584 + 220.41264243880 * t)
+    { 99568, 33992, 4, VSOP87A_FIXED_SERIES(X, 1) | VSOP87A_FIXED_MICRO },  // 0.00627104520 * cos(0.32898307969 + 7.11354700080 * t)
+    { -39922, -16094, 78, VSOP87A_FIXED_SERIES(X, 1) | VSOP87A_FIXED_MICRO },  // 0.00256560953 * cos(3.52478934343 + 639.89728631400 * t)
+    { 6150, -52043, 62, VSOP87A_FIXED_SERIES(X, 1) | VSOP87A_FIXED_MICRO },  // 0.00312356512 * cos(4.83001724941 + 419.48464387520 * t)
+    { -7112, -30935, 68, VSOP87A_FIXED_SERIES(X, 1) | VSOP87A_FIXED_MICRO },  // 0.00189196274 * cos(4.48642453552 + 433.71173787680 * t)
+    { 15193, 30602, 35, VSOP87A_FIXED_SERIES(X, 1) | VSOP87A_FIXED_MICRO },  // 0.00203646570 * cos(1.10998681782 + 213.29909543800 * t)
+    { 8240, 18283, 17, VSOP87A_FIXED_SERIES(X, 1) | VSOP87A_FIXED_MICRO },  // 0.00119531145 * cos(1.14735096078 + 110.20632121940 * t)
+    { -9358, -6156, 52, VSOP87A_FIXED_SERIES(X, 1) | VSOP87A_FIXED_MICRO },  // 0.00066764238 * cos(3.72346596928 + 316.39186965660 * t)
+    { 5284, -9902, 46, VSOP87A_FIXED_SERIES(X, 1) | VSOP87A_FIXED_MICRO },  // 0.00066901225 * cos(5.20257500380 + 227.52618943960 * t)
+    { 5073, -1148, 24, VSOP87A_FIXED_SERIES(X, 1) | VSOP87A_FIXED_MICRO },  // 0.00031000840 * cos(6.06067919437 + 199.07200143640 * t)
+    { 5014, 951, 8, VSOP87A_FIXED_SERIES(X, 1) | VSOP87A_FIXED_MICRO },  // 0.00030418100 * cos(0.18746903351 + 14.22709400160 * t)
+    { 3723, -328, 16, VSOP87A_FIXED_SERIES(X, 1) | VSOP87A_FIXED_MICRO },  // 0.00022275210 * cos(6.19530878014 + 103.09277421860 * t)
+    { -2968, 1135, 85, VSOP87A_FIXED_SERIES(X, 1) | VSOP87A_FIXED_MICRO },  // 0.00018939377 * cos(2.77618306725 + 853.19638175200 * t)
+    { 1124, -2820, 29, VSOP87A_FIXED_SERIES(X, 1) | VSOP87A_FIXED_MICRO },  // 0.00018093009 * cos(5.09162723865 + 209.36694217490 * t)
+    { 2935, -532, 41, VSOP87A_FIXED_SERIES(X, 1) | VSOP87A_FIXED_MICRO },  // 0.00017777854 * cos(6.10381593351 + 217.23124870110 * t)
+    { 428, -2700, 40, VSOP87A_FIXED_SERIES(X, 1) | VSOP87A_FIXED_MICRO },  // 0.00016296201 * cos(4.86945681437 + 216.48048917570 * t)
+    { -333, -2853, 77, VSOP87A_FIXED_SERIES(X, 1) | VSOP87A_FIXED_MICRO },  // 0.00017120250 * cos(4.59611664188 + 632.78373931320 * t)
+    { 2665, 97, 30, VSOP87A_FIXED_SERIES(X, 1) | VSOP87A_FIXED_MICRO },  // 0.00015894491 * cos(0.03653502304 + 210.11770170030 * t)
+    { 2121, -1698, 53, VSOP87A_FIXED_SERIES(X, 1) | VSOP87A_FIXED_MICRO },  // 0.00016192653 * cos(5.60798014450 + 323.50541665740 * t)
+    { -2090, -1233, 79, VSOP87A_FIXED_SERIES(X, 1) | VSOP87A_FIXED_MICRO },  // 0.00014466010 * cos(3.67449380090 + 647.01083331480 * t)
+    { 1855, 59, 18, VSOP87A_FIXED_SERIES(X, 1) | VSOP87A_FIXED_MICRO },  // 0.00011061528 * cos(0.03163071461 + 117.31986822020 * t)
+    { 777, -1463, 26, VSOP87A_FIXED_SERIES(X, 1) },  // 0.00009873183 * cos(5.20065307357 + 202.25339517410 * t)
+    { 1416, -359, 44, VSOP87A_FIXED_SERIES(X, 1) },  // 0.00008707608 * cos(6.03511731637 + 224.34479570190 * t)
+    { -280, -879, 70, VSOP87A_FIXED_SERIES(X, 1) },  // 0.00005499109 * cos(4.40350603415 + 440.82528487760 * t)
+    { -795, 472, 6, VSOP87A_FIXED_SERIES(X, 1) },  // 0.00005512222 * cos(2.60556642348 + 11.04570026390 * t)
+    { 55, 670, 72, VSOP87A_FIXED_SERIES(X, 1) },  // 0.00004008257 * cos(1.48942966807 + 522.57741809380 * t)
+    { 231, -553, 60, VSOP87A_FIXED_SERIES(X, 1) },  // 0.00003571196 * cos(5.10821908379 + 412.37109687440 * t)
+    { -260, -377, 22, VSOP87A_FIXED_SERIES(X, 1) },  // 0.00002731381 * cos(4.10892223660 + 149.56319713460 * t)
+    { -316, -339, 15, VSOP87A_FIXED_SERIES(X, 1) },  // 0.00002763786 * cos(3.96253590209 + 95.97922721780 * t)
+    { -257, 182, 3, VSOP87A_FIXED_SERIES(X, 1) },  // 0.00001875862 * cos(2.52384080586 + 3.93215326310 * t)
+    { 215, 203, 49, VSOP87A_FIXED_SERIES(X, 1) },  // 0.00001765816 * cos(0.75684544353 + 277.03499374140 * t)
+    { -189, -211, 63, VSOP87A_FIXED_SERIES(X, 1) },  // 0.00001688957 * cos(3.98270950731 + 422.66603761290 * t)
+    { 144, -215, 54, VSOP87A_FIXED_SERIES(X, 1) },  // 0.00001544787 * cos(5.30283923836 + 330.61896365820 * t)
+    { 243, -4, 73, VSOP87A_FIXED_SERIES(X, 1) },  // 0.00001449143 * cos(6.26507179861 + 529.69096509460 * t)
+    { -105, 209, 91, VSOP87A_FIXED_SERIES(X, 1) },  // 0.00001395551 * cos(2.03533642541 + 1066.49547719000 * t)
+    { 77, -210, 47, VSOP87A_FIXED_SERIES(X, 1) },  // 0.00001330413 * cos(5.06312203212 + 234.63973644040 * t)
+    { 253, -13, 2, VSOP87A_FIXED_SERIES(X, 1) },  // 0.00001511648 * cos(6.23274598777 + 3.18139373770 * t)
+    { -158, 144, 61, VSOP87A_FIXED_SERIES(X, 1) },  // 0.00001271050 * cos(2.40338468675 + 415.55249061210 * t)
+    { -23, -195, 74, VSOP87A_FIXED_SERIES(X, 1) },  // 0.00001171680 * cos(4.59341412127 + 536.80451209540 * t)
+    { 129, -139, 64, VSOP87A_FIXED_SERIES(X, 1) },  // 0.00001129056 * cos(5.45794529295 + 423.41679713830 * t)
+    { -183, 49, 86, VSOP87A_FIXED_SERIES(X, 1) },  // 0.00001126400 * cos(2.88173213734 + 860.30992875280 * t)
+    { -110, -149, 66, VSOP87A_FIXED_SERIES(X, 1) },  // 0.00001101245 * cos(4.07698108824 + 429.77958461370 * t)
+    { 213, 20, 82, VSOP87A_FIXED_SERIES(X, 1) },  // 0.00001273315 * cos(0.09572429396 + 742.99006053260 * t)
+    { -223, 34, 31, VSOP87A_FIXED_SERIES(X, 1) },  // 0.00001342277 * cos(2.98929557875 + 210.85141488320 * t)
+    { -74, 211, 39, VSOP87A_FIXED_SERIES(X, 1) },  // 0.00001331045 * cos(1.90899526877 + 215.74677599280 * t)
+    { 28411, 89685, 28, VSOP87A_FIXED_SERIES(X, 2) | VSOP87A_FIXED_MICRO },  // 0.00560746334 * cos(1.26401632282 + 206.18554843720 * t)
+    { -81149, -42438, 42, VSOP87A_FIXED_SERIES(X, 2) | VSOP87A_FIXED_MICRO },  // 0.00545834518 * cos(3.62343709657 + 220.41264243880 * t)
+    { -74380, 0, 0, VSOP87A_FIXED_SERIES(X, 2) | VSOP87A_FIXED_MICRO },  // 0.00443342186 * cos(3.14159265359 + 0.00000000000 * t)
+    { -42538, 37018, 35, VSOP87A_FIXED_SERIES(X, 2) | VSOP87A_FIXED_MICRO },  // 0.00336109713 * cos(2.42547432460 + 213.29909543800 * t)
+    { -29956, 22777, 65, VSOP87A_FIXED_SERIES(X, 2) | VSOP87A_FIXED_MICRO },  // 0.00224302269 * cos(2.49151203519 + 426.59819087600 * t)
+    { 2591, -14394, 4, VSOP87A_FIXED_SERIES(X, 2) | VSOP87A_FIXED_MICRO },  // 0.00087170924 * cos(4.89048951691 + 7.11354700080 * t)
+    { -7592, 3578, 68, VSOP87A_FIXED_SERIES(X, 2) | VSOP87A_FIXED_MICRO },  // 0.00050028094 * cos(2.70119046081 + 433.71173787680 * t)
+    { 7065, 2719, 62, VSOP87A_FIXED_SERIES(X, 2) | VSOP87A_FIXED_MICRO },  // 0.00045122590 * cos(0.36735068943 + 419.48464387520 * t)
+    { -117, 5510, 78, VSOP87A_FIXED_SERIES(X, 2) | VSOP87A_FIXED_MICRO },  // 0.00032847824 * cos(1.59210153669 + 639.89728631400 * t)
+    { -4269, -1590, 46, VSOP87A_FIXED_SERIES(X, 2) | VSOP87A_FIXED_MICRO },  // 0.00027153555 * cos(3.49804002218 + 227.52618943960 * t)
+    { 246, 2112, 24, VSOP87A_FIXED_SERIES(X, 2) | VSOP87A_FIXED_MICRO },  // 0.00012676167 * cos(1.45465729530 + 199.07200143640 * t)
+    { 99, -1730, 8, VSOP87A_FIXED_SERIES(X, 2) | VSOP87A_FIXED_MICRO },  // 0.00010330738 * cos(4.76949531290 + 14.22709400160 * t)
+    { 1017, -667, 17, VSOP87A_FIXED_SERIES(X, 2) },  // 0.00007249149 * cos(5.70264553247 + 110.20632121940 * t)
+    { -205, 753, 79, VSOP87A_FIXED_SERIES(X, 2) },  // 0.00004653214 * cos(1.83710048213 + 647.01083331480 * t)
+    { -825, 47, 40, VSOP87A_FIXED_SERIES(X, 2) },  // 0.00004923585 * cos(3.08463039042 + 216.48048917570 * t)
+    { -195, 777, 30, VSOP87A_FIXED_SERIES(X, 2) },  // 0.00004777358 * cos(1.81695155349 + 210.11770170030 * t)
+    { 404, -570, 52, VSOP87A_FIXED_SERIES(X, 2) },  // 0.00004166633 * cos(5.32887874226 + 316.39186965660 * t)
+    { 417, 415, 85, VSOP87A_FIXED_SERIES(X, 2) },  // 0.00003508385 * cos(0.78251653369 + 853.19638175200 * t)
+    { -446, -11, 29, VSOP87A_FIXED_SERIES(X, 2) },  // 0.00002660470 * cos(3.16731393212 + 209.36694217490 * t)
+    { -376, 201, 70, VSOP87A_FIXED_SERIES(X, 2) },  // 0.00002538027 * cos(2.65097612407 + 440.82528487760 * t)
+    { -73, 425, 41, VSOP87A_FIXED_SERIES(X, 2) },  // 0.00002568114 * cos(1.74024228572 + 217.23124870110 * t)
+    { -8, -420, 18, VSOP87A_FIXED_SERIES(X, 2) },  // 0.00002503277 * cos(4.69450368911 + 117.31986822020 * t)
+    { -74, 414, 16, VSOP87A_FIXED_SERIES(X, 2) },  // 0.00002506986 * cos(1.74781817701 + 103.09277421860 * t)
+    { 343, 100, 77, VSOP87A_FIXED_SERIES(X, 2) },  // 0.00002129256 * cos(0.28453141367 + 632.78373931320 * t)
+    { -204, -232, 53, VSOP87A_FIXED_SERIES(X, 2) },  // 0.00001841989 * cos(3.99269872894 + 323.50541665740 * t)
+    { 187, 86, 60, VSOP87A_FIXED_SERIES(X, 2) },  // 0.00001228511 * cos(0.42906039519 + 412.37109687440 * t)
+    { -12763, 2118, 28, VSOP87A_FIXED_SERIES(X, 3) | VSOP87A_FIXED_MICRO },  // 0.00077115952 * cos(2.97714385362 + 206.18554843720 * t)
+    { -3992, 11993, 42, VSOP87A_FIXED_SERIES(X, 3) | VSOP87A_FIXED_MICRO },  // 0.00075340436 * cos(1.89208005248 + 220.41264243880 * t)
+    { -3096, 0, 0, VSOP87A_FIXED_SERIES(X, 3) | VSOP87A_FIXED_MICRO },  // 0.00018450895 * cos(3.14159265359 + 0.00000000000 * t)
+    { 1391, 1088, 65, VSOP87A_FIXED_SERIES(X, 3) | VSOP87A_FIXED_MICRO },  // 0.00010527244 * cos(0.66368256891 + 426.59819087600 * t)
+    { 918, 1198, 68, VSOP87A_FIXED_SERIES(X, 3) },  // 0.00008994946 * cos(0.91696559755 + 433.71173787680 * t)
+    { -266, 1213, 46, VSOP87A_FIXED_SERIES(X, 3) },  // 0.00007403594 * cos(1.78627385870 + 227.52618943960 * t)
+    { -1350, 17, 4, VSOP87A_FIXED_SERIES(X, 3) },  // 0.00008045160 * cos(3.12864412887 + 7.11354700080 * t)
+    { -472, 590, 62, VSOP87A_FIXED_SERIES(X, 3) },  // 0.00004505149 * cos(2.24531319187 + 419.48464387520 * t)
+    { -582, -3, 24, VSOP87A_FIXED_SERIES(X, 3) },  // 0.00003468010 * cos(3.14590544446 + 199.07200143640 * t)
+    { 479, -139, 78, VSOP87A_FIXED_SERIES(X, 3) },  // 0.00002974601 * cos(6.00030641555 + 639.89728631400 * t)
+    { -392, 32, 8, VSOP87A_FIXED_SERIES(X, 3) },  // 0.00002342089 * cos(3.06091771643 + 14.22709400160 * t)
+    { -67, -195, 35, VSOP87A_FIXED_SERIES(X, 3) },  // 0.00001230715 * cos(4.38196130069 + 213.29909543800 * t)
+    { 172, 2, 79, VSOP87A_FIXED_SERIES(X, 3) },  // 0.00001023888 * cos(0.01138655869 + 647.01083331480 * t)
+    { -10, -1335, 28, VSOP87A_FIXED_SERIES(X, 4) },  // 0.00007959921 * cos(4.70523623364 + 206.18554843720 * t)
+    { 1302, 183, 42, VSOP87A_FIXED_SERIES(X, 4) },  // 0.00007836652 * cos(0.13981693631 + 220.41264243880 * t)
+    { 253, 17, 46, VSOP87A_FIXED_SERIES(X, 4) },  // 0.00001511196 * cos(0.06561560462 + 227.52618943960 * t)
+    { 133, -156, 68, VSOP87A_FIXED_SERIES(X, 4) },  // 0.00001223066 * cos(5.41618485361 + 433.71173787680 * t)
+    { 122576541, -102655242, 35, VSOP87A_FIXED_SERIES(Y, 0) | VSOP87A_FIXED_MICRO },  // 9.52986882699 * cos(5.58600556665 + 213.29909543800 * t)
+    { -13319094, 0, 0, VSOP87A_FIXED_SERIES(Y, 0) | VSOP87A_FIXED_MICRO },  // 0.79387988806 * cos(3.14159265359 + 0.00000000000 * t)
+    { 543800, -4402738, 65, VSOP87A_FIXED_SERIES(Y, 0) | VSOP87A_FIXED_MICRO },  // 0.26441781302 * cos(4.83528061849 + 426.59819087600 * t)
+    { -965017, 644455, 28, VSOP87A_FIXED_SERIES(Y, 0) | VSOP87A_FIXED_MICRO },  // 0.06916653915 * cos(2.55279408706 + 206.18554843720 * t)
+    { 758778, -814166, 42, VSOP87A_FIXED_SERIES(Y, 0) | VSOP87A_FIXED_MICRO },  // 0.06633570703 * cos(5.46258848288 + 220.41264243880 * t)
+    { 354944, 169937, 4, VSOP87A_FIXED_SERIES(Y, 0) | VSOP87A_FIXED_MICRO },  // 0.02345609742 * cos(0.44652132519 + 7.11354700080 * t)
+    { 44200, 193641, 62, VSOP87A_FIXED_SERIES(Y, 0) | VSOP87A_FIXED_MICRO },  // 0.01183874652 * cos(1.34638298371 + 419.48464387520 * t)
+    { 172068, 118648, 17, VSOP87A_FIXED_SERIES(Y, 0) | VSOP87A_FIXED_MICRO },  // 0.01245790434 * cos(0.60367177975 + 110.20632121940 * t)
+    { -108051, -149352, 78, VSOP87A_FIXED_SERIES(Y, 0) | VSOP87A_FIXED_MICRO },  // 0.01098751131 * cos(4.08608782813 + 639.89728631400 * t)
+    { 49517, 106648, 52, VSOP87A_FIXED_SERIES(Y, 0) | VSOP87A_FIXED_MICRO },  // 0.00700849336 * cos(1.13611298025 + 316.39186965660 * t)
+    { 47643, -55166, 73, VSOP87A_FIXED_SERIES(Y, 0) | VSOP87A_FIXED_MICRO },  // 0.00434466176 * cos(5.42474696262 + 529.69096509460 * t)
+    { 44, -62634, 68, VSOP87A_FIXED_SERIES(Y, 0) | VSOP87A_FIXED_MICRO },  // 0.00373327342 * cos(4.71308726958 + 433.71173787680 * t)
+    { 44276, 34663, 16, VSOP87A_FIXED_SERIES(Y, 0) | VSOP87A_FIXED_MICRO },  // 0.00335162363 * cos(0.66422253983 + 103.09277421860 * t)
+    { 13953, -8646, 53, VSOP87A_FIXED_SERIES(Y, 0) | VSOP87A_FIXED_MICRO },  // 0.00097837745 * cos(5.72844290173 + 323.50541665740 * t)
+    { -8282, -10684, 6, VSOP87A_FIXED_SERIES(Y, 0) | VSOP87A_FIXED_MICRO },  // 0.00080571808 * cos(4.05295449910 + 11.04570026390 * t)
+    { 8175, -11459, 46, VSOP87A_FIXED_SERIES(Y, 0) | VSOP87A_FIXED_MICRO },  // 0.00083899691 * cos(5.33204070267 + 227.52618943960 * t)
+    { 9112, -7451, 29, VSOP87A_FIXED_SERIES(Y, 0) | VSOP87A_FIXED_MICRO },  // 0.00070158491 * cos(5.59777963629 + 209.36694217490 * t)
+    { 3386, 10531, 26, VSOP87A_FIXED_SERIES(Y, 0) | VSOP87A_FIXED_MICRO },  // 0.00065937657 * cos(1.25969608208 + 202.25339517410 * t)
+    { 7503, 9242, 77, VSOP87A_FIXED_SERIES(Y, 0) | VSOP87A_FIXED_MICRO },  // 0.00070957225 * cos(0.88888207567 + 632.78373931320 * t)
+    { -8875, 7429, 41, VSOP87A_FIXED_SERIES(Y, 0) | VSOP87A_FIXED_MICRO },  // 0.00068985859 * cos(2.44460312617 + 217.23124870110 * t)
+    { 8140, 5448, 44, VSOP87A_FIXED_SERIES(Y, 0) | VSOP87A_FIXED_MICRO },  // 0.00058382264 * cos(0.58978766922 + 224.34479570190 * t)
+    { -8894, -1766, 85, VSOP87A_FIXED_SERIES(Y, 0) | VSOP87A_FIXED_MICRO },  // 0.00054049836 * cos(3.33757904879 + 853.19638175200 * t)
+    { 7332, 2295, 8, VSOP87A_FIXED_SERIES(Y, 0) | VSOP87A_FIXED_MICRO },  // 0.00045790930 * cos(0.30331527632 + 14.22709400160 * t)
+    { -6127, 3473, 24, VSOP87A_FIXED_SERIES(Y, 0) | VSOP87A_FIXED_MICRO },  // 0.00041976402 * cos(2.62591355948 + 199.07200143640 * t)
+    { 4622, 5905, 11, VSOP87A_FIXED_SERIES(Y, 0) | VSOP87A_FIXED_MICRO },  // 0.00044697175 * cos(0.90661238256 + 63.73589830340 * t)
+    { 1557, -3931, 40, VSOP87A_FIXED_SERIES(Y, 0) | VSOP87A_FIXED_MICRO },  // 0.00025199575 * cos(5.08963506006 + 216.48048917570 * t)
+    { -4062, 769, 30, VSOP87A_FIXED_SERIES(Y, 0) | VSOP87A_FIXED_MICRO },  // 0.00024640836 * cos(2.95445247282 + 210.11770170030 * t)
+    { -2640, -3224, 61, VSOP87A_FIXED_SERIES(Y, 0) | VSOP87A_FIXED_MICRO },  // 0.00024835151 * cos(4.02630190571 + 415.55249061210 * t)
+    { 4276, 284, 18, VSOP87A_FIXED_SERIES(Y, 0) | VSOP87A_FIXED_MICRO },  // 0.00025545907 * cos(0.06626229252 + 117.31986822020 * t)
+    { 4893, -911, 81, VSOP87A_FIXED_SERIES(Y, 0) | VSOP87A_FIXED_MICRO },  // 0.00029666833 * cos(6.09910638345 + 735.87651353180 * t)
+    { -2673, -2875, 79, VSOP87A_FIXED_SERIES(Y, 0) | VSOP87A_FIXED_MICRO },  // 0.00023396742 * cos(3.96337393635 + 647.01083331480 * t)
+    { 734, -3853, 22, VSOP87A_FIXED_SERIES(Y, 0) | VSOP87A_FIXED_MICRO },  // 0.00023380691 * cos(4.90051072276 + 149.56319713460 * t)
+    { -2373, 2436, 51, VSOP87A_FIXED_SERIES(Y, 0) | VSOP87A_FIXED_MICRO },  // 0.00020272215 * cos(2.34319548198 + 309.27832265580 * t)
+    { 1868, 2807, 72, VSOP87A_FIXED_SERIES(Y, 0) | VSOP87A_FIXED_MICRO },  // 0.00020099552 * cos(0.98365186365 + 522.57741809380 * t)
+    { -2946, -2945, 12, VSOP87A_FIXED_SERIES(Y, 0) | VSOP87A_FIXED_MICRO },  // 0.00024827950 * cos(3.92681428900 + 74.78159856730 * t)
+    { -2579, 101, 49, VSOP87A_FIXED_SERIES(Y, 0) | VSOP87A_FIXED_MICRO },  // 0.00015383927 * cos(3.10227822627 + 277.03499374140 * t)
+    { 1671, -1007, 90, VSOP87A_FIXED_SERIES(Y, 0) | VSOP87A_FIXED_MICRO },  // 0.00011629210 * cos(5.74108283772 + 1059.38193018920 * t)
+    { -1813, 1028, 71, VSOP87A_FIXED_SERIES(Y, 0) | VSOP87A_FIXED_MICRO },  // 0.00012422966 * cos(2.62557865743 + 490.33408917940 * t)
+    { -1174, -1645, 57, VSOP87A_FIXED_SERIES(Y, 0) | VSOP87A_FIXED_MICRO },  // 0.00012048048 * cos(4.09265980116 + 351.81659230870 * t)
+    { -1507, -544, 15, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00009551796 * cos(3.48788042094 + 95.97922721780 * t)
+    { 507, 1183, 82, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00007670379 * cos(1.16594276164 + 742.99006053260 * t)
+    { 452, 1069, 60, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00006919946 * cos(1.17090063883 + 412.37109687440 * t)
+    { 1387, -611, 89, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00009034877 * cos(5.86816144198 + 1052.26838318840 * t)
+    { 730, 818, 83, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00006536751 * cos(0.84246459392 + 838.96928775040 * t)
+    { -127, -1012, 70, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00006082097 * cos(4.58758280729 + 440.82528487760 * t)
+    { 503, 677, 84, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00005027211 * cos(0.93213690546 + 846.08283475120 * t)
+    { 219, -782, 74, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00004838146 * cos(4.98563812475 + 536.80451209540 * t)
+    { -801, -543, 9, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00005768897 * cos(3.73776690402 + 38.13303563780 * t)
+    { -861, 145, 31, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00005201849 * cos(2.97482802430 + 210.85141488320 * t)
+    { 293, -814, 39, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00005156578 * cos(5.05796998564 + 215.74677599280 * t)
+    { -185, -609, 63, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00003792348 * cos(4.41806046981 + 422.66603761290 * t)
+    { -633, -154, 3, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00003881104 * cos(3.38026646963 + 3.93215326310 * t)
+    { -346, 529, 32, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00003768751 * cos(2.14954247360 + 212.33588759150 * t)
+    { 579, -246, 38, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00003752010 * cos(5.88125434018 + 214.26230328450 * t)
+    { 392, -347, 34, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00003118938 * cos(5.55799397159 + 213.25091132820 * t)
+    { -410, 324, 36, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00003118056 * cos(2.47259780102 + 213.34727954780 * t)
+    { -490, 412, 75, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00003815691 * cos(2.44166851155 + 625.67019231240 * t)
+    { 217, 642, 20, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00004042463 * cos(1.24471211016 + 137.03302416240 * t)
+    { 317, -353, 54, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00002829944 * cos(5.44434225998 + 330.61896365820 * t)
+    { 559, -85, 69, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00003367270 * cos(6.13298847057 + 437.64389113990 * t)
+    { 441, -202, 14, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00002891352 * cos(5.85313497106 + 85.82729883120 * t)
+    { 366, -288, 27, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00002774595 * cos(5.61594351302 + 203.73786788240 * t)
+    { -340, -284, 50, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00002638715 * cos(3.83678156812 + 288.08069400530 * t)
+    { -263, -463, 13, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00003171680 * cos(4.19553075395 + 76.26607127560 * t)
+    { -394, -159, 76, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00002532374 * cos(3.52629372341 + 628.85158605010 * t)
+    { -309, -292, 21, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00002533632 * cos(3.89788590926 + 138.51749687070 * t)
+    { -425, 264, 91, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00002982174 * cos(2.58535107213 + 1066.49547719000 * t)
+    { 337, 282, 19, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00002620642 * cos(0.69751279148 + 127.47179660680 * t)
+    { 418, -35, 5, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00002501775 * cos(6.19929274396 + 9.56122755560 * t)
+    { 352, 212, 92, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00002448467 * cos(0.54179432209 + 1155.36115740700 * t)
+    { -301, 275, 43, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00002431496 * cos(2.40122451395 + 222.86032299360 * t)
+    { 418, -320, 93, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00003138628 * cos(5.63058455924 + 1368.66025284500 * t)
+    { -200, 324, 67, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00002269226 * cos(2.12401905105 + 430.53034413910 * t)
+    { -131, 323, 64, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00002078049 * cos(1.95682348964 + 423.41679713830 * t)
+    { 441, 81, 2, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00002670750 * cos(0.18165311734 + 3.18139373770 * t)
+    { -159, -359, 59, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00002339764 * cos(4.29619053852 + 388.46515523820 * t)
+    { -271, 46, 7, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00001636580 * cos(2.97440139727 + 12.53017297220 * t)
+    { 223, 162, 33, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00001639181 * cos(0.62823227849 + 212.77783057620 * t)
+    { 119, 247, 37, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00001634235 * cos(1.12043073218 + 213.82036029980 * t)
+    { 111, -226, 10, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00001499665 * cos(5.16865990579 + 52.69019803950 * t)
+    { -86, -230, 66, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00001462908 * cos(4.35285690993 + 429.77958461370 * t)
+    { -135, 247, 88, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00001678952 * cos(2.07211719214 + 949.17560896980 * t)
+    { 304, 138, 1, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00001989253 * cos(0.42496478369 + 1.48447270830 * t)
+    { -258, -19, 86, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00001540242 * cos(3.21449770483 + 860.30992875280 * t)
+    { -184, -156, 56, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00001437063 * cos(3.84293543293 + 350.33211960040 * t)
+    { -212, 33, 55, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00001276377 * cos(2.98728987770 + 340.77089204480 * t)
+    { -42, 189, 87, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00001152164 * cos(1.78736848302 + 942.06206196900 * t)
+    { 86, -166, 47, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00001112617 * cos(5.19114183145 + 234.63973644040 * t)
+    { 163, 46, 94, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00001011023 * cos(0.27242160432 + 1471.75302706360 * t)
+    { -137, 139, 25, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00001162807 * cos(2.35040840317 + 200.76892246580 * t)
+    { -81, -164, 58, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00001091025 * cos(4.25638370205 + 362.86229257260 * t)
+    { 166, -77, 23, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00001090678 * cos(5.85086226218 + 173.94221952280 * t)
+    { 124, -156, 95, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00001186647 * cos(5.38323620554 + 1685.05212250160 * t)
+    { -60, 178, 80, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00001120819 * cos(1.89478696683 + 703.63318461740 * t)
+    { 150, -78, 45, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00001008898 * cos(5.80110302450 + 225.82926841020 * t)
+    { 901589, 0, 0, VSOP87A_FIXED_SERIES(Y, 1) | VSOP87A_FIXED_MICRO },  // 0.05373889135 * cos(0.00000000000 + 0.00000000000 * t)
+    { -469539, 219974, 65, VSOP87A_FIXED_SERIES(Y, 1) | VSOP87A_FIXED_MICRO },  // 0.03090575152 * cos(2.70346890906 + 426.59819087600 * t)
+    { -198291, -415026, 28, VSOP87A_FIXED_SERIES(Y, 1) | VSOP87A_FIXED_MICRO },  // 0.02741594312 * cos(4.26667636015 + 206.18554843720 * t)
+    { -361574, -257984, 42, VSOP87A_FIXED_SERIES(Y, 1) | VSOP87A_FIXED_MICRO },  // 0.02647489677 * cos(3.76132298889 + 220.41264243880 * t)
+    { 33335, -100571, 4, VSOP87A_FIXED_SERIES(Y, 1) | VSOP87A_FIXED_MICRO },  // 0.00631520527 * cos(5.03245505280 + 7.11354700080 * t)
+    { -16090, 39967, 78, VSOP87A_FIXED_SERIES(Y, 1) | VSOP87A_FIXED_MICRO },  // 0.00256799701 * cos(1.95351819758 + 639.89728631400 * t)
+    { -52033, -6111, 62, VSOP87A_FIXED_SERIES(Y, 1) | VSOP87A_FIXED_MICRO },  // 0.00312271930 * cos(3.25850205023 + 419.48464387520 * t)
+    { -30969, 7139, 68, VSOP87A_FIXED_SERIES(Y, 1) | VSOP87A_FIXED_MICRO },  // 0.00189433319 * cos(2.91501840819 + 433.71173787680 * t)
+    { 15091, -23034, 35, VSOP87A_FIXED_SERIES(Y, 1) | VSOP87A_FIXED_MICRO },  // 0.00164133553 * cos(5.29239290066 + 213.29909543800 * t)
+    { 18110, -7481, 17, VSOP87A_FIXED_SERIES(Y, 1) | VSOP87A_FIXED_MICRO },  // 0.00116791227 * cos(5.89146675760 + 110.20632121940 * t)
+    { -6364, 9309, 52, VSOP87A_FIXED_SERIES(Y, 1) | VSOP87A_FIXED_MICRO },  // 0.00067210919 * cos(2.17042636344 + 316.39186965660 * t)
+    { -9922, -5285, 46, VSOP87A_FIXED_SERIES(Y, 1) | VSOP87A_FIXED_MICRO },  // 0.00067003292 * cos(3.63101075514 + 227.52618943960 * t)
+    { -1936, -5188, 24, VSOP87A_FIXED_SERIES(Y, 1) | VSOP87A_FIXED_MICRO },  // 0.00033002406 * cos(4.35527405801 + 199.07200143640 * t)
+    { 901, -5059, 8, VSOP87A_FIXED_SERIES(Y, 1) | VSOP87A_FIXED_MICRO },  // 0.00030628998 * cos(4.88861760772 + 14.22709400160 * t)
+    { -336, -3715, 16, VSOP87A_FIXED_SERIES(Y, 1) | VSOP87A_FIXED_MICRO },  // 0.00022234714 * cos(4.62212779231 + 103.09277421860 * t)
+    { 1140, 2967, 85, VSOP87A_FIXED_SERIES(Y, 1) | VSOP87A_FIXED_MICRO },  // 0.00018945004 * cos(1.20412493845 + 853.19638175200 * t)
+    { -2824, -1108, 29, VSOP87A_FIXED_SERIES(Y, 1) | VSOP87A_FIXED_MICRO },  // 0.00018079959 * cos(3.51566153251 + 209.36694217490 * t)
+    { -535, -2937, 41, VSOP87A_FIXED_SERIES(Y, 1) | VSOP87A_FIXED_MICRO },  // 0.00017791543 * cos(4.53214140649 + 217.23124870110 * t)
+    { -2705, -426, 40, VSOP87A_FIXED_SERIES(Y, 1) | VSOP87A_FIXED_MICRO },  // 0.00016320701 * cos(3.29784030970 + 216.48048917570 * t)
+    { 87, -2674, 30, VSOP87A_FIXED_SERIES(Y, 1) | VSOP87A_FIXED_MICRO },  // 0.00015944258 * cos(4.74503265169 + 210.11770170030 * t)
+    { -2778, 388, 77, VSOP87A_FIXED_SERIES(Y, 1) | VSOP87A_FIXED_MICRO },  // 0.00016717122 * cos(3.00270792752 + 632.78373931320 * t)
+    { -1684, -2123, 53, VSOP87A_FIXED_SERIES(Y, 1) | VSOP87A_FIXED_MICRO },  // 0.00016149947 * cos(4.04186432517 + 323.50541665740 * t)
+    { -1233, 2094, 79, VSOP87A_FIXED_SERIES(Y, 1) | VSOP87A_FIXED_MICRO },  // 0.00014481431 * cos(2.10298298650 + 647.01083331480 * t)
+    { 53, -1859, 18, VSOP87A_FIXED_SERIES(Y, 1) | VSOP87A_FIXED_MICRO },  // 0.00011084040 * cos(4.74073871754 + 117.31986822020 * t)
+    { -1488, -739, 26, VSOP87A_FIXED_SERIES(Y, 1) },  // 0.00009905491 * cos(3.60258599375 + 202.25339517410 * t)
+    { -361, -1419, 44, VSOP87A_FIXED_SERIES(Y, 1) },  // 0.00008726051 * cos(4.46341342877 + 224.34479570190 * t)
+    { -659, -887, 51, VSOP87A_FIXED_SERIES(Y, 1) },  // 0.00006585597 * cos(4.07326320487 + 309.27832265580 * t)
+    { -880, 281, 70, VSOP87A_FIXED_SERIES(Y, 1) },  // 0.00005505978 * cos(2.83207390240 + 440.82528487760 * t)
+    { 467, 781, 6, VSOP87A_FIXED_SERIES(Y, 1) },  // 0.00005424041 * cos(1.03197684410 + 11.04570026390 * t)
+    { -695, 92, 60, VSOP87A_FIXED_SERIES(Y, 1) },  // 0.00004178266 * cos(3.01038512076 + 412.37109687440 * t)
+    { 303, -608, 15, VSOP87A_FIXED_SERIES(Y, 1) },  // 0.00004049905 * cos(5.17488767645 + 95.97922721780 * t)
+    { -378, 260, 22, VSOP87A_FIXED_SERIES(Y, 1) },  // 0.00002735256 * cos(2.53975850409 + 149.56319713460 * t)
+    { -294, 267, 72, VSOP87A_FIXED_SERIES(Y, 1) },  // 0.00002369024 * cos(2.40497927917 + 522.57741809380 * t)
+    { 209, -205, 49, VSOP87A_FIXED_SERIES(Y, 1) },  // 0.00001745258 * cos(5.50576015456 + 277.03499374140 * t)
+    { -209, 192, 63, VSOP87A_FIXED_SERIES(Y, 1) },  // 0.00001692790 * cos(2.39926502529 + 422.66603761290 * t)
+    { -216, -144, 54, VSOP87A_FIXED_SERIES(Y, 1) },  // 0.00001546006 * cos(3.73156925599 + 330.61896365820 * t)
+    { 209, 104, 91, VSOP87A_FIXED_SERIES(Y, 1) },  // 0.00001389354 * cos(0.46207025895 + 1066.49547719000 * t)
+    { -210, -77, 47, VSOP87A_FIXED_SERIES(Y, 1) },  // 0.00001332553 * cos(3.49199812296 + 234.63973644040 * t)
+    { 146, 162, 61, VSOP87A_FIXED_SERIES(Y, 1) },  // 0.00001300934 * cos(0.83727681906 + 415.55249061210 * t)
+    { -21, -233, 2, VSOP87A_FIXED_SERIES(Y, 1) },  // 0.00001393622 * cos(4.62214277175 + 3.18139373770 * t)
+    { -180, 80, 84, VSOP87A_FIXED_SERIES(Y, 1) },  // 0.00001174319 * cos(2.72609984335 + 846.08283475120 * t)
+    { -192, 19, 74, VSOP87A_FIXED_SERIES(Y, 1) },  // 0.00001148010 * cos(3.04374738882 + 536.80451209540 * t)
+    { -70, -209, 75, VSOP87A_FIXED_SERIES(Y, 1) },  // 0.00001314125 * cos(4.38891656600 + 625.67019231240 * t)
+    { -141, -126, 64, VSOP87A_FIXED_SERIES(Y, 1) },  // 0.00001127952 * cos(3.87309692307 + 423.41679713830 * t)
+    { 49, 183, 86, VSOP87A_FIXED_SERIES(Y, 1) },  // 0.00001127646 * cos(1.31088906213 + 860.30992875280 * t)
+    { 252, -39, 3, VSOP87A_FIXED_SERIES(Y, 1) },  // 0.00001519732 * cos(6.12880664637 + 3.93215326310 * t)
+    { -149, 110, 66, VSOP87A_FIXED_SERIES(Y, 1) },  // 0.00001102361 * cos(2.50535306014 + 429.77958461370 * t)
+    { 34, 223, 31, VSOP87A_FIXED_SERIES(Y, 1) },  // 0.00001344891 * cos(1.41793593685 + 210.85141488320 * t)
+    { 211, 74, 39, VSOP87A_FIXED_SERIES(Y, 1) },  // 0.00001331786 * cos(0.33834520814 + 215.74677599280 * t)
+    { 90008, -29033, 28, VSOP87A_FIXED_SERIES(Y, 2) | VSOP87A_FIXED_MICRO },  // 0.00563706537 * cos(5.97115878242 + 206.18554843720 * t)
+    { -42440, 81371, 42, VSOP87A_FIXED_SERIES(Y, 2) | VSOP87A_FIXED_MICRO },  // 0.00547012116 * cos(2.05154973426 + 220.41264243880 * t)
+    { 76927, 0, 0, VSOP87A_FIXED_SERIES(Y, 2) | VSOP87A_FIXED_MICRO },  // 0.00458518613 * cos(0.00000000000 + 0.00000000000 * t)
+    { 38002, 47439, 35, VSOP87A_FIXED_SERIES(Y, 2) | VSOP87A_FIXED_MICRO },  // 0.00362294249 * cos(0.89540100509 + 213.29909543800 * t)
+    { 23012, 30034, 65, VSOP87A_FIXED_SERIES(Y, 2) | VSOP87A_FIXED_MICRO },  // 0.00225521642 * cos(0.91699821445 + 426.59819087600 * t)
+    { -14637, -2382, 4, VSOP87A_FIXED_SERIES(Y, 2) | VSOP87A_FIXED_MICRO },  // 0.00088390611 * cos(3.30289449917 + 7.11354700080 * t)
+    { 3588, 7601, 68, VSOP87A_FIXED_SERIES(Y, 2) | VSOP87A_FIXED_MICRO },  // 0.00050101314 * cos(1.12976163835 + 433.71173787680 * t)
+    { 2721, -7135, 62, VSOP87A_FIXED_SERIES(Y, 2) | VSOP87A_FIXED_MICRO },  // 0.00045516403 * cos(5.07669466539 + 419.48464387520 * t)
+    { 5518, 115, 78, VSOP87A_FIXED_SERIES(Y, 2) | VSOP87A_FIXED_MICRO },  // 0.00032896745 * cos(0.02089057938 + 639.89728631400 * t)
+    { -1589, 4278, 46, VSOP87A_FIXED_SERIES(Y, 2) | VSOP87A_FIXED_MICRO },  // 0.00027199743 * cos(1.92638417640 + 227.52618943960 * t)
+    { 2176, -455, 24, VSOP87A_FIXED_SERIES(Y, 2) | VSOP87A_FIXED_MICRO },  // 0.00013251505 * cos(6.07693099404 + 199.07200143640 * t)
+    { -1748, -71, 8, VSOP87A_FIXED_SERIES(Y, 2) | VSOP87A_FIXED_MICRO },  // 0.00010425984 * cos(3.18246869028 + 14.22709400160 * t)
+    { -502, -1001, 17, VSOP87A_FIXED_SERIES(Y, 2) },  // 0.00006673556 * cos(4.24747633887 + 110.20632121940 * t)
+    { 754, 205, 79, VSOP87A_FIXED_SERIES(Y, 2) },  // 0.00004658591 * cos(0.26557833758 + 647.01083331480 * t)
+    { 48, 826, 40, VSOP87A_FIXED_SERIES(Y, 2) },  // 0.00004934094 * cos(1.51301179516 + 216.48048917570 * t)
+    { 780, 194, 30, VSOP87A_FIXED_SERIES(Y, 2) },  // 0.00004789554 * cos(0.24337901916 + 210.11770170030 * t)
+    { -581, -389, 52, VSOP87A_FIXED_SERIES(Y, 2) },  // 0.00004167268 * cos(3.73203671391 + 316.39186965660 * t)
+    { 414, -418, 85, VSOP87A_FIXED_SERIES(Y, 2) },  // 0.00003509537 * cos(5.49281440568 + 853.19638175200 * t)
+    { 459, -29, 16, VSOP87A_FIXED_SERIES(Y, 2) },  // 0.00002743470 * cos(6.21939083886 + 103.09277421860 * t)
+    { -8, 446, 29, VSOP87A_FIXED_SERIES(Y, 2) },  // 0.00002661172 * cos(1.58795412736 + 209.36694217490 * t)
+    { 201, 376, 70, VSOP87A_FIXED_SERIES(Y, 2) },  // 0.00002541191 * cos(1.07964653574 + 440.82528487760 * t)
+    { 425, 72, 41, VSOP87A_FIXED_SERIES(Y, 2) },  // 0.00002568018 * cos(0.16811216098 + 217.23124870110 * t)
+    { -421, 10, 18, VSOP87A_FIXED_SERIES(Y, 2) },  // 0.00002507738 * cos(3.11882746290 + 117.31986822020 * t)
+    { 102, -347, 77, VSOP87A_FIXED_SERIES(Y, 2) },  // 0.00002159089 * cos(4.99912567024 + 632.78373931320 * t)
+    { -233, 199, 53, VSOP87A_FIXED_SERIES(Y, 2) },  // 0.00001828412 * cos(2.43368650590 + 323.50541665740 * t)
+    { 24, -226, 60, VSOP87A_FIXED_SERIES(Y, 2) },  // 0.00001351629 * cos(4.81673889364 + 412.37109687440 * t)
+    { 179, -84, 51, VSOP87A_FIXED_SERIES(Y, 2) },  // 0.00001177305 * cos(5.84484412189 + 309.27832265580 * t)
+    { 2156, 12801, 28, VSOP87A_FIXED_SERIES(Y, 3) | VSOP87A_FIXED_MICRO },  // 0.00077376615 * cos(1.40391048961 + 206.18554843720 * t)
+    { 12036, 3983, 42, VSOP87A_FIXED_SERIES(Y, 3) | VSOP87A_FIXED_MICRO },  // 0.00075564351 * cos(0.31962896379 + 220.41264243880 * t)
+    { -3833, 0, 0, VSOP87A_FIXED_SERIES(Y, 3) | VSOP87A_FIXED_MICRO },  // 0.00022843837 * cos(3.14159265359 + 0.00000000000 * t)
+    { 1087, -1423, 65, VSOP87A_FIXED_SERIES(Y, 3) | VSOP87A_FIXED_MICRO },  // 0.00010672263 * cos(5.36495663820 + 426.59819087600 * t)
+    { 1199, -920, 68, VSOP87A_FIXED_SERIES(Y, 3) },  // 0.00009010175 * cos(5.62865146645 + 433.71173787680 * t)
+    { 1216, 265, 46, VSOP87A_FIXED_SERIES(Y, 3) },  // 0.00007418018 * cos(0.21442310101 + 227.52618943960 * t)
+    { 67, 1391, 4, VSOP87A_FIXED_SERIES(Y, 3) },  // 0.00008298723 * cos(1.52262563519 + 7.11354700080 * t)
+    { 592, 471, 62, VSOP87A_FIXED_SERIES(Y, 3) },  // 0.00004507061 * cos(0.67248969480 + 419.48464387520 * t)
+    { 34, 600, 24, VSOP87A_FIXED_SERIES(Y, 3) },  // 0.00003581682 * cos(1.51466786030 + 199.07200143640 * t)
+    { -140, -480, 78, VSOP87A_FIXED_SERIES(Y, 3) },  // 0.00002981969 * cos(4.42868951627 + 639.89728631400 * t)
+    { 43, 396, 8, VSOP87A_FIXED_SERIES(Y, 3) },  // 0.00002376221 * cos(1.46232779180 + 14.22709400160 * t)
+    { 2, -172, 79, VSOP87A_FIXED_SERIES(Y, 3) },  // 0.00001024263 * cos(4.72337917196 + 647.01083331480 * t)
+    { -1339, 12, 28, VSOP87A_FIXED_SERIES(Y, 4) },  // 0.00007978886 * cos(3.13229268011 + 206.18554843720 * t)
+    { 180, -1308, 42, VSOP87A_FIXED_SERIES(Y, 4) },  // 0.00007868379 * cos(4.84940260021 + 220.41264243880 * t)
+    { 16, -254, 46, VSOP87A_FIXED_SERIES(Y, 4) },  // 0.00001514835 * cos(4.77675733867 + 227.52618943960 * t)
+    { -157, -133, 68, VSOP87A_FIXED_SERIES(Y, 4) },  // 0.00001225569 * cos(3.84500138574 + 433.71173787680 * t)
+    { -6214992, -3085008, 35, VSOP87A_FIXED_SERIES(Z, 0) | VSOP87A_FIXED_MICRO },  // 0.41356950940 * cos(3.60234142982 + 213.29909543800 * t)
+    { -184589, 55146, 65, VSOP87A_FIXED_SERIES(Z, 0) | VSOP87A_FIXED_MICRO },  // 0.01148283576 * cos(2.85128367469 + 426.59819087600 * t)
+    { 203717, 0, 0, VSOP87A_FIXED_SERIES(Z, 0) | VSOP87A_FIXED_MICRO },  // 0.01214249867 * cos(0.00000000000 + 0.00000000000 * t)
+    { 46474, 29868, 28, VSOP87A_FIXED_SERIES(Z, 0) | VSOP87A_FIXED_MICRO },  // 0.00329280791 * cos(0.57121407104 + 206.18554843720 * t)
+    { -45398, -16015, 42, VSOP87A_FIXED_SERIES(Z, 0) | VSOP87A_FIXED_MICRO },  // 0.00286934048 * cos(3.48073526693 + 220.41264243880 * t)
+    { 354, -16619, 4, VSOP87A_FIXED_SERIES(Z, 0) | VSOP87A_FIXED_MICRO },  // 0.00099076584 * cos(4.73369511264 + 7.11354700080 * t)
+    { 2041, -9405, 17, VSOP87A_FIXED_SERIES(Z, 0) | VSOP87A_FIXED_MICRO },  // 0.00057361820 * cos(4.92611225093 + 110.20632121940 * t)
+    { -4046, 6912, 78, VSOP87A_FIXED_SERIES(Z, 0) | VSOP87A_FIXED_MICRO },  // 0.00047738127 * cos(2.10039779728 + 639.89728631400 * t)
+    { 6615, -3067, 62, VSOP87A_FIXED_SERIES(Z, 0) | VSOP87A_FIXED_MICRO },  // 0.00043458803 * cos(5.84904978051 + 419.48464387520 * t)
+    { 3797, -4384, 52, VSOP87A_FIXED_SERIES(Z, 0) | VSOP87A_FIXED_MICRO },  // 0.00034565673 * cos(5.42614229590 + 316.39186965660 * t)
+    { -2489, 1087, 68, VSOP87A_FIXED_SERIES(Z, 0) | VSOP87A_FIXED_MICRO },  // 0.00016185391 * cos(2.72987173675 + 433.71173787680 * t)
+    { 284, 1483, 16, VSOP87A_FIXED_SERIES(Z, 0) },  // 0.00009001270 * cos(1.38140102737 + 103.09277421860 * t)
+    { -1610, -1043, 73, VSOP87A_FIXED_SERIES(Z, 0) | VSOP87A_FIXED_MICRO },  // 0.00011433574 * cos(3.71662021072 + 529.69096509460 * t)
+    { 369, -827, 26, VSOP87A_FIXED_SERIES(Z, 0) },  // 0.00005398708 * cos(5.13204892363 + 202.25339517410 * t)
+    { -550, -355, 53, VSOP87A_FIXED_SERIES(Z, 0) },  // 0.00003902467 * cos(3.71499738796 + 323.50541665740 * t)
+    { 209, -586, 77, VSOP87A_FIXED_SERIES(Z, 0) },  // 0.00003709212 * cos(5.05549348785 + 632.78373931320 * t)
+    { -593, -127, 46, VSOP87A_FIXED_SERIES(Z, 0) },  // 0.00003614100 * cos(3.35210451276 + 227.52618943960 * t)
+    { -305, 478, 6, VSOP87A_FIXED_SERIES(Z, 0) },  // 0.00003379953 * cos(2.13868919206 + 11.04570026390 * t)
+    { -459, -241, 29, VSOP87A_FIXED_SERIES(Z, 0) },  // 0.00003089874 * cos(3.62572857085 + 209.36694217490 * t)
+    { 74, -444, 44, VSOP87A_FIXED_SERIES(Z, 0) },  // 0.00002683064 * cos(4.87689555581 + 224.34479570190 * t)
+    { 444, 223, 41, VSOP87A_FIXED_SERIES(Z, 0) },  // 0.00002963493 * cos(0.46490184985 + 217.23124870110 * t)
+    { 88, 383, 85, VSOP87A_FIXED_SERIES(Z, 0) },  // 0.00002343367 * cos(1.34558278340 + 853.19638175200 * t)
+    { -397, 86, 11, VSOP87A_FIXED_SERIES(Z, 0) },  // 0.00002423663 * cos(2.92907094760 + 63.73589830340 * t)
+    { -92, 270, 81, VSOP87A_FIXED_SERIES(Z, 0) },  // 0.00001701916 * cos(1.89892525654 + 735.87651353180 * t)
+    { -38, -323, 8, VSOP87A_FIXED_SERIES(Z, 0) },  // 0.00001941205 * cos(4.59421314662 + 14.22709400160 * t)
+    { 248, 223, 24, VSOP87A_FIXED_SERIES(Z, 0) },  // 0.00001990145 * cos(0.73166053611 + 199.07200143640 * t)
+    { -245, 3, 72, VSOP87A_FIXED_SERIES(Z, 0) },  // 0.00001460265 * cos(3.12851339724 + 522.57741809380 * t)
+    { -57, -184, 18, VSOP87A_FIXED_SERIES(Z, 0) },  // 0.00001148341 * cos(4.41139213915 + 117.31986822020 * t)
+    { -183, 6, 40, VSOP87A_FIXED_SERIES(Z, 0) },  // 0.00001092809 * cos(3.10679381209 + 216.48048917570 * t)
+    { -68, 156, 79, VSOP87A_FIXED_SERIES(Z, 0) },  // 0.00001015179 * cos(1.97897195994 + 647.01083331480 * t)
+    { 106, 151, 30, VSOP87A_FIXED_SERIES(Z, 0) },  // 0.00001098254 * cos(0.96097709156 + 210.11770170030 * t)
+    { -90, 147, 61, VSOP87A_FIXED_SERIES(Z, 0) },  // 0.00001028743 * cos(2.11933059243 + 415.55249061210 * t)
+    { 73873, -311211, 35, VSOP87A_FIXED_SERIES(Z, 1) | VSOP87A_FIXED_MICRO },  // 0.01906503283 * cos(4.94544746116 + 213.29909543800 * t)
+    { -88634, 0, 0, VSOP87A_FIXED_SERIES(Z, 1) | VSOP87A_FIXED_MICRO },  // 0.00528301265 * cos(3.14159265359 + 0.00000000000 * t)
+    { -13921, 16847, 28, VSOP87A_FIXED_SERIES(Z, 1) | VSOP87A_FIXED_MICRO },  // 0.00130262284 * cos(2.26140980879 + 206.18554843720 * t)
+    { -3718, 16612, 42, VSOP87A_FIXED_SERIES(Z, 1) | VSOP87A_FIXED_MICRO },  // 0.00101466332 * cos(1.79095829545 + 220.41264243880 * t)
+    { 12541, 7116, 65, VSOP87A_FIXED_SERIES(Z, 1) | VSOP87A_FIXED_MICRO },  // 0.00085947578 * cos(0.51612788497 + 426.59819087600 * t)
+    { -3726, 242, 4, VSOP87A_FIXED_SERIES(Z, 1) | VSOP87A_FIXED_MICRO },  // 0.00022257446 * cos(3.07684015656 + 7.11354700080 * t)
+    { 984, 2530, 62, VSOP87A_FIXED_SERIES(Z, 1) | VSOP87A_FIXED_MICRO },  // 0.00016179946 * cos(1.19987517506 + 419.48464387520 * t)
+    { 1520, -170, 78, VSOP87A_FIXED_SERIES(Z, 1) },  // 0.00009117402 * cos(6.17205626814 + 639.89728631400 * t)
+    { 748, 1006, 68, VSOP87A_FIXED_SERIES(Z, 1) },  // 0.00007470703 * cos(0.93135621171 + 433.71173787680 * t)
+    { 818, 158, 52, VSOP87A_FIXED_SERIES(Z, 1) },  // 0.00004966668 * cos(0.19044864213 + 316.39186965660 * t)
+    { -207, -606, 17, VSOP87A_FIXED_SERIES(Z, 1) },  // 0.00003816564 * cos(4.38284565245 + 110.20632121940 * t)
+    { -39, 455, 46, VSOP87A_FIXED_SERIES(Z, 1) },  // 0.00002724120 * cos(1.65580138665 + 227.52618943960 * t)
+    { -271, -107, 16, VSOP87A_FIXED_SERIES(Z, 1) },  // 0.00001734540 * cos(3.51628075636 + 103.09277421860 * t)
+    { -195, 170, 24, VSOP87A_FIXED_SERIES(Z, 1) },  // 0.00001541995 * cos(2.42323572812 + 199.07200143640 * t)
+    { -198, 46, 8, VSOP87A_FIXED_SERIES(Z, 1) },  // 0.00001209302 * cos(2.91140089093 + 14.22709400160 * t)
+    { 21938, 1951, 35, VSOP87A_FIXED_SERIES(Z, 2) | VSOP87A_FIXED_MICRO },  // 0.00131275155 * cos(0.08868998101 + 213.29909543800 * t)
+    { -3623, -3530, 28, VSOP87A_FIXED_SERIES(Z, 2) | VSOP87A_FIXED_MICRO },  // 0.00030147649 * cos(3.91396203887 + 206.18554843720 * t)
+    { 3228, 299, 42, VSOP87A_FIXED_SERIES(Z, 2) | VSOP87A_FIXED_MICRO },  // 0.00019322173 * cos(0.09228748624 + 220.41264243880 * t)
+    { 804, -826, 65, VSOP87A_FIXED_SERIES(Z, 2) },  // 0.00006868926 * cos(5.48420255395 + 426.59819087600 * t)
+    { 97, 464, 4, VSOP87A_FIXED_SERIES(Z, 2) },  // 0.00002826107 * cos(1.36583318555 + 7.11354700080 * t)
+    { -436, 86, 62, VSOP87A_FIXED_SERIES(Z, 2) },  // 0.00002646332 * cos(2.94607395955 + 419.48464387520 * t)
+    { 527, 0, 0, VSOP87A_FIXED_SERIES(Z, 2) },  // 0.00003138233 * cos(0.00000000000 + 0.00000000000 * t)
+    { 205, -232, 68, VSOP87A_FIXED_SERIES(Z, 2) },  // 0.00001844798 * cos(5.43612062856 + 433.71173787680 * t)
+    { 177, -8, 46, VSOP87A_FIXED_SERIES(Z, 2) },  // 0.00001055383 * cos(6.23890785179 + 227.52618943960 * t)
+    { -63, -162, 78, VSOP87A_FIXED_SERIES(Z, 2) },  // 0.00001036435 * cos(4.33916308552 + 639.89728631400 * t)
+    { -103, 758, 35, VSOP87A_FIXED_SERIES(Z, 3) },  // 0.00004559419 * cos(1.70646871501 + 213.29909543800 * t)
+    { 610, -520, 28, VSOP87A_FIXED_SERIES(Z, 3) },  // 0.00004779074 * cos(5.57723756330 + 206.18554843720 * t)
+    { 665, 0, 0, VSOP87A_FIXED_SERIES(Z, 3) },  // 0.00003965402 * cos(0.00000000000 + 0.00000000000 * t)
+    { -26, -420, 42, VSOP87A_FIXED_SERIES(Z, 3) },  // 0.00002508242 * cos(4.64959056313 + 220.41264243880 * t)
+};
+
+// uranus: 453 terms (172 at micro precision) over 142 frequencies, 13 of them computed directly
+static const int64_t _vsop87a_fixed_uranus_rates[] = {
+    182071478LL,
+    300209504LL,
+    390199870LL,
+    990618878LL,
+    3948754026LL,
+    4344863706LL,
+    6462484728LL,
+    9152377098LL,
+    9158286908LL,
+    9166098584LL,
+    9177918204LL,
+    9185729880LL,
+    9191639690LL,
+};
+static const vsop87a_fixed_frequency_t _vsop87a_fixed_uranus_frequencies[] = {
+    { VSOP87A_FIXED_OP_ZERO | VSOP87A_FIXED_MICRO, 0, 0 },
+    { VSOP87A_FIXED_OP_BASE | VSOP87A_FIXED_MICRO, 0, 0 },
+    { VSOP87A_FIXED_OP_BASE | VSOP87A_FIXED_MICRO, 1, 0 },
+    { VSOP87A_FIXED_OP_SUM | VSOP87A_FIXED_MICRO, 1, 1 },
+    { VSOP87A_FIXED_OP_BASE | VSOP87A_FIXED_MICRO, 2, 0 },
+    { VSOP87A_FIXED_OP_SUM | VSOP87A_FIXED_MICRO, 2, 1 },
+    { VSOP87A_FIXED_OP_SUM | VSOP87A_FIXED_MICRO, 3, 1 },
+    { VSOP87A_FIXED_OP_SUM | VSOP87A_FIXED_MICRO, 3, 2 },
+    { VSOP87A_FIXED_OP_SUM | VSOP87A_FIXED_MICRO, 3, 3 },
+    { VSOP87A_FIXED_OP_SUM | VSOP87A_FIXED_MICRO, 5, 4 },
+    { VSOP87A_FIXED_OP_BASE | VSOP87A_FIXED_MICRO, 3, 0 },
+    { VSOP87A_FIXED_OP_SUM | VSOP87A_FIXED_MICRO, 9, 2 },
+    { VSOP87A_FIXED_OP_SUM | VSOP87A_FIXED_MICRO, 9, 5 },
+    { VSOP87A_FIXED_OP_SUM | VSOP87A_FIXED_MICRO, 9, 7 },
+    { VSOP87A_FIXED_OP_SUM | VSOP87A_FIXED_MICRO, 10, 8 },
+    { VSOP87A_FIXED_OP_SUM | VSOP87A_FIXED_MICRO, 11, 7 },
+    { VSOP87A_FIXED_OP_SUM | VSOP87A_FIXED_MICRO, 12, 9 },
+    { VSOP87A_FIXED_OP_SUM | VSOP87A_FIXED_MICRO, 12, 11 },
+    { VSOP87A_FIXED_OP_SUM | VSOP87A_FIXED_MICRO, 12, 12 },
+    { VSOP87A_FIXED_OP_BASE | VSOP87A_FIXED_MICRO, 4, 0 },
+    { VSOP87A_FIXED_OP_SUM | VSOP87A_FIXED_MICRO, 19, 1 },
+    { VSOP87A_FIXED_OP_SUM | VSOP87A_FIXED_MICRO, 19, 3 },
+    { VSOP87A_FIXED_OP_BASE | VSOP87A_FIXED_MICRO, 5, 0 },
+    { VSOP87A_FIXED_OP_SUM | VSOP87A_FIXED_MICRO, 19, 6 },
+    { VSOP87A_FIXED_OP_SUM | VSOP87A_FIXED_MICRO, 19, 8 },
+    { VSOP87A_FIXED_OP_SUM | VSOP87A_FIXED_MICRO, 22, 5 },
+    { VSOP87A_FIXED_OP_SUM | VSOP87A_FIXED_MICRO, 20, 8 },
+    { VSOP87A_FIXED_OP_SUM | VSOP87A_FIXED_MICRO, 21, 8 },
+    { VSOP87A_FIXED_OP_SUM | VSOP87A_FIXED_MICRO, 23, 8 },
+    { VSOP87A_FIXED_OP_SUM | VSOP87A_FIXED_MICRO, 22, 15 },
+    { VSOP87A_FIXED_OP_BASE | VSOP87A_FIXED_MICRO, 6, 0 },
+    { VSOP87A_FIXED_OP_SUM | VSOP87A_FIXED_MICRO, 30, 1 },
+    { VSOP87A_FIXED_OP_SUM | VSOP87A_FIXED_MICRO, 30, 5 },
+    { VSOP87A_FIXED_OP_SUM | VSOP87A_FIXED_MICRO, 30, 9 },
+    { VSOP87A_FIXED_OP_SUM | VSOP87A_FIXED_MICRO, 30, 11 },
+    { VSOP87A_FIXED_OP_SUM | VSOP87A_FIXED_MICRO, 30, 12 },
+    { VSOP87A_FIXED_OP_SUM | VSOP87A_FIXED_MICRO, 30, 13 },
+    { VSOP87A_FIXED_OP_SUM, 30, 14 },
+    { VSOP87A_FIXED_OP_SUM | VSOP87A_FIXED_MICRO, 30, 15 },
+    { VSOP87A_FIXED_OP_SUM | VSOP87A_FIXED_MICRO, 21, 20 },
+    { VSOP87A_FIXED_OP_SUM | VSOP87A_FIXED_MICRO, 21, 21 },
+    { VSOP87A_FIXED_OP_SUM | VSOP87A_FIXED_MICRO, 22, 22 },
+    { VSOP87A_FIXED_OP_SUM | VSOP87A_FIXED_MICRO, 32, 15 },
+    { VSOP87A_FIXED_OP_SUM | VSOP87A_FIXED_MICRO, 23, 21 },
+    { VSOP87A_FIXED_OP_SUM | VSOP87A_FIXED_MICRO, 31, 16 },
+    { VSOP87A_FIXED_OP_SUM | VSOP87A_FIXED_MICRO, 23, 23 },
+    { VSOP87A_FIXED_OP_SUM | VSOP87A_FIXED_MICRO, 33, 14 },
+    { VSOP87A_FIXED_OP_SUM, 41, 4 },
+    { VSOP87A_FIXED_OP_SUM | VSOP87A_FIXED_MICRO, 39, 7 },
+    { VSOP87A_FIXED_OP_SUM, 25, 21 },
+    { VSOP87A_FIXED_OP_BASE, 7, 0 },
+    { VSOP87A_FIXED_OP_BASE | VSOP87A_FIXED_MICRO, 8, 0 },
+    { VSOP87A_FIXED_OP_BASE, 9, 0 },
+    { VSOP87A_FIXED_OP_SUM | VSOP87A_FIXED_MICRO, 24, 23 },
+    { VSOP87A_FIXED_OP_BASE, 10, 0 },
+    { VSOP87A_FIXED_OP_BASE | VSOP87A_FIXED_MICRO, 11, 0 },
+    { VSOP87A_FIXED_OP_BASE, 12, 0 },
+    { VSOP87A_FIXED_OP_SUM, 26, 22 },
+    { VSOP87A_FIXED_OP_SUM | VSOP87A_FIXED_MICRO, 41, 6 },
+    { VSOP87A_FIXED_OP_SUM | VSOP87A_FIXED_MICRO, 38, 10 },
+    { VSOP87A_FIXED_OP_SUM | VSOP87A_FIXED_MICRO, 24, 24 },
+    { VSOP87A_FIXED_OP_SUM | VSOP87A_FIXED_MICRO, 32, 17 },
+    { VSOP87A_FIXED_OP_SUM | VSOP87A_FIXED_MICRO, 26, 24 },
+    { VSOP87A_FIXED_OP_SUM | VSOP87A_FIXED_MICRO, 33, 16 },
+    { VSOP87A_FIXED_OP_SUM | VSOP87A_FIXED_MICRO, 25, 25 },
+    { VSOP87A_FIXED_OP_SUM | VSOP87A_FIXED_MICRO, 26, 26 },
+    { VSOP87A_FIXED_OP_SUM, 36, 15 },
+    { VSOP87A_FIXED_OP_SUM, 27, 26 },
+    { VSOP87A_FIXED_OP_SUM | VSOP87A_FIXED_MICRO, 33, 18 },
+    { VSOP87A_FIXED_OP_SUM, 34, 17 },
+    { VSOP87A_FIXED_OP_SUM | VSOP87A_FIXED_MICRO, 34, 18 },
+    { VSOP87A_FIXED_OP_SUM | VSOP87A_FIXED_MICRO, 29, 22 },
+    { VSOP87A_FIXED_OP_SUM | VSOP87A_FIXED_MICRO, 36, 18 },
+    { VSOP87A_FIXED_OP_SUM, 41, 18 },
+    { VSOP87A_FIXED_OP_SUM, 53, 18 },
+    { VSOP87A_FIXED_OP_SUM | VSOP87A_FIXED_MICRO, 33, 25 },
+    { VSOP87A_FIXED_OP_SUM | VSOP87A_FIXED_MICRO, 39, 24 },
+    { VSOP87A_FIXED_OP_SUM | VSOP87A_FIXED_MICRO, 39, 26 },
+    { VSOP87A_FIXED_OP_SUM | VSOP87A_FIXED_MICRO, 39, 27 },
+    { VSOP87A_FIXED_OP_SUM, 33, 29 },
+    { VSOP87A_FIXED_OP_SUM | VSOP87A_FIXED_MICRO, 39, 28 },
+    { VSOP87A_FIXED_OP_SUM | VSOP87A_FIXED_MICRO, 40, 28 },
+    { VSOP87A_FIXED_OP_SUM, 43, 28 },
+    { VSOP87A_FIXED_OP_SUM | VSOP87A_FIXED_MICRO, 35, 35 },
+    { VSOP87A_FIXED_OP_SUM, 36, 35 },
+    { VSOP87A_FIXED_OP_SUM | VSOP87A_FIXED_MICRO, 38, 35 },
+    { VSOP87A_FIXED_OP_SUM, 41, 35 },
+    { VSOP87A_FIXED_OP_SUM, 40, 37 },
+    { VSOP87A_FIXED_OP_SUM | VSOP87A_FIXED_MICRO, 41, 38 },
+    { VSOP87A_FIXED_OP_SUM, 44, 38 },
+    { VSOP87A_FIXED_OP_SUM, 42, 41 },
+    { VSOP87A_FIXED_OP_SUM, 43, 43 },
+    { VSOP87A_FIXED_OP_SUM | VSOP87A_FIXED_MICRO, 45, 43 },
+    { VSOP87A_FIXED_OP_SUM | VSOP87A_FIXED_MICRO, 45, 44 },
+    { VSOP87A_FIXED_OP_SUM | VSOP87A_FIXED_MICRO, 45, 45 },
+    { VSOP87A_FIXED_OP_SUM | VSOP87A_FIXED_MICRO, 48, 46 },
+    { VSOP87A_FIXED_OP_SUM | VSOP87A_FIXED_MICRO, 53, 53 },
+    { VSOP87A_FIXED_OP_SUM | VSOP87A_FIXED_MICRO, 59, 58 },
+    { VSOP87A_FIXED_OP_SUM | VSOP87A_FIXED_MICRO, 60, 60 },
+    { VSOP87A_FIXED_OP_SUM, 61, 60 },
+    { VSOP87A_FIXED_OP_SUM, 62, 60 },
+    { VSOP87A_FIXED_OP_SUM, 68, 61 },
+    { VSOP87A_FIXED_OP_SUM | VSOP87A_FIXED_MICRO, 68, 64 },
+    { VSOP87A_FIXED_OP_SUM, 76, 53 },
+    { VSOP87A_FIXED_OP_SUM, 76, 60 },
+    { VSOP87A_FIXED_OP_SUM | VSOP87A_FIXED_MICRO, 76, 62 },
+    { VSOP87A_FIXED_OP_SUM, 76, 65 },
+    { VSOP87A_FIXED_OP_SUM, 76, 67 },
+    { VSOP87A_FIXED_OP_SUM, 83, 35 },
+    { VSOP87A_FIXED_OP_SUM | VSOP87A_FIXED_MICRO, 83, 53 },
+    { VSOP87A_FIXED_OP_SUM, 83, 64 },
+    { VSOP87A_FIXED_OP_SUM, 83, 70 },
+    { VSOP87A_FIXED_OP_SUM | VSOP87A_FIXED_MICRO, 83, 71 },
+    { VSOP87A_FIXED_OP_SUM, 78, 78 },
+    { VSOP87A_FIXED_OP_SUM, 79, 79 },
+    { VSOP87A_FIXED_OP_SUM | VSOP87A_FIXED_MICRO, 80, 78 },
+    { VSOP87A_FIXED_OP_SUM | VSOP87A_FIXED_MICRO, 80, 80 },
+    { VSOP87A_FIXED_OP_SUM | VSOP87A_FIXED_MICRO, 81, 80 },
+    { VSOP87A_FIXED_OP_SUM | VSOP87A_FIXED_MICRO, 81, 81 },
+    { VSOP87A_FIXED_OP_SUM, 82, 81 },
+    { VSOP87A_FIXED_OP_SUM | VSOP87A_FIXED_MICRO, 85, 75 },
+    { VSOP87A_FIXED_OP_SUM, 88, 74 },
+    { VSOP87A_FIXED_OP_SUM, 92, 82 },
+    { VSOP87A_FIXED_OP_SUM, 86, 85 },
+    { VSOP87A_FIXED_OP_SUM, 88, 88 },
+    { VSOP87A_FIXED_OP_SUM, 93, 90 },
+    { VSOP87A_FIXED_OP_SUM, 95, 95 },
+    { VSOP87A_FIXED_OP_SUM, 96, 95 },
+    { VSOP87A_FIXED_OP_SUM | VSOP87A_FIXED_MICRO, 96, 96 },
+    { VSOP87A_FIXED_OP_SUM, 97, 96 },
+    { VSOP87A_FIXED_OP_SUM, 110, 75 },
+    { VSOP87A_FIXED_OP_SUM, 108, 96 },
+    { VSOP87A_FIXED_OP_SUM, 107, 106 },
+    { VSOP87A_FIXED_OP_SUM, 120, 96 },
+    { VSOP87A_FIXED_OP_SUM, 109, 109 },
+    { VSOP87A_FIXED_OP_SUM, 112, 112 },
+    { VSOP87A_FIXED_OP_SUM, 123, 112 },
+    { VSOP87A_FIXED_OP_SUM, 133, 90 },
+    { VSOP87A_FIXED_OP_SUM | VSOP87A_FIXED_MICRO, 128, 120 },
+    { VSOP87A_FIXED_OP_SUM, 135, 79 },
+    { VSOP87A_FIXED_OP_SUM, 138, 130 },
+    { VSOP87A_FIXED_OP_SUM | VSOP87A_FIXED_MICRO, 138, 138 },
+};
+static const vsop87a_fixed_term_t _vsop87a_fixed_uranus_terms[] = {
+    { 223690056, -231174610, 53, VSOP87A_FIXED_SERIES(X, 0) | VSOP87A_FIXED_MICRO },  // 19.17370730359 * cos(5.48133416489 + 74.78159856730 * t)
+    { 22191647, 0, 0, VSOP87A_FIXED_SERIES(X, 0) | VSOP87A_FIXED_MICRO },  // 1.32272523872 * cos(0.00000000000 + 0.00000000000 * t)
+    { -661232, 7420099, 96, VSOP87A_FIXED_SERIES(X, 0) | VSOP87A_FIXED_MICRO },  // 0.44402496796 * cos(1.65967519586 + 149.56319713460 * t)
+    { -2363462, -685682, 45, VSOP87A_FIXED_SERIES(X, 0) | VSOP87A_FIXED_MICRO },  // 0.14668209481 * cos(3.42395862804 + 73.29712585900 * t)
+    { -738211, -2252798, 60, VSOP87A_FIXED_SERIES(X, 0) | VSOP87A_FIXED_MICRO },  // 0.14130269479 * cos(4.39572927934 + 76.26607127560 * t)
+    { 431853, -946509, 1, VSOP87A_FIXED_SERIES(X, 0) | VSOP87A_FIXED_MICRO },  // 0.06201106178 * cos(5.14043574125 + 1.48447270830 * t)
+    { -144274, -214932, 117, VSOP87A_FIXED_SERIES(X, 0) | VSOP87A_FIXED_MICRO },  // 0.01542951343 * cos(4.12121838072 + 224.34479570190 * t)
+    { -213741, 114122, 95, VSOP87A_FIXED_SERIES(X, 0) | VSOP87A_FIXED_MICRO },  // 0.01444216660 * cos(2.65117115201 + 148.07872442630 * t)
+    { -13918, 157932, 12, VSOP87A_FIXED_SERIES(X, 0) | VSOP87A_FIXED_MICRO },  // 0.00944995563 * cos(1.65869338757 + 11.04570026390 * t)
+    { 92518, 60081, 97, VSOP87A_FIXED_SERIES(X, 0) | VSOP87A_FIXED_MICRO },  // 0.00657524815 * cos(0.57595170636 + 151.04766984290 * t)
+    { -103934, 8622, 62, VSOP87A_FIXED_SERIES(X, 0) | VSOP87A_FIXED_MICRO },  // 0.00621624676 * cos(3.05882246638 + 77.75054398390 * t)
+    { 8527, -97806, 43, VSOP87A_FIXED_SERIES(X, 0) | VSOP87A_FIXED_MICRO },  // 0.00585182542 * cos(4.79934779678 + 71.81265315070 * t)
+    { -61528, -86766, 35, VSOP87A_FIXED_SERIES(X, 0) | VSOP87A_FIXED_MICRO },  // 0.00634000270 * cos(4.09556589724 + 63.73589830340 * t)
+    { -81090, -43220, 71, VSOP87A_FIXED_SERIES(X, 0) | VSOP87A_FIXED_MICRO },  // 0.00547699056 * cos(3.63127725056 + 85.82729883120 * t)
+    { -55389, -53311, 3, VSOP87A_FIXED_SERIES(X, 0) | VSOP87A_FIXED_MICRO },  // 0.00458219984 * cos(3.90788284112 + 2.96894541660 * t)
+    { 68717, 46959, 138, VSOP87A_FIXED_SERIES(X, 0) | VSOP87A_FIXED_MICRO },  // 0.00496087649 * cos(0.59947400861 + 529.69096509460 * t)
+    { 64068, -6141, 88, VSOP87A_FIXED_SERIES(X, 0) | VSOP87A_FIXED_MICRO },  // 0.00383625535 * cos(6.18762010576 + 138.51749687070 * t)
+    { 25454, 37052, 112, VSOP87A_FIXED_SERIES(X, 0) | VSOP87A_FIXED_MICRO },  // 0.00267938156 * cos(0.96885660137 + 213.29909543800 * t)
+    { 20294, -29895, 24, VSOP87A_FIXED_SERIES(X, 0) | VSOP87A_FIXED_MICRO },  // 0.00215368005 * cos(5.30877641428 + 38.13303563780 * t)
+    { -16583, 17915, 41, VSOP87A_FIXED_SERIES(X, 0) | VSOP87A_FIXED_MICRO },  // 0.00145505389 * cos(2.31759757085 + 70.84944530420 * t)
+    { 16261, -15848, 64, VSOP87A_FIXED_SERIES(X, 0) | VSOP87A_FIXED_MICRO },  // 0.00135340032 * cos(5.51062460816 + 78.71375183040 * t)
+    { -11511, -16434, 26, VSOP87A_FIXED_SERIES(X, 0) | VSOP87A_FIXED_MICRO },  // 0.00119593859 * cos(4.10138544267 + 39.61750834610 * t)
+    { -16996, 12315, 80, VSOP87A_FIXED_SERIES(X, 0) | VSOP87A_FIXED_MICRO },  // 0.00125105686 * cos(2.51455273063 + 111.43016149680 * t)
+    { 7443, -17118, 116, VSOP87A_FIXED_SERIES(X, 0) | VSOP87A_FIXED_MICRO },  // 0.00111260244 * cos(5.12252784325 + 222.86032299360 * t)
+    { -12677, -12140, 94, VSOP87A_FIXED_SERIES(X, 0) | VSOP87A_FIXED_MICRO },  // 0.00104619827 * cos(3.90538916334 + 146.59425171800 * t)
+    { -4708, -17866, 21, VSOP87A_FIXED_SERIES(X, 0) | VSOP87A_FIXED_MICRO },  // 0.00110125387 * cos(4.45473528724 + 35.16409022120 * t)
+    { 10192, 3149, 128, VSOP87A_FIXED_SERIES(X, 0) | VSOP87A_FIXED_MICRO },  // 0.00063584588 * cos(0.29966233158 + 299.12639426920 * t)
+    { -6402, -6388, 5, VSOP87A_FIXED_SERIES(X, 0) | VSOP87A_FIXED_MICRO },  // 0.00053904041 * cos(3.92590422507 + 3.93215326310 * t)
+    { -9080, -6060, 78, VSOP87A_FIXED_SERIES(X, 0) | VSOP87A_FIXED_MICRO },  // 0.00065066905 * cos(3.73008452906 + 109.94568878850 * t)
+    { -5910, 2878, 6, VSOP87A_FIXED_SERIES(X, 0) | VSOP87A_FIXED_MICRO },  // 0.00039181662 * cos(2.68841280769 + 4.45341812490 * t)
+    { -5731, 597, 118, VSOP87A_FIXED_SERIES(X, 0) | VSOP87A_FIXED_MICRO },  // 0.00034341683 * cos(3.03781661928 + 225.82926841020 * t)
+    { -4589, 3137, 36, VSOP87A_FIXED_SERIES(X, 0) | VSOP87A_FIXED_MICRO },  // 0.00033134636 * cos(2.54201591218 + 65.22037101170 * t)
+    { -1581, 5578, 65, VSOP87A_FIXED_SERIES(X, 0) | VSOP87A_FIXED_MICRO },  // 0.00034555652 * cos(1.84699329257 + 79.23501669220 * t)
+    { 5430, -1674, 40, VSOP87A_FIXED_SERIES(X, 0) | VSOP87A_FIXED_MICRO },  // 0.00033867050 * cos(5.98418436103 + 70.32818044240 * t)
+    { -4030, 2534, 83, VSOP87A_FIXED_SERIES(X, 0) | VSOP87A_FIXED_MICRO },  // 0.00028371614 * cos(2.58026657123 + 127.47179660680 * t)
+    { -3528, -4891, 109, VSOP87A_FIXED_SERIES(X, 0) | VSOP87A_FIXED_MICRO },  // 0.00035943348 * cos(4.08754543016 + 202.25339517410 * t)
+    { 2354, -3514, 11, VSOP87A_FIXED_SERIES(X, 0) | VSOP87A_FIXED_MICRO },  // 0.00025208833 * cos(5.30272144657 + 9.56122755560 * t)
+    { -2272, -3216, 93, VSOP87A_FIXED_SERIES(X, 0) | VSOP87A_FIXED_MICRO },  // 0.00023467802 * cos(4.09729860322 + 145.63104387150 * t)
+    { 2770, -2678, 70, VSOP87A_FIXED_SERIES(X, 0) | VSOP87A_FIXED_MICRO },  // 0.00022963939 * cos(5.51475073655 + 84.34282612290 * t)
+    { 3929, -3615, 98, VSOP87A_FIXED_SERIES(X, 0) | VSOP87A_FIXED_MICRO },  // 0.00031823951 * cos(5.53948583244 + 152.53214255120 * t)
+    { 4596, -1249, 105, VSOP87A_FIXED_SERIES(X, 0) | VSOP87A_FIXED_MICRO },  // 0.00028384953 * cos(6.01785430306 + 184.72728735580 * t)
+    { 4406, -769, 102, VSOP87A_FIXED_SERIES(X, 0) | VSOP87A_FIXED_MICRO },  // 0.00026657176 * cos(6.11027939727 + 160.60889739850 * t)
+    { 2418, -2248, 51, VSOP87A_FIXED_SERIES(X, 0) | VSOP87A_FIXED_MICRO },  // 0.00019676762 * cos(5.53431398332 + 74.66972398270 * t)
+    { -2164, 2488, 55, VSOP87A_FIXED_SERIES(X, 0) | VSOP87A_FIXED_MICRO },  // 0.00019653873 * cos(2.28660913421 + 74.89347315190 * t)
+    { 2810, 1819, 13, VSOP87A_FIXED_SERIES(X, 0) | VSOP87A_FIXED_MICRO },  // 0.00019954280 * cos(0.57450958037 + 12.53017297220 * t)
+    { 2531, 1815, 30, VSOP87A_FIXED_SERIES(X, 0) | VSOP87A_FIXED_MICRO },  // 0.00018565067 * cos(0.62225019017 + 52.69019803950 * t)
+    { -799, -3274, 18, VSOP87A_FIXED_SERIES(X, 0) | VSOP87A_FIXED_MICRO },  // 0.00020084756 * cos(4.47297488471 + 22.09140052780 * t)
+    { 572, 3294, 81, VSOP87A_FIXED_SERIES(X, 0) | VSOP87A_FIXED_MICRO },  // 0.00019926329 * cos(1.39878194708 + 112.91463420510 * t)
+    { 2605, -1711, 20, VSOP87A_FIXED_SERIES(X, 0) | VSOP87A_FIXED_MICRO },  // 0.00018575632 * cos(5.70217475790 + 33.67961751290 * t)
+    { 435, -2749, 77, VSOP87A_FIXED_SERIES(X, 0) | VSOP87A_FIXED_MICRO },  // 0.00016587870 * cos(4.86920309163 + 108.46121608020 * t)
+    { -2461, 648, 27, VSOP87A_FIXED_SERIES(X, 0) | VSOP87A_FIXED_MICRO },  // 0.00015171194 * cos(2.88415453399 + 41.10198105440 * t)
+    { 1860, -314, 42, VSOP87A_FIXED_SERIES(X, 0) | VSOP87A_FIXED_MICRO },  // 0.00011245800 * cos(6.11597016146 + 71.60020482960 * t)
+    { 2340, -18, 115, VSOP87A_FIXED_SERIES(X, 0) | VSOP87A_FIXED_MICRO },  // 0.00013948521 * cos(6.27545694160 + 221.37585028530 * t)
+    { -234, 1796, 63, VSOP87A_FIXED_SERIES(X, 0) | VSOP87A_FIXED_MICRO },  // 0.00010798350 * cos(1.70031857078 + 77.96299230500 * t)
+    { -1898, 1264, 72, VSOP87A_FIXED_SERIES(X, 0) | VSOP87A_FIXED_MICRO },  // 0.00013593955 * cos(2.55407820633 + 87.31177153950 * t)
+    { 1173, 1636, 141, VSOP87A_FIXED_SERIES(X, 0) | VSOP87A_FIXED_MICRO },  // 0.00011997848 * cos(0.94875212305 + 1059.38193018920 * t)
+    { 792, -2011, 92, VSOP87A_FIXED_SERIES(X, 0) | VSOP87A_FIXED_MICRO },  // 0.00012884351 * cos(5.08737999470 + 145.10977900970 * t)
+    { 2075, -134, 44, VSOP87A_FIXED_SERIES(X, 0) | VSOP87A_FIXED_MICRO },  // 0.00012394786 * cos(6.21892878850 + 72.33391801250 * t)
+    { 2017, 397, 23, VSOP87A_FIXED_SERIES(X, 0) | VSOP87A_FIXED_MICRO },  // 0.00012253318 * cos(0.19452856525 + 36.64856292950 * t)
+    { -388, 1897, 61, VSOP87A_FIXED_SERIES(X, 0) | VSOP87A_FIXED_MICRO },  // 0.00011538642 * cos(1.77241794539 + 77.22927912210 * t)
+    { 373, -1418, 106, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00008738409 * cos(4.96956808452 + 186.21176006410 * t)
+    { 314, 1148, 127, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00007095608 * cos(1.30384750044 + 297.64192156090 * t)
+    { -150, 1040, 99, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00006262602 * cos(1.71385983783 + 153.49535039770 * t)
+    { 1248, 143, 135, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00007487302 * cos(0.11408470667 + 426.59819087600 * t)
+    { 1173, -580, 131, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00007798974 * cos(5.82410372587 + 340.77089204480 * t)
+    { 409, -1042, 34, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00006669249 * cos(5.08626589612 + 62.25142559510 * t)
+    { -910, -157, 89, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00005505358 * cos(3.31282108025 + 140.00196957900 * t)
+    { -500, -750, 58, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00005372927 * cos(4.12498282863 + 75.30286342910 * t)
+    { -765, -470, 48, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00005354242 * cos(3.69263973447 + 74.26033370550 * t)
+    { 328, 676, 37, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00004478123 * cos(1.11838191479 + 66.70484372000 * t)
+    { -491, -513, 123, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00004233075 * cos(3.94913608184 + 265.98929347750 * t)
+    { -22, -845, 16, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00005038353 * cos(4.68664376918 + 18.15924726470 * t)
+    { 430, 635, 104, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00004570470 * cos(0.97536665751 + 183.24281464750 * t)
+    { 194, -773, 46, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00004751325 * cos(4.95762395337 + 73.81839072080 * t)
+    { 714, 217, 82, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00004448651 * cos(0.29436142982 + 114.39910691340 * t)
+    { 481, 278, 69, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00003312340 * cos(0.52418923788 + 82.85835341460 * t)
+    { -733, 192, 59, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00004515952 * cos(2.88576303120 + 75.74480641380 * t)
+    { 56, 594, 8, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00003559276 * cos(1.47627607503 + 5.93789083320 * t)
+    { 476, 272, 114, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00003268117 * cos(0.51827231333 + 220.41264243880 * t)
+    { 264, 539, 87, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00003578235 * cos(1.11528903208 + 137.03302416240 * t)
+    { 200, -463, 9, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00003004737 * cos(5.12122132051 + 7.11354700080 * t)
+    { -449, 179, 132, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00002882392 * cos(2.76136583899 + 373.90799283650 * t)
+    { -329, -281, 124, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00002579454 * cos(3.84784330333 + 277.03499374140 * t)
+    { 425, 97, 74, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00002597765 * cos(0.22409539936 + 96.87299909510 * t)
+    { -115, -414, 66, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00002560744 * cos(4.44236223450 + 80.19822453870 * t)
+    { 449, -86, 76, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00002722745 * cos(6.09456175016 + 106.97674337190 * t)
+    { 265, 331, 39, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00002528025 * cos(0.89508396542 + 68.84370773410 * t)
+    { 441, 21, 130, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00002631138 * cos(0.04831552531 + 305.34616939270 * t)
+    { 341, 256, 19, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00002541716 * cos(0.64495056482 + 32.19514480460 * t)
+    { 184, -328, 4, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00002241129 * cos(5.22377697501 + 3.18139373770 * t)
+    { 328, 30, 17, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00001965145 * cos(0.09207526632 + 20.60692781950 * t)
+    { 301, 222, 67, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00002232022 * cos(0.63571664756 + 80.71948940050 * t)
+    { 280, -164, 52, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00001933814 * cos(5.75490033864 + 74.73341445750 * t)
+    { -154, 286, 54, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00001933817 * cos(2.06557585395 + 74.82978267710 * t)
+    { -173, -314, 49, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00002138391 * cos(4.20897429922 + 74.52096613640 * t)
+    { -318, -162, 57, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00002126427 * cos(3.61171465436 + 75.04223099820 * t)
+    { -215, 304, 122, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00002215516 * cos(2.18613112875 + 259.50888592310 * t)
+    { 225, -224, 129, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00001891213 * cos(5.49941424248 + 300.61086697750 * t)
+    { 89, 311, 101, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00001927679 * cos(1.29228021932 + 159.12442469020 * t)
+    { 257, -158, 50, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00001796558 * cos(5.73271543335 + 74.62153987290 * t)
+    { -149, 261, 56, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00001792522 * cos(2.08789166984 + 74.94165726170 * t)
+    { -145, -279, 110, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00001873542 * cos(4.23391867169 + 206.18554843720 * t)
+    { 120, 346, 136, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00002182901 * cos(1.23755478345 + 479.28838891550 * t)
+    { -33, 310, 28, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00001860591 * cos(1.67536711716 + 42.58645376270 * t)
+    { -348, -5, 85, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00002075591 * cos(3.15586933464 + 131.40394986990 * t)
+    { 289, -140, 15, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00001912582 * cos(5.83091918696 + 14.97785352700 * t)
+    { -119, 227, 108, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00001529180 * cos(2.05204104820 + 191.20769491020 * t)
+    { -310, -154, 140, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00002064173 * cos(3.60208606410 + 835.03713448730 * t)
+    { 110, 276, 113, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00001768763 * cos(1.19254481620 + 219.89137757700 * t)
+    { -121, -294, 100, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00001892359 * cos(4.32128621847 + 154.01661525950 * t)
+    { -49, 297, 119, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00001797047 * cos(1.73417465594 + 227.31374111850 * t)
+    { 260, -30, 33, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00001558489 * cos(6.16891070489 + 59.80374504030 * t)
+    { 281, 3, 91, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00001672893 * cos(0.01232646186 + 143.62530630140 * t)
+    { -126, 211, 2, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00001467268 * cos(2.10975578758 + 2.44768055480 * t)
+    { 256, 116, 10, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00001677659 * cos(0.42525121334 + 8.07675484730 * t)
+    { 155, -165, 125, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00001347303 * cos(5.46763140224 + 288.08069400530 * t)
+    { 200, 214, 32, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00001744555 * cos(0.82022450313 + 56.62235130260 * t)
+    { 222, 91, 73, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00001427180 * cos(0.38786175669 + 92.94084583200 * t)
+    { 169, -128, 134, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00001263032 * cos(5.63689596853 + 404.50679034820 * t)
+    { 96, -181, 31, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00001221506 * cos(5.20012455894 + 54.17467074780 * t)
+    { 224, -140, 25, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00001574905 * cos(5.72297800263 + 39.35687591520 * t)
+    { -189, 98, 90, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00001269686 * cos(2.66330104031 + 142.44965013380 * t)
+    { 180, 160, 137, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00001438869 * cos(0.72633739717 + 522.57741809380 * t)
+    { -210, -108, 139, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00001408997 * cos(3.61751904356 + 536.80451209540 * t)
+    { -158, 178, 121, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00001418300 * cos(2.29718712012 + 235.39049596580 * t)
+    { -161, 67, 7, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00001040948 * cos(2.74644165501 + 5.41662597140 * t)
+    { 166, -130, 38, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00001256867 * cos(5.61684736425 + 67.66805156650 * t)
+    { -96, 170, 68, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00001164218 * cos(2.08302637541 + 81.89514556810 * t)
+    { -74, 152, 47, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00001009252 * cos(2.02320517037 + 74.03083904190 * t)
+    { 89, 157, 84, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00001077810 * cos(1.05685900920 + 128.95626931510 * t)
+    { -196, -55, 111, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00001212025 * cos(3.41577832660 + 211.81462272970 * t)
+    { -157, -133, 107, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00001223648 * cos(3.84373514640 + 187.69623277240 * t)
+    { -127, 184, 133, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00001334371 * cos(2.17621743689 + 380.12776796000 * t)
+    { -144, 127, 126, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00001144565 * cos(2.42148845239 + 296.15744885260 * t)
+    { -50, 202, 86, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00001241589 * cos(1.81282962357 + 134.58534360760 * t)
+    { 153, -128, 29, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00001192274 * cos(5.58661990233 + 50.40257617910 * t)
+    { -127, -132, 120, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00001093678 * cos(3.94451812233 + 230.56457082540 * t)
+    { 54, -173, 103, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00001077916 * cos(5.01417740021 + 181.75834193920 * t)
+    { -87, 176, 79, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00001166898 * cos(2.02955848543 + 110.20632121940 * t)
+    { 130, -121, 14, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00001056848 * cos(5.53440854164 + 14.01464568050 * t)
+    { 119526, -33403, 96, VSOP87A_FIXED_SERIES(X, 1) | VSOP87A_FIXED_MICRO },  // 0.00739730021 * cos(6.01067825116 + 149.56319713460 * t)
+    { -88396, 0, 0, VSOP87A_FIXED_SERIES(X, 1) | VSOP87A_FIXED_MICRO },  // 0.00526878306 * cos(3.14159265359 + 0.00000000000 * t)
+    { 23517, -32651, 45, VSOP87A_FIXED_SERIES(X, 1) | VSOP87A_FIXED_MICRO },  // 0.00239840801 * cos(5.33657762707 + 73.29712585900 * t)
+    { -30452, 23612, 60, VSOP87A_FIXED_SERIES(X, 1) | VSOP87A_FIXED_MICRO },  // 0.00229676787 * cos(2.48204455775 + 76.26607127560 * t)
+    { 14109, -12167, 12, VSOP87A_FIXED_SERIES(X, 1) | VSOP87A_FIXED_MICRO },  // 0.00111045158 * cos(5.57157235960 + 11.04570026390 * t)
+    { 15181, 5554, 35, VSOP87A_FIXED_SERIES(X, 1) | VSOP87A_FIXED_MICRO },  // 0.00096352822 * cos(0.35070389084 + 63.73589830340 * t)
+    { 4820, 12798, 71, VSOP87A_FIXED_SERIES(X, 1) | VSOP87A_FIXED_MICRO },  // 0.00081511870 * cos(1.21058618039 + 85.82729883120 * t)
+    { -5062, 5756, 88, VSOP87A_FIXED_SERIES(X, 1) | VSOP87A_FIXED_MICRO },  // 0.00045687564 * cos(2.29216583843 + 138.51749687070 * t)
+    { -4999, 7023, 117, VSOP87A_FIXED_SERIES(X, 1) | VSOP87A_FIXED_MICRO },  // 0.00051382501 * cos(2.18935125260 + 224.34479570190 * t)
+    { 6212, 1971, 41, VSOP87A_FIXED_SERIES(X, 1) | VSOP87A_FIXED_MICRO },  // 0.00038844330 * cos(0.30724575951 + 70.84944530420 * t)
+    { 1991, 5730, 64, VSOP87A_FIXED_SERIES(X, 1) | VSOP87A_FIXED_MICRO },  // 0.00036158493 * cos(1.23634798757 + 78.71375183040 * t)
+    { 1882, -5088, 53, VSOP87A_FIXED_SERIES(X, 1) | VSOP87A_FIXED_MICRO },  // 0.00032333094 * cos(5.06666556704 + 74.78159856730 * t)
+    { 811, -3547, 97, VSOP87A_FIXED_SERIES(X, 1) | VSOP87A_FIXED_MICRO },  // 0.00021685656 * cos(4.93710968392 + 151.04766984290 * t)
+    { 853, 3148, 62, VSOP87A_FIXED_SERIES(X, 1) | VSOP87A_FIXED_MICRO },  // 0.00019441970 * cos(1.30617490304 + 77.75054398390 * t)
+    { 2827, 710, 43, VSOP87A_FIXED_SERIES(X, 1) | VSOP87A_FIXED_MICRO },  // 0.00017376241 * cos(0.24607221230 + 71.81265315070 * t)
+    { 1864, -1743, 5, VSOP87A_FIXED_SERIES(X, 1) | VSOP87A_FIXED_MICRO },  // 0.00015211071 * cos(5.53141633140 + 3.93215326310 * t)
+    { -55, 1297, 42, VSOP87A_FIXED_SERIES(X, 1) },  // 0.00007735984 * cos(1.61349552789 + 71.60020482960 * t)
+    { 1242, -99, 63, VSOP87A_FIXED_SERIES(X, 1) },  // 0.00007425078 * cos(6.20357977116 + 77.96299230500 * t)
+    { -870, 787, 93, VSOP87A_FIXED_SERIES(X, 1) },  // 0.00006995857 * cos(2.40633283814 + 145.63104387150 * t)
+    { -755, 963, 3, VSOP87A_FIXED_SERIES(X, 1) },  // 0.00007291691 * cos(2.23597571444 + 2.96894541660 * t)
+    { -1181, 473, 95, VSOP87A_FIXED_SERIES(X, 1) },  // 0.00007585264 * cos(2.76074218330 + 148.07872442630 * t)
+    { -606, -416, 102, VSOP87A_FIXED_SERIES(X, 1) },  // 0.00004378335 * cos(3.74296322240 + 160.60889739850 * t)
+    { 60, 690, 18, VSOP87A_FIXED_SERIES(X, 1) },  // 0.00004127713 * cos(1.48475181305 + 22.09140052780 * t)
+    { 17, -660, 36, VSOP87A_FIXED_SERIES(X, 1) },  // 0.00003933541 * cos(4.73864204208 + 65.22037101170 * t)
+    { 456, -174, 83, VSOP87A_FIXED_SERIES(X, 1) },  // 0.00002910312 * cos(5.91941333050 + 127.47179660680 * t)
+    { 88, -460, 112, VSOP87A_FIXED_SERIES(X, 1) },  // 0.00002788434 * cos(4.90117297196 + 213.29909543800 * t)
+    { -382, -275, 30, VSOP87A_FIXED_SERIES(X, 1) },  // 0.00002802392 * cos(3.76505436434 + 52.69019803950 * t)
+    { -416, -96, 11, VSOP87A_FIXED_SERIES(X, 1) },  // 0.00002545264 * cos(3.36768337628 + 9.56122755560 * t)
+    { -77, -437, 13, VSOP87A_FIXED_SERIES(X, 1) },  // 0.00002647073 * cos(4.53813176345 + 12.53017297220 * t)
+    { -32, -532, 128, VSOP87A_FIXED_SERIES(X, 1) },  // 0.00003177614 * cos(4.65226634926 + 299.12639426920 * t)
+    { 368, 67, 72, VSOP87A_FIXED_SERIES(X, 1) },  // 0.00002228396 * cos(0.18087986338 + 87.31177153950 * t)
+    { -458, -122, 70, VSOP87A_FIXED_SERIES(X, 1) },  // 0.00002824668 * cos(3.40143685673 + 84.34282612290 * t)
+    { -404, 127, 16, VSOP87A_FIXED_SERIES(X, 1) },  // 0.00002525203 * cos(2.83821144961 + 18.15924726470 * t)
+    { 26, -371, 44, VSOP87A_FIXED_SERIES(X, 1) },  // 0.00002216987 * cos(4.78338909951 + 72.33391801250 * t)
+    { -222, -158, 99, VSOP87A_FIXED_SERIES(X, 1) },  // 0.00001624493 * cos(3.75817281127 + 153.49535039770 * t)
+    { -238, 219, 26, VSOP87A_FIXED_SERIES(X, 1) },  // 0.00001928881 * cos(2.39940180311 + 39.61750834610 * t)
+    { -142, -219, 46, VSOP87A_FIXED_SERIES(X, 1) },  // 0.00001555444 * cos(4.13741667297 + 73.81839072080 * t)
+    { 268, 22, 65, VSOP87A_FIXED_SERIES(X, 1) },  // 0.00001600865 * cos(0.08376247543 + 79.23501669220 * t)
+    { -214, -125, 59, VSOP87A_FIXED_SERIES(X, 1) },  // 0.00001476317 * cos(3.67283851029 + 75.74480641380 * t)
+    { 27, 238, 40, VSOP87A_FIXED_SERIES(X, 1) },  // 0.00001427088 * cos(1.45690759014 + 70.32818044240 * t)
+    { -216, -140, 98, VSOP87A_FIXED_SERIES(X, 1) },  // 0.00001533469 * cos(3.71776498048 + 152.53214255120 * t)
+    { -291, -31, 61, VSOP87A_FIXED_SERIES(X, 1) },  // 0.00001747266 * cos(3.24870046809 + 77.22927912210 * t)
+    { -279, -72, 116, VSOP87A_FIXED_SERIES(X, 1) },  // 0.00001716831 * cos(3.39415662657 + 222.86032299360 * t)
+    { 127, 257, 118, VSOP87A_FIXED_SERIES(X, 1) },  // 0.00001707504 * cos(1.11296012106 + 225.82926841020 * t)
+    { 184, -226, 94, VSOP87A_FIXED_SERIES(X, 1) },  // 0.00001734228 * cos(5.39619902298 + 146.59425171800 * t)
+    { -229, -94, 4, VSOP87A_FIXED_SERIES(X, 1) },  // 0.00001476617 * cos(3.53047075439 + 3.18139373770 * t)
+    { 82, -180, 114, VSOP87A_FIXED_SERIES(X, 1) },  // 0.00001179645 * cos(5.13953276367 + 220.41264243880 * t)
+    { 115, 173, 6, VSOP87A_FIXED_SERIES(X, 1) },  // 0.00001239315 * cos(0.98221206501 + 4.45341812490 * t)
+    { 40, 180, 34, VSOP87A_FIXED_SERIES(X, 1) },  // 0.00001099691 * cos(1.35138854505 + 62.25142559510 * t)
+    { 51, -171, 85, VSOP87A_FIXED_SERIES(X, 1) },  // 0.00001061312 * cos(5.00125105380 + 131.40394986990 * t)
+    { 113, -131, 78, VSOP87A_FIXED_SERIES(X, 1) },  // 0.00001029261 * cos(5.42434597865 + 109.94568878850 * t)
+    { -2063, -1722, 53, VSOP87A_FIXED_SERIES(X, 2) | VSOP87A_FIXED_MICRO },  // 0.00016015732 * cos(3.83700026619 + 74.78159856730 * t)
+    { -1820, 204, 96, VSOP87A_FIXED_SERIES(X, 2) | VSOP87A_FIXED_MICRO },  // 0.00010915299 * cos(3.02987776270 + 149.56319713460 * t)
+    { -968, -803, 12, VSOP87A_FIXED_SERIES(X, 2) },  // 0.00007497619 * cos(3.83429136661 + 11.04570026390 * t)
+    { -1119, 757, 35, VSOP87A_FIXED_SERIES(X, 2) },  // 0.00008053623 * cos(2.54646146122 + 63.73589830340 * t)
+    { 62, -905, 41, VSOP87A_FIXED_SERIES(X, 2) },  // 0.00005408033 * cos(4.78033642303 + 70.84944530420 * t)
+    { -839, 80, 64, VSOP87A_FIXED_SERIES(X, 2) },  // 0.00005021971 * cos(3.04632772928 + 78.71375183040 * t)
+    { 637, -930, 71, VSOP87A_FIXED_SERIES(X, 2) },  // 0.00006717313 * cos(5.31264214501 + 85.82729883120 * t)
+    { -462, 757, 45, VSOP87A_FIXED_SERIES(X, 2) },  // 0.00005284684 * cos(2.11901942097 + 73.29712585900 * t)
+    { 676, -460, 60, VSOP87A_FIXED_SERIES(X, 2) },  // 0.00004874936 * cos(5.68616132176 + 76.26607127560 * t)
+    { -298, -406, 88, VSOP87A_FIXED_SERIES(X, 2) },  // 0.00003002124 * cos(4.07944398452 + 138.51749687070 * t)
+    { -413, -92, 42, VSOP87A_FIXED_SERIES(X, 2) },  // 0.00002521797 * cos(3.36028253173 + 71.60020482960 * t)
+    { -102, -392, 63, VSOP87A_FIXED_SERIES(X, 2) },  // 0.00002413832 * cos(4.45865225690 + 77.96299230500 * t)
+    { 239, 286, 5, VSOP87A_FIXED_SERIES(X, 2) },  // 0.00002221373 * cos(0.87427485235 + 3.93215326310 * t)
+    { 384, 0, 0, VSOP87A_FIXED_SERIES(X, 2) },  // 0.00002291767 * cos(0.00000000000 + 0.00000000000 * t)
+    { 130, 117, 93, VSOP87A_FIXED_SERIES(X, 2) },  // 0.00001040250 * cos(0.73133408837 + 145.63104387150 * t)
+    { 160, -73, 117, VSOP87A_FIXED_SERIES(X, 2) },  // 0.00001046100 * cos(5.85311910228 + 224.34479570190 * t)
+    { 219, 0, 0, VSOP87A_FIXED_SERIES(X, 3) },  // 0.00001307049 * cos(0.00000000000 + 0.00000000000 * t)
+    { -231089951, -223571866, 53, VSOP87A_FIXED_SERIES(Y, 0) | VSOP87A_FIXED_MICRO },  // 19.16518231584 * cos(3.91045677002 + 74.78159856730 * t)
+    { 7418113, 660773, 96, VSOP87A_FIXED_SERIES(Y, 0) | VSOP87A_FIXED_MICRO },  // 0.44390465203 * cos(0.08884111329 + 149.56319713460 * t)
+    { -2727325, 0, 0, VSOP87A_FIXED_SERIES(Y, 0) | VSOP87A_FIXED_MICRO },  // 0.16256125476 * cos(3.14159265359 + 0.00000000000 * t)
+    { -692328, 2376858, 45, VSOP87A_FIXED_SERIES(Y, 0) | VSOP87A_FIXED_MICRO },  // 0.14755940186 * cos(1.85423280679 + 73.29712585900 * t)
+    { -2251739, 738044, 60, VSOP87A_FIXED_SERIES(Y, 0) | VSOP87A_FIXED_MICRO },  // 0.14123958128 * cos(2.82486076549 + 76.26607127560 * t)
+    { -954000, -435228, 1, VSOP87A_FIXED_SERIES(Y, 0) | VSOP87A_FIXED_MICRO },  // 0.06250078231 * cos(3.56960243857 + 1.48447270830 * t)
+    { -214890, 144251, 117, VSOP87A_FIXED_SERIES(Y, 0) | VSOP87A_FIXED_MICRO },  // 0.01542668264 * cos(2.55040539213 + 224.34479570190 * t)
+    { 114046, 213428, 95, VSOP87A_FIXED_SERIES(Y, 0) | VSOP87A_FIXED_MICRO },  // 0.01442356575 * cos(1.08004542712 + 148.07872442630 * t)
+    { 156857, 14591, 12, VSOP87A_FIXED_SERIES(Y, 0) | VSOP87A_FIXED_MICRO },  // 0.00938975501 * cos(0.09275714761 + 11.04570026390 * t)
+    { -101318, 40487, 35, VSOP87A_FIXED_SERIES(Y, 0) | VSOP87A_FIXED_MICRO },  // 0.00650331846 * cos(2.76142680222 + 63.73589830340 * t)
+    { 60061, -92494, 97, VSOP87A_FIXED_SERIES(Y, 0) | VSOP87A_FIXED_MICRO },  // 0.00657343120 * cos(5.28830704469 + 151.04766984290 * t)
+    { 8625, 103884, 62, VSOP87A_FIXED_SERIES(Y, 0) | VSOP87A_FIXED_MICRO },  // 0.00621326770 * cos(1.48795811387 + 77.75054398390 * t)
+    { -90443, -9364, 43, VSOP87A_FIXED_SERIES(Y, 0) | VSOP87A_FIXED_MICRO },  // 0.00541961958 * cos(3.24476486661 + 71.81265315070 * t)
+    { -43194, 81061, 71, VSOP87A_FIXED_SERIES(Y, 0) | VSOP87A_FIXED_MICRO },  // 0.00547472694 * cos(2.06037924573 + 85.82729883120 * t)
+    { -53491, 55534, 3, VSOP87A_FIXED_SERIES(Y, 0) | VSOP87A_FIXED_MICRO },  // 0.00459589120 * cos(2.33745536070 + 2.96894541660 * t)
+    { 46958, -68687, 138, VSOP87A_FIXED_SERIES(Y, 0) | VSOP87A_FIXED_MICRO },  // 0.00495936105 * cos(5.31205753740 + 529.69096509460 * t)
+    { -5987, -64807, 88, VSOP87A_FIXED_SERIES(Y, 0) | VSOP87A_FIXED_MICRO },  // 0.00387922853 * cos(4.62026923885 + 138.51749687070 * t)
+    { 37100, -25509, 112, VSOP87A_FIXED_SERIES(Y, 0) | VSOP87A_FIXED_MICRO },  // 0.00268363417 * cos(5.68085299020 + 213.29909543800 * t)
+    { -30016, -20377, 24, VSOP87A_FIXED_SERIES(Y, 0) | VSOP87A_FIXED_MICRO },  // 0.00216239629 * cos(3.73800767580 + 38.13303563780 * t)
+    { 17678, 16474, 41, VSOP87A_FIXED_SERIES(Y, 0) | VSOP87A_FIXED_MICRO },  // 0.00144032475 * cos(0.75015700920 + 70.84944530420 * t)
+    { -15845, -16253, 64, VSOP87A_FIXED_SERIES(Y, 0) | VSOP87A_FIXED_MICRO },  // 0.00135290820 * cos(3.93970260616 + 78.71375183040 * t)
+    { -16445, 11518, 26, VSOP87A_FIXED_SERIES(Y, 0) | VSOP87A_FIXED_MICRO },  // 0.00119670613 * cos(2.53058783780 + 39.61750834610 * t)
+    { 12302, 16957, 80, VSOP87A_FIXED_SERIES(Y, 0) | VSOP87A_FIXED_MICRO },  // 0.00124868545 * cos(0.94315917319 + 111.43016149680 * t)
+    { -17111, -7438, 116, VSOP87A_FIXED_SERIES(Y, 0) | VSOP87A_FIXED_MICRO },  // 0.00111204860 * cos(3.55163219419 + 222.86032299360 * t)
+    { -12113, 12677, 94, VSOP87A_FIXED_SERIES(Y, 0) | VSOP87A_FIXED_MICRO },  // 0.00104507929 * cos(2.33345675603 + 146.59425171800 * t)
+    { 17601, -4698, 21, VSOP87A_FIXED_SERIES(Y, 0) | VSOP87A_FIXED_MICRO },  // 0.00108584454 * cos(6.02234848388 + 35.16409022120 * t)
+    { 3149, -10191, 128, VSOP87A_FIXED_SERIES(Y, 0) | VSOP87A_FIXED_MICRO },  // 0.00063573747 * cos(5.01204967920 + 299.12639426920 * t)
+    { -6498, 6141, 5, VSOP87A_FIXED_SERIES(Y, 0) | VSOP87A_FIXED_MICRO },  // 0.00053289771 * cos(2.38437587876 + 3.93215326310 * t)
+    { -5911, 8919, 78, VSOP87A_FIXED_SERIES(Y, 0) | VSOP87A_FIXED_MICRO },  // 0.00063774261 * cos(2.15607602904 + 109.94568878850 * t)
+    { 2876, 5918, 6, VSOP87A_FIXED_SERIES(Y, 0) | VSOP87A_FIXED_MICRO },  // 0.00039218598 * cos(1.11841109252 + 4.45341812490 * t)
+    { 3458, 4580, 36, VSOP87A_FIXED_SERIES(Y, 0) | VSOP87A_FIXED_MICRO },  // 0.00034205426 * cos(0.92405922576 + 65.22037101170 * t)
+    { 597, 5729, 118, VSOP87A_FIXED_SERIES(Y, 0) | VSOP87A_FIXED_MICRO },  // 0.00034334377 * cos(1.46696169843 + 225.82926841020 * t)
+    { 5575, 1580, 65, VSOP87A_FIXED_SERIES(Y, 0) | VSOP87A_FIXED_MICRO },  // 0.00034538316 * cos(0.27613780697 + 79.23501669220 * t)
+    { 5704, -3293, 109, VSOP87A_FIXED_SERIES(Y, 0) | VSOP87A_FIXED_MICRO },  // 0.00039256771 * cos(5.75956853703 + 202.25339517410 * t)
+    { -3624, -2476, 11, VSOP87A_FIXED_SERIES(Y, 0) | VSOP87A_FIXED_MICRO },  // 0.00026157754 * cos(3.74097610798 + 9.56122755560 * t)
+    { -3212, 2265, 93, VSOP87A_FIXED_SERIES(Y, 0) | VSOP87A_FIXED_MICRO },  // 0.00023427328 * cos(2.52740125551 + 145.63104387150 * t)
+    { -2672, -2768, 70, VSOP87A_FIXED_SERIES(Y, 0) | VSOP87A_FIXED_MICRO },  // 0.00022933138 * cos(3.94455540350 + 84.34282612290 * t)
+    { -3614, -3928, 98, VSOP87A_FIXED_SERIES(Y, 0) | VSOP87A_FIXED_MICRO },  // 0.00031816303 * cos(3.96860170484 + 152.53214255120 * t)
+    { -1092, -4091, 40, VSOP87A_FIXED_SERIES(Y, 0) | VSOP87A_FIXED_MICRO },  // 0.00025237176 * cos(4.45141413666 + 70.32818044240 * t)
+    { -1248, -4594, 105, VSOP87A_FIXED_SERIES(Y, 0) | VSOP87A_FIXED_MICRO },  // 0.00028372491 * cos(4.44714627097 + 184.72728735580 * t)
+    { -769, -4405, 102, VSOP87A_FIXED_SERIES(Y, 0) | VSOP87A_FIXED_MICRO },  // 0.00026652859 * cos(4.53944395347 + 160.60889739850 * t)
+    { -2246, -2417, 51, VSOP87A_FIXED_SERIES(Y, 0) | VSOP87A_FIXED_MICRO },  // 0.00019666208 * cos(3.96350065335 + 74.66972398270 * t)
+    { 2487, 2163, 55, VSOP87A_FIXED_SERIES(Y, 0) | VSOP87A_FIXED_MICRO },  // 0.00019643845 * cos(0.71577796385 + 74.89347315190 * t)
+    { 1821, -2786, 13, VSOP87A_FIXED_SERIES(Y, 0) | VSOP87A_FIXED_MICRO },  // 0.00019838981 * cos(5.29113397354 + 12.53017297220 * t)
+    { 800, -3521, 23, VSOP87A_FIXED_SERIES(Y, 0) | VSOP87A_FIXED_MICRO },  // 0.00021523908 * cos(4.93565132068 + 36.64856292950 * t)
+    { -790, 2484, 30, VSOP87A_FIXED_SERIES(Y, 0) | VSOP87A_FIXED_MICRO },  // 0.00015537967 * cos(1.87863275460 + 52.69019803950 * t)
+    { -3211, -1040, 83, VSOP87A_FIXED_SERIES(Y, 0) | VSOP87A_FIXED_MICRO },  // 0.00020115100 * cos(3.45473780762 + 127.47179660680 * t)
+    { -3269, 792, 18, VSOP87A_FIXED_SERIES(Y, 0) | VSOP87A_FIXED_MICRO },  // 0.00020051641 * cos(2.90386352937 + 22.09140052780 * t)
+    { 3289, -573, 81, VSOP87A_FIXED_SERIES(Y, 0) | VSOP87A_FIXED_MICRO },  // 0.00019901477 * cos(6.11075402434 + 112.91463420510 * t)
+    { 1682, 2534, 20, VSOP87A_FIXED_SERIES(Y, 0) | VSOP87A_FIXED_MICRO },  // 0.00018126776 * cos(0.98478853787 + 33.67961751290 * t)
+    { 649, 2462, 27, VSOP87A_FIXED_SERIES(Y, 0) | VSOP87A_FIXED_MICRO },  // 0.00015174962 * cos(1.31314034959 + 41.10198105440 * t)
+    { -314, -1859, 42, VSOP87A_FIXED_SERIES(Y, 0) | VSOP87A_FIXED_MICRO },  // 0.00011239020 * cos(4.54508334011 + 71.60020482960 * t)
+    { -18, -2340, 115, VSOP87A_FIXED_SERIES(Y, 0) | VSOP87A_FIXED_MICRO },  // 0.00013948849 * cos(4.70474945682 + 221.37585028530 * t)
+    { 1800, 232, 63, VSOP87A_FIXED_SERIES(Y, 0) | VSOP87A_FIXED_MICRO },  // 0.00010819728 * cos(0.12807029856 + 77.96299230500 * t)
+    { 1264, 1897, 72, VSOP87A_FIXED_SERIES(Y, 0) | VSOP87A_FIXED_MICRO },  // 0.00013589665 * cos(0.98313719930 + 87.31177153950 * t)
+    { 1636, -1173, 141, VSOP87A_FIXED_SERIES(Y, 0) | VSOP87A_FIXED_MICRO },  // 0.00011996772 * cos(5.66129275335 + 1059.38193018920 * t)
+    { -131, -2078, 44, VSOP87A_FIXED_SERIES(Y, 0) | VSOP87A_FIXED_MICRO },  // 0.00012407787 * cos(4.64945783340 + 72.33391801250 * t)
+    { 1895, 388, 61, VSOP87A_FIXED_SERIES(Y, 0) | VSOP87A_FIXED_MICRO },  // 0.00011531140 * cos(0.20190074645 + 77.22927912210 * t)
+    { -1417, -373, 106, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00008736150 * cos(3.39874828293 + 186.21176006410 * t)
+    { 1148, -314, 127, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00007093587 * cos(6.01613487245 + 297.64192156090 * t)
+    { -756, -764, 34, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00006408245 * cos(3.93246367895 + 62.25142559510 * t)
+    { 1040, 149, 99, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00006261153 * cos(0.14258542752 + 153.49535039770 * t)
+    { 142, -1249, 135, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00007494000 * cos(4.82565771386 + 426.59819087600 * t)
+    { 570, 1188, 131, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00007856014 * cos(1.12354254831 + 340.77089204480 * t)
+    { -154, 913, 89, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00005516018 * cos(1.73758326119 + 140.00196957900 * t)
+    { -800, -479, 92, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00005556643 * cos(3.68095215063 + 145.10977900970 * t)
+    { -750, 499, 58, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00005368405 * cos(2.55422957958 + 75.30286342910 * t)
+    { -470, 765, 48, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00005350948 * cos(2.12171493922 + 74.26033370550 * t)
+    { 678, -336, 37, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00004508794 * cos(5.82224064821 + 66.70484372000 * t)
+    { 532, -484, 123, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00004290374 * cos(5.54490766551 + 265.98929347750 * t)
+    { -841, 19, 16, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00005013871 * cos(3.11907749268 + 18.15924726470 * t)
+    { 606, -399, 104, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00004326138 * cos(5.70135056853 + 183.24281464750 * t)
+    { -773, -193, 46, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00004750018 * cos(3.38678300054 + 73.81839072080 * t)
+    { 216, -714, 82, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00004445347 * cos(5.00638490308 + 114.39910691340 * t)
+    { 275, -483, 69, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00003314154 * cos(5.23054574329 + 82.85835341460 * t)
+    { 193, 731, 59, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00004509054 * cos(1.31254342829 + 75.74480641380 * t)
+    { 593, -56, 8, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00003553107 * cos(6.18906516846 + 5.93789083320 * t)
+    { 271, -476, 114, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00003265634 * cos(5.23063560176 + 220.41264243880 * t)
+    { 542, -257, 87, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00003575435 * cos(5.83994849224 + 137.03302416240 * t)
+    { 179, 449, 132, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00002880734 * cos(1.19038424330 + 373.90799283650 * t)
+    { -453, -171, 9, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00002885443 * cos(3.50279993038 + 7.11354700080 * t)
+    { 97, -424, 74, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00002594155 * cos(4.93691413537 + 96.87299909510 * t)
+    { -414, 114, 66, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00002559357 * cos(2.87184237678 + 80.19822453870 * t)
+    { -21, 449, 130, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00002676616 * cos(1.61805362044 + 305.34616939270 * t)
+    { 334, -175, 77, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00002246530 * cos(5.80081898763 + 108.46121608020 * t)
+    { -248, 333, 19, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00002474483 * cos(2.21173751117 + 32.19514480460 * t)
+    { 345, -14, 32, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00002060991 * cos(6.24178596384 + 56.62235130260 * t)
+    { 31, -327, 17, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00001958711 * cos(4.80807045815 + 20.60692781950 * t)
+    { 222, -301, 67, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00002227451 * cos(5.34765264557 + 80.71948940050 * t)
+    { 286, 155, 54, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00001937874 * cos(0.49529839431 + 74.82978267710 * t)
+    { -164, -281, 52, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00001937871 * cos(4.18462288684 + 74.73341445750 * t)
+    { 323, 166, 4, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00002164382 * cos(0.47581392325 + 3.18139373770 * t)
+    { -314, 173, 49, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00002138407 * cos(2.63817804331 + 74.52096613640 * t)
+    { -162, 319, 57, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00002130909 * cos(2.04143912495 + 75.04223099820 * t)
+    { 285, 95, 2, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00001787737 * cos(0.32096699926 + 2.44768055480 * t)
+    { 303, 214, 122, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00002212861 * cos(0.61491281306 + 259.50888592310 * t)
+    { -224, -224, 129, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00001889369 * cos(3.92852240171 + 300.61086697750 * t)
+    { 5, 382, 85, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00002275258 * cos(1.55666401505 + 131.40394986990 * t)
+    { 311, -89, 101, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00001925946 * cos(6.00527473515 + 159.12442469020 * t)
+    { -158, -258, 50, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00001802494 * cos(4.16218259902 + 74.62153987290 * t)
+    { 262, 149, 56, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00001796292 * cos(0.51761494342 + 74.94165726170 * t)
+    { 334, 173, 103, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00002240648 * cos(0.47739127862 + 181.75834193920 * t)
+    { -284, 154, 110, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00001924499 * cos(2.64284880495 + 206.18554843720 * t)
+    { -231, -145, 108, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00001626134 * cos(3.70023731184 + 191.20769491020 * t)
+    { 310, 33, 28, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00001860824 * cos(0.10445996392 + 42.58645376270 * t)
+    { -345, 121, 136, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00002177437 * cos(2.80437422101 + 479.28838891550 * t)
+    { -136, -287, 15, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00001896184 * cos(4.26975898003 + 14.97785352700 * t)
+    { 153, -307, 140, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00002045249 * cos(5.17400788104 + 835.03713448730 * t)
+    { -293, 121, 100, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00001887812 * cos(2.75000237791 + 154.01661525950 * t)
+    { 297, 49, 119, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00001794754 * cos(0.16290844853 + 227.31374111850 * t)
+    { -165, -154, 125, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00001347410 * cos(3.89237011696 + 288.08069400530 * t)
+    { 248, -90, 113, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00001572826 * cos(5.93367812903 + 219.89137757700 * t)
+    { 90, -221, 73, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00001424804 * cos(5.10004758033 + 92.94084583200 * t)
+    { 128, 170, 134, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00001267766 * cos(0.92771324396 + 404.50679034820 * t)
+    { -142, -226, 25, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00001588897 * cos(4.15115668974 + 39.35687591520 * t)
+    { 97, 190, 90, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00001269786 * cos(1.09685727529 + 142.44965013380 * t)
+    { 178, -124, 39, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00001291065 * cos(5.67425699047 + 68.84370773410 * t)
+    { 161, -180, 137, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00001436850 * cos(5.44312198350 + 522.57741809380 * t)
+    { -108, 210, 139, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00001405564 * cos(2.04677392527 + 536.80451209540 * t)
+    { 178, 158, 121, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00001416917 * cos(0.72597245494 + 235.39049596580 * t)
+    { 171, 96, 68, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00001165315 * cos(0.51071041452 + 81.89514556810 * t)
+    { 62, 162, 7, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00001035262 * cos(1.20639876458 + 5.41662597140 * t)
+    { 152, 74, 47, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00001009454 * cos(0.45375065997 + 74.03083904190 * t)
+    { -56, 197, 111, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00001220696 * cos(1.84988185963 + 211.81462272970 * t)
+    { -133, 157, 107, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00001222886 * cos(2.27306099902 + 187.69623277240 * t)
+    { -184, -128, 133, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00001336792 * cos(3.74888989756 + 380.12776796000 * t)
+    { 173, 87, 84, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00001151803 * cos(0.46579056125 + 128.95626931510 * t)
+    { 127, 145, 126, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00001149114 * cos(0.85101218281 + 296.15744885260 * t)
+    { 140, -136, 120, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00001163762 * cos(5.51157783762 + 230.56457082540 * t)
+    { 155, 126, 75, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00001192292 * cos(0.68084398426 + 99.16062095550 * t)
+    { -125, -148, 38, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00001151286 * cos(4.01147735438 + 67.66805156650 * t)
+    { -128, -153, 29, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00001189801 * cos(4.01778306134 + 50.40257617910 * t)
+    { 92, 144, 22, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00001015998 * cos(1.00290501307 + 35.42472265210 * t)
+    { 177, 87, 79, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00001174953 * cos(0.45683512473 + 110.20632121940 * t)
+    { -119, -130, 14, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00001051606 * cos(3.96907647535 + 14.01464568050 * t)
+    { 362035, 0, 0, VSOP87A_FIXED_SERIES(Y, 1) | VSOP87A_FIXED_MICRO },  // 0.02157896385 * cos(0.00000000000 + 0.00000000000 * t)
+    { -33409, -119437, 96, VSOP87A_FIXED_SERIES(Y, 1) | VSOP87A_FIXED_MICRO },  // 0.00739227349 * cos(4.43963890935 + 149.56319713460 * t)
+    { -32403, -23489, 45, VSOP87A_FIXED_SERIES(Y, 1) | VSOP87A_FIXED_MICRO },  // 0.00238545685 * cos(3.76882493145 + 73.29712585900 * t)
+    { 23593, 30406, 60, VSOP87A_FIXED_SERIES(Y, 1) | VSOP87A_FIXED_MICRO },  // 0.00229396424 * cos(0.91090183978 + 76.26607127560 * t)
+    { -11959, -14086, 12, VSOP87A_FIXED_SERIES(Y, 1) | VSOP87A_FIXED_MICRO },  // 0.00110137111 * cos(4.00844441616 + 11.04570026390 * t)
+    { 5599, -14919, 35, VSOP87A_FIXED_SERIES(Y, 1) | VSOP87A_FIXED_MICRO },  // 0.00094979054 * cos(5.07141537066 + 63.73589830340 * t)
+    { 12791, -4821, 71, VSOP87A_FIXED_SERIES(Y, 1) | VSOP87A_FIXED_MICRO },  // 0.00081474163 * cos(5.92275367106 + 85.82729883120 * t)
+    { 5668, 5102, 88, VSOP87A_FIXED_SERIES(Y, 1) | VSOP87A_FIXED_MICRO },  // 0.00045457174 * cos(0.73292241207 + 138.51749687070 * t)
+    { 7022, 4996, 117, VSOP87A_FIXED_SERIES(Y, 1) | VSOP87A_FIXED_MICRO },  // 0.00051366974 * cos(0.61844114994 + 224.34479570190 * t)
+    { 1938, -6126, 41, VSOP87A_FIXED_SERIES(Y, 1) | VSOP87A_FIXED_MICRO },  // 0.00038296005 * cos(5.01873578671 + 70.84944530420 * t)
+    { 5728, -1991, 64, VSOP87A_FIXED_SERIES(Y, 1) | VSOP87A_FIXED_MICRO },  // 0.00036146116 * cos(5.94859452787 + 78.71375183040 * t)
+    { -2049, -5039, 53, VSOP87A_FIXED_SERIES(Y, 1) | VSOP87A_FIXED_MICRO },  // 0.00032420558 * cos(4.32617271732 + 74.78159856730 * t)
+    { -3545, -809, 97, VSOP87A_FIXED_SERIES(Y, 1) | VSOP87A_FIXED_MICRO },  // 0.00021673269 * cos(3.36607263522 + 151.04766984290 * t)
+    { 3145, -853, 62, VSOP87A_FIXED_SERIES(Y, 1) | VSOP87A_FIXED_MICRO },  // 0.00019425087 * cos(6.01842187783 + 77.75054398390 * t)
+    { 718, -2828, 43, VSOP87A_FIXED_SERIES(Y, 1) | VSOP87A_FIXED_MICRO },  // 0.00017393206 * cos(4.96098895488 + 71.81265315070 * t)
+    { -1697, -1856, 5, VSOP87A_FIXED_SERIES(Y, 1) | VSOP87A_FIXED_MICRO },  // 0.00014991169 * cos(3.97176856758 + 3.93215326310 * t)
+    { 1296, 55, 42, VSOP87A_FIXED_SERIES(Y, 1) },  // 0.00007732367 * cos(0.04256630122 + 71.60020482960 * t)
+    { -101, -1244, 63, VSOP87A_FIXED_SERIES(Y, 1) },  // 0.00007438492 * cos(4.63165436478 + 77.96299230500 * t)
+    { 784, 870, 93, VSOP87A_FIXED_SERIES(Y, 1) },  // 0.00006979238 * cos(0.83723520791 + 145.63104387150 * t)
+    { 968, 757, 3, VSOP87A_FIXED_SERIES(Y, 1) },  // 0.00007321559 * cos(0.66348425538 + 2.96894541660 * t)
+    { 464, 1187, 95, VSOP87A_FIXED_SERIES(Y, 1) },  // 0.00007595636 * cos(1.19807643487 + 148.07872442630 * t)
+    { -415, 606, 102, VSOP87A_FIXED_SERIES(Y, 1) },  // 0.00004376824 * cos(2.17182724016 + 160.60889739850 * t)
+    { -664, -26, 36, VSOP87A_FIXED_SERIES(Y, 1) },  // 0.00003962568 * cos(3.18042711824 + 65.22037101170 * t)
+    { 688, -58, 18, VSOP87A_FIXED_SERIES(Y, 1) },  // 0.00004117202 * cos(6.19931612790 + 22.09140052780 * t)
+    { -465, -95, 112, VSOP87A_FIXED_SERIES(Y, 1) },  // 0.00002830313 * cos(3.34365222278 + 213.29909543800 * t)
+    { -98, 441, 11, VSOP87A_FIXED_SERIES(Y, 1) },  // 0.00002690065 * cos(1.78946471198 + 9.56122755560 * t)
+    { -435, 73, 13, VSOP87A_FIXED_SERIES(Y, 1) },  // 0.00002628159 * cos(2.97459067399 + 12.53017297220 * t)
+    { -532, 32, 128, VSOP87A_FIXED_SERIES(Y, 1) },  // 0.00003174617 * cos(3.08131638838 + 299.12639426920 * t)
+    { 68, -368, 72, VSOP87A_FIXED_SERIES(Y, 1) },  // 0.00002227510 * cos(4.89407437055 + 87.31177153950 * t)
+    { -122, 457, 70, VSOP87A_FIXED_SERIES(Y, 1) },  // 0.00002821206 * cos(1.83130010947 + 84.34282612290 * t)
+    { 124, 403, 16, VSOP87A_FIXED_SERIES(Y, 1) },  // 0.00002510693 * cos(1.27166561854 + 18.15924726470 * t)
+    { -372, -28, 44, VSOP87A_FIXED_SERIES(Y, 1) },  // 0.00002224655 * cos(3.21541108798 + 72.33391801250 * t)
+    { -9, -324, 30, VSOP87A_FIXED_SERIES(Y, 1) },  // 0.00001929662 * cos(4.68383962079 + 52.69019803950 * t)
+    { 223, -180, 83, VSOP87A_FIXED_SERIES(Y, 1) },  // 0.00001707606 * cos(5.60415260609 + 127.47179660680 * t)
+    { -157, 222, 99, VSOP87A_FIXED_SERIES(Y, 1) },  // 0.00001620819 * cos(2.18676505386 + 153.49535039770 * t)
+    { 219, 238, 26, VSOP87A_FIXED_SERIES(Y, 1) },  // 0.00001926926 * cos(0.82821252139 + 39.61750834610 * t)
+    { -219, 142, 46, VSOP87A_FIXED_SERIES(Y, 1) },  // 0.00001555611 * cos(2.56681954823 + 73.81839072080 * t)
+    { 22, -267, 65, VSOP87A_FIXED_SERIES(Y, 1) },  // 0.00001595703 * cos(4.79558057860 + 79.23501669220 * t)
+    { -125, 214, 59, VSOP87A_FIXED_SERIES(Y, 1) },  // 0.00001476550 * cos(2.10111459539 + 75.74480641380 * t)
+    { -140, 215, 98, VSOP87A_FIXED_SERIES(Y, 1) },  // 0.00001531355 * cos(2.14701519407 + 152.53214255120 * t)
+    { -32, 291, 61, VSOP87A_FIXED_SERIES(Y, 1) },  // 0.00001744564 * cos(1.67897185084 + 77.22927912210 * t)
+    { -72, 278, 116, VSOP87A_FIXED_SERIES(Y, 1) },  // 0.00001713945 * cos(1.82334975258 + 222.86032299360 * t)
+    { 257, -126, 118, VSOP87A_FIXED_SERIES(Y, 1) },  // 0.00001705184 * cos(5.82532917611 + 225.82926841020 * t)
+    { -226, -184, 94, VSOP87A_FIXED_SERIES(Y, 1) },  // 0.00001739019 * cos(3.82452086292 + 146.59425171800 * t)
+    { 216, -19, 40, VSOP87A_FIXED_SERIES(Y, 1) },  // 0.00001291753 * cos(6.19666243545 + 70.32818044240 * t)
+    { 93, -226, 4, VSOP87A_FIXED_SERIES(Y, 1) },  // 0.00001458526 * cos(5.10147126404 + 3.18139373770 * t)
+    { -180, -82, 114, VSOP87A_FIXED_SERIES(Y, 1) },  // 0.00001179966 * cos(3.56807126055 + 220.41264243880 * t)
+    { 172, -115, 6, VSOP87A_FIXED_SERIES(Y, 1) },  // 0.00001234914 * cos(5.69239889831 + 4.45341812490 * t)
+    { -34, 177, 32, VSOP87A_FIXED_SERIES(Y, 1) },  // 0.00001075108 * cos(1.76286452034 + 56.62235130260 * t)
+    { 172, -27, 34, VSOP87A_FIXED_SERIES(Y, 1) },  // 0.00001035661 * cos(6.12642568708 + 62.25142559510 * t)
+    { -180, -50, 85, VSOP87A_FIXED_SERIES(Y, 1) },  // 0.00001114523 * cos(3.41304662369 + 131.40394986990 * t)
+    { -135, -114, 78, VSOP87A_FIXED_SERIES(Y, 1) },  // 0.00001050191 * cos(3.84176879347 + 109.94568878850 * t)
+    { -5841, 0, 0, VSOP87A_FIXED_SERIES(Y, 2) | VSOP87A_FIXED_MICRO },  // 0.00034812647 * cos(3.14159265359 + 0.00000000000 * t)
+    { -1845, 2084, 53, VSOP87A_FIXED_SERIES(Y, 2) | VSOP87A_FIXED_MICRO },  // 0.00016589194 * cos(2.29556740620 + 74.78159856730 * t)
+    { 207, 1818, 96, VSOP87A_FIXED_SERIES(Y, 2) | VSOP87A_FIXED_MICRO },  // 0.00010905147 * cos(1.45737963668 + 149.56319713460 * t)
+    { -817, 953, 12, VSOP87A_FIXED_SERIES(Y, 2) },  // 0.00007484633 * cos(2.27968076918 + 11.04570026390 * t)
+    { 753, 1104, 35, VSOP87A_FIXED_SERIES(Y, 2) },  // 0.00007964298 * cos(0.97230247087 + 63.73589830340 * t)
+    { -889, -57, 41, VSOP87A_FIXED_SERIES(Y, 2) },  // 0.00005307100 * cos(3.20519221878 + 70.84944530420 * t)
+    { 80, 838, 64, VSOP87A_FIXED_SERIES(Y, 2) },  // 0.00005018595 * cos(1.47518527303 + 78.71375183040 * t)
+    { -930, -636, 71, VSOP87A_FIXED_SERIES(Y, 2) },  // 0.00006713255 * cos(3.74148881189 + 85.82729883120 * t)
+    { 754, 461, 45, VSOP87A_FIXED_SERIES(Y, 2) },  // 0.00005265170 * cos(0.54901216905 + 73.29712585900 * t)
+    { -460, -674, 60, VSOP87A_FIXED_SERIES(Y, 2) },  // 0.00004864822 * cos(4.11367426823 + 76.26607127560 * t)
+    { -401, 303, 88, VSOP87A_FIXED_SERIES(Y, 2) },  // 0.00002995853 * cos(2.49432193549 + 138.51749687070 * t)
+    { -91, 413, 42, VSOP87A_FIXED_SERIES(Y, 2) },  // 0.00002519021 * cos(1.78896824345 + 71.60020482960 * t)
+    { -393, 102, 63, VSOP87A_FIXED_SERIES(Y, 2) },  // 0.00002418371 * cos(2.88675006488 + 77.96299230500 * t)
+    { 282, -235, 5, VSOP87A_FIXED_SERIES(Y, 2) },  // 0.00002185856 * cos(5.58862614977 + 3.93215326310 * t)
+    { 117, -129, 93, VSOP87A_FIXED_SERIES(Y, 2) },  // 0.00001035578 * cos(5.44752448275 + 145.63104387150 * t)
+    { -73, -159, 117, VSOP87A_FIXED_SERIES(Y, 2) },  // 0.00001044459 * cos(4.27972239360 + 224.34479570190 * t)
+    { 203, 0, 0, VSOP87A_FIXED_SERIES(Y, 3) },  // 0.00001211380 * cos(0.00000000000 + 0.00000000000 * t)
+    { -3761304, 2168487, 53, VSOP87A_FIXED_SERIES(Z, 0) | VSOP87A_FIXED_MICRO },  // 0.25878127698 * cos(2.61861272578 + 74.78159856730 * t)
+    { -297681, 0, 0, VSOP87A_FIXED_SERIES(Z, 0) | VSOP87A_FIXED_MICRO },  // 0.01774318778 * cos(3.14159265359 + 0.00000000000 * t)
+    { 36248, -93788, 96, VSOP87A_FIXED_SERIES(Z, 0) | VSOP87A_FIXED_MICRO },  // 0.00599316131 * cos(5.08119500585 + 149.56319713460 * t)
+    { -1457, 31891, 60, VSOP87A_FIXED_SERIES(Z, 0) | VSOP87A_FIXED_MICRO },  // 0.00190281890 * cos(1.61643841193 + 76.26607127560 * t)
+    { 26810, 17515, 45, VSOP87A_FIXED_SERIES(Z, 0) | VSOP87A_FIXED_MICRO },  // 0.00190881685 * cos(0.57869575952 + 73.29712585900 * t)
+    { -9032, 10955, 1, VSOP87A_FIXED_SERIES(Z, 0) | VSOP87A_FIXED_MICRO },  // 0.00084626761 * cos(2.26030150166 + 1.48447270830 * t)
+    { 5014, 1204, 35, VSOP87A_FIXED_SERIES(Z, 0) | VSOP87A_FIXED_MICRO },  // 0.00030734257 * cos(0.23571721555 + 63.73589830340 * t)
+    { 1068, 3330, 117, VSOP87A_FIXED_SERIES(Z, 0) | VSOP87A_FIXED_MICRO },  // 0.00020842052 * cos(1.26054208091 + 224.34479570190 * t)
+    { 3216, -787, 95, VSOP87A_FIXED_SERIES(Z, 0) | VSOP87A_FIXED_MICRO },  // 0.00019734273 * cos(6.04314677688 + 148.07872442630 * t)
+    { 933, -1885, 12, VSOP87A_FIXED_SERIES(Z, 0) | VSOP87A_FIXED_MICRO },  // 0.00012537530 * cos(5.17169051466 + 11.04570026390 * t)
+    { 2424, -328, 43, VSOP87A_FIXED_SERIES(Z, 0) | VSOP87A_FIXED_MICRO },  // 0.00014582864 * cos(6.14852037212 + 71.81265315070 * t)
+    { -1523, -855, 112, VSOP87A_FIXED_SERIES(Z, 0) | VSOP87A_FIXED_MICRO },  // 0.00010407529 * cos(3.65320417038 + 213.29909543800 * t)
+    { -1727, -767, 138, VSOP87A_FIXED_SERIES(Z, 0) | VSOP87A_FIXED_MICRO },  // 0.00011261541 * cos(3.55973769686 + 529.69096509460 * t)
+    { -928, -1160, 97, VSOP87A_FIXED_SERIES(Z, 0) },  // 0.00008855669 * cos(4.03774505739 + 151.04766984290 * t)
+    { 1302, 464, 62, VSOP87A_FIXED_SERIES(Z, 0) },  // 0.00008239460 * cos(0.34225652715 + 77.75054398390 * t)
+    { 998, 885, 71, VSOP87A_FIXED_SERIES(Z, 0) },  // 0.00007950169 * cos(0.72564903051 + 85.82729883120 * t)
+    { 791, 838, 3, VSOP87A_FIXED_SERIES(Z, 0) },  // 0.00006867469 * cos(0.81417174224 + 2.96894541660 * t)
+    { -902, -291, 88, VSOP87A_FIXED_SERIES(Z, 0) },  // 0.00005648720 * cos(3.45324719543 + 138.51749687070 * t)
+    { -97, 763, 24, VSOP87A_FIXED_SERIES(Z, 0) },  // 0.00004581938 * cos(1.69668682344 + 38.13303563780 * t)
+    { 202, -383, 80, VSOP87A_FIXED_SERIES(Z, 0) },  // 0.00002578399 * cos(5.19696447390 + 111.43016149680 * t)
+    { 492, -69, 21, VSOP87A_FIXED_SERIES(Z, 0) },  // 0.00002964070 * cos(6.14338802239 + 35.16409022120 * t)
+    { -273, 160, 64, VSOP87A_FIXED_SERIES(Z, 0) },  // 0.00001884104 * cos(2.61192472648 + 78.71375183040 * t)
+    { 332, -207, 41, VSOP87A_FIXED_SERIES(Z, 0) },  // 0.00002330304 * cos(5.72640226150 + 70.84944530420 * t)
+    { 240, 230, 26, VSOP87A_FIXED_SERIES(Z, 0) },  // 0.00001985215 * cos(0.76408839812 + 39.61750834610 * t)
+    { 104, 273, 94, VSOP87A_FIXED_SERIES(Z, 0) },  // 0.00001743154 * cos(1.20586281789 + 146.59425171800 * t)
+    { 198, 279, 40, VSOP87A_FIXED_SERIES(Z, 0) },  // 0.00002037011 * cos(0.95353587037 + 70.32818044240 * t)
+    { -161, 195, 116, VSOP87A_FIXED_SERIES(Z, 0) },  // 0.00001508924 * cos(2.26195448553 + 222.86032299360 * t)
+    { -158, 89, 77, VSOP87A_FIXED_SERIES(Z, 0) },  // 0.00001082736 * cos(2.62872874057 + 108.46121608020 * t)
+    { 128, 121, 78, VSOP87A_FIXED_SERIES(Z, 0) },  // 0.00001051968 * cos(0.75560753840 + 109.94568878850 * t)
+    { 110036, 1400, 53, VSOP87A_FIXED_SERIES(Z, 1) | VSOP87A_FIXED_MICRO },  // 0.00655916626 * cos(0.01271947660 + 74.78159856730 * t)
+    { 8330, 0, 0, VSOP87A_FIXED_SERIES(Z, 1) | VSOP87A_FIXED_MICRO },  // 0.00049648951 * cos(0.00000000000 + 0.00000000000 * t)
+    { -3685, 1570, 96, VSOP87A_FIXED_SERIES(Z, 1) | VSOP87A_FIXED_MICRO },  // 0.00023874178 * cos(2.73870491220 + 149.56319713460 * t)
+    { 892, -900, 60, VSOP87A_FIXED_SERIES(Z, 1) },  // 0.00007552177 * cos(5.49304207700 + 76.26607127560 * t)
+    { -888, -452, 45, VSOP87A_FIXED_SERIES(Z, 1) },  // 0.00005941304 * cos(3.61254073304 + 73.29712585900 * t)
+    { -244, -415, 35, VSOP87A_FIXED_SERIES(Z, 1) },  // 0.00002868429 * cos(4.17954157878 + 63.73589830340 * t)
+    { 334, -105, 1, VSOP87A_FIXED_SERIES(Z, 1) },  // 0.00002087455 * cos(5.97858625817 + 1.48447270830 * t)
+    { -280, 126, 12, VSOP87A_FIXED_SERIES(Z, 1) },  // 0.00001827697 * cos(2.71810813335 + 11.04570026390 * t)
+    { -41, -215, 71, VSOP87A_FIXED_SERIES(Z, 1) },  // 0.00001305063 * cos(4.52337002195 + 85.82729883120 * t)
+    { 111, -160, 117, VSOP87A_FIXED_SERIES(Z, 1) },  // 0.00001158250 * cos(5.31913504112 + 224.34479570190 * t)
+    { -443, 2426, 53, VSOP87A_FIXED_SERIES(Z, 2) | VSOP87A_FIXED_MICRO },  // 0.00014697858 * cos(1.75149165003 + 74.78159856730 * t)
+    { -268, 0, 0, VSOP87A_FIXED_SERIES(Z, 2) },  // 0.00001600044 * cos(3.14159265359 + 0.00000000000 * t)
+};
+
+// neptune: 191 terms (70 at micro precision) over 64 frequencies, 16 of them computed directly
+static const int64_t _vsop87a_fixed_neptune_rates[] = {
+    182071478LL,
+    514247707LL,
+    990618878LL,
+    3504349580LL,
+    3948754026LL,
+    4162792229LL,
+    4376830432LL,
+    4613106484LL,
+    4663318450LL,
+    4671130125LL,
+    4682949746LL,
+    4690761421LL,
+    25288782497LL,
+    64094437095LL,
+    64966917947LL,
+    65839398798LL,
+};
+static const vsop87a_fixed_frequency_t _vsop87a_fixed_neptune_frequencies[] = {
+    { VSOP87A_FIXED_OP_ZERO | VSOP87A_FIXED_MICRO, 0, 0 },
+    { VSOP87A_FIXED_OP_BASE | VSOP87A_FIXED_MICRO, 0, 0 },
+    { VSOP87A_FIXED_OP_SUM | VSOP87A_FIXED_MICRO, 1, 1 },
+    { VSOP87A_FIXED_OP_BASE, 1, 0 },
+    { VSOP87A_FIXED_OP_SUM | VSOP87A_FIXED_MICRO, 2, 1 },
+    { VSOP87A_FIXED_OP_SUM | VSOP87A_FIXED_MICRO, 2, 2 },
+    { VSOP87A_FIXED_OP_BASE | VSOP87A_FIXED_MICRO, 2, 0 },
+    { VSOP87A_FIXED_OP_BASE | VSOP87A_FIXED_MICRO, 3, 0 },
+    { VSOP87A_FIXED_OP_SUM | VSOP87A_FIXED_MICRO, 7, 1 },
+    { VSOP87A_FIXED_OP_BASE | VSOP87A_FIXED_MICRO, 4, 0 },
+    { VSOP87A_FIXED_OP_SUM | VSOP87A_FIXED_MICRO, 9, 1 },
+    { VSOP87A_FIXED_OP_BASE, 5, 0 },
+    { VSOP87A_FIXED_OP_SUM | VSOP87A_FIXED_MICRO, 9, 2 },
+    { VSOP87A_FIXED_OP_BASE | VSOP87A_FIXED_MICRO, 6, 0 },
+    { VSOP87A_FIXED_OP_SUM | VSOP87A_FIXED_MICRO, 7, 6 },
+    { VSOP87A_FIXED_OP_SUM | VSOP87A_FIXED_MICRO, 13, 1 },
+    { VSOP87A_FIXED_OP_BASE | VSOP87A_FIXED_MICRO, 7, 0 },
+    { VSOP87A_FIXED_OP_SUM, 10, 3 },
+    { VSOP87A_FIXED_OP_BASE, 8, 0 },
+    { VSOP87A_FIXED_OP_BASE, 9, 0 },
+    { VSOP87A_FIXED_OP_SUM | VSOP87A_FIXED_MICRO, 8, 6 },
+    { VSOP87A_FIXED_OP_BASE, 10, 0 },
+    { VSOP87A_FIXED_OP_BASE, 11, 0 },
+    { VSOP87A_FIXED_OP_SUM, 11, 4 },
+    { VSOP87A_FIXED_OP_SUM | VSOP87A_FIXED_MICRO, 13, 2 },
+    { VSOP87A_FIXED_OP_SUM | VSOP87A_FIXED_MICRO, 16, 1 },
+    { VSOP87A_FIXED_OP_SUM | VSOP87A_FIXED_MICRO, 10, 5 },
+    { VSOP87A_FIXED_OP_SUM, 16, 2 },
+    { VSOP87A_FIXED_OP_SUM | VSOP87A_FIXED_MICRO, 12, 5 },
+    { VSOP87A_FIXED_OP_SUM, 17, 4 },
+    { VSOP87A_FIXED_OP_SUM | VSOP87A_FIXED_MICRO, 14, 5 },
+    { VSOP87A_FIXED_OP_SUM | VSOP87A_FIXED_MICRO, 20, 5 },
+    { VSOP87A_FIXED_OP_SUM, 20, 6 },
+    { VSOP87A_FIXED_OP_SUM, 26, 6 },
+    { VSOP87A_FIXED_OP_SUM | VSOP87A_FIXED_MICRO, 12, 12 },
+    { VSOP87A_FIXED_OP_SUM | VSOP87A_FIXED_MICRO, 14, 12 },
+    { VSOP87A_FIXED_OP_SUM, 20, 11 },
+    { VSOP87A_FIXED_OP_SUM | VSOP87A_FIXED_MICRO, 14, 14 },
+    { VSOP87A_FIXED_OP_SUM | VSOP87A_FIXED_MICRO, 16, 15 },
+    { VSOP87A_FIXED_OP_SUM | VSOP87A_FIXED_MICRO, 20, 20 },
+    { VSOP87A_FIXED_OP_SUM | VSOP87A_FIXED_MICRO, 25, 24 },
+    { VSOP87A_FIXED_OP_SUM, 26, 26 },
+    { VSOP87A_FIXED_OP_SUM | VSOP87A_FIXED_MICRO, 34, 7 },
+    { VSOP87A_FIXED_OP_SUM, 34, 14 },
+    { VSOP87A_FIXED_OP_SUM, 34, 20 },
+    { VSOP87A_FIXED_OP_SUM, 34, 26 },
+    { VSOP87A_FIXED_OP_SUM | VSOP87A_FIXED_MICRO, 34, 28 },
+    { VSOP87A_FIXED_OP_SUM | VSOP87A_FIXED_MICRO, 34, 30 },
+    { VSOP87A_FIXED_OP_SUM | VSOP87A_FIXED_MICRO, 34, 31 },
+    { VSOP87A_FIXED_OP_SUM, 35, 31 },
+    { VSOP87A_FIXED_OP_SUM, 42, 20 },
+    { VSOP87A_FIXED_OP_SUM, 37, 35 },
+    { VSOP87A_FIXED_OP_SUM, 38, 37 },
+    { VSOP87A_FIXED_OP_SUM, 38, 38 },
+    { VSOP87A_FIXED_OP_SUM, 43, 38 },
+    { VSOP87A_FIXED_OP_BASE, 12, 0 },
+    { VSOP87A_FIXED_OP_SUM | VSOP87A_FIXED_MICRO, 48, 42 },
+    { VSOP87A_FIXED_OP_SUM, 54, 24 },
+    { VSOP87A_FIXED_OP_SUM, 56, 42 },
+    { VSOP87A_FIXED_OP_SUM, 56, 56 },
+    { VSOP87A_FIXED_OP_BASE, 13, 0 },
+    { VSOP87A_FIXED_OP_BASE | VSOP87A_FIXED_MICRO, 14, 0 },
+    { VSOP87A_FIXED_OP_BASE, 15, 0 },
+    { VSOP87A_FIXED_OP_SUM | VSOP87A_FIXED_MICRO, 61, 61 },
+};
+static const vsop87a_fixed_term_t _vsop87a_fixed_neptune_terms[] = {
+    { 284637117, -416299052, 20, VSOP87A_FIXED_SERIES(X, 0) | VSOP87A_FIXED_MICRO },  // 30.05890004476 * cos(5.31211340029 + 38.13303563780 * t)
+    { -4543298, 0, 0, VSOP87A_FIXED_SERIES(X, 0) | VSOP87A_FIXED_MICRO },  // 0.27080164222 * cos(3.14159265359 + 0.00000000000 * t)
+    { -2121265, -796506, 39, VSOP87A_FIXED_SERIES(X, 0) | VSOP87A_FIXED_MICRO },  // 0.13505661755 * cos(3.50078975634 + 76.26607127560 * t)
+    { 2621517, 298005, 14, VSOP87A_FIXED_SERIES(X, 0) | VSOP87A_FIXED_MICRO },  // 0.15726094556 * cos(0.11319072675 + 36.64856292950 * t)
+    { 1169955, 2215790, 26, VSOP87A_FIXED_SERIES(X, 0) | VSOP87A_FIXED_MICRO },  // 0.14935120126 * cos(1.08499403018 + 39.61750834610 * t)
+    { -179714, 396972, 1, VSOP87A_FIXED_SERIES(X, 0) | VSOP87A_FIXED_MICRO },  // 0.02597313814 * cos(1.99590301412 + 1.48447270830 * t)
+    { 112271, -140944, 38, VSOP87A_FIXED_SERIES(X, 0) | VSOP87A_FIXED_MICRO },  // 0.01074040708 * cos(5.38502938672 + 74.78159856730 * t)
+    { 19092, 136885, 12, VSOP87A_FIXED_SERIES(X, 0) | VSOP87A_FIXED_MICRO },  // 0.00823793287 * cos(1.43221581862 + 35.16409022120 * t)
+    { 97341, 96643, 2, VSOP87A_FIXED_SERIES(X, 0) | VSOP87A_FIXED_MICRO },  // 0.00817588813 * cos(0.78180174031 + 2.96894541660 * t)
+    { 90823, -27453, 28, VSOP87A_FIXED_SERIES(X, 0) | VSOP87A_FIXED_MICRO },  // 0.00565534918 * cos(5.98964907613 + 41.10198105440 * t)
+    { 68666, 46925, 61, VSOP87A_FIXED_SERIES(X, 0) | VSOP87A_FIXED_MICRO },  // 0.00495719107 * cos(0.59948143567 + 529.69096509460 * t)
+    { 47517, 20103, 37, VSOP87A_FIXED_SERIES(X, 0) | VSOP87A_FIXED_MICRO },  // 0.00307525907 * cos(0.40023311011 + 73.29712585900 * t)
+    { 29298, 35042, 56, VSOP87A_FIXED_SERIES(X, 0) | VSOP87A_FIXED_MICRO },  // 0.00272253551 * cos(0.87443494387 + 213.29909543800 * t)
+    { 16891, -15312, 40, VSOP87A_FIXED_SERIES(X, 0) | VSOP87A_FIXED_MICRO },  // 0.00135887219 * cos(5.54676577816 + 77.75054398390 * t)
+    { -1801, 15155, 48, VSOP87A_FIXED_SERIES(X, 0) | VSOP87A_FIXED_MICRO },  // 0.00090965704 * cos(1.68910246115 + 114.39910691340 * t)
+    { 10438, -5023, 4, VSOP87A_FIXED_SERIES(X, 0) | VSOP87A_FIXED_MICRO },  // 0.00069040539 * cos(5.83469123520 + 4.45341812490 * t)
+    { -8876, 5031, 10, VSOP87A_FIXED_SERIES(X, 0) | VSOP87A_FIXED_MICRO },  // 0.00060813556 * cos(2.62589958380 + 33.67961751290 * t)
+    { 117, 9175, 35, VSOP87A_FIXED_SERIES(X, 0) | VSOP87A_FIXED_MICRO },  // 0.00054690827 * cos(1.55799996661 + 71.81265315070 * t)
+    { 374, -4832, 30, VSOP87A_FIXED_SERIES(X, 0) | VSOP87A_FIXED_MICRO },  // 0.00028889260 * cos(4.78966826027 + 42.58645376270 * t)
+    { -1925, -879, 47, VSOP87A_FIXED_SERIES(X, 0) | VSOP87A_FIXED_MICRO },  // 0.00012614732 * cos(3.57002516434 + 112.91463420510 * t)
+    { -1966, 842, 46, VSOP87A_FIXED_SERIES(X, 0) | VSOP87A_FIXED_MICRO },  // 0.00012749153 * cos(2.73719269645 + 111.43016149680 * t)
+    { 1174, 1639, 63, VSOP87A_FIXED_SERIES(X, 0) | VSOP87A_FIXED_MICRO },  // 0.00012013994 * cos(0.94912933496 + 1059.38193018920 * t)
+    { -1182, 450, 34, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00007540650 * cos(2.77783477855 + 70.32818044240 * t)
+    { 1264, 127, 59, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00007573383 * cos(0.10011329853 + 426.59819087600 * t)
+    { -92, 1340, 44, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00008004318 * cos(1.63965626260 + 108.46121608020 * t)
+    { -94, -1081, 5, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00006464842 * cos(4.62580066013 + 5.93789083320 * t)
+    { -724, -590, 9, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00005565860 * cos(3.82502185953 + 32.19514480460 * t)
+    { 777, 81, 16, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00004654361 * cos(0.10385887980 + 37.61177077600 * t)
+    { -458, -648, 41, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00004732434 * cos(4.09723977191 + 79.23501669220 * t)
+    { 349, 680, 24, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00004557247 * cos(1.09712669317 + 38.65430049960 * t)
+    { -524, 502, 19, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00004322550 * cos(2.37744780188 + 38.08485152800 * t)
+    { 277, -669, 21, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00004315539 * cos(5.10473142056 + 38.18121974760 * t)
+    { -282, 625, 15, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00004089036 * cos(1.99429048244 + 37.16982779130 * t)
+    { 568, -431, 7, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00004249674 * cos(5.63324475823 + 28.57180808220 * t)
+    { 463, -467, 25, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00003920412 * cos(5.49263784865 + 39.09624348430 * t)
+    { -442, 494, 42, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00003951848 * cos(2.29996934110 + 98.89998852460 * t)
+    { -14, -557, 3, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00003322735 * cos(4.68798591938 + 4.19278569400 * t)
+    { -141, 502, 33, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00003108292 * cos(1.84434543409 + 47.69426319340 * t)
+    { -134, 530, 51, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00003260095 * cos(1.81839652878 + 145.10977900970 * t)
+    { -355, -288, 45, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00002723442 * cos(3.82296285941 + 109.94568878850 * t)
+    { -21, -423, 58, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00002522938 * cos(4.66296126912 + 312.19908396260 * t)
+    { -316, -20, 13, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00001887430 * cos(3.20485417792 + 35.68535508300 * t)
+    { -166, -221, 8, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00001648985 * cos(4.06990666591 + 30.05628079050 * t)
+    { -277, -130, 31, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00001826700 * cos(3.58024318649 + 44.07092647100 * t)
+    { -173, -277, 55, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00001945462 * cos(4.15326825288 + 206.18554843720 * t)
+    { -119, -256, 27, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00001681255 * cos(4.27560304282 + 40.58071619260 * t)
+    { 99, 238, 18, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00001533383 * cos(1.17732211665 + 38.02116105320 * t)
+    { 232, 216, 57, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00001891892 * cos(0.74998855536 + 220.41264243880 * t)
+    { 256, 6, 22, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00001527526 * cos(0.02173640246 + 38.24491022240 * t)
+    { 1, 350, 53, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00002084477 * cos(1.56821671369 + 149.56319713460 * t)
+    { -333, 105, 50, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00002083682 * cos(2.83676961811 + 137.03302416240 * t)
+    { -264, 62, 43, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00001615063 * cos(2.91063835010 + 106.97674337190 * t)
+    { -204, -58, 32, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00001265797 * cos(3.42037275447 + 46.20979048510 * t)
+    { 222, 139, 17, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00001560429 * cos(0.55865739143 + 37.87240320690 * t)
+    { 208, 155, 23, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00001545705 * cos(0.64028780672 + 38.39366806870 * t)
+    { 180, 160, 60, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00001434798 * cos(0.72658718863 + 522.57741809380 * t)
+    { -197, 83, 11, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00001271543 * cos(2.74412981229 + 33.94024994380 * t)
+    { -210, -108, 62, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00001407422 * cos(3.61743288666 + 536.80451209540 * t)
+    { -195, -127, 49, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00001387922 * cos(3.71814330952 + 115.88357962170 * t)
+    { -193, 71, 36, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00001228939 * cos(2.78878211792 + 72.07328558160 * t)
+    { -98, 222, 54, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00001448439 * cos(1.98814317259 + 181.75834193920 * t)
+    { -130, -147, 6, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00001170078 * cos(3.98594689041 + 8.07675484730 * t)
+    { 8, -181, 29, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00001080795 * cos(4.75485636019 + 42.32582133180 * t)
+    { -180, 97, 52, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00001220341 * cos(2.64791449584 + 148.07872442630 * t)
+    { -18614, 38677, 14, VSOP87A_FIXED_SERIES(X, 1) | VSOP87A_FIXED_MICRO },  // 0.00255840261 * cos(2.01935686795 + 36.64856292950 * t)
+    { 27797, -29852, 26, VSOP87A_FIXED_SERIES(X, 1) | VSOP87A_FIXED_MICRO },  // 0.00243125299 * cos(5.46214902873 + 39.61750834610 * t)
+    { -19201, 5089, 39, VSOP87A_FIXED_SERIES(X, 1) | VSOP87A_FIXED_MICRO },  // 0.00118398168 * cos(2.88251845061 + 76.26607127560 * t)
+    { -6370, 0, 0, VSOP87A_FIXED_SERIES(X, 1) | VSOP87A_FIXED_MICRO },  // 0.00037965449 * cos(3.14159265359 + 0.00000000000 * t)
+    { -3672, -220, 12, VSOP87A_FIXED_SERIES(X, 1) | VSOP87A_FIXED_MICRO },  // 0.00021924705 * cos(3.20156164152 + 35.16409022120 * t)
+    { -1271, -2639, 28, VSOP87A_FIXED_SERIES(X, 1) | VSOP87A_FIXED_MICRO },  // 0.00017459808 * cos(4.26349398817 + 41.10198105440 * t)
+    { 1336, -1751, 2, VSOP87A_FIXED_SERIES(X, 1) | VSOP87A_FIXED_MICRO },  // 0.00013130617 * cos(5.36424961848 + 2.96894541660 * t)
+    { -295, 801, 20, VSOP87A_FIXED_SERIES(X, 1) },  // 0.00005086527 * cos(1.92377354729 + 38.13303563780 * t)
+    { -410, 712, 37, VSOP87A_FIXED_SERIES(X, 1) },  // 0.00004899718 * cos(2.09349497813 + 73.29712585900 * t)
+    { -279, -367, 40, VSOP87A_FIXED_SERIES(X, 1) },  // 0.00002745267 * cos(4.06252818667 + 77.75054398390 * t)
+    { -118, -351, 10, VSOP87A_FIXED_SERIES(X, 1) },  // 0.00002204414 * cos(4.38855639521 + 33.67961751290 * t)
+    { -204, -301, 4, VSOP87A_FIXED_SERIES(X, 1) },  // 0.00002168719 * cos(4.11768012563 + 4.45341812490 * t)
+    { 125, 232, 48, VSOP87A_FIXED_SERIES(X, 1) },  // 0.00001572202 * cos(1.07606611589 + 114.39910691340 * t)
+    { -224, 23, 30, VSOP87A_FIXED_SERIES(X, 1) },  // 0.00001344022 * cos(3.03802059051 + 42.58645376270 * t)
+    { 208, -55, 38, VSOP87A_FIXED_SERIES(X, 1) },  // 0.00001285542 * cos(6.02367554997 + 74.78159856730 * t)
+    { 901, 0, 0, VSOP87A_FIXED_SERIES(X, 2) },  // 0.00005371138 * cos(0.00000000000 + 0.00000000000 * t)
+    { 236, -724, 14, VSOP87A_FIXED_SERIES(X, 2) },  // 0.00004536283 * cos(5.02700751836 + 36.64856292950 * t)
+    { -564, 463, 26, VSOP87A_FIXED_SERIES(X, 2) },  // 0.00004350766 * cos(2.45420254304 + 39.61750834610 * t)
+    { 422, 303, 20, VSOP87A_FIXED_SERIES(X, 2) },  // 0.00003092965 * cos(0.62250463031 + 38.13303563780 * t)
+    { -80, 354, 39, VSOP87A_FIXED_SERIES(X, 2) },  // 0.00002163703 * cos(1.79218168368 + 76.26607127560 * t)
+    { -416451315, -284463777, 20, VSOP87A_FIXED_SERIES(Y, 0) | VSOP87A_FIXED_MICRO },  // 30.06056351665 * cos(3.74086294714 + 38.13303563780 * t)
+    { -5067702, 0, 0, VSOP87A_FIXED_SERIES(Y, 0) | VSOP87A_FIXED_MICRO },  // 0.30205857683 * cos(3.14159265359 + 0.00000000000 * t)
+    { -795567, 2121748, 39, VSOP87A_FIXED_SERIES(Y, 0) | VSOP87A_FIXED_MICRO },  // 0.13506391797 * cos(1.92953034883 + 76.26607127560 * t)
+    { 297164, -2618319, 14, VSOP87A_FIXED_SERIES(Y, 0) | VSOP87A_FIXED_MICRO },  // 0.15706589373 * cos(4.82539970129 + 36.64856292950 * t)
+    { 2215437, -1170999, 26, VSOP87A_FIXED_SERIES(Y, 0) | VSOP87A_FIXED_MICRO },  // 0.14936165806 * cos(5.79694900665 + 39.61750834610 * t)
+    { 394906, 178964, 1, VSOP87A_FIXED_SERIES(Y, 0) | VSOP87A_FIXED_MICRO },  // 0.02584250749 * cos(0.42549700754 + 1.48447270830 * t)
+    { -140962, -112166, 38, VSOP87A_FIXED_SERIES(Y, 0) | VSOP87A_FIXED_MICRO },  // 0.01073739772 * cos(3.81371728533 + 74.78159856730 * t)
+    { 96370, -97045, 2, VSOP87A_FIXED_SERIES(Y, 0) | VSOP87A_FIXED_MICRO },  // 0.00815187583 * cos(5.49429775826 + 2.96894541660 * t)
+    { 97309, -8472, 12, VSOP87A_FIXED_SERIES(Y, 0) | VSOP87A_FIXED_MICRO },  // 0.00582199295 * cos(6.19633718936 + 35.16409022120 * t)
+    { -27493, -90818, 28, VSOP87A_FIXED_SERIES(Y, 0) | VSOP87A_FIXED_MICRO },  // 0.00565576412 * cos(4.41843009015 + 41.10198105440 * t)
+    { 46924, -68638, 61, VSOP87A_FIXED_SERIES(Y, 0) | VSOP87A_FIXED_MICRO },  // 0.00495581047 * cos(5.31205825784 + 529.69096509460 * t)
+    { 19806, -47096, 37, VSOP87A_FIXED_SERIES(Y, 0) | VSOP87A_FIXED_MICRO },  // 0.00304525203 * cos(5.11048113661 + 73.29712585900 * t)
+    { 35069, -29368, 56, VSOP87A_FIXED_SERIES(Y, 0) | VSOP87A_FIXED_MICRO },  // 0.00272640298 * cos(5.58603690785 + 213.29909543800 * t)
+    { -15321, -16885, 40, VSOP87A_FIXED_SERIES(Y, 0) | VSOP87A_FIXED_MICRO },  // 0.00135897385 * cos(3.97553750964 + 77.75054398390 * t)
+    { 15157, 1794, 48, VSOP87A_FIXED_SERIES(Y, 0) | VSOP87A_FIXED_MICRO },  // 0.00090970871 * cos(0.11783619888 + 114.39910691340 * t)
+    { -5004, -10400, 4, VSOP87A_FIXED_SERIES(Y, 0) | VSOP87A_FIXED_MICRO },  // 0.00068790261 * cos(4.26391997151 + 4.45341812490 * t)
+    { -4833, -372, 30, VSOP87A_FIXED_SERIES(Y, 0) | VSOP87A_FIXED_MICRO },  // 0.00028893355 * cos(3.21848975032 + 42.58645376270 * t)
+    { 1227, 3138, 10, VSOP87A_FIXED_SERIES(Y, 0) | VSOP87A_FIXED_MICRO },  // 0.00020081559 * cos(1.19787916085 + 33.67961751290 * t)
+    { -876, 1926, 47, VSOP87A_FIXED_SERIES(Y, 0) | VSOP87A_FIXED_MICRO },  // 0.00012613583 * cos(1.99777332934 + 112.91463420510 * t)
+    { 845, 1980, 46, VSOP87A_FIXED_SERIES(Y, 0) | VSOP87A_FIXED_MICRO },  // 0.00012828708 * cos(1.16740053443 + 111.43016149680 * t)
+    { 1638, -1174, 63, VSOP87A_FIXED_SERIES(Y, 0) | VSOP87A_FIXED_MICRO },  // 0.00012012961 * cos(5.66157563804 + 1059.38193018920 * t)
+    { -1465, -137, 44, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00008768580 * cos(3.23487156950 + 108.46121608020 * t)
+    { 126, -1266, 59, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00007581788 * cos(4.81169168396 + 426.59819087600 * t)
+    { -1076, 94, 5, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00006439265 * cos(3.05453259951 + 5.93789083320 * t)
+    { 626, 631, 35, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00005297978 * cos(0.79002313990 + 71.81265315070 * t)
+    { 80, -776, 16, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00004650708 * cos(4.81540983294 + 37.61177077600 * t)
+    { -648, 458, 41, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00004733483 * cos(2.52620194642 + 79.23501669220 * t)
+    { 680, -349, 24, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00004557247 * cos(5.80951552318 + 38.65430049960 * t)
+    { 502, 524, 19, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00004322550 * cos(0.80665145881 + 38.08485152800 * t)
+    { -669, -277, 21, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00004315539 * cos(3.53393506841 + 38.18121974760 * t)
+    { 625, 282, 15, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00004089036 * cos(0.42349446479 + 37.16982779130 * t)
+    { -431, -568, 7, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00004247643 * cos(4.06355336504 + 28.57180808220 * t)
+    { -472, -461, 25, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00003932515 * cos(3.91607592815 + 39.09624348430 * t)
+    { -494, -437, 42, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00003930135 * cos(3.86614178174 + 98.89998852460 * t)
+    { -558, 14, 3, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00003323991 * cos(3.11674274385 + 4.19278569400 * t)
+    { 503, 141, 33, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00003112636 * cos(0.27319642944 + 47.69426319340 * t)
+    { -548, -143, 51, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00003373281 * cos(3.39616255650 + 145.10977900970 * t)
+    { -303, 330, 45, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00002670944 * cos(2.31235275416 + 109.94568878850 * t)
+    { 423, -21, 58, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00002523042 * cos(6.23400745185 + 312.19908396260 * t)
+    { -20, 316, 13, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00001888827 * cos(1.63364331324 + 35.68535508300 * t)
+    { -221, 165, 8, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00001647474 * cos(2.50010254963 + 30.05628079050 * t)
+    { -130, 277, 31, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00001826390 * cos(2.00938305966 + 44.07092647100 * t)
+    { -277, 180, 55, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00001967147 * cos(2.56634772532 + 206.18554843720 * t)
+    { -256, 119, 27, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00001681258 * cos(2.70480318579 + 40.58071619260 * t)
+    { 238, -99, 18, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00001533383 * cos(5.88971113590 + 38.02116105320 * t)
+    { 217, -232, 57, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00001894261 * cos(5.46274825258 + 220.41264243880 * t)
+    { 6, -256, 22, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00001527526 * cos(4.73412534395 + 38.24491022240 * t)
+    { 350, 0, 53, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00002086907 * cos(6.28313624461 + 149.56319713460 * t)
+    { -111, -327, 50, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00002057794 * cos(4.38552505781 + 137.03302416240 * t)
+    { -63, -282, 43, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00001720954 * cos(4.49400805134 + 106.97674337190 * t)
+    { -51, 215, 32, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00001314116 * cos(1.80386443362 + 46.20979048510 * t)
+    { -156, -245, 34, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00001732739 * cos(4.14518500834 + 70.32818044240 * t)
+    { 139, -222, 17, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00001559193 * cos(5.27114846878 + 37.87240320690 * t)
+    { 155, -208, 23, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00001545705 * cos(5.35267669439 + 38.39366806870 * t)
+    { 161, -179, 60, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00001435274 * cos(5.44292013172 + 522.57741809380 * t)
+    { -108, 210, 62, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00001404991 * cos(2.04611088339 + 536.80451209540 * t)
+    { 94, 186, 11, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00001242929 * cos(1.10242173566 + 33.94024994380 * t)
+    { -127, 195, 49, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00001388024 * cos(2.14792830412 + 115.88357962170 * t)
+    { -225, -101, 54, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00001467042 * cos(3.56226463770 + 181.75834193920 * t)
+    { 72, 193, 36, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00001227926 * cos(1.21334651843 + 72.07328558160 * t)
+    { -181, -8, 29, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00001080807 * cos(3.18401661435 + 42.32582133180 * t)
+    { 134, -129, 6, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00001111708 * cos(5.51669920239 + 8.07675484730 * t)
+    { 97, 184, 52, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00001237027 * cos(1.08622199668 + 148.07872442630 * t)
+    { -59215, 0, 0, VSOP87A_FIXED_SERIES(Y, 1) | VSOP87A_FIXED_MICRO },  // 0.00352947493 * cos(3.14159265359 + 0.00000000000 * t)
+    { 38738, 18597, 14, VSOP87A_FIXED_SERIES(Y, 1) | VSOP87A_FIXED_MICRO },  // 0.00256125493 * cos(0.44757496817 + 36.64856292950 * t)
+    { -29865, -27789, 26, VSOP87A_FIXED_SERIES(Y, 1) | VSOP87A_FIXED_MICRO },  // 0.00243147725 * cos(3.89099798696 + 39.61750834610 * t)
+    { 5099, 19203, 39, VSOP87A_FIXED_SERIES(Y, 1) | VSOP87A_FIXED_MICRO },  // 0.00118427205 * cos(1.31128027037 + 76.26607127560 * t)
+    { -222, 3674, 12, VSOP87A_FIXED_SERIES(Y, 1) | VSOP87A_FIXED_MICRO },  // 0.00021936702 * cos(1.63124087591 + 35.16409022120 * t)
+    { -2639, 1272, 28, VSOP87A_FIXED_SERIES(Y, 1) | VSOP87A_FIXED_MICRO },  // 0.00017462332 * cos(2.69229902966 + 41.10198105440 * t)
+    { -1730, -1326, 2, VSOP87A_FIXED_SERIES(Y, 1) | VSOP87A_FIXED_MICRO },  // 0.00012992380 * cos(3.79578633002 + 2.96894541660 * t)
+    { 721, 410, 37, VSOP87A_FIXED_SERIES(Y, 1) },  // 0.00004945117 * cos(0.51727080684 + 73.29712585900 * t)
+    { -367, 279, 40, VSOP87A_FIXED_SERIES(Y, 1) },  // 0.00002745921 * cos(2.49178311082 + 77.75054398390 * t)
+    { -298, 201, 4, VSOP87A_FIXED_SERIES(Y, 1) },  // 0.00002145481 * cos(2.54768447291 + 4.45341812490 * t)
+    { 232, -125, 48, VSOP87A_FIXED_SERIES(Y, 1) },  // 0.00001572289 * cos(5.78853350711 + 114.39910691340 * t)
+    { -255, 63, 10, VSOP87A_FIXED_SERIES(Y, 1) },  // 0.00001565725 * cos(2.89846266272 + 33.67961751290 * t)
+    { -12, 244, 20, VSOP87A_FIXED_SERIES(Y, 1) },  // 0.00001458269 * cos(1.61835542699 + 38.13303563780 * t)
+    { -54, -210, 38, VSOP87A_FIXED_SERIES(Y, 1) },  // 0.00001293459 * cos(4.45868061082 + 74.78159856730 * t)
+    { 23, 224, 30, VSOP87A_FIXED_SERIES(Y, 1) },  // 0.00001343731 * cos(1.46712622109 + 42.58645376270 * t)
+    { -724, -236, 14, VSOP87A_FIXED_SERIES(Y, 2) },  // 0.00004539421 * cos(3.45613207922 + 36.64856292950 * t)
+    { 463, 564, 26, VSOP87A_FIXED_SERIES(Y, 2) },  // 0.00004347956 * cos(0.88317230351 + 39.61750834610 * t)
+    { -603, 0, 0, VSOP87A_FIXED_SERIES(Y, 2) },  // 0.00003595394 * cos(3.14159265359 + 0.00000000000 * t)
+    { 293, -421, 20, VSOP87A_FIXED_SERIES(Y, 2) },  // 0.00003058647 * cos(5.31956613665 + 38.13303563780 * t)
+    { 354, 80, 39, VSOP87A_FIXED_SERIES(Y, 2) },  // 0.00002163809 * cos(0.22086532214 + 76.26607127560 * t)
+    { 2015990, 15449360, 20, VSOP87A_FIXED_SERIES(Z, 0) | VSOP87A_FIXED_MICRO },  // 0.92866054405 * cos(1.44103930278 + 38.13303563780 * t)
+    { 209040, 0, 0, VSOP87A_FIXED_SERIES(Z, 0) | VSOP87A_FIXED_MICRO },  // 0.01245978462 * cos(0.00000000000 + 0.00000000000 * t)
+    { -64796, 46200, 14, VSOP87A_FIXED_SERIES(Z, 0) | VSOP87A_FIXED_MICRO },  // 0.00474333567 * cos(2.52218774238 + 36.64856292950 * t)
+    { -70757, -27273, 26, VSOP87A_FIXED_SERIES(Z, 0) | VSOP87A_FIXED_MICRO },  // 0.00451987936 * cos(3.50949720541 + 39.61750834610 * t)
+    { 65312, -25338, 39, VSOP87A_FIXED_SERIES(Z, 0) | VSOP87A_FIXED_MICRO },  // 0.00417558068 * cos(5.91310695421 + 76.26607127560 * t)
+    { -4480, -13380, 1, VSOP87A_FIXED_SERIES(Z, 0) | VSOP87A_FIXED_MICRO },  // 0.00084104329 * cos(4.38928900096 + 1.48447270830 * t)
+    { 276, 5480, 38, VSOP87A_FIXED_SERIES(Z, 0) | VSOP87A_FIXED_MICRO },  // 0.00032704958 * cos(1.52048692001 + 74.78159856730 * t)
+    { -5123, -767, 12, VSOP87A_FIXED_SERIES(Z, 0) | VSOP87A_FIXED_MICRO },  // 0.00030873335 * cos(3.29017611456 + 35.16409022120 * t)
+    { -4325, -223, 2, VSOP87A_FIXED_SERIES(Z, 0) | VSOP87A_FIXED_MICRO },  // 0.00025812584 * cos(3.19303128782 + 2.96894541660 * t)
+    { -1507, 2395, 28, VSOP87A_FIXED_SERIES(Z, 0) | VSOP87A_FIXED_MICRO },  // 0.00016865319 * cos(2.13251104425 + 41.10198105440 * t)
+    { -1774, -875, 56, VSOP87A_FIXED_SERIES(Z, 0) | VSOP87A_FIXED_MICRO },  // 0.00011789909 * cos(3.60001877675 + 213.29909543800 * t)
+    { -1545, 547, 37, VSOP87A_FIXED_SERIES(Z, 0) },  // 0.00009770125 * cos(2.80133971586 + 73.29712585900 * t)
+    { -1731, -766, 61, VSOP87A_FIXED_SERIES(Z, 0) | VSOP87A_FIXED_MICRO },  // 0.00011279680 * cos(3.55816676334 + 529.69096509460 * t)
+    { -75, 687, 40, VSOP87A_FIXED_SERIES(Z, 0) },  // 0.00004119873 * cos(1.67934316836 + 77.75054398390 * t)
+    { -269, -389, 48, VSOP87A_FIXED_SERIES(Z, 0) },  // 0.00002818034 * cos(4.10661077794 + 114.39910691340 * t)
+    { -206, -435, 10, VSOP87A_FIXED_SERIES(Z, 0) },  // 0.00002868677 * cos(4.27011526203 + 33.67961751290 * t)
+    { -141, 344, 4, VSOP87A_FIXED_SERIES(Z, 0) },  // 0.00002213464 * cos(1.96045135168 + 4.45341812490 * t)
+    { 105, -295, 35, VSOP87A_FIXED_SERIES(Z, 0) },  // 0.00001865650 * cos(5.05540709577 + 71.81265315070 * t)
+    { -14057, 21855, 20, VSOP87A_FIXED_SERIES(Z, 1) | VSOP87A_FIXED_MICRO },  // 0.00154885971 * cos(2.14239039664 + 38.13303563780 * t)
+    { -400, -1243, 14, VSOP87A_FIXED_SERIES(Z, 1) },  // 0.00007783708 * cos(4.40146905905 + 36.64856292950 * t)
+    { -102, 1147, 26, VSOP87A_FIXED_SERIES(Z, 1) },  // 0.00006862414 * cos(1.65930160610 + 39.61750834610 * t)
+    { 1588, 0, 0, VSOP87A_FIXED_SERIES(Z, 1) },  // 0.00009464276 * cos(0.00000000000 + 0.00000000000 * t)
+    { 448, -475, 39, VSOP87A_FIXED_SERIES(Z, 1) },  // 0.00003891873 * cos(5.46761139427 + 76.26607127560 * t)
+    { -71, 200, 20, VSOP87A_FIXED_SERIES(Z, 2) },  // 0.00001264840 * cos(1.91401498992 + 38.13303563780 * t)
+};
+
+// emb: 36 terms (13 at micro precision) over 10 frequencies, 7 of them computed directly
+static const int64_t _vsop87a_fixed_emb_rates[] = {
+    64966917947LL,
+    193462141605LL,
+    288580459975LL,
+    640689225661LL,
+    770190948954LL,
+    770623061555LL,
+    771055174156LL,
+};
+static const vsop87a_fixed_frequency_t _vsop87a_fixed_emb_frequencies[] = {
+    { VSOP87A_FIXED_OP_ZERO | VSOP87A_FIXED_MICRO, 0, 0 },
+    { VSOP87A_FIXED_OP_BASE, 0, 0 },
+    { VSOP87A_FIXED_OP_BASE, 1, 0 },
+    { VSOP87A_FIXED_OP_BASE, 2, 0 },
+    { VSOP87A_FIXED_OP_BASE, 3, 0 },
+    { VSOP87A_FIXED_OP_BASE, 4, 0 },
+    { VSOP87A_FIXED_OP_BASE | VSOP87A_FIXED_MICRO, 5, 0 },
+    { VSOP87A_FIXED_OP_BASE, 6, 0 },
+    { VSOP87A_FIXED_OP_SUM | VSOP87A_FIXED_MICRO, 6, 6 },
+    { VSOP87A_FIXED_OP_SUM | VSOP87A_FIXED_MICRO, 8, 6 },
+};
+static const vsop87a_fixed_term_t _vsop87a_fixed_emb_terms[] = {
+    { -3047478, 16495204, 6, VSOP87A_FIXED_SERIES(X, 0) | VSOP87A_FIXED_MICRO },  // 0.99982927460 * cos(1.75348568475 + 6283.07584999140 * t)
+    { -19492, 138771, 8, VSOP87A_FIXED_SERIES(X, 0) | VSOP87A_FIXED_MICRO },  // 0.00835257300 * cos(1.71034539450 + 12566.15169998280 * t)
+    { 94144, 0, 0, VSOP87A_FIXED_SERIES(X, 0) | VSOP87A_FIXED_MICRO },  // 0.00561144161 * cos(0.00000000000 + 0.00000000000 * t)
+    { -169, 1748, 9, VSOP87A_FIXED_SERIES(X, 0) | VSOP87A_FIXED_MICRO },  // 0.00010466628 * cos(1.66722645223 + 18849.22754997420 * t)
+    { 357, 236, 1, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00002552498 * cos(0.58310207301 + 529.69096509460 * t)
+    { 165, 318, 2, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00002137256 * cos(1.09235189672 + 1577.34354244780 * t)
+    { 252, 136, 5, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00001709103 * cos(0.49540223397 + 6279.55273164240 * t)
+    { 284, -37, 7, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00001707882 * cos(6.15315547484 + 6286.59896834040 * t)
+    { -229, -79, 3, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00001445242 * cos(3.47272783760 + 2352.86615377180 * t)
+    { -156, -95, 4, VSOP87A_FIXED_SERIES(X, 0) },  // 0.00001091006 * cos(3.68984782465 + 5223.69391980220 * t)
+    { 20704, 0, 0, VSOP87A_FIXED_SERIES(X, 1) | VSOP87A_FIXED_MICRO },  // 0.00123403046 * cos(0.00000000000 + 0.00000000000 * t)
+    { 8303, -2392, 8, VSOP87A_FIXED_SERIES(X, 1) | VSOP87A_FIXED_MICRO },  // 0.00051500156 * cos(6.00266267204 + 12566.15169998280 * t)
+    { 205, -69, 9, VSOP87A_FIXED_SERIES(X, 1) },  // 0.00001290726 * cos(5.95943124583 + 18849.22754997420 * t)
+    { -77, 162, 6, VSOP87A_FIXED_SERIES(X, 1) },  // 0.00001068627 * cos(2.01554176551 + 6283.07584999140 * t)
+    { -695, 0, 0, VSOP87A_FIXED_SERIES(X, 2) },  // 0.00004143217 * cos(3.14159265359 + 0.00000000000 * t)
+    { -112, -347, 8, VSOP87A_FIXED_SERIES(X, 2) },  // 0.00002175695 * cos(4.39999849572 + 12566.15169998280 * t)
+    { 16496333, 3047167, 6, VSOP87A_FIXED_SERIES(Y, 0) | VSOP87A_FIXED_MICRO },  // 0.99989209645 * cos(0.18265890456 + 6283.07584999140 * t)
+    { -409817, 0, 0, VSOP87A_FIXED_SERIES(Y, 0) | VSOP87A_FIXED_MICRO },  // 0.02442698841 * cos(3.14159265359 + 0.00000000000 * t)
+    { 138777, 19490, 8, VSOP87A_FIXED_SERIES(Y, 0) | VSOP87A_FIXED_MICRO },  // 0.00835292314 * cos(0.13952878991 + 12566.15169998280 * t)
+    { 1748, 169, 9, VSOP87A_FIXED_SERIES(Y, 0) | VSOP87A_FIXED_MICRO },  // 0.00010466965 * cos(0.09641690558 + 18849.22754997420 * t)
+    { 239, -359, 1, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00002570338 * cos(5.30103973360 + 529.69096509460 * t)
+    { -320, 166, 2, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00002147473 * cos(2.66253538905 + 1577.34354244780 * t)
+    { 136, -252, 5, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00001709219 * cos(5.20780401071 + 6279.55273164240 * t)
+    { -37, -284, 7, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00001707987 * cos(4.58232858766 + 6286.59896834040 * t)
+    { -78, 229, 3, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00001440265 * cos(1.90068164664 + 2352.86615377180 * t)
+    { 101, -161, 4, VSOP87A_FIXED_SERIES(Y, 0) },  // 0.00001135092 * cos(5.27313415220 + 5223.69391980220 * t)
+    { 15611, 0, 0, VSOP87A_FIXED_SERIES(Y, 1) | VSOP87A_FIXED_MICRO },  // 0.00093046317 * cos(0.00000000000 + 0.00000000000 * t)
+    { -2393, -8303, 8, VSOP87A_FIXED_SERIES(Y, 1) | VSOP87A_FIXED_MICRO },  // 0.00051506609 * cos(4.43180499286 + 12566.15169998280 * t)
+    { -69, -205, 9, VSOP87A_FIXED_SERIES(Y, 1) },  // 0.00001290800 * cos(4.38860548540 + 18849.22754997420 * t)
+    { 852, 0, 0, VSOP87A_FIXED_SERIES(Y, 2) },  // 0.00005080208 * cos(0.00000000000 + 0.00000000000 * t)
+    { -348, 112, 8, VSOP87A_FIXED_SERIES(Y, 2) },  // 0.00002178016 * cos(2.82957544235 + 12566.15169998280 * t)
+    { -13, -171, 6, VSOP87A_FIXED_SERIES(Y, 2) },  // 0.00001020487 * cos(4.63746718598 + 6283.07584999140 * t)
+    { -36816, -10274, 6, VSOP87A_FIXED_SERIES(Z, 1) | VSOP87A_FIXED_MICRO },  // 0.00227822442 * cos(3.41372504278 + 6283.07584999140 * t)
+    { 911, 0, 0, VSOP87A_FIXED_SERIES(Z, 1) },  // 0.00005429282 * cos(0.00000000000 + 0.00000000000 * t)
+    { -311, -72, 8, VSOP87A_FIXED_SERIES(Z, 1) },  // 0.00001903183 * cos(3.37061270964 + 12566.15169998280 * t)
+    { 695, -1476, 6, VSOP87A_FIXED_SERIES(Z, 2) },  // 0.00009721989 * cos(5.15233725915 + 6283.07584999140 * t)
+};
+
+#define VSOP87A_FIXED_MAX_FREQUENCIES 142
+
+static const vsop87a_fixed_series_t _vsop87a_fixed_series[] = {
+    { _vsop87a_fixed_mercury_rates, _vsop87a_fixed_mercury_frequencies, _vsop87a_fixed_mercury_terms, 7, 42, 2 },
+    { _vsop87a_fixed_venus_rates, _vsop87a_fixed_venus_frequencies, _vsop87a_fixed_venus_terms, 8, 30, 2 },
+    { _vsop87a_fixed_earth_rates, _vsop87a_fixed_earth_frequencies, _vsop87a_fixed_earth_terms, 11, 38, 2 },
+    { _vsop87a_fixed_mars_rates, _vsop87a_fixed_mars_frequencies, _vsop87a_fixed_mars_terms, 36, 109, 3 },
+    { _vsop87a_fixed_jupiter_rates, _vsop87a_fixed_jupiter_frequencies, _vsop87a_fixed_jupiter_terms, 57, 264, 4 },
+    { _vsop87a_fixed_saturn_rates, _vsop87a_fixed_saturn_frequencies, _vsop87a_fixed_saturn_terms, 96, 435, 4 },
+    { _vsop87a_fixed_uranus_rates, _vsop87a_fixed_uranus_frequencies, _vsop87a_fixed_uranus_terms, 142, 453, 3 },
+    { _vsop87a_fixed_neptune_rates, _vsop87a_fixed_neptune_frequencies, _vsop87a_fixed_neptune_terms, 64, 191, 2 },
+    { _vsop87a_fixed_emb_rates, _vsop87a_fixed_emb_frequencies, _vsop87a_fixed_emb_terms, 10, 36, 2 },
+};
+
+#endif // VSOP87A_FIXED_TABLES_H_
@@ -24,13 +24,10 @@
 
 #include <stdlib.h>
 #include <string.h>
-#include <math.h>
 #include "orrery_face.h"
 #include "watch.h"
 #include "watch_utility.h"
-#include "vsop87a_micro.h" // smaller size, less accurate
-#include "vsop87a_milli.h"
-#include "astrolib.h"
+#include "vsop87a_fixed.h"
 
 #define NUM_AVAILABLE_BODIES 9
 
@@ -49,49 +46,16 @@ static const char orrery_celestial_body_names[NUM_AVAILABLE_BODIES][3] = {
 static void _orrery_face_recalculate(orrery_state_t *state) {
     watch_date_time_t date_time = watch_rtc_get_date_time();
     uint32_t timestamp = watch_utility_date_time_to_unix_time(date_time, movement_get_current_timezone_offset());
-    date_time = watch_utility_date_time_from_unix_time(timestamp, 0);
-    double jd = astro_convert_date_to_julian_date(date_time.unit.year + WATCH_RTC_REFERENCE_YEAR, date_time.unit.month, date_time.unit.day, date_time.unit.hour, date_time.unit.minute, date_time.unit.second);
-    double et = astro_convert_jd_to_julian_millenia_since_j2000(jd);
-    double r[3] = {0};
+    int32_t days = vsop87a_fixed_days_since_j2000(timestamp);
 
-    switch(state->active_body_index) {
-        case 0:
-            vsop87a_milli_getMercury(et, r);
-            break;
-        case 1:
-            vsop87a_milli_getVenus(et, r);
-            break;
-        case 2:
-            vsop87a_milli_getEarth(et, r);
-            break;
-        case 3:
-            {
-                 double earth[3];
-                 double emb[3];
-                 vsop87a_milli_getEarth(et, earth);
-                 vsop87a_milli_getEmb(et, emb);
-                 vsop87a_milli_getMoon(earth, emb, r);
-             }
-            break;
-        case 4:
-            vsop87a_milli_getMars(et, r);
-            break;
-        case 5:
-            vsop87a_milli_getJupiter(et, r);
-            break;
-        case 6:
-            vsop87a_milli_getSaturn(et, r);
-            break;
-        case 7:
-            vsop87a_milli_getUranus(et, r);
-            break;
-        case 8:
-            vsop87a_milli_getNeptune(et, r);
-            break;
-    }
-    state->coords[0] = r[0];
-    state->coords[1] = r[1];
-    state->coords[2] = r[2];
+    // the face's bodies are in the same order as vsop87a_fixed_body_t. MICRO would be smaller and less accurate.
+    vsop87a_fixed_get_position(state->active_body_index, days, VSOP87A_FIXED_PRECISION_MILLI, state->coords);
+}
+
+// converts a coordinate to hundredths of an AU, rounding to nearest.
+static int16_t _orrery_face_hundredths(int32_t coordinate) {
+    int32_t half = coordinate < 0 ? -VSOP87A_FIXED_AU / 2 : VSOP87A_FIXED_AU / 2;
+    return (int16_t)(((int64_t)coordinate * 100 + half) / VSOP87A_FIXED_AU);
 }
 
 static void _orrery_face_update(movement_event_t event, orrery_state_t *state) {
@@ -132,15 +96,15 @@ static void _orrery_face_update(movement_event_t event, orrery_state_t *state) {
             state->mode = ORRERY_MODE_DISPLAYING_X;
             // fall through
         case ORRERY_MODE_DISPLAYING_X:
-            sprintf(buf, "%s X%6d", orrery_celestial_body_names[state->active_body_index], (int16_t)round(state->coords[0] * 100));
+            sprintf(buf, "%s X%6d", orrery_celestial_body_names[state->active_body_index], _orrery_face_hundredths(state->coords[0]));
             watch_display_string(buf, 0);
             break;
         case ORRERY_MODE_DISPLAYING_Y:
-            sprintf(buf, "%s Y%6d", orrery_celestial_body_names[state->active_body_index], (int16_t)round(state->coords[1] * 100));
+            sprintf(buf, "%s Y%6d", orrery_celestial_body_names[state->active_body_index], _orrery_face_hundredths(state->coords[1]));
             watch_display_string(buf, 0);
             break;
         case ORRERY_MODE_DISPLAYING_Z:
-            sprintf(buf, "%s Z%6d", orrery_celestial_body_names[state->active_body_index], (int16_t)round(state->coords[2] * 100));
+            sprintf(buf, "%s Z%6d", orrery_celestial_body_names[state->active_body_index], _orrery_face_hundredths(state->coords[2]));
             watch_display_string(buf, 0);
             break;
         case ORRERY_MODE_NUM_MODES:
@@ -81,7 +81,7 @@ typedef enum {
 typedef struct {
     orrery_mode_t mode;
     uint8_t active_body_index;
-    double coords[3];
+    int32_t coords[3];  // in units of VSOP87A_FIXED_AU
     uint8_t animation_state;
 } orrery_state_t;
 
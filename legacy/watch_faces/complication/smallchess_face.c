@@ -32,6 +32,19 @@
 
 #define PIECE_LIST_END_MARKER 0xff
 
+/* The CPU searches a slice of SMALLCHESS_NODES_PER_TICK positions per tick,
+ * for at most SMALLCHESS_THINK_TICKS ticks, then plays the best move found.
+ * utils/smallchess_bench plays this budget against the fixed depth 3 search
+ * this face used before. If there's no memory for the search, the CPU falls
+ * back to that depth 3 search, which blocks but only needs the stack.
+ */
+#define SMALLCHESS_THINK_TICK_FREQUENCY 8
+#define SMALLCHESS_NODES_PER_TICK 24
+#define SMALLCHESS_THINK_TICKS (20 * SMALLCHESS_THINK_TICK_FREQUENCY)
+#define SMALLCHESS_MAX_DEPTH 6
+#define SMALLCHESS_EXTENSION_DEPTH 2
+#define SMALLCHESS_FALLBACK_DEPTH 3
+
 int8_t cpu_done_beep[] = {BUZZER_NOTE_C5, 5, BUZZER_NOTE_C6, 5, BUZZER_NOTE_C7, 5, 0};
 
 static void smallchess_init_board(smallchess_face_state_t *state) {
@@ -54,7 +67,14 @@ void smallchess_face_setup(uint8_t watch_face_index, void ** context_ptr) {
 }
 
 void smallchess_face_activate(void *context) {
-    (void) context;
+    smallchess_face_state_t *state = (smallchess_face_state_t *)context;
+
+    if (state->search != NULL) {
+        /* resume thinking */
+        movement_request_tick_frequency(SMALLCHESS_THINK_TICK_FREQUENCY);
+        watch_clear_display();
+        watch_start_character_blink('C', 100);
+    }
 }
 
 static void _smallchess_calc_moveable_pieces(smallchess_face_state_t *state) {
@@ -75,36 +95,81 @@ static void _smallchess_calc_moveable_pieces(smallchess_face_state_t *state) {
     state->moveable_pieces_idx = 0;
 }
 
-static void _smallchess_make_ai_move(smallchess_face_state_t *state) {
+/* plays the move in ai_from_square and ai_to_square, however the CPU found it */
+static void _smallchess_make_ai_move(smallchess_face_state_t *state, char ai_prom) {
     char ai_from_str[3] = {0};
     char ai_to_str[3] = {0};
+
+    SCL_gameMakeMove(state->game, state->ai_from_square, state->ai_to_square, ai_prom);
+    watch_stop_blink();
+
+    watch_buzzer_play_sequence(cpu_done_beep, NULL);
+
+    /* cache the move as a string for SHOW_CPU_MOVE state */
+    SCL_squareToString(state->ai_from_square, ai_from_str);
+    SCL_squareToString(state->ai_to_square, ai_to_str);
+    snprintf(state->last_move_str, sizeof(state->last_move_str), " %s-%s", ai_from_str, ai_to_str);
+
+    /* now cache the list of legal pieces we can move */
+    _smallchess_calc_moveable_pieces(state);
+    state->state = SMALLCHESS_SHOW_CPU_MOVE;
+}
+
+static void _smallchess_start_ai_move(smallchess_face_state_t *state) {
     uint8_t rep_from, rep_to;
-    char ai_prom;
 
     watch_clear_display();
     watch_start_character_blink('C', 100);
     SCL_gameGetRepetiotionMove(state->game, &rep_from, &rep_to);
 
+    /* the search only takes memory while the CPU is thinking */
+    state->search = malloc(sizeof(SCL_Search));
+    if (state->search == NULL) {
+        char ai_prom;
+
 #ifndef __EMSCRIPTEN__
-    hri_oscctrl_write_OSC16MCTRL_FSEL_bf(OSCCTRL, OSCCTRL_OSC16MCTRL_FSEL_16_Val);
+        hri_oscctrl_write_OSC16MCTRL_FSEL_bf(OSCCTRL, OSCCTRL_OSC16MCTRL_FSEL_16_Val);
 #endif
-    SCL_getAIMove(state->game, 3, 0, 0, SCL_boardEvaluateStatic, NULL, 0, rep_from, rep_to, &state->ai_from_square, &state->ai_to_square, &ai_prom);
+        SCL_getAIMove(((SCL_Game *)state->game)->board, SMALLCHESS_FALLBACK_DEPTH, 0, 0, SCL_boardEvaluateStatic, NULL, 0,
+                      rep_from, rep_to, &state->ai_from_square, &state->ai_to_square, &ai_prom);
 #ifndef __EMSCRIPTEN__
-    hri_oscctrl_write_OSC16MCTRL_FSEL_bf(OSCCTRL, OSCCTRL_OSC16MCTRL_FSEL_4_Val);
+        hri_oscctrl_write_OSC16MCTRL_FSEL_bf(OSCCTRL, OSCCTRL_OSC16MCTRL_FSEL_4_Val);
 #endif
+        _smallchess_make_ai_move(state, ai_prom);
+        return;
+    }
 
-    SCL_gameMakeMove(state->game, state->ai_from_square, state->ai_to_square, ai_prom);
-    watch_stop_blink();
+    SCL_searchInit(state->search, ((SCL_Game *)state->game)->board, SMALLCHESS_MAX_DEPTH, SMALLCHESS_EXTENSION_DEPTH,
+                   SCL_boardEvaluateStatic, rep_from, rep_to);
+    state->think_ticks = 0;
+    state->state = SMALLCHESS_CPU_THINKING;
 
-    watch_buzzer_play_sequence(cpu_done_beep, NULL);
+    movement_request_tick_frequency(SMALLCHESS_THINK_TICK_FREQUENCY);
+}
 
-    /* cache the move as a string for SHOW_CPU_MOVE state */
-    SCL_squareToString(state->ai_from_square, ai_from_str);
-    SCL_squareToString(state->ai_to_square, ai_to_str);
-    snprintf(state->last_move_str, sizeof(state->last_move_str), " %s-%s", ai_from_str, ai_to_str);
+static void _smallchess_finish_ai_move(smallchess_face_state_t *state) {
+    char ai_prom;
 
-    /* now cache the list of legal pieces we can move */
-    _smallchess_calc_moveable_pieces(state);
+    SCL_searchGetMove(state->search, &state->ai_from_square, &state->ai_to_square, &ai_prom);
+    free(state->search);
+    state->search = NULL;
+
+    movement_request_tick_frequency(1);
+    _smallchess_make_ai_move(state, ai_prom);
+}
+
+static void _smallchess_think(smallchess_face_state_t *state) {
+#ifndef __EMSCRIPTEN__
+    hri_oscctrl_write_OSC16MCTRL_FSEL_bf(OSCCTRL, OSCCTRL_OSC16MCTRL_FSEL_16_Val);
+#endif
+    bool done = SCL_searchStep(state->search, SMALLCHESS_NODES_PER_TICK);
+#ifndef __EMSCRIPTEN__
+    hri_oscctrl_write_OSC16MCTRL_FSEL_bf(OSCCTRL, OSCCTRL_OSC16MCTRL_FSEL_4_Val);
+#endif
+
+    if (done || ++state->think_ticks >= SMALLCHESS_THINK_TICKS) {
+        _smallchess_finish_ai_move(state);
+    }
 }
 
 static char _smallchess_make_lowercase(char c) {
@@ -148,6 +213,9 @@ static void _smallchess_face_update_lcd(smallchess_face_state_t *state) {
     uint16_t ply = ((SCL_Game *)state->game)->ply;
 
     switch (state->state) {
+        case SMALLCHESS_CPU_THINKING:
+            /* leave the blinking C alone */
+            return;
         case SMALLCHESS_MENU_RESUME:
             snprintf(buf, sizeof(buf), "SC%2dResume", ply);
             break;
@@ -231,8 +299,7 @@ static void _smallchess_select_main_menu_subitem(smallchess_face_state_t *state)
         case SMALLCHESS_MENU_NEW_BLACK:
             SCL_gameInit((SCL_Game *)state->game, 0);
             /* force a move since black is playing */
-            _smallchess_make_ai_move(state);
-            state->state = SMALLCHESS_SHOW_CPU_MOVE;
+            _smallchess_start_ai_move(state);
             break;
         case SMALLCHESS_MENU_SHOW_LAST_MOVE:
             /* fetch the move */
@@ -355,8 +422,7 @@ static void _smallchess_handle_select_dest_button_event(smallchess_face_state_t
 
             /* if the player didn't win or draw here, calculate a move */
             if (((SCL_Game *)state->game)->state == SCL_GAME_STATE_PLAYING) {
-                _smallchess_make_ai_move(state);
-                state->state = SMALLCHESS_SHOW_CPU_MOVE;
+                _smallchess_start_ai_move(state);
             } else {
                 /* player ended the game through mate or draw; jump to select piece screen to show state */
                 state->state = SMALLCHESS_SELECT_PIECE;
@@ -466,6 +532,10 @@ bool smallchess_face_loop(movement_event_t event, void *context) {
 
     switch (event.event_type) {
         case EVENT_ACTIVATE:
+            if (state->search != NULL) {
+                /* still thinking; see smallchess_face_activate */
+                break;
+            }
             if (((SCL_Game *)state->game)->ply == 0) {
                 state->state = SMALLCHESS_MENU_NEW_WHITE;
             } else {
@@ -481,6 +551,12 @@ bool smallchess_face_loop(movement_event_t event, void *context) {
             _smallchess_face_update_lcd(state);
             break;
         case EVENT_TICK:
+            if (state->state == SMALLCHESS_CPU_THINKING) {
+                _smallchess_think(state);
+                if (state->state != SMALLCHESS_CPU_THINKING) {
+                    _smallchess_face_update_lcd(state);
+                }
+            }
             break;
         case EVENT_TIMEOUT:
             break;
@@ -495,6 +571,12 @@ bool smallchess_face_loop(movement_event_t event, void *context) {
 }
 
 void smallchess_face_resign(void *context) {
-    (void) context;
+    smallchess_face_state_t *state = (smallchess_face_state_t *)context;
+
+    /* if the CPU is thinking, it carries on when the face is activated again */
+    if (state->search != NULL) {
+        watch_stop_blink();
+        movement_request_tick_frequency(1);
+    }
     watch_set_led_off();
 }
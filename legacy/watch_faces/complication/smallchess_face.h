@@ -40,6 +40,10 @@
  * - Alarm button: navigate forwards through the current menu
  * - Light button (long press): navigate up to the parent menu
  * - Alarm button (long press): select the current item or submenu
+ *
+ * The CPU thinks for up to 20 seconds per move, searching a little on each
+ * tick so the watch stays responsive; you can leave the face while it thinks,
+ * and it picks up where it left off when you come back.
  */
 
 enum smallchess_state {
@@ -55,6 +59,7 @@ enum smallchess_state {
     /* playing game submenu */
     SMALLCHESS_SHOW_LAST_MOVE,
     SMALLCHESS_SHOW_CPU_MOVE,
+    SMALLCHESS_CPU_THINKING,
     SMALLCHESS_SELECT_PIECE,
     SMALLCHESS_SELECT_DEST,
 };
@@ -64,6 +69,8 @@ enum smallchess_state {
 
 typedef struct {
     void *game;
+    void *search; // the CPU's search in progress, or NULL
+    uint8_t think_ticks;
     enum smallchess_state state;
     uint8_t moveable_pieces[SMALLCHESS_NUM_PIECES + 1];
     uint8_t moveable_pieces_idx;
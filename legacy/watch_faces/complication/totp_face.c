@@ -111,12 +111,15 @@ static void totp_generate(totp_state_t *totp_state) {
         return;
     }
 
-    TOTP(
+    prepareKey(
+        &totp_state->key,
         totp_state->current_decoded_key,
         totp_state->current_decoded_key_length,
         totp->period,
         totp->algorithm
     );
+    // the cached codes were for the last key.
+    totp_state->codes.steps = 0;
 }
 
 static void totp_display_error(totp_state_t *totp_state) {
@@ -129,17 +132,12 @@ static void totp_display_error(totp_state_t *totp_state) {
 
 static void totp_display_code(totp_state_t *totp_state) {
     char buf[14];
-    div_t result;
     uint8_t valid_for;
     totp_t *totp = totp_current(totp_state);
 
-    result = div(totp_state->timestamp, totp->period);
-    if (result.quot != totp_state->steps) {
-        totp_state->current_code = getCodeFromTimestamp(totp_state->timestamp);
-        totp_state->steps = result.quot;
-    }
-    valid_for = totp->period - result.rem;
-    sprintf(buf, "%c%c%2d%06lu", totp->labels[0], totp->labels[1], valid_for, totp_state->current_code);
+    updateCodes(&totp_state->key, &totp_state->codes, totp_state->timestamp);
+    valid_for = totp->period - totp_state->timestamp % totp->period;
+    sprintf(buf, "%c%c%2d%06lu", totp->labels[0], totp->labels[1], valid_for, totp_state->codes.current);
 
     watch_display_string(buf, 0);
 }
@@ -178,8 +176,7 @@ void totp_face_activate(void *context) {
     totp_state_t *totp = (totp_state_t *) context;
 
     totp->timestamp = totp_compute_base_timestamp();
-    totp->steps = 0;
-    totp->current_code = 0;
+    totp->codes.steps = 0;
     totp->current_index = 0;
     totp->current_decoded_key_length = 0;
     // totp->current_decoded_key is already initialized in setup
@@ -68,11 +68,12 @@
  */
 
 #include "movement.h"
+#include "TOTP.h"
 
 typedef struct {
     uint32_t timestamp;
-    uint8_t steps;
-    uint32_t current_code;
+    totp_key key;
+    totp_codes codes;
     uint8_t current_index;
     uint8_t *current_decoded_key;
     size_t current_decoded_key_length;
@@ -38,32 +38,58 @@
 #define MAX_TOTP_RECORDS 30
 #define MAX_TOTP_SECRET_SIZE 128
 #define TOTP_FILE "totp_uris.txt"
+#define TOTP_INDEX_FILE "totp_uris" FILESYSTEM_INDEX_EXTENSION
+#define TOTP_INDEX_VERSION 1
+// marks an index whose records were still being written; it's rebuilt on the next activation.
+#define TOTP_INDEX_INCOMPLETE 0xFF
 
 const char* TOTP_URI_START = "otpauth://totp/";
 
+/* The index file is a totp_index_header followed by one totp_record per
+ * valid URI. It's built the first time the face activates after the URI
+ * file changes (setup registers the index, so the filesystem removes it
+ * whenever totp_uris.txt is written), so activating the face and scrolling
+ * through records only reads a few bytes, and only the secret on display is
+ * ever decoded.
+ */
+struct totp_index_header {
+    uint8_t version;
+    uint8_t num_records;
+    uint16_t reserved;
+    // the URI file's size when the index was built, in case it was edited by firmware that didn't remove the index.
+    int32_t uri_file_size;
+};
+
 struct totp_record {
     char label[2];
-    hmac_alg algorithm;
+    uint8_t algorithm;
     uint8_t period;
     uint8_t secret_size;
-
-    union {
-        uint8_t *secret;
-        struct {
-            uint16_t file_secret_offset;
-            uint16_t file_secret_length;
-        };
-    };
+    uint8_t reserved;
+    uint16_t file_secret_offset;
+    uint16_t file_secret_length;
 };
 
-/* This is used if we're not storing all the secrets but instead
- * calculating them on demand. Avoids malloc in normal operation.
+/* The secret of the record on display, decoded on demand. Avoids malloc in
+ * normal operation.
  */
 static uint8_t current_secret[MAX_TOTP_SECRET_SIZE];
 
-static struct totp_record totp_records[MAX_TOTP_RECORDS];
+static struct totp_record current_record;
 static uint8_t num_totp_records = 0;
 
+/* Each record's codes for the current and next period, so that scrolling back
+ * to a record within the same period costs nothing, and a new period only
+ * costs one code.
+ */
+static totp_codes totp_record_codes[MAX_TOTP_RECORDS];
+
+/* The prepared key for the record that last needed codes generated; preparing
+ * a key means reading and decoding its secret, so it's only done on demand.
+ */
+static totp_key current_key;
+static int8_t current_key_index = -1;
+
 static void init_totp_record(struct totp_record *totp_record) {
     totp_record->label[0] = 'A';
     totp_record->label[1] = 'A';
@@ -127,17 +153,25 @@ static bool totp_face_lfs_read_param(struct totp_record *totp_record, char *para
     return true;
 }
 
-static void totp_face_lfs_read_file(char *filename) {
+static void totp_face_lfs_build_index(char *filename, int32_t file_size) {
     // For 'format' of file, see comment at top.
     const size_t uri_start_len = strlen(TOTP_URI_START);
+    struct totp_index_header header = {
+        .version = TOTP_INDEX_VERSION,
+        .num_records = TOTP_INDEX_INCOMPLETE,
+        .uri_file_size = file_size,
+    };
+    struct totp_record record;
 
-    if (!filesystem_file_exists(filename)) {
-        printf("TOTP file error: %s\n", filename);
+    num_totp_records = 0;
+    if (!filesystem_write_file(TOTP_INDEX_FILE, (char *)&header, sizeof(header))) {
+        printf("TOTP can't write %s\n", TOTP_INDEX_FILE);
         return;
     }
 
     char line[256];
     int32_t offset = 0, old_offset = 0;
+
     while (old_offset = offset, filesystem_read_line(filename, line, &offset, 255) && strlen(line)) {
         if (num_totp_records == MAX_TOTP_RECORDS) {
             printf("TOTP max records: %d\n", MAX_TOTP_RECORDS);
@@ -160,15 +194,15 @@ static void totp_face_lfs_read_file(char *filename) {
         }
 
         // Process the parameters and put them in the record
-        init_totp_record(&totp_records[num_totp_records]);
+        init_totp_record(&record);
         bool error = false;
         param = strtok_r(params + 1, "&", &param_saveptr);
         do {
             char *param_middle = strchr(param, '=');
             *param_middle = '\0';
-            if (totp_face_lfs_read_param(&totp_records[num_totp_records], param, param_middle + 1)) {
+            if (totp_face_lfs_read_param(&record, param, param_middle + 1)) {
                 if (!strcmp(param, "secret")) {
-                    totp_records[num_totp_records].file_secret_offset = old_offset + (param_middle + 1 - line);
+                    record.file_secret_offset = old_offset + (param_middle + 1 - line);
                 }
             } else {
                 error = true;
@@ -176,17 +210,51 @@ static void totp_face_lfs_read_file(char *filename) {
         } while ((param = strtok_r(NULL, "&", &param_saveptr)));
 
         if (error) {
-            totp_records[num_totp_records].secret_size = 0;
             continue;
         }
 
         // If we found a probably valid TOTP record, keep it.
-        if (totp_records[num_totp_records].secret_size) {
+        if (record.secret_size) {
+            if (!filesystem_append_file(TOTP_INDEX_FILE, (char *)&record, sizeof(record))) {
+                printf("TOTP can't write %s\n", TOTP_INDEX_FILE);
+                num_totp_records = 0;
+                return;
+            }
             num_totp_records += 1;
         } else {
             printf("TOTP missing secret: %s\n", line);
         }
     }
+
+    header.num_records = num_totp_records;
+    if (!filesystem_write_file_at(TOTP_INDEX_FILE, (char *)&header, 0, sizeof(header))) {
+        num_totp_records = 0;
+    }
+}
+
+static void totp_face_lfs_load_index(void) {
+    struct totp_index_header header;
+    int32_t file_size = filesystem_get_file_size(TOTP_FILE);
+
+    if (file_size < 0) {
+        printf("TOTP file error: %s\n", TOTP_FILE);
+        num_totp_records = 0;
+        return;
+    }
+
+    if (filesystem_read_file_at(TOTP_INDEX_FILE, (char *)&header, 0, sizeof(header)) &&
+        header.version == TOTP_INDEX_VERSION &&
+        header.num_records != TOTP_INDEX_INCOMPLETE &&
+        header.uri_file_size == file_size) {
+        if (header.num_records == num_totp_records) return;
+        num_totp_records = header.num_records;
+    } else {
+        totp_face_lfs_build_index(TOTP_FILE, file_size);
+    }
+
+    // the records may have changed, so forget any codes and keys from the old ones.
+    memset(totp_record_codes, 0, sizeof(totp_record_codes));
+    current_key_index = -1;
 }
 
 void totp_face_lfs_setup(uint8_t watch_face_index, void ** context_ptr) {
@@ -194,70 +262,74 @@ void totp_face_lfs_setup(uint8_t watch_face_index, void ** context_ptr) {
     if (*context_ptr == NULL) {
         *context_ptr = malloc(sizeof(totp_lfs_state_t));
     }
-
-#if !(__EMSCRIPTEN__)
-    if (num_totp_records == 0) {
-        totp_face_lfs_read_file(TOTP_FILE);
-    }
-#endif
+    filesystem_register_index(TOTP_FILE);
 }
 
 static uint8_t *totp_face_lfs_get_file_secret(struct totp_record *record) {
     char buffer[BASE32_LEN(MAX_TOTP_SECRET_SIZE) + 1];
-    int32_t file_secret_offset = record->file_secret_offset;
 
-    /* TODO filesystem_read_line is quite inefficient. Consider writing a new function,
-     * and keeping the file open?
-     */
-    if (!filesystem_read_line(TOTP_FILE, buffer, &file_secret_offset, record->file_secret_length + 1)) {
+    memset(buffer, 0, sizeof(buffer));
+    if (!filesystem_read_file_at(TOTP_FILE, buffer, record->file_secret_offset, record->file_secret_length)) {
         /* Shouldn't happen at this point. Return current_secret, which is misleading but will not cause a crash. */
-        printf("TOTP can't read expected secret from totp_uris.txt (failed readline)\n");
+        printf("TOTP can't read expected secret from %s\n", TOTP_FILE);
         return current_secret;
     }
     if (base32_decode((unsigned char *)buffer, current_secret) != record->secret_size) {
-        printf("TOTP can't properly decode secret '%s' from totp_uris.txt; failed at offset %d; read to %ld\n", buffer, record->file_secret_offset, file_secret_offset);
+        printf("TOTP can't properly decode secret '%s' from %s at offset %d\n", buffer, TOTP_FILE, record->file_secret_offset);
     }
     return current_secret;
 }
 
 static void totp_face_set_record(totp_lfs_state_t *totp_state, int i) {
-    struct totp_record *record;
+    if (num_totp_records == 0 || i >= num_totp_records) {
+        return;
+    }
 
-    if (num_totp_records == 0 && i >= num_totp_records) {
+    int32_t offset = sizeof(struct totp_index_header) + i * sizeof(struct totp_record);
+    if (!filesystem_read_file_at(TOTP_INDEX_FILE, (char *)&current_record, offset, sizeof(current_record))) {
+        printf("TOTP can't read record %d from %s\n", i, TOTP_INDEX_FILE);
+        num_totp_records = 0;
         return;
     }
 
     totp_state->current_index = i;
-    record = &totp_records[i];
-
-    TOTP(
-        totp_face_lfs_get_file_secret(record),
-        record->secret_size,
-        record->period,
-        record->algorithm
-    );
-    totp_state->current_code = getCodeFromTimestamp(totp_state->timestamp);
-    totp_state->steps = totp_state->timestamp / record->period;
+}
+
+static uint32_t totp_face_lfs_get_code(totp_lfs_state_t *totp_state) {
+    uint8_t index = totp_state->current_index;
+    struct totp_record *record = &current_record;
+    totp_codes *codes = &totp_record_codes[index];
+
+    if (!codesAreCurrent(codes, totp_state->timestamp, record->period)) {
+        if (current_key_index != index) {
+            prepareKey(
+                &current_key,
+                totp_face_lfs_get_file_secret(record),
+                record->secret_size,
+                record->period,
+                (hmac_alg)record->algorithm
+            );
+            current_key_index = index;
+        }
+        updateCodes(&current_key, codes, totp_state->timestamp);
+    }
+
+    return codes->current;
 }
 
 void totp_face_lfs_activate(void *context) {
     memset(context, 0, sizeof(totp_lfs_state_t));
     totp_lfs_state_t *totp_state = (totp_lfs_state_t *)context;
 
-#if __EMSCRIPTEN__
-    if (num_totp_records == 0) {
-        // Doing this here rather than in setup makes things a bit more pleasant in the simulator, since there's no easy way to trigger
-        // setup again after uploading the data.
-        totp_face_lfs_read_file(TOTP_FILE);
-    }
-#endif
+    // Cheap unless totp_uris.txt changed since the last activation, in which case the index is rebuilt; so new
+    // records show up without a restart.
+    totp_face_lfs_load_index();
 
     totp_state->timestamp = watch_utility_date_time_to_unix_time(watch_rtc_get_date_time(), movement_get_current_timezone_offset());
     totp_face_set_record(totp_state, 0);
 }
 
 static void totp_face_display(totp_lfs_state_t *totp_state) {
-    uint8_t index = totp_state->current_index;
     char buf[14];
 
     if (num_totp_records == 0) {
@@ -265,14 +337,10 @@ static void totp_face_display(totp_lfs_state_t *totp_state) {
         return;
     }
 
-    div_t result = div(totp_state->timestamp, totp_records[index].period);
-    if (result.quot != totp_state->steps) {
-        totp_state->current_code = getCodeFromTimestamp(totp_state->timestamp);
-        totp_state->steps = result.quot;
-    }
-    uint8_t valid_for = totp_records[index].period - result.rem;
+    uint32_t code = totp_face_lfs_get_code(totp_state);
+    uint8_t valid_for = current_record.period - totp_state->timestamp % current_record.period;
 
-    sprintf(buf, "%c%c%2d%06lu", totp_records[index].label[0], totp_records[index].label[1], valid_for, totp_state->current_code);
+    sprintf(buf, "%c%c%2d%06lu", current_record.label[0], current_record.label[1], valid_for, code);
 
     watch_display_string(buf, 0);
 }
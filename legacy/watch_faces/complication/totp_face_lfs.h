@@ -43,6 +43,10 @@
  *   echo otpauth://totp/ACME%20Co:john.doe@email.com?secret=HXDMVJECJJWSRB3HWIZR4IFUGFTMXBOZ&issuer=ACME%20Co&algorithm=SHA1&digits=6&period=30 >> totp_uris.txt
  * (note the double >> in the second one)
  *
+ * The first time the face activates after totp_uris.txt changes, it writes
+ * a small index of the valid records to totp_uris.idx; after that, it only
+ * reads the record on display and decodes that one secret.
+ *
  * You may want to customise the characters that appear to identify the 2FA
  * code. These are just the first two characters of the issuer, and it's fine
  * to modify the URI.
@@ -56,8 +60,6 @@
 
 typedef struct {
     uint32_t timestamp;
-    uint8_t steps;
-    uint32_t current_code;
     uint8_t current_index;
 } totp_lfs_state_t;
 
@@ -35,6 +35,18 @@ static uint32_t get_random(uint32_t max) {
     #endif
 }
 
+// Reads word index from one of the packed arrays in wordle_face_dict.h, where two 20-bit words share five bytes.
+static uint32_t get_packed_word(const uint8_t *words, uint16_t index) {
+    const uint8_t *bytes = words + ((uint32_t)index * 5) / 2;
+    if (index & 1) return ((uint32_t)(bytes[0] & 0xF) << 16) | ((uint32_t)bytes[1] << 8) | bytes[2];
+    return ((uint32_t)bytes[0] << 12) | ((uint32_t)bytes[1] << 4) | (bytes[2] >> 4);
+}
+
+// Returns the index in _valid_letters of the letter at position in a packed word.
+static uint8_t get_packed_letter(uint32_t packed, uint8_t position) {
+    return (packed >> (4 * (WORDLE_LENGTH - 1 - position))) & 0xF;
+}
+
 static uint8_t get_first_pos(WordleLetterResult *word_elements_result) {
     for (size_t i = 0; i < WORDLE_LENGTH; i++) {
         if (word_elements_result[i] != WORDLE_LETTER_CORRECT)
@@ -108,38 +120,54 @@ static void display_already_guessed(wordle_state_t *state) {
     watch_display_string("GUESSD", 4);
 }
 
+// Returns the index of packed in words[start..end), which must be sorted, or end if it isn't there.
+static uint16_t find_packed_word(const uint8_t *words, uint16_t start, uint16_t end, uint32_t packed) {
+    uint16_t low = start;
+    uint16_t high = end;
+    while (low < high) {
+        uint16_t mid = low + (high - low) / 2;
+        uint32_t word = get_packed_word(words, mid);
+        if (word == packed) return mid;
+        if (word < packed) low = mid + 1;
+        else high = mid;
+    }
+    return end;
+}
+
 static uint32_t check_word_in_dict(uint8_t *word_elements) {
-    bool is_exact_match;
-    for (uint16_t i = 0; i < WORDLE_NUM_WORDS; i++) {
-        is_exact_match = true;
-        for (size_t j = 0; j < WORDLE_LENGTH; j++) {
-            if (_valid_letters[word_elements[j]] != _valid_words[i][j]) {
-                is_exact_match = false;
-                break;  
-            }
-        }
-        if (is_exact_match) return i;
+    // _valid_words is sorted in three runs; see wordle_face_dict.h.
+    static const uint16_t valid_word_runs[] = {0, WORDLE_NUM_BEST_WORDS, WORDLE_NUM_UNIQUE_WORDS, WORDLE_NUM_WORDS};
+    uint32_t packed = 0;
+    for (size_t i = 0; i < WORDLE_LENGTH; i++) {
+        packed = (packed << 4) | word_elements[i];
     }
-    for (uint16_t i = 0; i < WORDLE_NUM_POSSIBLE_WORDS; i++) {
-        is_exact_match = true;
-        for (size_t j = 0; j < WORDLE_LENGTH; j++) {
-            if (_valid_letters[word_elements[j]] != _possible_words[i][j]) {
-                is_exact_match = false;
-                break;  
-            }
-        }
-        if (is_exact_match) return WORDLE_NUM_WORDS + i;
+    for (size_t i = 0; i < sizeof(valid_word_runs) / sizeof(valid_word_runs[0]) - 1; i++) {
+        uint16_t index = find_packed_word(_valid_words, valid_word_runs[i], valid_word_runs[i + 1], packed);
+        if (index != valid_word_runs[i + 1]) return index;
     }
+    uint16_t index = find_packed_word(_possible_words, 0, WORDLE_NUM_POSSIBLE_WORDS, packed);
+    if (index != WORDLE_NUM_POSSIBLE_WORDS) return WORDLE_NUM_WORDS + index;
     return WORDLE_NUM_WORDS + WORDLE_NUM_POSSIBLE_WORDS;
 }
 #endif
 
+static char get_answer_letter(wordle_state_t *state, uint8_t position) {
+    return _valid_letters[get_packed_letter(get_packed_word(_valid_words, state->curr_answer), position)];
+}
+
+static void get_answer(wordle_state_t *state, char *buf) {
+    for (size_t i = 0; i < WORDLE_LENGTH; i++) {
+        buf[i] = get_answer_letter(state, i);
+    }
+    buf[WORDLE_LENGTH] = '\0';
+}
+
 static bool check_word(wordle_state_t *state) {
     // Exact
     bool is_exact_match = true;
     bool answer_already_accounted[WORDLE_LENGTH] = { false };
     for (size_t i = 0; i < WORDLE_LENGTH; i++) {
-        if (_valid_letters[state->word_elements[i]] == _valid_words[state->curr_answer][i]) {
+        if (_valid_letters[state->word_elements[i]] == get_answer_letter(state, i)) {
             state->word_elements_result[i] = WORDLE_LETTER_CORRECT;
             answer_already_accounted[i] = true;
         }
@@ -154,7 +182,7 @@ static bool check_word(wordle_state_t *state) {
         if (state->word_elements_result[i] != WORDLE_LETTER_WRONG) continue;
         for (size_t j = 0; j < WORDLE_LENGTH; j++) {
             if (answer_already_accounted[j]) continue;
-            if (_valid_letters[state->word_elements[i]] == _valid_words[state->curr_answer][j]) {
+            if (_valid_letters[state->word_elements[i]] == get_answer_letter(state, j)) {
                 state->word_elements_result[i] = WORDLE_LETTER_WRONG_LOC;
                 answer_already_accounted[j] = true;
                 break;
@@ -238,7 +266,9 @@ static void reset_board(wordle_state_t *state) {
     display_playing(state);
     watch_display_string(" -", 4);
 #if __EMSCRIPTEN__
-    printf("ANSWER: %s\r\n", _valid_words[state->curr_answer]);
+    char answer[WORDLE_LENGTH + 1];
+    get_answer(state, answer);
+    printf("ANSWER: %s\r\n", answer);
 #endif
 }
 
@@ -302,7 +332,9 @@ static uint32_t get_day_unix_time(void) {
 
 static void display_lose(wordle_state_t *state, uint8_t subsecond) {
     char buf[WORDLE_LENGTH + 6];
-    sprintf(buf," L   %s", subsecond % 2 ? _valid_words[state->curr_answer] : "     ");
+    char answer[WORDLE_LENGTH + 1];
+    get_answer(state, answer);
+    sprintf(buf," L   %s", subsecond % 2 ? answer : "     ");
     watch_display_string(buf, 0);
 }
 
@@ -463,13 +495,10 @@ static void insert_random_guess(wordle_state_t *state) {
     do {  // Don't allow the guess to be the same as the answer
         random_guess = get_random(_num_random_guess_words);
     } while (random_guess == state->curr_answer); 
+    uint32_t packed = get_packed_word(_valid_words, random_guess);
     for (size_t i = 0; i < WORDLE_LENGTH; i++) {
-        for (size_t j = 0; j < WORDLE_NUM_VALID_LETTERS; j++)
-        {
-            if (_valid_words[random_guess][i] == _valid_letters[j])
-                state->word_elements[i] = j;     
-        }
-    } 
+        state->word_elements[i] = get_packed_letter(packed, i);
+    }
     state->position = WORDLE_LENGTH - 1;
     display_all_letters(state);
     state->using_random_guess = true;
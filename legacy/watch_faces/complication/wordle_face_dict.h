@@ -5,289 +5,276 @@
 #define WORDLE_LENGTH 5
 #endif
 
+#if (WORDLE_LENGTH != 5)
+#error "The packed dictionary holds 5-letter words; regenerate it with utils/wordle_face/wordle_list.py."
+#endif
+
 #ifndef WORDLE_USE_RANDOM_GUESS
 #define WORDLE_USE_RANDOM_GUESS 2
 #endif
 
 static const char _valid_letters[] = {'A', 'C', 'E', 'H', 'I', 'L', 'N', 'O', 'P', 'R', 'S', 'T'};
 
+// Words are packed as 20-bit integers: each letter is its 4-bit index in _valid_letters, first letter
+// highest, so sorting the integers sorts the words. Two words share every five bytes.
 // From: https://matthewminer.name/projects/calculators/wordle-words-left/
 // Number of words found: 432
-static const char _valid_words[][WORDLE_LENGTH + 1] = {
-    "SLATE", "STARE", "SNARE", "SANER", "CRANE", "STALE", "CRATE", "RAISE", "TRACE", 
-    "SHARE", "ARISE", "SCARE", "SPARE", "CHAOS", "TAPIR", "CAIRN", "TENOR", "CLEAN", 
-    "HEART", "SCOPE", "SNARL", "SLEPT", "SINCE", "EPOCH", "SPACE", "RELIC", "SPOIL", 
-    "LITER", "LEAPT", "LANCE", "RANCH", "HORSE", "LEACH", "LATER", "STEAL", "CHEAP", 
-    "SHORT", "ETHIC", "CHANT", "ACTOR", "REACH", "SEPIA", "ONSET", "SPLAT", "LEANT", 
-    "REACT", "OCTAL", "SPORE", "IRATE", "CORAL", "NICER", "SPILT", "SCENT", "PANIC", 
-    "SHIRT", "PECAN", "SLAIN", "SPLIT", "ROACH", "ASCOT", "PHONE", "LITHE", "STOIC", 
-    "STRIP", "RENAL", "POISE", "ENACT", "CHEAT", "PITCH", "NOISE", "INLET", "PEARL", 
-    "POLAR", "PEACH", "STOLE", "CASTE", "CREST", "CRONE", "ETHOS", "THEIR", "STONE", 
-    "SHIRE", "LATCH", "HASTE", "CLOSE", "SPINE", "SLANT", "SPEAR", "SCALE", "CAPER", 
-    "RETCH", "PESTO", "CHIRP", "SPORT", "OPTIC", "SNAIL", "PRICE", "PLANE", "TORCH", 
-    "PASTE", "RECAP", "SOLAR", "CRASH", "LINER", "OPINE", "ASHEN", "PALER", "ECLAT", 
-    "SPELT", "TRIAL", "PERIL", "SLICE", "SCANT", "SAINT", "POSIT", "ATONE", "SPIRE", 
-    "COAST", "INEPT", "SHOAL", "CLASH", "THORN", "PHASE", "SCORE", "TRICE", "PERCH", 
-    "PORCH", "SHEAR", "CHOIR", "RHINO", "PLANT", "SHONE", "CHORE", "LEARN", "ALTER", 
-    "CHAIN", "PANEL", "PLIER", "STEIN", "COPSE", "SONIC", "ALIEN", "CHOSE", "ACORN", 
-    "ANTIC", "CHEST", "OTHER", "CHINA", "TALON", "SCORN", "PLAIN", "PILOT", "RIPEN", 
-    "PATCH", "SPICE", "CLONE", "SCION", "SCONE", "STRAP", "PARSE", "SHALE", "RISEN", 
-    "CANOE", "INTER", "LEASH", "ISLET", "PRINT", "SHINE", "NORTH", "CLEAT", "PLAIT", 
-    "SCRAP", "CLEAR", "SLOTH", "LAPSE", "CHAIR", "SNORT", "SHARP", "OPERA", "STAIN", 
-    "TEACH", "TRAIL", "TRAIN", "LATHE", "PIANO", "PINCH", "PETAL", "STERN", "PRONE", 
-    "PROSE", "PLEAT", "TROPE", "PLACE", "POSER", "INERT", "CHASE", "CAROL", "STAIR", 
-    "SATIN", "SPITE", "LOATH", "ROAST", "ARSON", "SHAPE", "CLASP", "LOSER", "SALON", 
-    "CATER", "SHALT", "INTRO", "ALERT", "PENAL", "SHORE", "RINSE", "CREPT", "APRON", 
-    "SONAR", "AISLE", "AROSE", "HATER", "NICHE", "POINT", "EARTH", "PINTO", "THOSE", 
-    "CLOTH", "NOTCH", "TOPIC", "RESIN", "SCALP", "HEIST", "HERON", "TRIPE", "TONAL", 
-    "TAPER", "SHORN", "TONIC", "HOIST", "SNORE", "STORE", "SLOPE", "OCEAN", "CHART", 
-    "PAINT", "SPENT", "SNIPE", "CRISP", "TRASH", "PATIO", "PLATE", "HOTEL", "LEAST", 
-    "ALONE", "RALPH", "SPIEL", "SIREN", "RATIO", "STOOP", "TROLL", "ATOLL", "SLASH", 
-    "RETRO", "CREEP", "STILT", "SPREE", "TASTE", "CACHE", "CANON", "EATEN", "TEPEE", 
-    "SHEET", "SNEER", "ERROR", "NATAL", "SLEEP", "STINT", "TROOP", "SHALL", "STALL", 
-    "PIPER", "TOAST", "NASAL", "CORER", "THERE", "POOCH", "SCREE", "ELITE", "ALTAR", 
-    "PENCE", "EATER", "ALPHA", "TENTH", "LINEN", "SHEER", "TAINT", "HEATH", "CRIER", 
-    "TENSE", "CARAT", "CANAL", "APNEA", "THESE", "HATCH", "SHELL", "CIRCA", "APART", 
-    "SPILL", "STEEL", "LOCAL", "STOOL", "SHEEN", "RESET", "STEEP", "ELATE", "PRESS", 
-    "SLEET", "CROSS", "TOTAL", "TREAT", "ONION", "STATE", "CINCH", "ASSET", "THREE", 
-    "TORSO", "SNOOP", "PENNE", "SPOON", "SHEEP", "PAPAL", "STILL", "CHILL", "THETA", 
-    "LEECH", "INNER", "HONOR", "LOOSE", "CONIC", "SCENE", "COACH", "CONCH", "LATTE", 
-    "ERASE", "ESTER", "PEACE", "PASTA", "INANE", "SPOOL", "TEASE", "HARSH", "PIECE", 
-    "STEER", "SCOOP", "NINTH", "OTTER", "OCTET", "EERIE", "RISER", "LAPEL", "HIPPO", 
-    "PREEN", "ETHER", "AORTA", "SENSE", "TRACT", "SHOOT", "SLOOP", "REPEL", "TITHE", 
-    "IONIC", "CELLO", "CHESS", "SOOTH", "COCOA", "TITAN", "TOOTH", "TIARA", "CRESS", 
-    "SLOSH", "RARER", "TERSE", "ERECT", "HELLO", "PARER", "RIPER", "NOOSE", "CREPE", 
-    "CACAO", "ILIAC", "POSSE", "CACTI", "EASEL", "LASSO", "ROOST", "ALLOT", "COLON", 
-    "LEPER", "TEETH", "TITLE", "HENCE", "NIECE", "PAPER", "TRITE", "SPELL", "RACER", 
-    "ATTIC", "CRASS", "HITCH", "LEASE", "CEASE", "ROTOR", "ELOPE", "APPLE", "CHILI", 
-    "START", "PHOTO", "SALSA", "STASH", "PRIOR", "TAROT", "COLOR", "CHEER", "CLASS", 
-    "ARENA", "ELECT", "ENTER", "CATCH", "TENET", "TACIT", "TRAIT", "TERRA", "LILAC", 
+#define WORDLE_NUM_WORDS 432
+#define WORDLE_NUM_BEST_WORDS 13  // The valid_words array begins with this many words that are considered the top 3% best options.
+#define WORDLE_NUM_UNIQUE_WORDS 257  // The valid_words array begins with this many words where each letter is different.
+static const uint8_t _valid_words[] = {
+    0x09, 0x4A, 0x21, 0x90, 0x62, 0x19, 0x0B, 0x29, 0x04, 0xA2, 0xA0, 0x62, 0x9A, 0x10, 0x92, 0xA3, 0x09, 0x2A, 0x50, 0xB2, 0xA6, 0x09, 0x2A, 0x80, 0x92,  // ARISE CRANE CRATE RAISE SANER SCARE SHARE SLATE SNARE SPARE
+    0xAB, 0x05, 0x2A, 0xB0, 0x92, 0xB9, 0x01, 0x20, 0x17, 0x96, 0x01, 0xB7, 0x90, 0x4A, 0x52, 0x05, 0x29, 0xB0, 0x54, 0x26, 0x05, 0x76, 0x20, 0x5B, 0x29,  // STALE STARE TRACE ACORN ACTOR AISLE ALERT ALIEN ALONE ALTER
+    0x06, 0xB4, 0x10, 0x89, 0x76, 0x09, 0x7A, 0x20, 0x9A, 0x76, 0x0A, 0x17, 0xB0, 0xA3, 0x26, 0x0B, 0x76, 0x21, 0x04, 0x96, 0x10, 0x67, 0x21, 0x08, 0x29,  // ANTIC APRON AROSE ARSON ASCOT ASHEN ATONE CAIRN CANOE CAPER
+    0x10, 0x97, 0x51, 0x0A, 0xB2, 0x10, 0xB2, 0x91, 0x30, 0x46, 0x13, 0x04, 0x91, 0x30, 0x6B, 0x13, 0x07, 0xA1, 0x30, 0x9B, 0x13, 0x0A, 0x21, 0x32, 0x08,  // CAROL CASTE CATER CHAIN CHAIR CHANT CHAOS CHART CHASE CHEAP
+    0x13, 0x20, 0xB1, 0x32, 0xAB, 0x13, 0x46, 0x01, 0x34, 0x98, 0x13, 0x74, 0x91, 0x37, 0x92, 0x13, 0x7A, 0x21, 0x50, 0xA3, 0x15, 0x0A, 0x81, 0x52, 0x06,  // CHEAT CHEST CHINA CHIRP CHOIR CHORE CHOSE CLASH CLASP CLEAN
+    0x15, 0x20, 0x91, 0x52, 0x0B, 0x15, 0x76, 0x21, 0x57, 0xA2, 0x15, 0x7B, 0x31, 0x70, 0xAB, 0x17, 0x8A, 0x21, 0x79, 0x05, 0x19, 0x0A, 0x31, 0x92, 0x8B,  // CLEAR CLEAT CLONE CLOSE CLOTH COAST COPSE CORAL CRASH CREPT
+    0x19, 0x2A, 0xB1, 0x94, 0xA8, 0x19, 0x76, 0x22, 0x09, 0xB3, 0x21, 0x50, 0xB2, 0x60, 0x1B, 0x28, 0x71, 0x32, 0xB3, 0x41, 0x2B, 0x37, 0xA3, 0x0A, 0xB2,  // CREST CRISP CRONE EARTH ECLAT ENACT EPOCH ETHIC ETHOS HASTE
+    0x30, 0xB2, 0x93, 0x20, 0x9B, 0x32, 0x4A, 0xB3, 0x29, 0x76, 0x37, 0x4A, 0xB3, 0x79, 0xA2, 0x37, 0xB2, 0x54, 0x62, 0x8B, 0x46, 0x29, 0xB4, 0x65, 0x2B,  // HATER HEART HEIST HERON HOIST HORSE HOTEL INEPT INERT INLET
+    0x46, 0xB2, 0x94, 0x6B, 0x97, 0x49, 0x0B, 0x24, 0xA5, 0x2B, 0x50, 0x61, 0x25, 0x08, 0xA2, 0x50, 0xB1, 0x35, 0x0B, 0x29, 0x50, 0xB3, 0x25, 0x20, 0x13,  // INTER INTRO IRATE ISLET LANCE LAPSE LATCH LATER LATHE LEACH
+    0x52, 0x06, 0xB5, 0x20, 0x8B, 0x52, 0x09, 0x65, 0x20, 0xA3, 0x52, 0x0A, 0xB5, 0x46, 0x29, 0x54, 0xB2, 0x95, 0x4B, 0x32, 0x57, 0x0B, 0x35, 0x7A, 0x29,  // LEANT LEAPT LEARN LEASH LEAST LINER LITER LITHE LOATH LOSER
+    0x64, 0x12, 0x96, 0x41, 0x32, 0x67, 0x4A, 0x26, 0x79, 0xB3, 0x67, 0xB1, 0x37, 0x12, 0x06, 0x71, 0xB0, 0x57, 0x6A, 0x2B, 0x78, 0x29, 0x07, 0x84, 0x62,  // NICER NICHE NOISE NORTH NOTCH OCEAN OCTAL ONSET OPERA OPINE
+    0x78, 0xB4, 0x17, 0xB3, 0x29, 0x80, 0x46, 0xB8, 0x05, 0x29, 0x80, 0x62, 0x58, 0x06, 0x41, 0x80, 0x9A, 0x28, 0x0A, 0xB2, 0x80, 0xB1, 0x38, 0x0B, 0x47,  // OPTIC OTHER PAINT PALER PANEL PANIC PARSE PASTE PATCH PATIO
+    0x82, 0x01, 0x38, 0x20, 0x95, 0x82, 0x10, 0x68, 0x26, 0x05, 0x82, 0x91, 0x38, 0x29, 0x45, 0x82, 0xAB, 0x78, 0x2B, 0x05, 0x83, 0x0A, 0x28, 0x37, 0x62,  // PEACH PEARL PECAN PENAL PERCH PERIL PESTO PETAL PHASE PHONE
+    0x84, 0x06, 0x78, 0x45, 0x7B, 0x84, 0x61, 0x38, 0x46, 0xB7, 0x84, 0xB1, 0x38, 0x50, 0x12, 0x85, 0x04, 0x68, 0x50, 0x4B, 0x85, 0x06, 0x28, 0x50, 0x6B,  // PIANO PILOT PINCH PINTO PITCH PLACE PLAIN PLAIT PLANE PLANT
+    0x85, 0x0B, 0x28, 0x52, 0x0B, 0x85, 0x42, 0x98, 0x74, 0x6B, 0x87, 0x4A, 0x28, 0x75, 0x09, 0x87, 0x91, 0x38, 0x7A, 0x29, 0x87, 0xA4, 0xB8, 0x94, 0x12,  // PLATE PLEAT PLIER POINT POISE POLAR PORCH POSER POSIT PRICE
+    0x89, 0x46, 0xB8, 0x97, 0x62, 0x89, 0x7A, 0x29, 0x05, 0x83, 0x90, 0x61, 0x39, 0x0B, 0x47, 0x92, 0x01, 0x39, 0x20, 0x1B, 0x92, 0x10, 0x89, 0x25, 0x41,  // PRINT PRONE PROSE RALPH RANCH RATIO REACH REACT RECAP RELIC
+    0x92, 0x60, 0x59, 0x2A, 0x46, 0x92, 0xB1, 0x39, 0x34, 0x67, 0x94, 0x6A, 0x29, 0x48, 0x26, 0x94, 0xA2, 0x69, 0x70, 0x13, 0x97, 0x0A, 0xBA, 0x04, 0x6B,  // RENAL RESIN RETCH RHINO RINSE RIPEN RISEN ROACH ROAST SAINT
+    0xA0, 0x57, 0x6A, 0x0B, 0x46, 0xA1, 0x05, 0x2A, 0x10, 0x58, 0xA1, 0x06, 0xBA, 0x12, 0x6B, 0xA1, 0x47, 0x6A, 0x17, 0x62, 0xA1, 0x78, 0x2A, 0x17, 0x92,  // SALON SATIN SCALE SCALP SCANT SCENT SCION SCONE SCOPE SCORE
+    0xA1, 0x79, 0x6A, 0x19, 0x08, 0xA2, 0x84, 0x0A, 0x30, 0x52, 0xA3, 0x05, 0xBA, 0x30, 0x82, 0xA3, 0x09, 0x8A, 0x32, 0x09, 0xA3, 0x46, 0x2A, 0x34, 0x92,  // SCORN SCRAP SEPIA SHALE SHALT SHAPE SHARP SHEAR SHINE SHIRE
+    0xA3, 0x49, 0xBA, 0x37, 0x05, 0xA3, 0x76, 0x2A, 0x37, 0x92, 0xA3, 0x79, 0x6A, 0x37, 0x9B, 0xA4, 0x61, 0x2A, 0x49, 0x26, 0xA5, 0x04, 0x6A, 0x50, 0x6B,  // SHIRT SHOAL SHONE SHORE SHORN SHORT SINCE SIREN SLAIN SLANT
+    0xA5, 0x28, 0xBA, 0x54, 0x12, 0xA5, 0x78, 0x2A, 0x57, 0xB3, 0xA6, 0x04, 0x5A, 0x60, 0x95, 0xA6, 0x48, 0x2A, 0x67, 0x92, 0xA6, 0x79, 0xBA, 0x75, 0x09,  // SLEPT SLICE SLOPE SLOTH SNAIL SNARL SNIPE SNORE SNORT SOLAR
+    0xA7, 0x60, 0x9A, 0x76, 0x41, 0xA8, 0x01, 0x2A, 0x82, 0x09, 0xA8, 0x25, 0xBA, 0x82, 0x6B, 0xA8, 0x41, 0x2A, 0x84, 0x25, 0xA8, 0x45, 0xBA, 0x84, 0x62,  // SONAR SONIC SPACE SPEAR SPELT SPENT SPICE SPIEL SPILT SPINE
+    0xA8, 0x49, 0x2A, 0x84, 0xB2, 0xA8, 0x50, 0xBA, 0x85, 0x4B, 0xA8, 0x74, 0x5A, 0x87, 0x92, 0xA8, 0x79, 0xBA, 0xB0, 0x46, 0xAB, 0x04, 0x9A, 0xB2, 0x05,  // SPIRE SPITE SPLAT SPLIT SPOIL SPORE SPORT STAIN STAIR STEAL
+    0xAB, 0x24, 0x6A, 0xB2, 0x96, 0xAB, 0x74, 0x1A, 0xB7, 0x52, 0xAB, 0x76, 0x2A, 0xB7, 0x92, 0xAB, 0x90, 0x8A, 0xB9, 0x48, 0xB0, 0x57, 0x6B, 0x08, 0x29,  // STEIN STERN STOIC STOLE STONE STORE STRAP STRIP TALON TAPER
+    0xB0, 0x84, 0x9B, 0x20, 0x13, 0xB2, 0x67, 0x9B, 0x32, 0x49, 0xB3, 0x79, 0x6B, 0x37, 0xA2, 0xB7, 0x60, 0x5B, 0x76, 0x41, 0xB7, 0x84, 0x1B, 0x79, 0x13,  // TAPIR TEACH TENOR THEIR THORN THOSE TONAL TONIC TOPIC TORCH
+    0xB9, 0x04, 0x5B, 0x90, 0x46, 0xB9, 0x0A, 0x3B, 0x94, 0x05, 0xB9, 0x41, 0x2B, 0x94, 0x82, 0xB9, 0x78, 0x20, 0x55, 0x7B, 0x05, 0x83, 0x00, 0x5B, 0x09,  // TRAIL TRAIN TRASH TRIAL TRICE TRIPE TROPE ALLOT ALPHA ALTAR
+    0x07, 0x9B, 0x00, 0x80, 0x9B, 0x08, 0x62, 0x00, 0x88, 0x52, 0x09, 0x26, 0x00, 0xAA, 0x2B, 0x0B, 0x75, 0x50, 0xBB, 0x41, 0x10, 0x10, 0x71, 0x01, 0x32,  // AORTA APART APNEA APPLE ARENA ASSET ATOLL ATTIC CACAO CACHE
+    0x10, 0x1B, 0x41, 0x06, 0x05, 0x10, 0x67, 0x61, 0x09, 0x0B, 0x10, 0xB1, 0x31, 0x20, 0xA2, 0x12, 0x55, 0x71, 0x32, 0x29, 0x13, 0x2A, 0xA1, 0x34, 0x54,  // CACTI CANAL CANON CARAT CATCH CEASE CELLO CHEER CHESS CHILI
+    0x13, 0x45, 0x51, 0x46, 0x13, 0x14, 0x91, 0x01, 0x50, 0xAA, 0x17, 0x01, 0x31, 0x71, 0x70, 0x17, 0x57, 0x61, 0x75, 0x79, 0x17, 0x61, 0x31, 0x76, 0x41,  // CHILL CINCH CIRCA CLASS COACH COCOA COLON COLOR CONCH CONIC
+    0x17, 0x92, 0x91, 0x90, 0xAA, 0x19, 0x22, 0x81, 0x92, 0x82, 0x19, 0x2A, 0xA1, 0x94, 0x29, 0x19, 0x7A, 0xA2, 0x0A, 0x25, 0x20, 0xB2, 0x62, 0x0B, 0x29,  // CORER CRASS CREEP CREPE CRESS CRIER CROSS EASEL EATEN EATER
+    0x22, 0x94, 0x22, 0x50, 0xB2, 0x25, 0x21, 0xB2, 0x54, 0xB2, 0x25, 0x78, 0x22, 0x6B, 0x29, 0x29, 0x0A, 0x22, 0x92, 0x1B, 0x29, 0x97, 0x92, 0xAB, 0x29,  // EERIE ELATE ELECT ELITE ELOPE ENTER ERASE ERECT ERROR ESTER
+    0x2B, 0x32, 0x93, 0x09, 0xA3, 0x30, 0xB1, 0x33, 0x20, 0xB3, 0x32, 0x55, 0x73, 0x26, 0x12, 0x34, 0x88, 0x73, 0x4B, 0x13, 0x37, 0x67, 0x94, 0x54, 0x01,  // ETHER HARSH HATCH HEATH HELLO HENCE HIPPO HITCH HONOR ILIAC
+    0x46, 0x06, 0x24, 0x66, 0x29, 0x47, 0x64, 0x15, 0x08, 0x25, 0x50, 0xAA, 0x75, 0x0B, 0xB2, 0x52, 0x0A, 0x25, 0x22, 0x13, 0x52, 0x82, 0x95, 0x45, 0x01,  // INANE INNER IONIC LAPEL LASSO LATTE LEASE LEECH LEPER LILAC
+    0x54, 0x62, 0x65, 0x71, 0x05, 0x57, 0x7A, 0x26, 0x0A, 0x05, 0x60, 0xB0, 0x56, 0x42, 0x12, 0x64, 0x6B, 0x36, 0x77, 0xA2, 0x71, 0xB2, 0xB7, 0x64, 0x76,  // LINEN LOCAL LOOSE NASAL NATAL NIECE NINTH NOOSE OCTET ONION
+    0x7B, 0xB2, 0x98, 0x08, 0x05, 0x80, 0x82, 0x98, 0x09, 0x29, 0x80, 0xAB, 0x08, 0x20, 0x12, 0x82, 0x61, 0x28, 0x26, 0x62, 0x83, 0x7B, 0x78, 0x42, 0x12,  // OTTER PAPAL PAPER PARER PASTA PEACE PENCE PENNE PHOTO PIECE
+    0x84, 0x82, 0x98, 0x77, 0x13, 0x87, 0xAA, 0x28, 0x92, 0x26, 0x89, 0x2A, 0xA8, 0x94, 0x79, 0x90, 0x12, 0x99, 0x09, 0x29, 0x92, 0x82, 0x59, 0x2A, 0x2B,  // PIPER POOCH POSSE PREEN PRESS PRIOR RACER RARER REPEL RESET
+    0x92, 0xB9, 0x79, 0x48, 0x29, 0x94, 0xA2, 0x99, 0x77, 0xAB, 0x97, 0xB7, 0x9A, 0x05, 0xA0, 0xA1, 0x26, 0x2A, 0x17, 0x78, 0xA1, 0x92, 0x2A, 0x26, 0xA2,  // RETRO RIPER RISER ROOST ROTOR SALSA SCENE SCOOP SCREE SENSE
+    0xA3, 0x05, 0x5A, 0x32, 0x26, 0xA3, 0x22, 0x8A, 0x32, 0x29, 0xA3, 0x22, 0xBA, 0x32, 0x55, 0xA3, 0x77, 0xBA, 0x50, 0xA3, 0xA5, 0x22, 0x8A, 0x52, 0x2B,  // SHALL SHEEN SHEEP SHEER SHEET SHELL SHOOT SLASH SLEEP SLEET
+    0xA5, 0x77, 0x8A, 0x57, 0xA3, 0xA6, 0x22, 0x9A, 0x67, 0x78, 0xA7, 0x7B, 0x3A, 0x82, 0x55, 0xA8, 0x45, 0x5A, 0x87, 0x75, 0xA8, 0x77, 0x6A, 0x89, 0x22,  // SLOOP SLOSH SNEER SNOOP SOOTH SPELL SPILL SPOOL SPOON SPREE
+    0xAB, 0x05, 0x5A, 0xB0, 0x9B, 0xAB, 0x0A, 0x3A, 0xB0, 0xB2, 0xAB, 0x22, 0x5A, 0xB2, 0x28, 0xAB, 0x22, 0x9A, 0xB4, 0x55, 0xAB, 0x45, 0xBA, 0xB4, 0x6B,  // STALL START STASH STATE STEEL STEEP STEER STILL STILT STINT
+    0xAB, 0x77, 0x5A, 0xB7, 0x78, 0xB0, 0x14, 0xBB, 0x04, 0x6B, 0xB0, 0x97, 0xBB, 0x0A, 0xB2, 0xB2, 0x0A, 0x2B, 0x22, 0xB3, 0xB2, 0x62, 0xBB, 0x26, 0xA2,  // STOOL STOOP TACIT TAINT TAROT TASTE TEASE TEETH TENET TENSE
+    0xB2, 0x6B, 0x3B, 0x28, 0x22, 0xB2, 0x99, 0x0B, 0x29, 0xA2, 0xB3, 0x29, 0x2B, 0x32, 0xA2, 0xB3, 0x2B, 0x0B, 0x39, 0x22, 0xB4, 0x09, 0x0B, 0x4B, 0x06,  // TENTH TEPEE TERRA TERSE THERE THESE THETA THREE TIARA TITAN
+    0xB4, 0xB3, 0x2B, 0x4B, 0x52, 0xB7, 0x0A, 0xBB, 0x77, 0xB3, 0xB7, 0x9A, 0x7B, 0x7B, 0x05, 0xB9, 0x01, 0xBB, 0x90, 0x4B, 0xB9, 0x20, 0xBB, 0x94, 0xB2,  // TITHE TITLE TOAST TOOTH TORSO TOTAL TRACT TRAIT TREAT TRITE
+    0xB9, 0x75, 0x5B, 0x97, 0x78,  // TROLL TROOP
 };
 
 // These are words that'll never be used, but still need to be in the dictionary for guesses.
 // Number of words found: 1898
-static const char _possible_words[][WORDLE_LENGTH + 1] = {
 #if !WORDLE_ALLOW_NON_WORD_AND_REPEAT_GUESSES
-    "AALII", "AARTI", "ACAIS", "ACARI", "ACCAS", "ACERS", "ACETA", "ACHAR", "ACHES", 
-    "ACHOO", "ACINI", "ACNES", "ACRES", "ACROS", "ACTIN", "ACTON", "AECIA", "AEONS", 
-    "AERIE", "AEROS", "AESIR", "AHEAP", "AHENT", "AHINT", "AINEE", "AIOLI", "AIRER", 
-    "AIRNS", "AIRTH", "AIRTS", "AITCH", "ALAAP", "ALANE", "ALANS", "ALANT", "ALAPA", 
-    "ALAPS", "ALATE", "ALCOS", "ALECS", "ALEPH", "ALIAS", "ALINE", "ALIST", "ALLEE", 
-    "ALLEL", "ALLIS", "ALOES", "ALOHA", "ALOIN", "ALOOS", "ALTHO", "ALTOS", "ANANA", 
-    "ANATA", "ANCHO", "ANCLE", "ANCON", "ANEAR", "ANELE", "ANENT", "ANILE", "ANILS", 
-    "ANION", "ANISE", "ANLAS", "ANNAL", "ANNAS", "ANNAT", "ANOAS", "ANOLE", "ANSAE", 
-    "ANTAE", "ANTAR", "ANTAS", "ANTES", "ANTIS", "ANTRA", "ANTRE", "APACE", "APERS", 
-    "APERT", "APHIS", "APIAN", "APIOL", "APISH", "APOOP", "APORT", "APPAL", "APPEL", 
-    "APPRO", "APRES", "APSES", "APSIS", "APSOS", "APTER", "ARARS", "ARCHI", "ARCOS", 
-    "AREAE", "AREAL", "AREAR", "AREAS", "ARECA", "AREIC", "ARENE", "AREPA", "ARERE", 
-    "ARETE", "ARETS", "ARETT", "ARHAT", "ARIAS", "ARIEL", "ARILS", "ARIOT", "ARISH", 
-    "ARLES", "ARNAS", "AROHA", "ARPAS", "ARPEN", "ARRAH", "ARRAS", "ARRET", "ARRIS", 
-    "ARSES", "ARSIS", "ARTAL", "ARTEL", "ARTIC", "ARTIS", "ASANA", "ASCON", "ASHES", 
-    "ASHET", "ASPEN", "ASPER", "ASPIC", "ASPIE", "ASPIS", "ASPRO", "ASSAI", "ASSES", 
-    "ASSOT", "ASTER", "ASTIR", "ATAPS", "ATILT", "ATLAS", "ATOCS", "ATRIA", "ATRIP", 
-    "ATTAP", "ATTAR", "CACAS", "CAECA", "CAESE", "CAINS", "CALLA", "CALLS", "CALOS", 
-    "CALPA", "CALPS", "CANEH", "CANER", "CANES", "CANNA", "CANNS", "CANSO", "CANST", 
-    "CANTO", "CANTS", "CAPAS", "CAPES", "CAPHS", "CAPLE", "CAPON", "CAPOS", "CAPOT", 
-    "CAPRI", "CARAP", "CARER", "CARES", "CARET", "CARLE", "CARLS", "CARNS", "CARON", 
-    "CARPI", "CARPS", "CARRS", "CARSE", "CARTA", "CARTE", "CARTS", "CASAS", "CASCO", 
-    "CASES", "CASTS", "CATES", "CECAL", "CEILI", "CEILS", "CELLA", "CELLI", "CELLS", 
-    "CELTS", "CENSE", "CENTO", "CENTS", "CEORL", "CEPES", "CERCI", "CERES", "CERIA", 
-    "CERIC", "CERNE", "CEROC", "CEROS", "CERTS", "CESSE", "CESTA", "CESTI", "CETES", 
-    "CHACE", "CHACO", "CHAIS", "CHALS", "CHANA", "CHAPE", "CHAPS", "CHAPT", "CHARA", 
-    "CHARE", "CHARR", "CHARS", "CHATS", "CHEEP", "CHELA", "CHELP", "CHERE", "CHERT", 
-    "CHETH", "CHIAO", "CHIAS", "CHICA", "CHICH", "CHICO", "CHICS", "CHIEL", "CHILE", 
-    "CHINE", "CHINO", "CHINS", "CHIPS", "CHIRL", "CHIRO", "CHIRR", "CHIRT", "CHITS", 
-    "CHOCO", "CHOCS", "CHOIL", "CHOLA", "CHOLI", "CHOLO", "CHONS", "CHOON", "CHOPS", 
-    "CHOTA", "CHOTT", "CIELS", "CILIA", "CILLS", "CINCT", "CINES", "CIONS", "CIPPI", 
-    "CIRCS", "CIRES", "CIRLS", "CIRRI", "CISCO", "CISTS", "CITAL", "CITER", "CITES", 
-    "CLACH", "CLAES", "CLANS", "CLAPS", "CLAPT", "CLARO", "CLART", "CLAST", "CLATS", 
-    "CLEEP", "CLEPE", "CLEPT", "CLIES", "CLINE", "CLINT", "CLIPE", "CLIPS", "CLIPT", 
-    "CLITS", "CLONS", "CLOOP", "CLOOT", "CLOPS", "CLOTE", "CLOTS", "COACT", "COALA", 
-    "COALS", "COAPT", "COATE", "COATI", "COATS", "COCAS", "COCCI", "COCCO", "COCOS", 
-    "COHEN", "COHOE", "COHOS", "COILS", "COINS", "COIRS", "COITS", "COLAS", "COLES", 
-    "COLIC", "COLIN", "COLLS", "COLTS", "CONES", "CONIA", "CONIN", "CONNE", "CONNS", 
-    "CONTE", "CONTO", "COOCH", "COOEE", "COOER", "COOLS", "COONS", "COOPS", "COOPT", 
-    "COOST", "COOTS", "COPAL", "COPEN", "COPER", "COPES", "COPRA", "CORES", "CORIA", 
-    "CORNI", "CORNO", "CORNS", "CORPS", "CORSE", "CORSO", "COSEC", "COSES", "COSET", 
-    "COSIE", "COSTA", "COSTE", "COSTS", "COTAN", "COTES", "COTHS", "COTTA", "COTTS", 
-    "CRAAL", "CRAIC", "CRANS", "CRAPE", "CRAPS", "CRARE", "CREEL", "CREES", "CRENA", 
-    "CREPS", "CRIAS", "CRIES", "CRINE", "CRIOS", "CRIPE", "CRIPS", "CRISE", "CRITH", 
-    "CRITS", "CROCI", "CROCS", "CRONS", "CROOL", "CROON", "CROPS", "CRORE", "CROST", 
-    "CTENE", "EALES", "EARLS", "EARNS", "EARNT", "EARST", "EASER", "EASES", "EASLE", 
-    "EASTS", "EATHE", "ECHES", "ECHOS", "EISEL", "ELAIN", "ELANS", "ELCHI", "ELINT", 
-    "ELOIN", "ELOPS", "ELPEE", "ELSIN", "ENATE", "ENIAC", "ENLIT", "ENOLS", "ENROL", 
-    "ENTIA", "EORLS", "EOSIN", "EPACT", "EPEES", "EPHAH", "EPHAS", "EPHOR", "EPICS", 
-    "EPOPT", "EPRIS", "ERICA", "ERICS", "ERNES", "EROSE", "ERSES", "ESCAR", "ESCOT", 
-    "ESILE", "ESNES", "ESSES", "ESTOC", "ESTOP", "ESTRO", "ETAPE", "ETATS", "ETENS", 
-    "ETHAL", "ETHNE", "ETICS", "ETNAS", "ETTIN", "ETTLE", "HAARS", "HAETS", "HAHAS", 
-    "HAILS", "HAINS", "HAINT", "HAIRS", "HAITH", "HALAL", "HALER", "HALES", "HALLO", 
-    "HALLS", "HALON", "HALOS", "HALSE", "HALTS", "HANAP", "HANCE", "HANCH", "HANSA", 
-    "HANSE", "HANTS", "HAOLE", "HAPPI", "HARES", "HARLS", "HARNS", "HAROS", "HARPS", 
-    "HARTS", "HASPS", "HASTA", "HATES", "HATHA", "HEALS", "HEAPS", "HEARE", "HEARS", 
-    "HEAST", "HEATS", "HECHT", "HEELS", "HEILS", "HEIRS", "HELES", "HELIO", "HELLS", 
-    "HELOS", "HELOT", "HELPS", "HENCH", "HENNA", "HENTS", "HEPAR", "HERES", "HERLS", 
-    "HERNS", "HEROS", "HERSE", "HESPS", "HESTS", "HETES", "HETHS", "HIANT", "HILAR", 
-    "HILCH", "HILLO", "HILLS", "HILTS", "HINTS", "HIOIS", "HIREE", "HIRER", "HIRES", 
-    "HISTS", "HITHE", "HOARS", "HOAST", "HOERS", "HOISE", "HOLES", "HOLLA", "HOLLO", 
-    "HOLON", "HOLOS", "HOLTS", "HONAN", "HONER", "HONES", "HOOCH", "HOONS", "HOOPS", 
-    "HOORS", "HOOSH", "HOOTS", "HOPER", "HOPES", "HORAH", "HORAL", "HORAS", "HORIS", 
-    "HORNS", "HORST", "HOSEL", "HOSEN", "HOSER", "HOSES", "HOSTA", "HOSTS", "HOTCH", 
-    "HOTEN", "ICERS", "ICHES", "ICHOR", "ICIER", "ICONS", "ICTAL", "ICTIC", "ILEAC", 
-    "ILEAL", "ILIAL", "ILLER", "ILLTH", "INAPT", "INCEL", "INCLE", "INION", "INNIT", 
-    "INSET", "INSPO", "INTEL", "INTIL", "INTIS", "INTRA", "IOTAS", "IPPON", "IRONE", 
-    "IRONS", "ISHES", "ISLES", "ISNAE", "ISSEI", "ISTLE", "ITHER", "LAARI", "LACER", 
-    "LACES", "LACET", "LAERS", "LAHAL", "LAHAR", "LAICH", "LAICS", "LAIRS", "LAITH", 
-    "LALLS", "LANAI", "LANAS", "LANCH", "LANES", "LANTS", "LAPIN", "LAPIS", "LARCH", 
-    "LAREE", "LARES", "LARIS", "LARNS", "LARNT", "LASER", "LASES", "LASSI", "LASTS", 
-    "LATAH", "LATEN", "LATHI", "LATHS", "LEANS", "LEAPS", "LEARE", "LEARS", "LEATS", 
-    "LEEAR", "LEEPS", "LEERS", "LEESE", "LEETS", "LEHRS", "LEIRS", "LEISH", "LENES", 
-    "LENIS", "LENOS", "LENSE", "LENTI", "LENTO", "LEONE", "LEPRA", "LEPTA", "LERES", 
-    "LERPS", "LESES", "LESTS", "LETCH", "LETHE", "LIANA", "LIANE", "LIARS", "LIART", 
-    "LICHI", "LICHT", "LICIT", "LIENS", "LIERS", "LILLS", "LILOS", "LILTS", "LINAC", 
-    "LINCH", "LINES", "LININ", "LINNS", "LINOS", "LINTS", "LIONS", "LIPAS", "LIPES", 
-    "LIPIN", "LIPOS", "LIRAS", "LIROT", "LISLE", "LISPS", "LISTS", "LITAI", "LITAS", 
-    "LITES", "LITHO", "LITHS", "LITRE", "LLANO", "LOACH", "LOANS", "LOAST", "LOCHE", 
-    "LOCHS", "LOCIE", "LOCIS", "LOCOS", "LOESS", "LOHAN", "LOINS", "LOIPE", "LOIRS", 
-    "LOLLS", "LONER", "LOOIE", "LOONS", "LOOPS", "LOOTS", "LOPER", "LOPES", "LORAL", 
-    "LORAN", "LOREL", "LORES", "LORIC", "LORIS", "LOSEL", "LOSEN", "LOSES", "LOTAH", 
-    "LOTAS", "LOTES", "LOTIC", "LOTOS", "LOTSA", "LOTTA", "LOTTE", "LOTTO", "NAANS", 
-    "NACHE", "NACHO", "NACRE", "NAHAL", "NAILS", "NAIRA", "NALAS", "NALLA", "NANAS", 
-    "NANCE", "NANNA", "NANOS", "NAPAS", "NAPES", "NAPOO", "NAPPA", "NAPPE", "NARAS", 
-    "NARCO", "NARCS", "NARES", "NARIC", "NARIS", "NARRE", "NASHI", "NATCH", "NATES", 
-    "NATIS", "NEALS", "NEAPS", "NEARS", "NEATH", "NEATS", "NEELE", "NEEPS", "NEESE", 
-    "NEIST", "NELIS", "NENES", "NEONS", "NEPER", "NEPIT", "NERAL", "NEROL", "NERTS", 
-    "NESTS", "NETES", "NETOP", "NETTS", "NICHT", "NICOL", "NIHIL", "NILLS", "NINER", 
-    "NINES", "NINON", "NIPAS", "NIRLS", "NISEI", "NISSE", "NITER", "NITES", "NITON", 
-    "NITRE", "NITRO", "NOAHS", "NOELS", "NOILS", "NOINT", "NOIRS", "NOLES", "NOLLS", 
-    "NOLOS", "NONAS", "NONCE", "NONES", "NONET", "NONIS", "NOOIT", "NOONS", "NOOPS", 
-    "NOPAL", "NORIA", "NORIS", "NOSER", "NOSES", "NOTAL", "NOTER", "NOTES", "OASES", 
-    "OASIS", "OASTS", "OATEN", "OATER", "OATHS", "OCHER", "OCHES", "OCHRE", "OCREA", 
-    "OCTAN", "OCTAS", "OHIAS", "OHONE", "OILER", "OINTS", "OLEIC", "OLEIN", "OLENT", 
-    "OLEOS", "OLIOS", "OLLAS", "OLLER", "OLLIE", "OLPAE", "OLPES", "ONCER", "ONCES", 
-    "ONCET", "ONERS", "ONTIC", "OONTS", "OORIE", "OOSES", "OPAHS", "OPALS", "OPENS", 
-    "OPEPE", "OPPOS", "OPSIN", "OPTER", "ORACH", "ORALS", "ORANT", "ORATE", "ORCAS", 
-    "ORCIN", "ORIEL", "ORLES", "ORLON", "ORLOP", "ORNIS", "ORPIN", "ORRIS", "ORTHO", 
-    "OSCAR", "OSHAC", "OSIER", "OSSIA", "OSTIA", "OTTAR", "OTTOS", "PAALS", "PAANS", 
-    "PACAS", "PACER", "PACES", "PACHA", "PACOS", "PACTA", "PACTS", "PAEAN", "PAEON", 
-    "PAILS", "PAINS", "PAIRE", "PAIRS", "PAISA", "PAISE", "PALAS", "PALEA", "PALES", 
-    "PALET", "PALIS", "PALLA", "PALLS", "PALPI", "PALPS", "PALSA", "PANCE", "PANES", 
-    "PANNE", "PANNI", "PANTO", "PANTS", "PAOLI", "PAOLO", "PAPAS", "PAPES", "PAPPI", 
-    "PARAE", "PARAS", "PARCH", "PAREN", "PAREO", "PARES", "PARIS", "PARLE", "PAROL", 
-    "PARPS", "PARRA", "PARRS", "PARTI", "PARTS", "PASEO", "PASES", "PASHA", "PASSE", 
-    "PASTS", "PATEN", "PATER", "PATES", "PATHS", "PATIN", "PATTE", "PEALS", "PEANS", 
-    "PEARE", "PEARS", "PEART", "PEASE", "PEATS", "PECHS", "PEECE", "PEELS", "PEENS", 
-    "PEEPE", "PEEPS", "PEERS", "PEINS", "PEISE", "PELAS", "PELES", "PELLS", "PELON", 
-    "PELTA", "PELTS", "PENES", "PENIE", "PENIS", "PENNA", "PENNI", "PENTS", "PEONS", 
-    "PEPLA", "PEPOS", "PEPSI", "PERAI", "PERCE", "PERCS", "PEREA", "PERES", "PERIS", 
-    "PERNS", "PERPS", "PERSE", "PERST", "PERTS", "PESOS", "PESTS", "PETAR", "PETER", 
-    "PETIT", "PETRE", "PETRI", "PETTI", "PETTO", "PHARE", "PHEER", "PHENE", "PHEON", 
-    "PHESE", "PHIAL", "PHISH", "PHOCA", "PHONO", "PHONS", "PHOTS", "PHPHT", "PIANI", 
-    "PIANS", "PICAL", "PICAS", "PICOT", "PICRA", "PIERS", "PIERT", "PIETA", "PIETS", 
-    "PILAE", "PILAO", "PILAR", "PILCH", "PILEA", "PILEI", "PILER", "PILES", "PILIS", 
-    "PILLS", "PINAS", "PINES", "PINNA", "PINON", "PINOT", "PINTA", "PINTS", "PIONS", 
-    "PIPAL", "PIPAS", "PIPES", "PIPET", "PIPIS", "PIPIT", "PIRAI", "PIRLS", "PIRNS", 
-    "PISCO", "PISES", "PISOS", "PISTE", "PITAS", "PITHS", "PITON", "PITOT", "PITTA", 
-    "PLAAS", "PLANS", "PLAPS", "PLASH", "PLAST", "PLATS", "PLATT", "PLEAS", "PLENA", 
-    "PLEON", "PLESH", "PLICA", "PLIES", "PLOAT", "PLOPS", "PLOTS", "POACH", "POEPS", 
-    "POETS", "POLER", "POLES", "POLIO", "POLIS", "POLLS", "POLOS", "POLTS", "PONCE", 
-    "PONES", "PONTS", "POOHS", "POOLS", "POONS", "POOPS", "POORI", "POORT", "POOTS", 
-    "POPES", "POPPA", "PORAE", "PORAL", "PORER", "PORES", "PORIN", "PORNO", "PORNS", 
-    "PORTA", "PORTS", "POSES", "POSHO", "POSTS", "POTAE", "POTCH", "POTES", "POTIN", 
-    "POTOO", "POTTO", "POTTS", "PRANA", "PRAOS", "PRASE", "PRATE", "PRATS", "PRATT", 
-    "PREES", "PRENT", "PREON", "PREOP", "PREPS", "PRESA", "PRESE", "PREST", "PRIAL", 
-    "PRIER", "PRIES", "PRILL", "PRION", "PRISE", "PRISS", "PROAS", "PROIN", "PROLE", 
-    "PROLL", "PROPS", "PRORE", "PROSO", "PROSS", "PROST", "PROTO", "PSION", "PSOAE", 
-    "PSOAI", "PSOAS", "PSORA", "RACES", "RACHE", "RACON", "RAIAS", "RAILE", "RAILS", 
-    "RAINE", "RAINS", "RAITA", "RAITS", "RALES", "RANAS", "RANCE", "RANEE", "RANIS", 
-    "RANTS", "RAPER", "RAPES", "RAPHE", "RAPPE", "RAREE", "RARES", "RASER", "RASES", 
-    "RASPS", "RASSE", "RASTA", "RATAL", "RATAN", "RATAS", "RATCH", "RATEL", "RATER", 
-    "RATES", "RATHA", "RATHE", "RATHS", "RATOO", "RATOS", "REAIS", "REALO", "REALS", 
-    "REANS", "REAPS", "REARS", "REAST", "REATA", "REATE", "RECAL", "RECCE", "RECCO", 
-    "RECIT", "RECON", "RECTA", "RECTI", "RECTO", "REECH", "REELS", "REENS", "REEST", 
-    "REINS", "REIST", "RELET", "RELIE", "RELIT", "RELLO", "RENIN", "RENNE", "RENOS", 
-    "RENTE", "RENTS", "REOIL", "REPIN", "REPLA", "REPOS", "REPOT", "REPPS", "REPRO", 
-    "RERAN", "RESAT", "RESEE", "RESES", "RESIT", "RESTO", "RESTS", "RETIA", "RETIE", 
-    "RHEAS", "RHIES", "RHINE", "RHONE", "RIALS", "RIANT", "RIATA", "RICER", "RICES", 
-    "RICHT", "RICIN", "RIELS", "RILES", "RILLE", "RILLS", "RINES", "RIOTS", "RIPES", 
-    "RIPPS", "RISES", "RISHI", "RISPS", "RITES", "RITTS", "ROANS", "ROARS", "ROATE", 
-    "ROHES", "ROILS", "ROINS", "ROIST", "ROLES", "ROLLS", "RONEO", "RONES", "RONIN", 
-    "RONNE", "RONTE", "RONTS", "ROONS", "ROOPS", "ROOSA", "ROOSE", "ROOTS", "ROPER", 
-    "ROPES", "RORAL", "RORES", "RORIC", "RORIE", "RORTS", "ROSES", "ROSET", "ROSHI", 
-    "ROSIN", "ROSIT", "ROSTI", "ROSTS", "ROTAL", "ROTAN", "ROTAS", "ROTCH", "ROTES", 
-    "ROTIS", "ROTLS", "ROTON", "ROTOS", "ROTTE", "SACRA", "SAICE", "SAICS", "SAILS", 
-    "SAINE", "SAINS", "SAIRS", "SAIST", "SAITH", "SALAL", "SALAT", "SALEP", "SALES", 
-    "SALET", "SALIC", "SALLE", "SALOL", "SALOP", "SALPA", "SALPS", "SALSE", "SALTO", 
-    "SALTS", "SANES", "SANSA", "SANTO", "SANTS", "SAOLA", "SAPAN", "SAPOR", "SARAN", 
-    "SAREE", "SARIN", "SARIS", "SAROS", "SASER", "SASIN", "SASSE", "SATAI", "SATES", 
-    "SATIS", "SCAIL", "SCALA", "SCALL", "SCANS", "SCAPA", "SCAPE", "SCAPI", "SCARP", 
-    "SCARS", "SCART", "SCATH", "SCATS", "SCATT", "SCEAT", "SCENA", "SCOOT", "SCOPA", 
-    "SCOPS", "SCOTS", "SCRAE", "SCRAN", "SCRAT", "SCRIP", "SEALS", "SEANS", "SEARE", 
-    "SEARS", "SEASE", "SEATS", "SECCO", "SECHS", "SECTS", "SEELS", "SEEPS", "SEERS", 
-    "SEHRI", "SEILS", "SEINE", "SEIRS", "SEISE", "SELAH", "SELES", "SELLA", "SELLE", 
-    "SELLS", "SENAS", "SENES", "SENNA", "SENOR", "SENSA", "SENSI", "SENTE", "SENTI", 
-    "SENTS", "SEPAL", "SEPIC", "SEPTA", "SEPTS", "SERAC", "SERAI", "SERAL", "SERER", 
-    "SERES", "SERIC", "SERIN", "SERON", "SERRA", "SERRE", "SERRS", "SESSA", "SETAE", 
-    "SETAL", "SETON", "SETTS", "SHAHS", "SHANS", "SHAPS", "SHARN", "SHASH", "SHCHI", 
-    "SHEAL", "SHEAS", "SHEEL", "SHENT", "SHEOL", "SHERE", "SHERO", "SHETS", "SHIAI", 
-    "SHIEL", "SHIER", "SHIES", "SHILL", "SHINS", "SHIPS", "SHIRR", "SHIRS", "SHISH", 
-    "SHISO", "SHIST", "SHITE", "SHITS", "SHLEP", "SHOAT", "SHOER", "SHOES", "SHOLA", 
-    "SHOOL", "SHOON", "SHOOS", "SHOPE", "SHOPS", "SHORL", "SHOTE", "SHOTS", "SHOTT", 
-    "SHRIS", "SIALS", "SICES", "SICHT", "SIENS", "SIENT", "SIETH", "SILEN", "SILER", 
-    "SILES", "SILLS", "SILOS", "SILTS", "SINES", "SINHS", "SIPES", "SIREE", "SIRES", 
-    "SIRIH", "SIRIS", "SIROC", "SIRRA", "SISAL", "SISES", "SISTA", "SISTS", "SITAR", 
-    "SITES", "SITHE", "SLAES", "SLANE", "SLAPS", "SLART", "SLATS", "SLEER", "SLIER", 
-    "SLIPE", "SLIPS", "SLIPT", "SLISH", "SLITS", "SLOAN", "SLOES", "SLOOT", "SLOPS", 
-    "SLOTS", "SNAPS", "SNARS", "SNASH", "SNATH", "SNEAP", "SNEES", "SNELL", "SNIES", 
-    "SNIPS", "SNIRT", "SNITS", "SNOEP", "SNOOL", "SNOOT", "SNOTS", "SOAPS", "SOARE", 
-    "SOARS", "SOCAS", "SOCES", "SOCLE", "SOILS", "SOLAH", "SOLAN", "SOLAS", "SOLEI", 
-    "SOLER", "SOLES", "SOLON", "SOLOS", "SONCE", "SONES", "SONNE", "SONSE", "SOOLE", 
-    "SOOLS", "SOOPS", "SOOTE", "SOOTS", "SOPHS", "SOPOR", "SOPRA", "SORAL", "SORAS", 
-    "SOREE", "SOREL", "SORER", "SORES", "SORNS", "SORRA", "SORTA", "SORTS", "SOTHS", 
-    "SOTOL", "SPAER", "SPAES", "SPAHI", "SPAIL", "SPAIN", "SPAIT", "SPALE", "SPALL", 
-    "SPALT", "SPANE", "SPANS", "SPARS", "SPART", "SPATE", "SPATS", "SPEAL", "SPEAN", 
-    "SPEAT", "SPECS", "SPECT", "SPEEL", "SPEER", "SPEIL", "SPEIR", "SPEOS", "SPETS", 
-    "SPIAL", "SPICA", "SPICS", "SPIER", "SPIES", "SPILE", "SPINA", "SPINS", "SPIRT", 
-    "SPITS", "SPOOR", "SPOOT", "SPOSH", "SPOTS", "SPRAT", "SPRIT", "STANE", "STAPH", 
-    "STAPS", "STARN", "STARR", "STARS", "STATS", "STEAN", "STEAR", "STEEN", "STEIL", 
-    "STELA", "STELE", "STELL", "STENO", "STENS", "STENT", "STEPS", "STEPT", "STERE", 
-    "STETS", "STICH", "STIES", "STILE", "STIPA", "STIPE", "STIRE", "STIRP", "STIRS", 
-    "STOAE", "STOAI", "STOAS", "STOAT", "STOEP", "STOIT", "STOLN", "STONN", "STOOR", 
-    "STOPE", "STOPS", "STOPT", "STOSS", "STOTS", "STOTT", "STRAE", "STREP", "STRIA", 
-    "STROP", "TAALS", "TAATA", "TACAN", "TACES", "TACET", "TACHE", "TACHO", "TACHS", 
-    "TACOS", "TACTS", "TAELS", "TAHAS", "TAHRS", "TAILS", "TAINS", "TAIRA", "TAISH", 
-    "TAITS", "TALAR", "TALAS", "TALCS", "TALEA", "TALER", "TALES", "TALLS", "TALPA", 
-    "TANAS", "TANHS", "TANNA", "TANTI", "TANTO", "TAPAS", "TAPEN", "TAPES", "TAPET", 
-    "TAPIS", "TAPPA", "TARAS", "TARES", "TARNS", "TAROC", "TAROS", "TARPS", "TARRE", 
-    "TARSI", "TARTS", "TASAR", "TASER", "TASES", "TASSA", "TASSE", "TASSO", "TATAR", 
-    "TATER", "TATES", "TATHS", "TATIE", "TATTS", "TEALS", "TEARS", "TEATS", "TECHS", 
-    "TECTA", "TEELS", "TEENE", "TEENS", "TEERS", "TEHRS", "TEILS", "TEINS", "TELAE", 
-    "TELCO", "TELES", "TELIA", "TELIC", "TELLS", "TELOI", "TELOS", "TENCH", "TENES", 
-    "TENIA", "TENNE", "TENNO", "TENON", "TENTS", "TEPAL", "TEPAS", "TERAI", "TERAS", 
-    "TERCE", "TERES", "TERNE", "TERNS", "TERTS", "TESLA", "TESTA", "TESTE", "TESTS", 
-    "TETES", "TETHS", "TETRA", "TETRI", "THALE", "THALI", "THANA", "THANE", "THANS", 
-    "THARS", "THECA", "THEES", "THEIC", "THEIN", "THENS", "THESP", "THETE", "THILL", 
-    "THINE", "THINS", "THIOL", "THIRL", "THOLE", "THOLI", "THORO", "THORP", "THRAE", 
-    "THRIP", "THROE", "TIANS", "TIARS", "TICAL", "TICCA", "TICES", "TIERS", "TILER", 
-    "TILES", "TILLS", "TILTH", "TILTS", "TINAS", "TINCT", "TINEA", "TINES", "TINTS", 
-    "TIPIS", "TIRES", "TIRLS", "TIROS", "TIRRS", "TITCH", "TITER", "TITIS", "TITRE", 
-    "TOCOS", "TOEAS", "TOHOS", "TOILE", "TOILS", "TOISE", "TOITS", "TOLAN", "TOLAR", 
-    "TOLAS", "TOLES", "TOLLS", "TOLTS", "TONER", "TONES", "TONNE", "TOOLS", "TOONS", 
-    "TOOTS", "TOPEE", "TOPER", "TOPES", "TOPHE", "TOPHI", "TOPHS", "TOPIS", "TOPOI", 
-    "TOPOS", "TORAH", "TORAN", "TORAS", "TORCS", "TORES", "TORIC", "TORII", "TOROS", 
-    "TOROT", "TORRS", "TORSE", "TORSI", "TORTA", "TORTE", "TORTS", "TOSAS", "TOSES", 
-    "TOTER", "TOTES", "TRANS", "TRANT", "TRAPE", "TRAPS", "TRAPT", "TRASS", "TRATS", 
-    "TRATT", "TREEN", "TREES", "TRESS", "TREST", "TRETS", "TRIAC", "TRIER", "TRIES", 
-    "TRILL", "TRINE", "TRINS", "TRIOL", "TRIOR", "TRIOS", "TRIPS", "TRIST", "TROAT", 
-    "TROIS", "TRONA", "TRONC", "TRONE", "TRONS", "TROTH", "TROTS", "TSARS", 
-#endif
+#define WORDLE_NUM_POSSIBLE_WORDS 1898
+static const uint8_t _possible_words[] = {
+    0x00, 0x54, 0x40, 0x09, 0xB4, 0x01, 0x04, 0xA0, 0x10, 0x94, 0x01, 0x10, 0xA0, 0x12, 0x9A, 0x01, 0x2B, 0x00, 0x13, 0x09, 0x01, 0x32, 0xA0, 0x13, 0x77,  // AALII AARTI ACAIS ACARI ACCAS ACERS ACETA ACHAR ACHES ACHOO
+    0x01, 0x46, 0x40, 0x16, 0x2A, 0x01, 0x92, 0xA0, 0x19, 0x7A, 0x01, 0xB4, 0x60, 0x1B, 0x76, 0x02, 0x14, 0x00, 0x27, 0x6A, 0x02, 0x94, 0x20, 0x29, 0x7A,  // ACINI ACNES ACRES ACROS ACTIN ACTON AECIA AEONS AERIE AEROS
+    0x02, 0xA4, 0x90, 0x32, 0x08, 0x03, 0x26, 0xB0, 0x34, 0x6B, 0x04, 0x62, 0x20, 0x47, 0x54, 0x04, 0x92, 0x90, 0x49, 0x6A, 0x04, 0x9B, 0x30, 0x49, 0xBA,  // AESIR AHEAP AHENT AHINT AINEE AIOLI AIRER AIRNS AIRTH AIRTS
+    0x04, 0xB1, 0x30, 0x50, 0x08, 0x05, 0x06, 0x20, 0x50, 0x6A, 0x05, 0x06, 0xB0, 0x50, 0x80, 0x05, 0x08, 0xA0, 0x50, 0xB2, 0x05, 0x17, 0xA0, 0x52, 0x1A,  // AITCH ALAAP ALANE ALANS ALANT ALAPA ALAPS ALATE ALCOS ALECS
+    0x05, 0x28, 0x30, 0x54, 0x0A, 0x05, 0x46, 0x20, 0x54, 0xAB, 0x05, 0x52, 0x20, 0x55, 0x25, 0x05, 0x54, 0xA0, 0x57, 0x2A, 0x05, 0x73, 0x00, 0x57, 0x46,  // ALEPH ALIAS ALINE ALIST ALLEE ALLEL ALLIS ALOES ALOHA ALOIN
+    0x05, 0x77, 0xA0, 0x5B, 0x37, 0x05, 0xB7, 0xA0, 0x60, 0x60, 0x06, 0x0B, 0x00, 0x61, 0x37, 0x06, 0x15, 0x20, 0x61, 0x76, 0x06, 0x20, 0x90, 0x62, 0x52,  // ALOOS ALTHO ALTOS ANANA ANATA ANCHO ANCLE ANCON ANEAR ANELE
+    0x06, 0x26, 0xB0, 0x64, 0x52, 0x06, 0x45, 0xA0, 0x64, 0x76, 0x06, 0x4A, 0x20, 0x65, 0x0A, 0x06, 0x60, 0x50, 0x66, 0x0A, 0x06, 0x60, 0xB0, 0x67, 0x0A,  // ANENT ANILE ANILS ANION ANISE ANLAS ANNAL ANNAS ANNAT ANOAS
+    0x06, 0x75, 0x20, 0x6A, 0x02, 0x06, 0xB0, 0x20, 0x6B, 0x09, 0x06, 0xB0, 0xA0, 0x6B, 0x2A, 0x06, 0xB4, 0xA0, 0x6B, 0x90, 0x06, 0xB9, 0x20, 0x80, 0x12,  // ANOLE ANSAE ANTAE ANTAR ANTAS ANTES ANTIS ANTRA ANTRE APACE
+    0x08, 0x29, 0xA0, 0x82, 0x9B, 0x08, 0x34, 0xA0, 0x84, 0x06, 0x08, 0x47, 0x50, 0x84, 0xA3, 0x08, 0x77, 0x80, 0x87, 0x9B, 0x08, 0x80, 0x50, 0x88, 0x25,  // APERS APERT APHIS APIAN APIOL APISH APOOP APORT APPAL APPEL
+    0x08, 0x89, 0x70, 0x89, 0x2A, 0x08, 0xA2, 0xA0, 0x8A, 0x4A, 0x08, 0xA7, 0xA0, 0x8B, 0x29, 0x09, 0x09, 0xA0, 0x91, 0x34, 0x09, 0x17, 0xA0, 0x92, 0x02,  // APPRO APRES APSES APSIS APSOS APTER ARARS ARCHI ARCOS AREAE
+    0x09, 0x20, 0x50, 0x92, 0x09, 0x09, 0x20, 0xA0, 0x92, 0x10, 0x09, 0x24, 0x10, 0x92, 0x62, 0x09, 0x28, 0x00, 0x92, 0x92, 0x09, 0x2B, 0x20, 0x92, 0xBA,  // AREAL AREAR AREAS ARECA AREIC ARENE AREPA ARERE ARETE ARETS
+    0x09, 0x2B, 0xB0, 0x93, 0x0B, 0x09, 0x40, 0xA0, 0x94, 0x25, 0x09, 0x45, 0xA0, 0x94, 0x7B, 0x09, 0x4A, 0x30, 0x95, 0x2A, 0x09, 0x60, 0xA0, 0x97, 0x30,  // ARETT ARHAT ARIAS ARIEL ARILS ARIOT ARISH ARLES ARNAS AROHA
+    0x09, 0x80, 0xA0, 0x98, 0x26, 0x09, 0x90, 0x30, 0x99, 0x0A, 0x09, 0x92, 0xB0, 0x99, 0x4A, 0x09, 0xA2, 0xA0, 0x9A, 0x4A, 0x09, 0xB0, 0x50, 0x9B, 0x25,  // ARPAS ARPEN ARRAH ARRAS ARRET ARRIS ARSES ARSIS ARTAL ARTEL
+    0x09, 0xB4, 0x10, 0x9B, 0x4A, 0x0A, 0x06, 0x00, 0xA1, 0x76, 0x0A, 0x32, 0xA0, 0xA3, 0x2B, 0x0A, 0x82, 0x60, 0xA8, 0x29, 0x0A, 0x84, 0x10, 0xA8, 0x42,  // ARTIC ARTIS ASANA ASCON ASHES ASHET ASPEN ASPER ASPIC ASPIE
+    0x0A, 0x84, 0xA0, 0xA8, 0x97, 0x0A, 0xA0, 0x40, 0xAA, 0x2A, 0x0A, 0xA7, 0xB0, 0xAB, 0x29, 0x0A, 0xB4, 0x90, 0xB0, 0x8A, 0x0B, 0x45, 0xB0, 0xB5, 0x0A,  // ASPIS ASPRO ASSAI ASSES ASSOT ASTER ASTIR ATAPS ATILT ATLAS
+    0x0B, 0x71, 0xA0, 0xB9, 0x40, 0x0B, 0x94, 0x80, 0xBB, 0x08, 0x0B, 0xB0, 0x91, 0x01, 0x0A, 0x10, 0x21, 0x01, 0x02, 0xA2, 0x10, 0x46, 0xA1, 0x05, 0x50,  // ATOCS ATRIA ATRIP ATTAP ATTAR CACAS CAECA CAESE CAINS CALLA
+    0x10, 0x55, 0xA1, 0x05, 0x7A, 0x10, 0x58, 0x01, 0x05, 0x8A, 0x10, 0x62, 0x31, 0x06, 0x29, 0x10, 0x62, 0xA1, 0x06, 0x60, 0x10, 0x66, 0xA1, 0x06, 0xA7,  // CALLS CALOS CALPA CALPS CANEH CANER CANES CANNA CANNS CANSO
+    0x10, 0x6A, 0xB1, 0x06, 0xB7, 0x10, 0x6B, 0xA1, 0x08, 0x0A, 0x10, 0x82, 0xA1, 0x08, 0x3A, 0x10, 0x85, 0x21, 0x08, 0x76, 0x10, 0x87, 0xA1, 0x08, 0x7B,  // CANST CANTO CANTS CAPAS CAPES CAPHS CAPLE CAPON CAPOS CAPOT
+    0x10, 0x89, 0x41, 0x09, 0x08, 0x10, 0x92, 0x91, 0x09, 0x2A, 0x10, 0x92, 0xB1, 0x09, 0x52, 0x10, 0x95, 0xA1, 0x09, 0x6A, 0x10, 0x97, 0x61, 0x09, 0x84,  // CAPRI CARAP CARER CARES CARET CARLE CARLS CARNS CARON CARPI
+    0x10, 0x98, 0xA1, 0x09, 0x9A, 0x10, 0x9A, 0x21, 0x09, 0xB0, 0x10, 0x9B, 0x21, 0x09, 0xBA, 0x10, 0xA0, 0xA1, 0x0A, 0x17, 0x10, 0xA2, 0xA1, 0x0A, 0xBA,  // CARPS CARRS CARSE CARTA CARTE CARTS CASAS CASCO CASES CASTS
+    0x10, 0xB2, 0xA1, 0x21, 0x05, 0x12, 0x45, 0x41, 0x24, 0x5A, 0x12, 0x55, 0x01, 0x25, 0x54, 0x12, 0x55, 0xA1, 0x25, 0xBA, 0x12, 0x6A, 0x21, 0x26, 0xB7,  // CATES CECAL CEILI CEILS CELLA CELLI CELLS CELTS CENSE CENTO
+    0x12, 0x6B, 0xA1, 0x27, 0x95, 0x12, 0x82, 0xA1, 0x29, 0x14, 0x12, 0x92, 0xA1, 0x29, 0x40, 0x12, 0x94, 0x11, 0x29, 0x62, 0x12, 0x97, 0x11, 0x29, 0x7A,  // CENTS CEORL CEPES CERCI CERES CERIA CERIC CERNE CEROC CEROS
+    0x12, 0x9B, 0xA1, 0x2A, 0xA2, 0x12, 0xAB, 0x01, 0x2A, 0xB4, 0x12, 0xB2, 0xA1, 0x30, 0x12, 0x13, 0x01, 0x71, 0x30, 0x4A, 0x13, 0x05, 0xA1, 0x30, 0x60,  // CERTS CESSE CESTA CESTI CETES CHACE CHACO CHAIS CHALS CHANA
+    0x13, 0x08, 0x21, 0x30, 0x8A, 0x13, 0x08, 0xB1, 0x30, 0x90, 0x13, 0x09, 0x21, 0x30, 0x99, 0x13, 0x09, 0xA1, 0x30, 0xBA, 0x13, 0x22, 0x81, 0x32, 0x50,  // CHAPE CHAPS CHAPT CHARA CHARE CHARR CHARS CHATS CHEEP CHELA
+    0x13, 0x25, 0x81, 0x32, 0x92, 0x13, 0x29, 0xB1, 0x32, 0xB3, 0x13, 0x40, 0x71, 0x34, 0x0A, 0x13, 0x41, 0x01, 0x34, 0x13, 0x13, 0x41, 0x71, 0x34, 0x1A,  // CHELP CHERE CHERT CHETH CHIAO CHIAS CHICA CHICH CHICO CHICS
+    0x13, 0x42, 0x51, 0x34, 0x52, 0x13, 0x46, 0x21, 0x34, 0x67, 0x13, 0x46, 0xA1, 0x34, 0x8A, 0x13, 0x49, 0x51, 0x34, 0x97, 0x13, 0x49, 0x91, 0x34, 0x9B,  // CHIEL CHILE CHINE CHINO CHINS CHIPS CHIRL CHIRO CHIRR CHIRT
+    0x13, 0x4B, 0xA1, 0x37, 0x17, 0x13, 0x71, 0xA1, 0x37, 0x45, 0x13, 0x75, 0x01, 0x37, 0x54, 0x13, 0x75, 0x71, 0x37, 0x6A, 0x13, 0x77, 0x61, 0x37, 0x8A,  // CHITS CHOCO CHOCS CHOIL CHOLA CHOLI CHOLO CHONS CHOON CHOPS
+    0x13, 0x7B, 0x01, 0x37, 0xBB, 0x14, 0x25, 0xA1, 0x45, 0x40, 0x14, 0x55, 0xA1, 0x46, 0x1B, 0x14, 0x62, 0xA1, 0x47, 0x6A, 0x14, 0x88, 0x41, 0x49, 0x1A,  // CHOTA CHOTT CIELS CILIA CILLS CINCT CINES CIONS CIPPI CIRCS
+    0x14, 0x92, 0xA1, 0x49, 0x5A, 0x14, 0x99, 0x41, 0x4A, 0x17, 0x14, 0xAB, 0xA1, 0x4B, 0x05, 0x14, 0xB2, 0x91, 0x4B, 0x2A, 0x15, 0x01, 0x31, 0x50, 0x2A,  // CIRES CIRLS CIRRI CISCO CISTS CITAL CITER CITES CLACH CLAES
+    0x15, 0x06, 0xA1, 0x50, 0x8A, 0x15, 0x08, 0xB1, 0x50, 0x97, 0x15, 0x09, 0xB1, 0x50, 0xAB, 0x15, 0x0B, 0xA1, 0x52, 0x28, 0x15, 0x28, 0x21, 0x52, 0x8B,  // CLANS CLAPS CLAPT CLARO CLART CLAST CLATS CLEEP CLEPE CLEPT
+    0x15, 0x42, 0xA1, 0x54, 0x62, 0x15, 0x46, 0xB1, 0x54, 0x82, 0x15, 0x48, 0xA1, 0x54, 0x8B, 0x15, 0x4B, 0xA1, 0x57, 0x6A, 0x15, 0x77, 0x81, 0x57, 0x7B,  // CLIES CLINE CLINT CLIPE CLIPS CLIPT CLITS CLONS CLOOP CLOOT
+    0x15, 0x78, 0xA1, 0x57, 0xB2, 0x15, 0x7B, 0xA1, 0x70, 0x1B, 0x17, 0x05, 0x01, 0x70, 0x5A, 0x17, 0x08, 0xB1, 0x70, 0xB2, 0x17, 0x0B, 0x41, 0x70, 0xBA,  // CLOPS CLOTE CLOTS COACT COALA COALS COAPT COATE COATI COATS
+    0x17, 0x10, 0xA1, 0x71, 0x14, 0x17, 0x11, 0x71, 0x71, 0x7A, 0x17, 0x32, 0x61, 0x73, 0x72, 0x17, 0x37, 0xA1, 0x74, 0x5A, 0x17, 0x46, 0xA1, 0x74, 0x9A,  // COCAS COCCI COCCO COCOS COHEN COHOE COHOS COILS COINS COIRS
+    0x17, 0x4B, 0xA1, 0x75, 0x0A, 0x17, 0x52, 0xA1, 0x75, 0x41, 0x17, 0x54, 0x61, 0x75, 0x5A, 0x17, 0x5B, 0xA1, 0x76, 0x2A, 0x17, 0x64, 0x01, 0x76, 0x46,  // COITS COLAS COLES COLIC COLIN COLLS COLTS CONES CONIA CONIN
+    0x17, 0x66, 0x21, 0x76, 0x6A, 0x17, 0x6B, 0x21, 0x76, 0xB7, 0x17, 0x71, 0x31, 0x77, 0x22, 0x17, 0x72, 0x91, 0x77, 0x5A, 0x17, 0x76, 0xA1, 0x77, 0x8A,  // CONNE CONNS CONTE CONTO COOCH COOEE COOER COOLS COONS COOPS
+    0x17, 0x78, 0xB1, 0x77, 0xAB, 0x17, 0x7B, 0xA1, 0x78, 0x05, 0x17, 0x82, 0x61, 0x78, 0x29, 0x17, 0x82, 0xA1, 0x78, 0x90, 0x17, 0x92, 0xA1, 0x79, 0x40,  // COOPT COOST COOTS COPAL COPEN COPER COPES COPRA CORES CORIA
+    0x17, 0x96, 0x41, 0x79, 0x67, 0x17, 0x96, 0xA1, 0x79, 0x8A, 0x17, 0x9A, 0x21, 0x79, 0xA7, 0x17, 0xA2, 0x11, 0x7A, 0x2A, 0x17, 0xA2, 0xB1, 0x7A, 0x42,  // CORNI CORNO CORNS CORPS CORSE CORSO COSEC COSES COSET COSIE
+    0x17, 0xAB, 0x01, 0x7A, 0xB2, 0x17, 0xAB, 0xA1, 0x7B, 0x06, 0x17, 0xB2, 0xA1, 0x7B, 0x3A, 0x17, 0xBB, 0x01, 0x7B, 0xBA, 0x19, 0x00, 0x51, 0x90, 0x41,  // COSTA COSTE COSTS COTAN COTES COTHS COTTA COTTS CRAAL CRAIC
+    0x19, 0x06, 0xA1, 0x90, 0x82, 0x19, 0x08, 0xA1, 0x90, 0x92, 0x19, 0x22, 0x51, 0x92, 0x2A, 0x19, 0x26, 0x01, 0x92, 0x8A, 0x19, 0x40, 0xA1, 0x94, 0x2A,  // CRANS CRAPE CRAPS CRARE CREEL CREES CRENA CREPS CRIAS CRIES
+    0x19, 0x46, 0x21, 0x94, 0x7A, 0x19, 0x48, 0x21, 0x94, 0x8A, 0x19, 0x4A, 0x21, 0x94, 0xB3, 0x19, 0x4B, 0xA1, 0x97, 0x14, 0x19, 0x71, 0xA1, 0x97, 0x6A,  // CRINE CRIOS CRIPE CRIPS CRISE CRITH CRITS CROCI CROCS CRONS
+    0x19, 0x77, 0x51, 0x97, 0x76, 0x19, 0x78, 0xA1, 0x97, 0x92, 0x19, 0x7A, 0xB1, 0xB2, 0x62, 0x20, 0x52, 0xA2, 0x09, 0x5A, 0x20, 0x96, 0xA2, 0x09, 0x6B,  // CROOL CROON CROPS CRORE CROST CTENE EALES EARLS EARNS EARNT
+    0x20, 0x9A, 0xB2, 0x0A, 0x29, 0x20, 0xA2, 0xA2, 0x0A, 0x52, 0x20, 0xAB, 0xA2, 0x0B, 0x32, 0x21, 0x32, 0xA2, 0x13, 0x7A, 0x24, 0xA2, 0x52, 0x50, 0x46,  // EARST EASER EASES EASLE EASTS EATHE ECHES ECHOS EISEL ELAIN
+    0x25, 0x06, 0xA2, 0x51, 0x34, 0x25, 0x46, 0xB2, 0x57, 0x46, 0x25, 0x78, 0xA2, 0x58, 0x22, 0x25, 0xA4, 0x62, 0x60, 0xB2, 0x26, 0x40, 0x12, 0x65, 0x4B,  // ELANS ELCHI ELINT ELOIN ELOPS ELPEE ELSIN ENATE ENIAC ENLIT
+    0x26, 0x75, 0xA2, 0x69, 0x75, 0x26, 0xB4, 0x02, 0x79, 0x5A, 0x27, 0xA4, 0x62, 0x80, 0x1B, 0x28, 0x22, 0xA2, 0x83, 0x03, 0x28, 0x30, 0xA2, 0x83, 0x79,  // ENOLS ENROL ENTIA EORLS EOSIN EPACT EPEES EPHAH EPHAS EPHOR
+    0x28, 0x41, 0xA2, 0x87, 0x8B, 0x28, 0x94, 0xA2, 0x94, 0x10, 0x29, 0x41, 0xA2, 0x96, 0x2A, 0x29, 0x7A, 0x22, 0x9A, 0x2A, 0x2A, 0x10, 0x92, 0xA1, 0x7B,  // EPICS EPOPT EPRIS ERICA ERICS ERNES EROSE ERSES ESCAR ESCOT
+    0x2A, 0x45, 0x22, 0xA6, 0x2A, 0x2A, 0xA2, 0xA2, 0xAB, 0x71, 0x2A, 0xB7, 0x82, 0xAB, 0x97, 0x2B, 0x08, 0x22, 0xB0, 0xBA, 0x2B, 0x26, 0xA2, 0xB3, 0x05,  // ESILE ESNES ESSES ESTOC ESTOP ESTRO ETAPE ETATS ETENS ETHAL
+    0x2B, 0x36, 0x22, 0xB4, 0x1A, 0x2B, 0x60, 0xA2, 0xBB, 0x46, 0x2B, 0xB5, 0x23, 0x00, 0x9A, 0x30, 0x2B, 0xA3, 0x03, 0x0A, 0x30, 0x45, 0xA3, 0x04, 0x6A,  // ETHNE ETICS ETNAS ETTIN ETTLE HAARS HAETS HAHAS HAILS HAINS
+    0x30, 0x46, 0xB3, 0x04, 0x9A, 0x30, 0x4B, 0x33, 0x05, 0x05, 0x30, 0x52, 0x93, 0x05, 0x2A, 0x30, 0x55, 0x73, 0x05, 0x5A, 0x30, 0x57, 0x63, 0x05, 0x7A,  // HAINT HAIRS HAITH HALAL HALER HALES HALLO HALLS HALON HALOS
+    0x30, 0x5A, 0x23, 0x05, 0xBA, 0x30, 0x60, 0x83, 0x06, 0x12, 0x30, 0x61, 0x33, 0x06, 0xA0, 0x30, 0x6A, 0x23, 0x06, 0xBA, 0x30, 0x75, 0x23, 0x08, 0x84,  // HALSE HALTS HANAP HANCE HANCH HANSA HANSE HANTS HAOLE HAPPI
+    0x30, 0x92, 0xA3, 0x09, 0x5A, 0x30, 0x96, 0xA3, 0x09, 0x7A, 0x30, 0x98, 0xA3, 0x09, 0xBA, 0x30, 0xA8, 0xA3, 0x0A, 0xB0, 0x30, 0xB2, 0xA3, 0x0B, 0x30,  // HARES HARLS HARNS HAROS HARPS HARTS HASPS HASTA HATES HATHA
+    0x32, 0x05, 0xA3, 0x20, 0x8A, 0x32, 0x09, 0x23, 0x20, 0x9A, 0x32, 0x0A, 0xB3, 0x20, 0xBA, 0x32, 0x13, 0xB3, 0x22, 0x5A, 0x32, 0x45, 0xA3, 0x24, 0x9A,  // HEALS HEAPS HEARE HEARS HEAST HEATS HECHT HEELS HEILS HEIRS
+    0x32, 0x52, 0xA3, 0x25, 0x47, 0x32, 0x55, 0xA3, 0x25, 0x7A, 0x32, 0x57, 0xB3, 0x25, 0x8A, 0x32, 0x61, 0x33, 0x26, 0x60, 0x32, 0x6B, 0xA3, 0x28, 0x09,  // HELES HELIO HELLS HELOS HELOT HELPS HENCH HENNA HENTS HEPAR
+    0x32, 0x92, 0xA3, 0x29, 0x5A, 0x32, 0x96, 0xA3, 0x29, 0x7A, 0x32, 0x9A, 0x23, 0x2A, 0x8A, 0x32, 0xAB, 0xA3, 0x2B, 0x2A, 0x32, 0xB3, 0xA3, 0x40, 0x6B,  // HERES HERLS HERNS HEROS HERSE HESPS HESTS HETES HETHS HIANT
+    0x34, 0x50, 0x93, 0x45, 0x13, 0x34, 0x55, 0x73, 0x45, 0x5A, 0x34, 0x5B, 0xA3, 0x46, 0xBA, 0x34, 0x74, 0xA3, 0x49, 0x22, 0x34, 0x92, 0x93, 0x49, 0x2A,  // HILAR HILCH HILLO HILLS HILTS HINTS HIOIS HIREE HIRER HIRES
+    0x34, 0xAB, 0xA3, 0x4B, 0x32, 0x37, 0x09, 0xA3, 0x70, 0xAB, 0x37, 0x29, 0xA3, 0x74, 0xA2, 0x37, 0x52, 0xA3, 0x75, 0x50, 0x37, 0x55, 0x73, 0x75, 0x76,  // HISTS HITHE HOARS HOAST HOERS HOISE HOLES HOLLA HOLLO HOLON
+    0x37, 0x57, 0xA3, 0x75, 0xBA, 0x37, 0x60, 0x63, 0x76, 0x29, 0x37, 0x62, 0xA3, 0x77, 0x13, 0x37, 0x76, 0xA3, 0x77, 0x8A, 0x37, 0x79, 0xA3, 0x77, 0xA3,  // HOLOS HOLTS HONAN HONER HONES HOOCH HOONS HOOPS HOORS HOOSH
+    0x37, 0x7B, 0xA3, 0x78, 0x29, 0x37, 0x82, 0xA3, 0x79, 0x03, 0x37, 0x90, 0x53, 0x79, 0x0A, 0x37, 0x94, 0xA3, 0x79, 0x6A, 0x37, 0x9A, 0xB3, 0x7A, 0x25,  // HOOTS HOPER HOPES HORAH HORAL HORAS HORIS HORNS HORST HOSEL
+    0x37, 0xA2, 0x63, 0x7A, 0x29, 0x37, 0xA2, 0xA3, 0x7A, 0xB0, 0x37, 0xAB, 0xA3, 0x7B, 0x13, 0x37, 0xB2, 0x64, 0x12, 0x9A, 0x41, 0x32, 0xA4, 0x13, 0x79,  // HOSEN HOSER HOSES HOSTA HOSTS HOTCH HOTEN ICERS ICHES ICHOR
+    0x41, 0x42, 0x94, 0x17, 0x6A, 0x41, 0xB0, 0x54, 0x1B, 0x41, 0x45, 0x20, 0x14, 0x52, 0x05, 0x45, 0x40, 0x54, 0x55, 0x29, 0x45, 0x5B, 0x34, 0x60, 0x8B,  // ICIER ICONS ICTAL ICTIC ILEAC ILEAL ILIAL ILLER ILLTH INAPT
+    0x46, 0x12, 0x54, 0x61, 0x52, 0x46, 0x47, 0x64, 0x66, 0x4B, 0x46, 0xA2, 0xB4, 0x6A, 0x87, 0x46, 0xB2, 0x54, 0x6B, 0x45, 0x46, 0xB4, 0xA4, 0x6B, 0x90,  // INCEL INCLE INION INNIT INSET INSPO INTEL INTIL INTIS INTRA
+    0x47, 0xB0, 0xA4, 0x88, 0x76, 0x49, 0x76, 0x24, 0x97, 0x6A, 0x4A, 0x32, 0xA4, 0xA5, 0x2A, 0x4A, 0x60, 0x24, 0xAA, 0x24, 0x4A, 0xB5, 0x24, 0xB3, 0x29,  // IOTAS IPPON IRONE IRONS ISHES ISLES ISNAE ISSEI ISTLE ITHER
+    0x50, 0x09, 0x45, 0x01, 0x29, 0x50, 0x12, 0xA5, 0x01, 0x2B, 0x50, 0x29, 0xA5, 0x03, 0x05, 0x50, 0x30, 0x95, 0x04, 0x13, 0x50, 0x41, 0xA5, 0x04, 0x9A,  // LAARI LACER LACES LACET LAERS LAHAL LAHAR LAICH LAICS LAIRS
+    0x50, 0x4B, 0x35, 0x05, 0x5A, 0x50, 0x60, 0x45, 0x06, 0x0A, 0x50, 0x61, 0x35, 0x06, 0x2A, 0x50, 0x6B, 0xA5, 0x08, 0x46, 0x50, 0x84, 0xA5, 0x09, 0x13,  // LAITH LALLS LANAI LANAS LANCH LANES LANTS LAPIN LAPIS LARCH
+    0x50, 0x92, 0x25, 0x09, 0x2A, 0x50, 0x94, 0xA5, 0x09, 0x6A, 0x50, 0x96, 0xB5, 0x0A, 0x29, 0x50, 0xA2, 0xA5, 0x0A, 0xA4, 0x50, 0xAB, 0xA5, 0x0B, 0x03,  // LAREE LARES LARIS LARNS LARNT LASER LASES LASSI LASTS LATAH
+    0x50, 0xB2, 0x65, 0x0B, 0x34, 0x50, 0xB3, 0xA5, 0x20, 0x6A, 0x52, 0x08, 0xA5, 0x20, 0x92, 0x52, 0x09, 0xA5, 0x20, 0xBA, 0x52, 0x20, 0x95, 0x22, 0x8A,  // LATEN LATHI LATHS LEANS LEAPS LEARE LEARS LEATS LEEAR LEEPS
+    0x52, 0x29, 0xA5, 0x22, 0xA2, 0x52, 0x2B, 0xA5, 0x23, 0x9A, 0x52, 0x49, 0xA5, 0x24, 0xA3, 0x52, 0x62, 0xA5, 0x26, 0x4A, 0x52, 0x67, 0xA5, 0x26, 0xA2,  // LEERS LEESE LEETS LEHRS LEIRS LEISH LENES LENIS LENOS LENSE
+    0x52, 0x6B, 0x45, 0x26, 0xB7, 0x52, 0x76, 0x25, 0x28, 0x90, 0x52, 0x8B, 0x05, 0x29, 0x2A, 0x52, 0x98, 0xA5, 0x2A, 0x2A, 0x52, 0xAB, 0xA5, 0x2B, 0x13,  // LENTI LENTO LEONE LEPRA LEPTA LERES LERPS LESES LESTS LETCH
+    0x52, 0xB3, 0x25, 0x40, 0x60, 0x54, 0x06, 0x25, 0x40, 0x9A, 0x54, 0x09, 0xB5, 0x41, 0x34, 0x54, 0x13, 0xB5, 0x41, 0x4B, 0x54, 0x26, 0xA5, 0x42, 0x9A,  // LETHE LIANA LIANE LIARS LIART LICHI LICHT LICIT LIENS LIERS
+    0x54, 0x55, 0xA5, 0x45, 0x7A, 0x54, 0x5B, 0xA5, 0x46, 0x01, 0x54, 0x61, 0x35, 0x46, 0x2A, 0x54, 0x64, 0x65, 0x46, 0x6A, 0x54, 0x67, 0xA5, 0x46, 0xBA,  // LILLS LILOS LILTS LINAC LINCH LINES LININ LINNS LINOS LINTS
+    0x54, 0x76, 0xA5, 0x48, 0x0A, 0x54, 0x82, 0xA5, 0x48, 0x46, 0x54, 0x87, 0xA5, 0x49, 0x0A, 0x54, 0x97, 0xB5, 0x4A, 0x52, 0x54, 0xA8, 0xA5, 0x4A, 0xBA,  // LIONS LIPAS LIPES LIPIN LIPOS LIRAS LIROT LISLE LISPS LISTS
+    0x54, 0xB0, 0x45, 0x4B, 0x0A, 0x54, 0xB2, 0xA5, 0x4B, 0x37, 0x54, 0xB3, 0xA5, 0x4B, 0x92, 0x55, 0x06, 0x75, 0x70, 0x13, 0x57, 0x06, 0xA5, 0x70, 0xAB,  // LITAI LITAS LITES LITHO LITHS LITRE LLANO LOACH LOANS LOAST
+    0x57, 0x13, 0x25, 0x71, 0x3A, 0x57, 0x14, 0x25, 0x71, 0x4A, 0x57, 0x17, 0xA5, 0x72, 0xAA, 0x57, 0x30, 0x65, 0x74, 0x6A, 0x57, 0x48, 0x25, 0x74, 0x9A,  // LOCHE LOCHS LOCIE LOCIS LOCOS LOESS LOHAN LOINS LOIPE LOIRS
+    0x57, 0x55, 0xA5, 0x76, 0x29, 0x57, 0x74, 0x25, 0x77, 0x6A, 0x57, 0x78, 0xA5, 0x77, 0xBA, 0x57, 0x82, 0x95, 0x78, 0x2A, 0x57, 0x90, 0x55, 0x79, 0x06,  // LOLLS LONER LOOIE LOONS LOOPS LOOTS LOPER LOPES LORAL LORAN
+    0x57, 0x92, 0x55, 0x79, 0x2A, 0x57, 0x94, 0x15, 0x79, 0x4A, 0x57, 0xA2, 0x55, 0x7A, 0x26, 0x57, 0xA2, 0xA5, 0x7B, 0x03, 0x57, 0xB0, 0xA5, 0x7B, 0x2A,  // LOREL LORES LORIC LORIS LOSEL LOSEN LOSES LOTAH LOTAS LOTES
+    0x57, 0xB4, 0x15, 0x7B, 0x7A, 0x57, 0xBA, 0x05, 0x7B, 0xB0, 0x57, 0xBB, 0x25, 0x7B, 0xB7, 0x60, 0x06, 0xA6, 0x01, 0x32, 0x60, 0x13, 0x76, 0x01, 0x92,  // LOTIC LOTOS LOTSA LOTTA LOTTE LOTTO NAANS NACHE NACHO NACRE
+    0x60, 0x30, 0x56, 0x04, 0x5A, 0x60, 0x49, 0x06, 0x05, 0x0A, 0x60, 0x55, 0x06, 0x06, 0x0A, 0x60, 0x61, 0x26, 0x06, 0x60, 0x60, 0x67, 0xA6, 0x08, 0x0A,  // NAHAL NAILS NAIRA NALAS NALLA NANAS NANCE NANNA NANOS NAPAS
+    0x60, 0x82, 0xA6, 0x08, 0x77, 0x60, 0x88, 0x06, 0x08, 0x82, 0x60, 0x90, 0xA6, 0x09, 0x17, 0x60, 0x91, 0xA6, 0x09, 0x2A, 0x60, 0x94, 0x16, 0x09, 0x4A,  // NAPES NAPOO NAPPA NAPPE NARAS NARCO NARCS NARES NARIC NARIS
+    0x60, 0x99, 0x26, 0x0A, 0x34, 0x60, 0xB1, 0x36, 0x0B, 0x2A, 0x60, 0xB4, 0xA6, 0x20, 0x5A, 0x62, 0x08, 0xA6, 0x20, 0x9A, 0x62, 0x0B, 0x36, 0x20, 0xBA,  // NARRE NASHI NATCH NATES NATIS NEALS NEAPS NEARS NEATH NEATS
+    0x62, 0x25, 0x26, 0x22, 0x8A, 0x62, 0x2A, 0x26, 0x24, 0xAB, 0x62, 0x54, 0xA6, 0x26, 0x2A, 0x62, 0x76, 0xA6, 0x28, 0x29, 0x62, 0x84, 0xB6, 0x29, 0x05,  // NEELE NEEPS NEESE NEIST NELIS NENES NEONS NEPER NEPIT NERAL
+    0x62, 0x97, 0x56, 0x29, 0xBA, 0x62, 0xAB, 0xA6, 0x2B, 0x2A, 0x62, 0xB7, 0x86, 0x2B, 0xBA, 0x64, 0x13, 0xB6, 0x41, 0x75, 0x64, 0x34, 0x56, 0x45, 0x5A,  // NEROL NERTS NESTS NETES NETOP NETTS NICHT NICOL NIHIL NILLS
+    0x64, 0x62, 0x96, 0x46, 0x2A, 0x64, 0x67, 0x66, 0x48, 0x0A, 0x64, 0x95, 0xA6, 0x4A, 0x24, 0x64, 0xAA, 0x26, 0x4B, 0x29, 0x64, 0xB2, 0xA6, 0x4B, 0x76,  // NINER NINES NINON NIPAS NIRLS NISEI NISSE NITER NITES NITON
+    0x64, 0xB9, 0x26, 0x4B, 0x97, 0x67, 0x03, 0xA6, 0x72, 0x5A, 0x67, 0x45, 0xA6, 0x74, 0x6B, 0x67, 0x49, 0xA6, 0x75, 0x2A, 0x67, 0x55, 0xA6, 0x75, 0x7A,  // NITRE NITRO NOAHS NOELS NOILS NOINT NOIRS NOLES NOLLS NOLOS
+    0x67, 0x60, 0xA6, 0x76, 0x12, 0x67, 0x62, 0xA6, 0x76, 0x2B, 0x67, 0x64, 0xA6, 0x77, 0x4B, 0x67, 0x76, 0xA6, 0x77, 0x8A, 0x67, 0x80, 0x56, 0x79, 0x40,  // NONAS NONCE NONES NONET NONIS NOOIT NOONS NOOPS NOPAL NORIA
+    0x67, 0x94, 0xA6, 0x7A, 0x29, 0x67, 0xA2, 0xA6, 0x7B, 0x05, 0x67, 0xB2, 0x96, 0x7B, 0x2A, 0x70, 0xA2, 0xA7, 0x0A, 0x4A, 0x70, 0xAB, 0xA7, 0x0B, 0x26,  // NORIS NOSER NOSES NOTAL NOTER NOTES OASES OASIS OASTS OATEN
+    0x70, 0xB2, 0x97, 0x0B, 0x3A, 0x71, 0x32, 0x97, 0x13, 0x2A, 0x71, 0x39, 0x27, 0x19, 0x20, 0x71, 0xB0, 0x67, 0x1B, 0x0A, 0x73, 0x40, 0xA7, 0x37, 0x62,  // OATER OATHS OCHER OCHES OCHRE OCREA OCTAN OCTAS OHIAS OHONE
+    0x74, 0x52, 0x97, 0x46, 0xBA, 0x75, 0x24, 0x17, 0x52, 0x46, 0x75, 0x26, 0xB7, 0x52, 0x7A, 0x75, 0x47, 0xA7, 0x55, 0x0A, 0x75, 0x52, 0x97, 0x55, 0x42,  // OILER OINTS OLEIC OLEIN OLENT OLEOS OLIOS OLLAS OLLER OLLIE
+    0x75, 0x80, 0x27, 0x58, 0x2A, 0x76, 0x12, 0x97, 0x61, 0x2A, 0x76, 0x12, 0xB7, 0x62, 0x9A, 0x76, 0xB4, 0x17, 0x76, 0xBA, 0x77, 0x94, 0x27, 0x7A, 0x2A,  // OLPAE OLPES ONCER ONCES ONCET ONERS ONTIC OONTS OORIE OOSES
+    0x78, 0x03, 0xA7, 0x80, 0x5A, 0x78, 0x26, 0xA7, 0x82, 0x82, 0x78, 0x87, 0xA7, 0x8A, 0x46, 0x78, 0xB2, 0x97, 0x90, 0x13, 0x79, 0x05, 0xA7, 0x90, 0x6B,  // OPAHS OPALS OPENS OPEPE OPPOS OPSIN OPTER ORACH ORALS ORANT
+    0x79, 0x0B, 0x27, 0x91, 0x0A, 0x79, 0x14, 0x67, 0x94, 0x25, 0x79, 0x52, 0xA7, 0x95, 0x76, 0x79, 0x57, 0x87, 0x96, 0x4A, 0x79, 0x84, 0x67, 0x99, 0x4A,  // ORATE ORCAS ORCIN ORIEL ORLES ORLON ORLOP ORNIS ORPIN ORRIS
+    0x79, 0xB3, 0x77, 0xA1, 0x09, 0x7A, 0x30, 0x17, 0xA4, 0x29, 0x7A, 0xA4, 0x07, 0xAB, 0x40, 0x7B, 0xB0, 0x97, 0xBB, 0x7A, 0x80, 0x05, 0xA8, 0x00, 0x6A,  // ORTHO OSCAR OSHAC OSIER OSSIA OSTIA OTTAR OTTOS PAALS PAANS
+    0x80, 0x10, 0xA8, 0x01, 0x29, 0x80, 0x12, 0xA8, 0x01, 0x30, 0x80, 0x17, 0xA8, 0x01, 0xB0, 0x80, 0x1B, 0xA8, 0x02, 0x06, 0x80, 0x27, 0x68, 0x04, 0x5A,  // PACAS PACER PACES PACHA PACOS PACTA PACTS PAEAN PAEON PAILS
+    0x80, 0x46, 0xA8, 0x04, 0x92, 0x80, 0x49, 0xA8, 0x04, 0xA0, 0x80, 0x4A, 0x28, 0x05, 0x0A, 0x80, 0x52, 0x08, 0x05, 0x2A, 0x80, 0x52, 0xB8, 0x05, 0x4A,  // PAINS PAIRE PAIRS PAISA PAISE PALAS PALEA PALES PALET PALIS
+    0x80, 0x55, 0x08, 0x05, 0x5A, 0x80, 0x58, 0x48, 0x05, 0x8A, 0x80, 0x5A, 0x08, 0x06, 0x12, 0x80, 0x62, 0xA8, 0x06, 0x62, 0x80, 0x66, 0x48, 0x06, 0xB7,  // PALLA PALLS PALPI PALPS PALSA PANCE PANES PANNE PANNI PANTO
+    0x80, 0x6B, 0xA8, 0x07, 0x54, 0x80, 0x75, 0x78, 0x08, 0x0A, 0x80, 0x82, 0xA8, 0x08, 0x84, 0x80, 0x90, 0x28, 0x09, 0x0A, 0x80, 0x91, 0x38, 0x09, 0x26,  // PANTS PAOLI PAOLO PAPAS PAPES PAPPI PARAE PARAS PARCH PAREN
+    0x80, 0x92, 0x78, 0x09, 0x2A, 0x80, 0x94, 0xA8, 0x09, 0x52, 0x80, 0x97, 0x58, 0x09, 0x8A, 0x80, 0x99, 0x08, 0x09, 0x9A, 0x80, 0x9B, 0x48, 0x09, 0xBA,  // PAREO PARES PARIS PARLE PAROL PARPS PARRA PARRS PARTI PARTS
+    0x80, 0xA2, 0x78, 0x0A, 0x2A, 0x80, 0xA3, 0x08, 0x0A, 0xA2, 0x80, 0xAB, 0xA8, 0x0B, 0x26, 0x80, 0xB2, 0x98, 0x0B, 0x2A, 0x80, 0xB3, 0xA8, 0x0B, 0x46,  // PASEO PASES PASHA PASSE PASTS PATEN PATER PATES PATHS PATIN
+    0x80, 0xBB, 0x28, 0x20, 0x5A, 0x82, 0x06, 0xA8, 0x20, 0x92, 0x82, 0x09, 0xA8, 0x20, 0x9B, 0x82, 0x0A, 0x28, 0x20, 0xBA, 0x82, 0x13, 0xA8, 0x22, 0x12,  // PATTE PEALS PEANS PEARE PEARS PEART PEASE PEATS PECHS PEECE
+    0x82, 0x25, 0xA8, 0x22, 0x6A, 0x82, 0x28, 0x28, 0x22, 0x8A, 0x82, 0x29, 0xA8, 0x24, 0x6A, 0x82, 0x4A, 0x28, 0x25, 0x0A, 0x82, 0x52, 0xA8, 0x25, 0x5A,  // PEELS PEENS PEEPE PEEPS PEERS PEINS PEISE PELAS PELES PELLS
+    0x82, 0x57, 0x68, 0x25, 0xB0, 0x82, 0x5B, 0xA8, 0x26, 0x2A, 0x82, 0x64, 0x28, 0x26, 0x4A, 0x82, 0x66, 0x08, 0x26, 0x64, 0x82, 0x6B, 0xA8, 0x27, 0x6A,  // PELON PELTA PELTS PENES PENIE PENIS PENNA PENNI PENTS PEONS
+    0x82, 0x85, 0x08, 0x28, 0x7A, 0x82, 0x8A, 0x48, 0x29, 0x04, 0x82, 0x91, 0x28, 0x29, 0x1A, 0x82, 0x92, 0x08, 0x29, 0x2A, 0x82, 0x94, 0xA8, 0x29, 0x6A,  // PEPLA PEPOS PEPSI PERAI PERCE PERCS PEREA PERES PERIS PERNS
+    0x82, 0x98, 0xA8, 0x29, 0xA2, 0x82, 0x9A, 0xB8, 0x29, 0xBA, 0x82, 0xA7, 0xA8, 0x2A, 0xBA, 0x82, 0xB0, 0x98, 0x2B, 0x29, 0x82, 0xB4, 0xB8, 0x2B, 0x92,  // PERPS PERSE PERST PERTS PESOS PESTS PETAR PETER PETIT PETRE
+    0x82, 0xB9, 0x48, 0x2B, 0xB4, 0x82, 0xBB, 0x78, 0x30, 0x92, 0x83, 0x22, 0x98, 0x32, 0x62, 0x83, 0x27, 0x68, 0x32, 0xA2, 0x83, 0x40, 0x58, 0x34, 0xA3,  // PETRI PETTI PETTO PHARE PHEER PHENE PHEON PHESE PHIAL PHISH
+    0x83, 0x71, 0x08, 0x37, 0x67, 0x83, 0x76, 0xA8, 0x37, 0xBA, 0x83, 0x83, 0xB8, 0x40, 0x64, 0x84, 0x06, 0xA8, 0x41, 0x05, 0x84, 0x10, 0xA8, 0x41, 0x7B,  // PHOCA PHONO PHONS PHOTS PHPHT PIANI PIANS PICAL PICAS PICOT
+    0x84, 0x19, 0x08, 0x42, 0x9A, 0x84, 0x29, 0xB8, 0x42, 0xB0, 0x84, 0x2B, 0xA8, 0x45, 0x02, 0x84, 0x50, 0x78, 0x45, 0x09, 0x84, 0x51, 0x38, 0x45, 0x20,  // PICRA PIERS PIERT PIETA PIETS PILAE PILAO PILAR PILCH PILEA
+    0x84, 0x52, 0x48, 0x45, 0x29, 0x84, 0x52, 0xA8, 0x45, 0x4A, 0x84, 0x55, 0xA8, 0x46, 0x0A, 0x84, 0x62, 0xA8, 0x46, 0x60, 0x84, 0x67, 0x68, 0x46, 0x7B,  // PILEI PILER PILES PILIS PILLS PINAS PINES PINNA PINON PINOT
+    0x84, 0x6B, 0x08, 0x46, 0xBA, 0x84, 0x76, 0xA8, 0x48, 0x05, 0x84, 0x80, 0xA8, 0x48, 0x2A, 0x84, 0x82, 0xB8, 0x48, 0x4A, 0x84, 0x84, 0xB8, 0x49, 0x04,  // PINTA PINTS PIONS PIPAL PIPAS PIPES PIPET PIPIS PIPIT PIRAI
+    0x84, 0x95, 0xA8, 0x49, 0x6A, 0x84, 0xA1, 0x78, 0x4A, 0x2A, 0x84, 0xA7, 0xA8, 0x4A, 0xB2, 0x84, 0xB0, 0xA8, 0x4B, 0x3A, 0x84, 0xB7, 0x68, 0x4B, 0x7B,  // PIRLS PIRNS PISCO PISES PISOS PISTE PITAS PITHS PITON PITOT
+    0x84, 0xBB, 0x08, 0x50, 0x0A, 0x85, 0x06, 0xA8, 0x50, 0x8A, 0x85, 0x0A, 0x38, 0x50, 0xAB, 0x85, 0x0B, 0xA8, 0x50, 0xBB, 0x85, 0x20, 0xA8, 0x52, 0x60,  // PITTA PLAAS PLANS PLAPS PLASH PLAST PLATS PLATT PLEAS PLENA
+    0x85, 0x27, 0x68, 0x52, 0xA3, 0x85, 0x41, 0x08, 0x54, 0x2A, 0x85, 0x70, 0xB8, 0x57, 0x8A, 0x85, 0x7B, 0xA8, 0x70, 0x13, 0x87, 0x28, 0xA8, 0x72, 0xBA,  // PLEON PLESH PLICA PLIES PLOAT PLOPS PLOTS POACH POEPS POETS
+    0x87, 0x52, 0x98, 0x75, 0x2A, 0x87, 0x54, 0x78, 0x75, 0x4A, 0x87, 0x55, 0xA8, 0x75, 0x7A, 0x87, 0x5B, 0xA8, 0x76, 0x12, 0x87, 0x62, 0xA8, 0x76, 0xBA,  // POLER POLES POLIO POLIS POLLS POLOS POLTS PONCE PONES PONTS
+    0x87, 0x73, 0xA8, 0x77, 0x5A, 0x87, 0x76, 0xA8, 0x77, 0x8A, 0x87, 0x79, 0x48, 0x77, 0x9B, 0x87, 0x7B, 0xA8, 0x78, 0x2A, 0x87, 0x88, 0x08, 0x79, 0x02,  // POOHS POOLS POONS POOPS POORI POORT POOTS POPES POPPA PORAE
+    0x87, 0x90, 0x58, 0x79, 0x29, 0x87, 0x92, 0xA8, 0x79, 0x46, 0x87, 0x96, 0x78, 0x79, 0x6A, 0x87, 0x9B, 0x08, 0x79, 0xBA, 0x87, 0xA2, 0xA8, 0x7A, 0x37,  // PORAL PORER PORES PORIN PORNO PORNS PORTA PORTS POSES POSHO
+    0x87, 0xAB, 0xA8, 0x7B, 0x02, 0x87, 0xB1, 0x38, 0x7B, 0x2A, 0x87, 0xB4, 0x68, 0x7B, 0x77, 0x87, 0xBB, 0x78, 0x7B, 0xBA, 0x89, 0x06, 0x08, 0x90, 0x7A,  // POSTS POTAE POTCH POTES POTIN POTOO POTTO POTTS PRANA PRAOS
+    0x89, 0x0A, 0x28, 0x90, 0xB2, 0x89, 0x0B, 0xA8, 0x90, 0xBB, 0x89, 0x22, 0xA8, 0x92, 0x6B, 0x89, 0x27, 0x68, 0x92, 0x78, 0x89, 0x28, 0xA8, 0x92, 0xA0,  // PRASE PRATE PRATS PRATT PREES PRENT PREON PREOP PREPS PRESA
+    0x89, 0x2A, 0x28, 0x92, 0xAB, 0x89, 0x40, 0x58, 0x94, 0x29, 0x89, 0x42, 0xA8, 0x94, 0x55, 0x89, 0x47, 0x68, 0x94, 0xA2, 0x89, 0x4A, 0xA8, 0x97, 0x0A,  // PRESE PREST PRIAL PRIER PRIES PRILL PRION PRISE PRISS PROAS
+    0x89, 0x74, 0x68, 0x97, 0x52, 0x89, 0x75, 0x58, 0x97, 0x8A, 0x89, 0x79, 0x28, 0x97, 0xA7, 0x89, 0x7A, 0xA8, 0x97, 0xAB, 0x89, 0x7B, 0x78, 0xA4, 0x76,  // PROIN PROLE PROLL PROPS PRORE PROSO PROSS PROST PROTO PSION
+    0x8A, 0x70, 0x28, 0xA7, 0x04, 0x8A, 0x70, 0xA8, 0xA7, 0x90, 0x90, 0x12, 0xA9, 0x01, 0x32, 0x90, 0x17, 0x69, 0x04, 0x0A, 0x90, 0x45, 0x29, 0x04, 0x5A,  // PSOAE PSOAI PSOAS PSORA RACES RACHE RACON RAIAS RAILE RAILS
+    0x90, 0x46, 0x29, 0x04, 0x6A, 0x90, 0x4B, 0x09, 0x04, 0xBA, 0x90, 0x52, 0xA9, 0x06, 0x0A, 0x90, 0x61, 0x29, 0x06, 0x22, 0x90, 0x64, 0xA9, 0x06, 0xBA,  // RAINE RAINS RAITA RAITS RALES RANAS RANCE RANEE RANIS RANTS
+    0x90, 0x82, 0x99, 0x08, 0x2A, 0x90, 0x83, 0x29, 0x08, 0x82, 0x90, 0x92, 0x29, 0x09, 0x2A, 0x90, 0xA2, 0x99, 0x0A, 0x2A, 0x90, 0xA8, 0xA9, 0x0A, 0xA2,  // RAPER RAPES RAPHE RAPPE RAREE RARES RASER RASES RASPS RASSE
+    0x90, 0xAB, 0x09, 0x0B, 0x05, 0x90, 0xB0, 0x69, 0x0B, 0x0A, 0x90, 0xB1, 0x39, 0x0B, 0x25, 0x90, 0xB2, 0x99, 0x0B, 0x2A, 0x90, 0xB3, 0x09, 0x0B, 0x32,  // RASTA RATAL RATAN RATAS RATCH RATEL RATER RATES RATHA RATHE
+    0x90, 0xB3, 0xA9, 0x0B, 0x77, 0x90, 0xB7, 0xA9, 0x20, 0x4A, 0x92, 0x05, 0x79, 0x20, 0x5A, 0x92, 0x06, 0xA9, 0x20, 0x8A, 0x92, 0x09, 0xA9, 0x20, 0xAB,  // RATHS RATOO RATOS REAIS REALO REALS REANS REAPS REARS REAST
+    0x92, 0x0B, 0x09, 0x20, 0xB2, 0x92, 0x10, 0x59, 0x21, 0x12, 0x92, 0x11, 0x79, 0x21, 0x4B, 0x92, 0x17, 0x69, 0x21, 0xB0, 0x92, 0x1B, 0x49, 0x21, 0xB7,  // REATA REATE RECAL RECCE RECCO RECIT RECON RECTA RECTI RECTO
+    0x92, 0x21, 0x39, 0x22, 0x5A, 0x92, 0x26, 0xA9, 0x22, 0xAB, 0x92, 0x46, 0xA9, 0x24, 0xAB, 0x92, 0x52, 0xB9, 0x25, 0x42, 0x92, 0x54, 0xB9, 0x25, 0x57,  // REECH REELS REENS REEST REINS REIST RELET RELIE RELIT RELLO
+    0x92, 0x64, 0x69, 0x26, 0x62, 0x92, 0x67, 0xA9, 0x26, 0xB2, 0x92, 0x6B, 0xA9, 0x27, 0x45, 0x92, 0x84, 0x69, 0x28, 0x50, 0x92, 0x87, 0xA9, 0x28, 0x7B,  // RENIN RENNE RENOS RENTE RENTS REOIL REPIN REPLA REPOS REPOT
+    0x92, 0x88, 0xA9, 0x28, 0x97, 0x92, 0x90, 0x69, 0x2A, 0x0B, 0x92, 0xA2, 0x29, 0x2A, 0x2A, 0x92, 0xA4, 0xB9, 0x2A, 0xB7, 0x92, 0xAB, 0xA9, 0x2B, 0x40,  // REPPS REPRO RERAN RESAT RESEE RESES RESIT RESTO RESTS RETIA
+    0x92, 0xB4, 0x29, 0x32, 0x0A, 0x93, 0x42, 0xA9, 0x34, 0x62, 0x93, 0x76, 0x29, 0x40, 0x5A, 0x94, 0x06, 0xB9, 0x40, 0xB0, 0x94, 0x12, 0x99, 0x41, 0x2A,  // RETIE RHEAS RHIES RHINE RHONE RIALS RIANT RIATA RICER RICES
+    0x94, 0x13, 0xB9, 0x41, 0x46, 0x94, 0x25, 0xA9, 0x45, 0x2A, 0x94, 0x55, 0x29, 0x45, 0x5A, 0x94, 0x62, 0xA9, 0x47, 0xBA, 0x94, 0x82, 0xA9, 0x48, 0x8A,  // RICHT RICIN RIELS RILES RILLE RILLS RINES RIOTS RIPES RIPPS
+    0x94, 0xA2, 0xA9, 0x4A, 0x34, 0x94, 0xA8, 0xA9, 0x4B, 0x2A, 0x94, 0xBB, 0xA9, 0x70, 0x6A, 0x97, 0x09, 0xA9, 0x70, 0xB2, 0x97, 0x32, 0xA9, 0x74, 0x5A,  // RISES RISHI RISPS RITES RITTS ROANS ROARS ROATE ROHES ROILS
+    0x97, 0x46, 0xA9, 0x74, 0xAB, 0x97, 0x52, 0xA9, 0x75, 0x5A, 0x97, 0x62, 0x79, 0x76, 0x2A, 0x97, 0x64, 0x69, 0x76, 0x62, 0x97, 0x6B, 0x29, 0x76, 0xBA,  // ROINS ROIST ROLES ROLLS RONEO RONES RONIN RONNE RONTE RONTS
+    0x97, 0x76, 0xA9, 0x77, 0x8A, 0x97, 0x7A, 0x09, 0x77, 0xA2, 0x97, 0x7B, 0xA9, 0x78, 0x29, 0x97, 0x82, 0xA9, 0x79, 0x05, 0x97, 0x92, 0xA9, 0x79, 0x41,  // ROONS ROOPS ROOSA ROOSE ROOTS ROPER ROPES RORAL RORES RORIC
+    0x97, 0x94, 0x29, 0x79, 0xBA, 0x97, 0xA2, 0xA9, 0x7A, 0x2B, 0x97, 0xA3, 0x49, 0x7A, 0x46, 0x97, 0xA4, 0xB9, 0x7A, 0xB4, 0x97, 0xAB, 0xA9, 0x7B, 0x05,  // RORIE RORTS ROSES ROSET ROSHI ROSIN ROSIT ROSTI ROSTS ROTAL
+    0x97, 0xB0, 0x69, 0x7B, 0x0A, 0x97, 0xB1, 0x39, 0x7B, 0x2A, 0x97, 0xB4, 0xA9, 0x7B, 0x5A, 0x97, 0xB7, 0x69, 0x7B, 0x7A, 0x97, 0xBB, 0x2A, 0x01, 0x90,  // ROTAN ROTAS ROTCH ROTES ROTIS ROTLS ROTON ROTOS ROTTE SACRA
+    0xA0, 0x41, 0x2A, 0x04, 0x1A, 0xA0, 0x45, 0xAA, 0x04, 0x62, 0xA0, 0x46, 0xAA, 0x04, 0x9A, 0xA0, 0x4A, 0xBA, 0x04, 0xB3, 0xA0, 0x50, 0x5A, 0x05, 0x0B,  // SAICE SAICS SAILS SAINE SAINS SAIRS SAIST SAITH SALAL SALAT
+    0xA0, 0x52, 0x8A, 0x05, 0x2A, 0xA0, 0x52, 0xBA, 0x05, 0x41, 0xA0, 0x55, 0x2A, 0x05, 0x75, 0xA0, 0x57, 0x8A, 0x05, 0x80, 0xA0, 0x58, 0xAA, 0x05, 0xA2,  // SALEP SALES SALET SALIC SALLE SALOL SALOP SALPA SALPS SALSE
+    0xA0, 0x5B, 0x7A, 0x05, 0xBA, 0xA0, 0x62, 0xAA, 0x06, 0xA0, 0xA0, 0x6B, 0x7A, 0x06, 0xBA, 0xA0, 0x75, 0x0A, 0x08, 0x06, 0xA0, 0x87, 0x9A, 0x09, 0x06,  // SALTO SALTS SANES SANSA SANTO SANTS SAOLA SAPAN SAPOR SARAN
+    0xA0, 0x92, 0x2A, 0x09, 0x46, 0xA0, 0x94, 0xAA, 0x09, 0x7A, 0xA0, 0xA2, 0x9A, 0x0A, 0x46, 0xA0, 0xAA, 0x2A, 0x0B, 0x04, 0xA0, 0xB2, 0xAA, 0x0B, 0x4A,  // SAREE SARIN SARIS SAROS SASER SASIN SASSE SATAI SATES SATIS
+    0xA1, 0x04, 0x5A, 0x10, 0x50, 0xA1, 0x05, 0x5A, 0x10, 0x6A, 0xA1, 0x08, 0x0A, 0x10, 0x82, 0xA1, 0x08, 0x4A, 0x10, 0x98, 0xA1, 0x09, 0xAA, 0x10, 0x9B,  // SCAIL SCALA SCALL SCANS SCAPA SCAPE SCAPI SCARP SCARS SCART
+    0xA1, 0x0B, 0x3A, 0x10, 0xBA, 0xA1, 0x0B, 0xBA, 0x12, 0x0B, 0xA1, 0x26, 0x0A, 0x17, 0x7B, 0xA1, 0x78, 0x0A, 0x17, 0x8A, 0xA1, 0x7B, 0xAA, 0x19, 0x02,  // SCATH SCATS SCATT SCEAT SCENA SCOOT SCOPA SCOPS SCOTS SCRAE
+    0xA1, 0x90, 0x6A, 0x19, 0x0B, 0xA1, 0x94, 0x8A, 0x20, 0x5A, 0xA2, 0x06, 0xAA, 0x20, 0x92, 0xA2, 0x09, 0xAA, 0x20, 0xA2, 0xA2, 0x0B, 0xAA, 0x21, 0x17,  // SCRAN SCRAT SCRIP SEALS SEANS SEARE SEARS SEASE SEATS SECCO
+    0xA2, 0x13, 0xAA, 0x21, 0xBA, 0xA2, 0x25, 0xAA, 0x22, 0x8A, 0xA2, 0x29, 0xAA, 0x23, 0x94, 0xA2, 0x45, 0xAA, 0x24, 0x62, 0xA2, 0x49, 0xAA, 0x24, 0xA2,  // SECHS SECTS SEELS SEEPS SEERS SEHRI SEILS SEINE SEIRS SEISE
+    0xA2, 0x50, 0x3A, 0x25, 0x2A, 0xA2, 0x55, 0x0A, 0x25, 0x52, 0xA2, 0x55, 0xAA, 0x26, 0x0A, 0xA2, 0x62, 0xAA, 0x26, 0x60, 0xA2, 0x67, 0x9A, 0x26, 0xA0,  // SELAH SELES SELLA SELLE SELLS SENAS SENES SENNA SENOR SENSA
+    0xA2, 0x6A, 0x4A, 0x26, 0xB2, 0xA2, 0x6B, 0x4A, 0x26, 0xBA, 0xA2, 0x80, 0x5A, 0x28, 0x41, 0xA2, 0x8B, 0x0A, 0x28, 0xBA, 0xA2, 0x90, 0x1A, 0x29, 0x04,  // SENSI SENTE SENTI SENTS SEPAL SEPIC SEPTA SEPTS SERAC SERAI
+    0xA2, 0x90, 0x5A, 0x29, 0x29, 0xA2, 0x92, 0xAA, 0x29, 0x41, 0xA2, 0x94, 0x6A, 0x29, 0x76, 0xA2, 0x99, 0x0A, 0x29, 0x92, 0xA2, 0x99, 0xAA, 0x2A, 0xA0,  // SERAL SERER SERES SERIC SERIN SERON SERRA SERRE SERRS SESSA
+    0xA2, 0xB0, 0x2A, 0x2B, 0x05, 0xA2, 0xB7, 0x6A, 0x2B, 0xBA, 0xA3, 0x03, 0xAA, 0x30, 0x6A, 0xA3, 0x08, 0xAA, 0x30, 0x96, 0xA3, 0x0A, 0x3A, 0x31, 0x34,  // SETAE SETAL SETON SETTS SHAHS SHANS SHAPS SHARN SHASH SHCHI
+    0xA3, 0x20, 0x5A, 0x32, 0x0A, 0xA3, 0x22, 0x5A, 0x32, 0x6B, 0xA3, 0x27, 0x5A, 0x32, 0x92, 0xA3, 0x29, 0x7A, 0x32, 0xBA, 0xA3, 0x40, 0x4A, 0x34, 0x25,  // SHEAL SHEAS SHEEL SHENT SHEOL SHERE SHERO SHETS SHIAI SHIEL
+    0xA3, 0x42, 0x9A, 0x34, 0x2A, 0xA3, 0x45, 0x5A, 0x34, 0x6A, 0xA3, 0x48, 0xAA, 0x34, 0x99, 0xA3, 0x49, 0xAA, 0x34, 0xA3, 0xA3, 0x4A, 0x7A, 0x34, 0xAB,  // SHIER SHIES SHILL SHINS SHIPS SHIRR SHIRS SHISH SHISO SHIST
+    0xA3, 0x4B, 0x2A, 0x34, 0xBA, 0xA3, 0x52, 0x8A, 0x37, 0x0B, 0xA3, 0x72, 0x9A, 0x37, 0x2A, 0xA3, 0x75, 0x0A, 0x37, 0x75, 0xA3, 0x77, 0x6A, 0x37, 0x7A,  // SHITE SHITS SHLEP SHOAT SHOER SHOES SHOLA SHOOL SHOON SHOOS
+    0xA3, 0x78, 0x2A, 0x37, 0x8A, 0xA3, 0x79, 0x5A, 0x37, 0xB2, 0xA3, 0x7B, 0xAA, 0x37, 0xBB, 0xA3, 0x94, 0xAA, 0x40, 0x5A, 0xA4, 0x12, 0xAA, 0x41, 0x3B,  // SHOPE SHOPS SHORL SHOTE SHOTS SHOTT SHRIS SIALS SICES SICHT
+    0xA4, 0x26, 0xAA, 0x42, 0x6B, 0xA4, 0x2B, 0x3A, 0x45, 0x26, 0xA4, 0x52, 0x9A, 0x45, 0x2A, 0xA4, 0x55, 0xAA, 0x45, 0x7A, 0xA4, 0x5B, 0xAA, 0x46, 0x2A,  // SIENS SIENT SIETH SILEN SILER SILES SILLS SILOS SILTS SINES
+    0xA4, 0x63, 0xAA, 0x48, 0x2A, 0xA4, 0x92, 0x2A, 0x49, 0x2A, 0xA4, 0x94, 0x3A, 0x49, 0x4A, 0xA4, 0x97, 0x1A, 0x49, 0x90, 0xA4, 0xA0, 0x5A, 0x4A, 0x2A,  // SINHS SIPES SIREE SIRES SIRIH SIRIS SIROC SIRRA SISAL SISES
+    0xA4, 0xAB, 0x0A, 0x4A, 0xBA, 0xA4, 0xB0, 0x9A, 0x4B, 0x2A, 0xA4, 0xB3, 0x2A, 0x50, 0x2A, 0xA5, 0x06, 0x2A, 0x50, 0x8A, 0xA5, 0x09, 0xBA, 0x50, 0xBA,  // SISTA SISTS SITAR SITES SITHE SLAES SLANE SLAPS SLART SLATS
+    0xA5, 0x22, 0x9A, 0x54, 0x29, 0xA5, 0x48, 0x2A, 0x54, 0x8A, 0xA5, 0x48, 0xBA, 0x54, 0xA3, 0xA5, 0x4B, 0xAA, 0x57, 0x06, 0xA5, 0x72, 0xAA, 0x57, 0x7B,  // SLEER SLIER SLIPE SLIPS SLIPT SLISH SLITS SLOAN SLOES SLOOT
+    0xA5, 0x78, 0xAA, 0x57, 0xBA, 0xA6, 0x08, 0xAA, 0x60, 0x9A, 0xA6, 0x0A, 0x3A, 0x60, 0xB3, 0xA6, 0x20, 0x8A, 0x62, 0x2A, 0xA6, 0x25, 0x5A, 0x64, 0x2A,  // SLOPS SLOTS SNAPS SNARS SNASH SNATH SNEAP SNEES SNELL SNIES
+    0xA6, 0x48, 0xAA, 0x64, 0x9B, 0xA6, 0x4B, 0xAA, 0x67, 0x28, 0xA6, 0x77, 0x5A, 0x67, 0x7B, 0xA6, 0x7B, 0xAA, 0x70, 0x8A, 0xA7, 0x09, 0x2A, 0x70, 0x9A,  // SNIPS SNIRT SNITS SNOEP SNOOL SNOOT SNOTS SOAPS SOARE SOARS
+    0xA7, 0x10, 0xAA, 0x71, 0x2A, 0xA7, 0x15, 0x2A, 0x74, 0x5A, 0xA7, 0x50, 0x3A, 0x75, 0x06, 0xA7, 0x50, 0xAA, 0x75, 0x24, 0xA7, 0x52, 0x9A, 0x75, 0x2A,  // SOCAS SOCES SOCLE SOILS SOLAH SOLAN SOLAS SOLEI SOLER SOLES
+    0xA7, 0x57, 0x6A, 0x75, 0x7A, 0xA7, 0x61, 0x2A, 0x76, 0x2A, 0xA7, 0x66, 0x2A, 0x76, 0xA2, 0xA7, 0x75, 0x2A, 0x77, 0x5A, 0xA7, 0x78, 0xAA, 0x77, 0xB2,  // SOLON SOLOS SONCE SONES SONNE SONSE SOOLE SOOLS SOOPS SOOTE
+    0xA7, 0x7B, 0xAA, 0x78, 0x3A, 0xA7, 0x87, 0x9A, 0x78, 0x90, 0xA7, 0x90, 0x5A, 0x79, 0x0A, 0xA7, 0x92, 0x2A, 0x79, 0x25, 0xA7, 0x92, 0x9A, 0x79, 0x2A,  // SOOTS SOPHS SOPOR SOPRA SORAL SORAS SOREE SOREL SORER SORES
+    0xA7, 0x96, 0xAA, 0x79, 0x90, 0xA7, 0x9B, 0x0A, 0x79, 0xBA, 0xA7, 0xB3, 0xAA, 0x7B, 0x75, 0xA8, 0x02, 0x9A, 0x80, 0x2A, 0xA8, 0x03, 0x4A, 0x80, 0x45,  // SORNS SORRA SORTA SORTS SOTHS SOTOL SPAER SPAES SPAHI SPAIL
+    0xA8, 0x04, 0x6A, 0x80, 0x4B, 0xA8, 0x05, 0x2A, 0x80, 0x55, 0xA8, 0x05, 0xBA, 0x80, 0x62, 0xA8, 0x06, 0xAA, 0x80, 0x9A, 0xA8, 0x09, 0xBA, 0x80, 0xB2,  // SPAIN SPAIT SPALE SPALL SPALT SPANE SPANS SPARS SPART SPATE
+    0xA8, 0x0B, 0xAA, 0x82, 0x05, 0xA8, 0x20, 0x6A, 0x82, 0x0B, 0xA8, 0x21, 0xAA, 0x82, 0x1B, 0xA8, 0x22, 0x5A, 0x82, 0x29, 0xA8, 0x24, 0x5A, 0x82, 0x49,  // SPATS SPEAL SPEAN SPEAT SPECS SPECT SPEEL SPEER SPEIL SPEIR
+    0xA8, 0x27, 0xAA, 0x82, 0xBA, 0xA8, 0x40, 0x5A, 0x84, 0x10, 0xA8, 0x41, 0xAA, 0x84, 0x29, 0xA8, 0x42, 0xAA, 0x84, 0x52, 0xA8, 0x46, 0x0A, 0x84, 0x6A,  // SPEOS SPETS SPIAL SPICA SPICS SPIER SPIES SPILE SPINA SPINS
+    0xA8, 0x49, 0xBA, 0x84, 0xBA, 0xA8, 0x77, 0x9A, 0x87, 0x7B, 0xA8, 0x7A, 0x3A, 0x87, 0xBA, 0xA8, 0x90, 0xBA, 0x89, 0x4B, 0xAB, 0x06, 0x2A, 0xB0, 0x83,  // SPIRT SPITS SPOOR SPOOT SPOSH SPOTS SPRAT SPRIT STANE STAPH
+    0xAB, 0x08, 0xAA, 0xB0, 0x96, 0xAB, 0x09, 0x9A, 0xB0, 0x9A, 0xAB, 0x0B, 0xAA, 0xB2, 0x06, 0xAB, 0x20, 0x9A, 0xB2, 0x26, 0xAB, 0x24, 0x5A, 0xB2, 0x50,  // STAPS STARN STARR STARS STATS STEAN STEAR STEEN STEIL STELA
+    0xAB, 0x25, 0x2A, 0xB2, 0x55, 0xAB, 0x26, 0x7A, 0xB2, 0x6A, 0xAB, 0x26, 0xBA, 0xB2, 0x8A, 0xAB, 0x28, 0xBA, 0xB2, 0x92, 0xAB, 0x2B, 0xAA, 0xB4, 0x13,  // STELE STELL STENO STENS STENT STEPS STEPT STERE STETS STICH
+    0xAB, 0x42, 0xAA, 0xB4, 0x52, 0xAB, 0x48, 0x0A, 0xB4, 0x82, 0xAB, 0x49, 0x2A, 0xB4, 0x98, 0xAB, 0x49, 0xAA, 0xB7, 0x02, 0xAB, 0x70, 0x4A, 0xB7, 0x0A,  // STIES STILE STIPA STIPE STIRE STIRP STIRS STOAE STOAI STOAS
+    0xAB, 0x70, 0xBA, 0xB7, 0x28, 0xAB, 0x74, 0xBA, 0xB7, 0x56, 0xAB, 0x76, 0x6A, 0xB7, 0x79, 0xAB, 0x78, 0x2A, 0xB7, 0x8A, 0xAB, 0x78, 0xBA, 0xB7, 0xAA,  // STOAT STOEP STOIT STOLN STONN STOOR STOPE STOPS STOPT STOSS
+    0xAB, 0x7B, 0xAA, 0xB7, 0xBB, 0xAB, 0x90, 0x2A, 0xB9, 0x28, 0xAB, 0x94, 0x0A, 0xB9, 0x78, 0xB0, 0x05, 0xAB, 0x00, 0xB0, 0xB0, 0x10, 0x6B, 0x01, 0x2A,  // STOTS STOTT STRAE STREP STRIA STROP TAALS TAATA TACAN TACES
+    0xB0, 0x12, 0xBB, 0x01, 0x32, 0xB0, 0x13, 0x7B, 0x01, 0x3A, 0xB0, 0x17, 0xAB, 0x01, 0xBA, 0xB0, 0x25, 0xAB, 0x03, 0x0A, 0xB0, 0x39, 0xAB, 0x04, 0x5A,  // TACET TACHE TACHO TACHS TACOS TACTS TAELS TAHAS TAHRS TAILS
+    0xB0, 0x46, 0xAB, 0x04, 0x90, 0xB0, 0x4A, 0x3B, 0x04, 0xBA, 0xB0, 0x50, 0x9B, 0x05, 0x0A, 0xB0, 0x51, 0xAB, 0x05, 0x20, 0xB0, 0x52, 0x9B, 0x05, 0x2A,  // TAINS TAIRA TAISH TAITS TALAR TALAS TALCS TALEA TALER TALES
+    0xB0, 0x55, 0xAB, 0x05, 0x80, 0xB0, 0x60, 0xAB, 0x06, 0x3A, 0xB0, 0x66, 0x0B, 0x06, 0xB4, 0xB0, 0x6B, 0x7B, 0x08, 0x0A, 0xB0, 0x82, 0x6B, 0x08, 0x2A,  // TALLS TALPA TANAS TANHS TANNA TANTI TANTO TAPAS TAPEN TAPES
+    0xB0, 0x82, 0xBB, 0x08, 0x4A, 0xB0, 0x88, 0x0B, 0x09, 0x0A, 0xB0, 0x92, 0xAB, 0x09, 0x6A, 0xB0, 0x97, 0x1B, 0x09, 0x7A, 0xB0, 0x98, 0xAB, 0x09, 0x92,  // TAPET TAPIS TAPPA TARAS TARES TARNS TAROC TAROS TARPS TARRE
+    0xB0, 0x9A, 0x4B, 0x09, 0xBA, 0xB0, 0xA0, 0x9B, 0x0A, 0x29, 0xB0, 0xA2, 0xAB, 0x0A, 0xA0, 0xB0, 0xAA, 0x2B, 0x0A, 0xA7, 0xB0, 0xB0, 0x9B, 0x0B, 0x29,  // TARSI TARTS TASAR TASER TASES TASSA TASSE TASSO TATAR TATER
+    0xB0, 0xB2, 0xAB, 0x0B, 0x3A, 0xB0, 0xB4, 0x2B, 0x0B, 0xBA, 0xB2, 0x05, 0xAB, 0x20, 0x9A, 0xB2, 0x0B, 0xAB, 0x21, 0x3A, 0xB2, 0x1B, 0x0B, 0x22, 0x5A,  // TATES TATHS TATIE TATTS TEALS TEARS TEATS TECHS TECTA TEELS
+    0xB2, 0x26, 0x2B, 0x22, 0x6A, 0xB2, 0x29, 0xAB, 0x23, 0x9A, 0xB2, 0x45, 0xAB, 0x24, 0x6A, 0xB2, 0x50, 0x2B, 0x25, 0x17, 0xB2, 0x52, 0xAB, 0x25, 0x40,  // TEENE TEENS TEERS TEHRS TEILS TEINS TELAE TELCO TELES TELIA
+    0xB2, 0x54, 0x1B, 0x25, 0x5A, 0xB2, 0x57, 0x4B, 0x25, 0x7A, 0xB2, 0x61, 0x3B, 0x26, 0x2A, 0xB2, 0x64, 0x0B, 0x26, 0x62, 0xB2, 0x66, 0x7B, 0x26, 0x76,  // TELIC TELLS TELOI TELOS TENCH TENES TENIA TENNE TENNO TENON
+    0xB2, 0x6B, 0xAB, 0x28, 0x05, 0xB2, 0x80, 0xAB, 0x29, 0x04, 0xB2, 0x90, 0xAB, 0x29, 0x12, 0xB2, 0x92, 0xAB, 0x29, 0x62, 0xB2, 0x96, 0xAB, 0x29, 0xBA,  // TENTS TEPAL TEPAS TERAI TERAS TERCE TERES TERNE TERNS TERTS
+    0xB2, 0xA5, 0x0B, 0x2A, 0xB0, 0xB2, 0xAB, 0x2B, 0x2A, 0xBA, 0xB2, 0xB2, 0xAB, 0x2B, 0x3A, 0xB2, 0xB9, 0x0B, 0x2B, 0x94, 0xB3, 0x05, 0x2B, 0x30, 0x54,  // TESLA TESTA TESTE TESTS TETES TETHS TETRA TETRI THALE THALI
+    0xB3, 0x06, 0x0B, 0x30, 0x62, 0xB3, 0x06, 0xAB, 0x30, 0x9A, 0xB3, 0x21, 0x0B, 0x32, 0x2A, 0xB3, 0x24, 0x1B, 0x32, 0x46, 0xB3, 0x26, 0xAB, 0x32, 0xA8,  // THANA THANE THANS THARS THECA THEES THEIC THEIN THENS THESP
+    0xB3, 0x2B, 0x2B, 0x34, 0x55, 0xB3, 0x46, 0x2B, 0x34, 0x6A, 0xB3, 0x47, 0x5B, 0x34, 0x95, 0xB3, 0x75, 0x2B, 0x37, 0x54, 0xB3, 0x79, 0x7B, 0x37, 0x98,  // THETE THILL THINE THINS THIOL THIRL THOLE THOLI THORO THORP
+    0xB3, 0x90, 0x2B, 0x39, 0x48, 0xB3, 0x97, 0x2B, 0x40, 0x6A, 0xB4, 0x09, 0xAB, 0x41, 0x05, 0xB4, 0x11, 0x0B, 0x41, 0x2A, 0xB4, 0x29, 0xAB, 0x45, 0x29,  // THRAE THRIP THROE TIANS TIARS TICAL TICCA TICES TIERS TILER
+    0xB4, 0x52, 0xAB, 0x45, 0x5A, 0xB4, 0x5B, 0x3B, 0x45, 0xBA, 0xB4, 0x60, 0xAB, 0x46, 0x1B, 0xB4, 0x62, 0x0B, 0x46, 0x2A, 0xB4, 0x6B, 0xAB, 0x48, 0x4A,  // TILES TILLS TILTH TILTS TINAS TINCT TINEA TINES TINTS TIPIS
+    0xB4, 0x92, 0xAB, 0x49, 0x5A, 0xB4, 0x97, 0xAB, 0x49, 0x9A, 0xB4, 0xB1, 0x3B, 0x4B, 0x29, 0xB4, 0xB4, 0xAB, 0x4B, 0x92, 0xB7, 0x17, 0xAB, 0x72, 0x0A,  // TIRES TIRLS TIROS TIRRS TITCH TITER TITIS TITRE TOCOS TOEAS
+    0xB7, 0x37, 0xAB, 0x74, 0x52, 0xB7, 0x45, 0xAB, 0x74, 0xA2, 0xB7, 0x4B, 0xAB, 0x75, 0x06, 0xB7, 0x50, 0x9B, 0x75, 0x0A, 0xB7, 0x52, 0xAB, 0x75, 0x5A,  // TOHOS TOILE TOILS TOISE TOITS TOLAN TOLAR TOLAS TOLES TOLLS
+    0xB7, 0x5B, 0xAB, 0x76, 0x29, 0xB7, 0x62, 0xAB, 0x76, 0x62, 0xB7, 0x75, 0xAB, 0x77, 0x6A, 0xB7, 0x7B, 0xAB, 0x78, 0x22, 0xB7, 0x82, 0x9B, 0x78, 0x2A,  // TOLTS TONER TONES TONNE TOOLS TOONS TOOTS TOPEE TOPER TOPES
+    0xB7, 0x83, 0x2B, 0x78, 0x34, 0xB7, 0x83, 0xAB, 0x78, 0x4A, 0xB7, 0x87, 0x4B, 0x78, 0x7A, 0xB7, 0x90, 0x3B, 0x79, 0x06, 0xB7, 0x90, 0xAB, 0x79, 0x1A,  // TOPHE TOPHI TOPHS TOPIS TOPOI TOPOS TORAH TORAN TORAS TORCS
+    0xB7, 0x92, 0xAB, 0x79, 0x41, 0xB7, 0x94, 0x4B, 0x79, 0x7A, 0xB7, 0x97, 0xBB, 0x79, 0x9A, 0xB7, 0x9A, 0x2B, 0x79, 0xA4, 0xB7, 0x9B, 0x0B, 0x79, 0xB2,  // TORES TORIC TORII TOROS TOROT TORRS TORSE TORSI TORTA TORTE
+    0xB7, 0x9B, 0xAB, 0x7A, 0x0A, 0xB7, 0xA2, 0xAB, 0x7B, 0x29, 0xB7, 0xB2, 0xAB, 0x90, 0x6A, 0xB9, 0x06, 0xBB, 0x90, 0x82, 0xB9, 0x08, 0xAB, 0x90, 0x8B,  // TORTS TOSAS TOSES TOTER TOTES TRANS TRANT TRAPE TRAPS TRAPT
+    0xB9, 0x0A, 0xAB, 0x90, 0xBA, 0xB9, 0x0B, 0xBB, 0x92, 0x26, 0xB9, 0x22, 0xAB, 0x92, 0xAA, 0xB9, 0x2A, 0xBB, 0x92, 0xBA, 0xB9, 0x40, 0x1B, 0x94, 0x29,  // TRASS TRATS TRATT TREEN TREES TRESS TREST TRETS TRIAC TRIER
+    0xB9, 0x42, 0xAB, 0x94, 0x55, 0xB9, 0x46, 0x2B, 0x94, 0x6A, 0xB9, 0x47, 0x5B, 0x94, 0x79, 0xB9, 0x47, 0xAB, 0x94, 0x8A, 0xB9, 0x4A, 0xBB, 0x97, 0x0B,  // TRIES TRILL TRINE TRINS TRIOL TRIOR TRIOS TRIPS TRIST TROAT
+    0xB9, 0x74, 0xAB, 0x97, 0x60, 0xB9, 0x76, 0x1B, 0x97, 0x62, 0xB9, 0x76, 0xAB, 0x97, 0xB3, 0xB9, 0x7B, 0xAB, 0xA0, 0x9A,  // TROIS TRONA TRONC TRONE TRONS TROTH TROTS TSARS
 };
+#else
+#define WORDLE_NUM_POSSIBLE_WORDS 0
+#endif
 
 #if (WORDLE_USE_RANDOM_GUESS == 3)
-static const uint16_t _num_random_guess_words = 13;  // The valid_words array begins with this many words that are considered the top 3% best options.
+static const uint16_t _num_random_guess_words = WORDLE_NUM_BEST_WORDS;
 #elif (WORDLE_USE_RANDOM_GUESS == 2)
-static const uint16_t _num_random_guess_words = 257;  // The valid_words array begins with this many words where each letter is different.
+static const uint16_t _num_random_guess_words = WORDLE_NUM_UNIQUE_WORDS;
 #elif (WORDLE_USE_RANDOM_GUESS == 1)
-static const uint16_t _num_random_guess_words = _num_words;
+static const uint16_t _num_random_guess_words = WORDLE_NUM_WORDS;
 #endif
 
-#endif // WORDLE_FACE_DICT_H_
\ No newline at end of file
+#endif // WORDLE_FACE_DICT_H_
@@ -0,0 +1,139 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 Second Movement contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "moon_phase.h"
+
+// Saturday, 6 January 2000 18:14:00 in unix epoch time
+#define FIRST_MOON 947182440
+
+#define NUM_SEGMENTS 9
+
+// where each phase begins, in seconds after the new moon: 0, 1, 6.38, 8.38, 13.77, 15.77, 21.15, 23.15 and
+// 28.53 days. The last entry is the length of the cycle.
+static const uint32_t _moon_phase_segment_starts[NUM_SEGMENTS + 1] = {
+    0, 86400, 551461, 724261, 1189321, 1362121, 1827182, 1999982, 2465043, MOON_PHASE_SYNODIC_MONTH
+};
+
+static const moon_phase_t _moon_phase_segment_phases[NUM_SEGMENTS] = {
+    MOON_PHASE_NEW,
+    MOON_PHASE_WAXING_CRESCENT,
+    MOON_PHASE_FIRST_QUARTER,
+    MOON_PHASE_WAXING_GIBBOUS,
+    MOON_PHASE_FULL,
+    MOON_PHASE_WANING_GIBBOUS,
+    MOON_PHASE_THIRD_QUARTER,
+    MOON_PHASE_WANING_CRESCENT,
+    MOON_PHASE_NEW,
+};
+
+// (1 - cos(angle)) / 2 in percent times 256, for angles from 0 to 180 degrees in steps of 11.25.
+static const uint16_t _moon_phase_illumination[17] = {
+    0, 246, 974, 2157, 3749, 5689, 7902, 10303, 12800, 15297, 17698, 19911, 21851, 23443, 24626, 25354, 25600
+};
+
+static uint32_t _moon_phase_cycle_start(uint16_t cycle) {
+    // the cycle is 2551442.7778 seconds long; add up the fractional part in 16.16 so it doesn't drift.
+    return FIRST_MOON + (uint32_t)cycle * (MOON_PHASE_SYNODIC_MONTH - 1) + (((uint32_t)cycle * 50972) >> 16);
+}
+
+static void _moon_phase_set_segment(moon_phase_tracker_t *tracker, uint8_t segment) {
+    tracker->segment = segment;
+    tracker->phase = _moon_phase_segment_phases[segment];
+    tracker->phase_start = tracker->cycle_start + _moon_phase_segment_starts[segment];
+    tracker->next_change = tracker->cycle_start + _moon_phase_segment_starts[segment + 1];
+}
+
+static void _moon_phase_set_cycle(moon_phase_tracker_t *tracker, uint16_t cycle) {
+    tracker->cycle = cycle;
+    tracker->cycle_start = _moon_phase_cycle_start(cycle);
+}
+
+bool moon_phase_update(moon_phase_tracker_t *tracker, uint32_t timestamp) {
+    moon_phase_t previous = tracker->phase;
+
+    if (timestamp >= tracker->phase_start && timestamp < tracker->next_change) return false;
+
+    if (timestamp < tracker->phase_start || timestamp - tracker->next_change >= MOON_PHASE_SYNODIC_MONTH) {
+        // a jump backwards or across a whole cycle (or a new tracker): find the cycle from scratch.
+        uint16_t cycle = (timestamp - FIRST_MOON) / MOON_PHASE_SYNODIC_MONTH;
+        // the division used the rounded cycle length, so it can be one off.
+        if (cycle && _moon_phase_cycle_start(cycle) > timestamp) cycle--;
+        else if (_moon_phase_cycle_start(cycle + 1) <= timestamp) cycle++;
+        _moon_phase_set_cycle(tracker, cycle);
+
+        uint8_t segment = 0;
+        while (timestamp - tracker->cycle_start >= _moon_phase_segment_starts[segment + 1]) segment++;
+        _moon_phase_set_segment(tracker, segment);
+    } else {
+        // the usual case: step forward one phase at a time.
+        while (timestamp >= tracker->next_change) {
+            if (tracker->segment + 1 == NUM_SEGMENTS) {
+                _moon_phase_set_cycle(tracker, tracker->cycle + 1);
+                _moon_phase_set_segment(tracker, 0);
+            } else {
+                _moon_phase_set_segment(tracker, tracker->segment + 1);
+            }
+        }
+    }
+
+    return tracker->phase != previous;
+}
+
+uint32_t moon_phase_get_age(const moon_phase_tracker_t *tracker, uint32_t timestamp) {
+    return timestamp - tracker->cycle_start;
+}
+
+uint8_t moon_phase_get_illumination(const moon_phase_tracker_t *tracker, uint32_t timestamp) {
+    // position in the cycle, where 65536 is a full cycle: age * 2^48 / MOON_PHASE_SYNODIC_MONTH, then >> 32.
+    uint32_t position = ((uint64_t)moon_phase_get_age(tracker, timestamp) * 110319925) >> 32;
+
+    // illumination is symmetric about the full moon.
+    if (position > 32768) position = 65536 - position;
+    if (position >= 32768) return 100;
+
+    uint8_t index = position >> 11;
+    uint32_t fraction = position & 0x7FF;
+    uint32_t value = _moon_phase_illumination[index] + (((_moon_phase_illumination[index + 1] - _moon_phase_illumination[index]) * fraction) >> 11);
+
+    return (value + 128) >> 8;
+}
+
+uint32_t moon_phase_get_next_start(const moon_phase_tracker_t *tracker, moon_phase_t phase) {
+    uint32_t cycle_start = tracker->cycle_start;
+    uint16_t cycle = tracker->cycle;
+    uint8_t segment = tracker->segment;
+
+    for (uint8_t i = 0; i < NUM_SEGMENTS * 2; i++) {
+        if (++segment == NUM_SEGMENTS) {
+            segment = 0;
+            cycle_start = _moon_phase_cycle_start(++cycle);
+        }
+        // the first segment continues the new moon that began at the end of the previous cycle.
+        if (segment != 0 && _moon_phase_segment_phases[segment] == phase) {
+            return cycle_start + _moon_phase_segment_starts[segment];
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,87 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 Second Movement contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// Moon phase:
+// Tracks the phase of the Moon using integer math only. The mean lunar cycle is split into the same eight named
+// phases the moon phase face has always shown, and a tracker remembers the UNIX time at which the current phase
+// ends. Updating a tracker is then just a comparison until that time passes, at which point it steps to the next
+// phase; only a jump of more than a cycle (or a jump backwards) costs a division.
+//
+// This is the mean synodic month, so the phases can be off from the real Moon by up to about 14 hours.
+
+/// the mean synodic month, in seconds (29.53058770576 days).
+#define MOON_PHASE_SYNODIC_MONTH 2551443
+
+typedef enum {
+    MOON_PHASE_NEW = 0,
+    MOON_PHASE_WAXING_CRESCENT,
+    MOON_PHASE_FIRST_QUARTER,
+    MOON_PHASE_WAXING_GIBBOUS,
+    MOON_PHASE_FULL,
+    MOON_PHASE_WANING_GIBBOUS,
+    MOON_PHASE_THIRD_QUARTER,
+    MOON_PHASE_WANING_CRESCENT,
+    MOON_PHASE_COUNT
+} moon_phase_t;
+
+typedef struct {
+    uint32_t cycle_start;   // UNIX time of the new moon that began the current cycle
+    uint32_t phase_start;   // UNIX time the current phase began
+    uint32_t next_change;   // UNIX time the current phase ends
+    uint16_t cycle;         // cycles since the new moon of 6 January 2000
+    uint8_t segment;        // index into the phase table; the new moon is split across the end of one cycle and the start of the next
+    moon_phase_t phase;
+} moon_phase_tracker_t;
+
+/** @brief Brings a tracker up to date. A zeroed tracker is valid, and will be set up on its first update.
+  * @param tracker The tracker.
+  * @param timestamp The UNIX time to track; must be in 2000 or later.
+  * @return true if the phase is different than it was before the update.
+  */
+bool moon_phase_update(moon_phase_tracker_t *tracker, uint32_t timestamp);
+
+/** @brief Returns how far into the current cycle a time is, in seconds since the last new moon.
+  * @param tracker A tracker that has been updated to timestamp.
+  * @param timestamp The UNIX time.
+  */
+uint32_t moon_phase_get_age(const moon_phase_tracker_t *tracker, uint32_t timestamp);
+
+/** @brief Returns the illuminated fraction of the Moon's disc, from a lookup table.
+  * @param tracker A tracker that has been updated to timestamp.
+  * @param timestamp The UNIX time.
+  * @return The illumination, in percent (0-100).
+  */
+uint8_t moon_phase_get_illumination(const moon_phase_tracker_t *tracker, uint32_t timestamp);
+
+/** @brief Returns when a phase next begins, for example to schedule a full moon alert.
+  * @param tracker An up-to-date tracker.
+  * @param phase The phase to look for.
+  * @return The UNIX time that phase next begins, after the start of the current phase.
+  */
+uint32_t moon_phase_get_next_start(const moon_phase_tracker_t *tracker, moon_phase_t phase);
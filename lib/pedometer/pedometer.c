@@ -0,0 +1,175 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 Second Movement contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <string.h>
+#include "pedometer.h"
+
+// the quietest peak that can be a step, in milli-g. Sensor noise in low power mode is around 10 mg.
+#define PEDOMETER_MIN_THRESHOLD 60
+// the fastest and slowest plausible paces: 4 steps a second, and one every 2 seconds.
+#define PEDOMETER_MIN_INTERVAL (PEDOMETER_SAMPLE_RATE / 4)
+#define PEDOMETER_MAX_INTERVAL (PEDOMETER_SAMPLE_RATE * 2)
+// the high-pass filter's running mean covers about 32 samples; let it fill before looking for steps.
+#define PEDOMETER_SETTLING_SAMPLES 32
+
+// a minute with at least this many steps counts as walking...
+#define PEDOMETER_WALK_CADENCE 20
+// ...and as running with a cadence at least this high, and a mean filtered signal of at least this many milli-g.
+#define PEDOMETER_RUN_CADENCE 130
+#define PEDOMETER_RUN_ENERGY 150
+
+static uint16_t _pedometer_isqrt(uint32_t x) {
+    uint32_t result = 0;
+    uint32_t bit = (uint32_t)1 << 30;
+
+    while (bit > x) bit >>= 2;
+    while (bit) {
+        if (x >= result + bit) {
+            x -= result + bit;
+            result = (result >> 1) + bit;
+        } else {
+            result >>= 1;
+        }
+        bit >>= 2;
+    }
+
+    return result;
+}
+
+void pedometer_init(pedometer_t *pedometer) {
+    memset(pedometer, 0, sizeof(pedometer_t));
+    pedometer_restart(pedometer);
+}
+
+void pedometer_restart(pedometer_t *pedometer) {
+    pedometer->previous[0] = 0;
+    pedometer->previous[1] = 0;
+    pedometer->above = false;
+    pedometer->walking = false;
+    pedometer->pending = 0;
+    pedometer->since_step = PEDOMETER_MAX_INTERVAL;
+    pedometer->settling = PEDOMETER_SETTLING_SAMPLES;
+}
+
+static uint16_t _pedometer_step(pedometer_t *pedometer) {
+    uint16_t counted = 0;
+
+    if (pedometer->since_step >= PEDOMETER_MAX_INTERVAL) {
+        // too long since the last one; this may be the start of a new walk.
+        pedometer->walking = false;
+        pedometer->pending = 0;
+    }
+    pedometer->since_step = 0;
+
+    if (pedometer->walking) {
+        counted = 1;
+    } else if (++pedometer->pending == PEDOMETER_STEPS_TO_START) {
+        counted = pedometer->pending;
+        pedometer->pending = 0;
+        pedometer->walking = true;
+    }
+
+    pedometer->minute_steps += counted;
+    pedometer->total_steps += counted;
+
+    return counted;
+}
+
+uint16_t pedometer_process(pedometer_t *pedometer, const lis2dw_reading_t *readings, uint8_t count) {
+    uint16_t steps = 0;
+
+    for (uint8_t i = 0; i < count; i++) {
+        // raw readings are left justified; at ±2g, shifting right 4 leaves about one milli-g per count.
+        int32_t x = readings[i].x >> 4;
+        int32_t y = readings[i].y >> 4;
+        int32_t z = readings[i].z >> 4;
+        int32_t magnitude = _pedometer_isqrt(x * x + y * y + z * z);
+
+        if (pedometer->settling == PEDOMETER_SETTLING_SAMPLES) pedometer->baseline = magnitude << 8;
+        pedometer->baseline += ((magnitude << 8) - pedometer->baseline) >> 5;
+
+        int16_t high_passed = magnitude - (pedometer->baseline >> 8);
+        int16_t filtered = (high_passed + 2 * pedometer->previous[0] + pedometer->previous[1]) >> 2;
+        pedometer->previous[1] = pedometer->previous[0];
+        pedometer->previous[0] = high_passed;
+
+        pedometer->minute_samples++;
+        pedometer->minute_energy += filtered < 0 ? -filtered : filtered;
+
+        if (pedometer->settling) {
+            pedometer->settling--;
+            continue;
+        }
+
+        if (pedometer->since_step < UINT16_MAX) pedometer->since_step++;
+        if (pedometer->since_step > PEDOMETER_MAX_INTERVAL) {
+            // nothing for a while: give up on the current walk, and let the threshold sink back down.
+            pedometer->walking = false;
+            pedometer->pending = 0;
+            pedometer->envelope -= pedometer->envelope >> 5;
+        }
+
+        int16_t threshold = pedometer->envelope / 2;
+        if (threshold < PEDOMETER_MIN_THRESHOLD) threshold = PEDOMETER_MIN_THRESHOLD;
+
+        if (!pedometer->above) {
+            if (filtered > threshold) {
+                pedometer->above = true;
+                pedometer->peak = filtered;
+            }
+        } else if (filtered > pedometer->peak) {
+            pedometer->peak = filtered;
+        } else if (filtered < 0) {
+            // back down through zero: that was a peak. Ignore it if it came too soon after the last step, as the
+            // rebound from an impact can.
+            pedometer->above = false;
+            if (pedometer->since_step >= PEDOMETER_MIN_INTERVAL) {
+                pedometer->envelope += (pedometer->peak - pedometer->envelope) >> 2;
+                steps += _pedometer_step(pedometer);
+            }
+        }
+    }
+
+    return steps;
+}
+
+pedometer_minute_t pedometer_finish_minute(pedometer_t *pedometer) {
+    pedometer_minute_t minute;
+
+    minute.steps = pedometer->minute_steps > UINT8_MAX ? UINT8_MAX : pedometer->minute_steps;
+    if (pedometer->minute_steps >= PEDOMETER_RUN_CADENCE &&
+        pedometer->minute_energy >= (uint32_t)PEDOMETER_RUN_ENERGY * pedometer->minute_samples) {
+        minute.activity = PEDOMETER_ACTIVITY_RUN;
+    } else if (pedometer->minute_steps >= PEDOMETER_WALK_CADENCE) {
+        minute.activity = PEDOMETER_ACTIVITY_WALK;
+    } else {
+        minute.activity = PEDOMETER_ACTIVITY_STILL;
+    }
+
+    pedometer->minute_steps = 0;
+    pedometer->minute_samples = 0;
+    pedometer->minute_energy = 0;
+
+    return minute;
+}
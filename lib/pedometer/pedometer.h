@@ -0,0 +1,96 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 Second Movement contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "lis2dw.h"
+
+// Pedometer:
+// Counts steps and classifies each minute as still, walking or running, from accelerometer samples taken at
+// PEDOMETER_SAMPLE_RATE and read out of the LIS2DW's FIFO in batches. Everything is integer math, and the only
+// state is this struct, so the same code runs on the watch and in utils/pedometer_replay on recorded data.
+//
+// The pipeline, per sample:
+//  * the magnitude of the acceleration vector, so it doesn't matter how the wrist is turned;
+//  * a high-pass filter (a running mean, subtracted) to remove gravity, and a [1 2 1] low-pass to remove
+//    sensor noise and the sharp edges of each impact;
+//  * peak detection: the signal must rise above a threshold, which follows the height of recent peaks, and
+//    fall back below zero; that's one step, unless it came too soon after the last one.
+// Steps are only counted once PEDOMETER_STEPS_TO_START of them arrive at a regular pace, so that waving a hand
+// or turning a steering wheel doesn't add up; after that, every step counts until the pace breaks.
+
+/// the rate the filters are tuned for; configure the accelerometer for LIS2DW_DATA_RATE_25_HZ.
+#define PEDOMETER_SAMPLE_RATE 25
+
+/// steps in a row it takes to decide the wearer is walking.
+#define PEDOMETER_STEPS_TO_START 4
+
+typedef enum {
+    PEDOMETER_ACTIVITY_STILL = 0,
+    PEDOMETER_ACTIVITY_WALK,
+    PEDOMETER_ACTIVITY_RUN,
+} pedometer_activity_t;
+
+typedef struct {
+    uint8_t steps;
+    pedometer_activity_t activity;
+} pedometer_minute_t;
+
+typedef struct {
+    int32_t baseline;           // running mean of the magnitude, in milli-g times 256
+    int16_t previous[2];        // the last two high-passed samples, for the low-pass filter
+    int16_t peak;               // the highest point since the signal rose above the threshold
+    int16_t envelope;           // running average of recent peak heights
+    uint16_t since_step;        // samples since the last step, saturating
+    bool above;                 // the signal has risen above the threshold and not yet fallen back below zero
+    bool walking;               // a regular run of steps is in progress, so each new step counts right away
+    uint8_t pending;            // steps seen while not yet walking
+    uint8_t settling;           // samples left before the filters have settled
+    uint16_t minute_steps;
+    uint16_t minute_samples;
+    uint32_t minute_energy;     // sum of the filtered signal's magnitude over the minute
+    uint32_t total_steps;       // since pedometer_init; the owner may reset it, say at midnight
+} pedometer_t;
+
+/** @brief Resets a pedometer, including its step count.
+  */
+void pedometer_init(pedometer_t *pedometer);
+
+/** @brief Resets the filters, but not the counts; for when samples were lost, as after a FIFO overrun.
+  */
+void pedometer_restart(pedometer_t *pedometer);
+
+/** @brief Runs a batch of raw readings, as lis2dw_read_fifo returns them, through the pipeline.
+  * @param pedometer The pedometer.
+  * @param readings Raw readings at PEDOMETER_SAMPLE_RATE, at the ±2g range.
+  * @param count The number of readings.
+  * @return The number of steps counted in this batch. (A step can be counted a few samples after it happened.)
+  */
+uint16_t pedometer_process(pedometer_t *pedometer, const lis2dw_reading_t *readings, uint8_t count);
+
+/** @brief Ends a minute: returns the steps counted in it and what the wearer was doing, and starts the next.
+  */
+pedometer_minute_t pedometer_finish_minute(pedometer_t *pedometer);
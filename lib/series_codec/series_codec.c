@@ -0,0 +1,108 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 Second Movement contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <string.h>
+#include "series_codec.h"
+
+static inline uint16_t _zigzag_encode(int16_t value) {
+    return ((uint16_t)value << 1) ^ (uint16_t)(value >> 15);
+}
+
+static inline int16_t _zigzag_decode(uint16_t value) {
+    return (int16_t)((value >> 1) ^ -(value & 1));
+}
+
+void series_codec_init(series_codec_state_t *state, uint8_t channels) {
+    memset(state, 0, sizeof(series_codec_state_t));
+    if (channels == 0) channels = 1;
+    if (channels > SERIES_CODEC_MAX_CHANNELS) channels = SERIES_CODEC_MAX_CHANNELS;
+    state->channels = channels;
+}
+
+size_t series_codec_put_varint(uint8_t *out, uint16_t value) {
+    size_t length = 0;
+    while (value >= 0x80) {
+        out[length++] = (value & 0x7f) | 0x80;
+        value >>= 7;
+    }
+    out[length++] = value;
+
+    return length;
+}
+
+size_t series_codec_get_varint(const uint8_t *in, size_t length, uint16_t *value) {
+    uint16_t result = 0;
+    for (size_t i = 0; i < length && i < 3; i++) {
+        result |= (uint16_t)(in[i] & 0x7f) << (7 * i);
+        if (!(in[i] & 0x80)) {
+            *value = result;
+            return i + 1;
+        }
+    }
+
+    return 0;
+}
+
+size_t series_codec_encode(series_codec_state_t *state, const int16_t *values, size_t count, uint8_t *out) {
+    size_t length = 0;
+    uint8_t channel = state->channel;
+
+    for (size_t i = 0; i < count; i++) {
+        // the subtraction wraps, and the decoder's addition wraps the same way, so every delta fits in 16 bits.
+        int16_t delta = (int16_t)(uint16_t)(values[i] - state->previous[channel]);
+        state->previous[channel] = values[i];
+        length += series_codec_put_varint(out + length, _zigzag_encode(delta));
+        if (++channel == state->channels) channel = 0;
+    }
+    state->channel = channel;
+
+    return length;
+}
+
+size_t series_codec_decode(series_codec_state_t *state, const uint8_t *in, size_t length, int16_t *values, size_t max_count) {
+    size_t count = 0;
+
+    for (size_t i = 0; i < length; i++) {
+        if (count == max_count) break;
+        state->partial_value |= (uint16_t)(in[i] & 0x7f) << state->partial_shift;
+        if (in[i] & 0x80) {
+            state->partial_shift += 7;
+            // a varint longer than three bytes can't come from the encoder; resynchronize on the next byte.
+            if (state->partial_shift > 14) {
+                state->partial_shift = 0;
+                state->partial_value = 0;
+            }
+            continue;
+        }
+
+        int16_t value = (int16_t)(uint16_t)(state->previous[state->channel] + _zigzag_decode(state->partial_value));
+        state->previous[state->channel] = value;
+        values[count++] = value;
+        if (++state->channel == state->channels) state->channel = 0;
+        state->partial_shift = 0;
+        state->partial_value = 0;
+    }
+
+    return count;
+}
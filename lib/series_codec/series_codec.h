@@ -0,0 +1,95 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 Second Movement contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+
+// A small streaming codec for logs of slowly-changing 16-bit samples: accelerometer axes, temperatures,
+// voltages, step counts. Each value is stored as the difference from the previous value on the same
+// channel, zigzag-mapped so that small negative deltas stay small, and written as a little-endian base-128
+// varint. A delta of -64..63 costs one byte, -8192..8191 two bytes, and nothing ever costs more than three.
+//
+// We use this rather than a general-purpose compressor like LZ77 because the data we log is numeric and
+// noisy; LZ matches are rare in it, and a match window eats RAM we don't have. This codec needs a dozen
+// bytes of state, no tables, and no division.
+//
+// Channels are interleaved: with three channels, values are x0, y0, z0, x1, y1, z1... and x1 is encoded
+// relative to x0. Encoder and decoder state can be carried across calls to process a stream in chunks.
+
+#define SERIES_CODEC_MAX_CHANNELS 8
+
+/// The most bytes that encoding count values can produce.
+#define SERIES_CODEC_MAX_ENCODED_SIZE(count) ((count) * 3)
+
+typedef struct {
+    int16_t previous[SERIES_CODEC_MAX_CHANNELS];
+    uint8_t channels;
+    uint8_t channel;
+    // decoder only: a varint that was split across two calls to series_codec_decode.
+    uint8_t partial_shift;
+    uint16_t partial_value;
+} series_codec_state_t;
+
+/** @brief Resets a codec state so that the next value on each channel is encoded relative to zero.
+  * @param state the state to initialize
+  * @param channels the number of interleaved channels, 1 to SERIES_CODEC_MAX_CHANNELS
+  */
+void series_codec_init(series_codec_state_t *state, uint8_t channels);
+
+/** @brief Encodes values, continuing the stream described by state.
+  * @param state an initialized codec state
+  * @param values the samples to encode
+  * @param count the number of samples
+  * @param out a buffer of at least SERIES_CODEC_MAX_ENCODED_SIZE(count) bytes
+  * @return the number of bytes written to out
+  */
+size_t series_codec_encode(series_codec_state_t *state, const int16_t *values, size_t count, uint8_t *out);
+
+/** @brief Decodes bytes produced by series_codec_encode, continuing the stream described by state.
+  * @param state an initialized codec state, with the same channel count that was used to encode
+  * @param in the encoded bytes
+  * @param length the number of encoded bytes
+  * @param values a buffer for the decoded samples
+  * @param max_count the capacity of values
+  * @return the number of samples written to values. If a varint is cut off at the end of the input, it
+  *         is held in state and completed on the next call. Decoding also stops when values is full; in
+  *         that case, the rest of the input is ignored.
+  */
+size_t series_codec_decode(series_codec_state_t *state, const uint8_t *in, size_t length, int16_t *values, size_t max_count);
+
+/** @brief Writes an unsigned value as a base-128 varint.
+  * @return the number of bytes written, 1 to 3.
+  */
+size_t series_codec_put_varint(uint8_t *out, uint16_t value);
+
+/** @brief Reads a base-128 varint.
+  * @param in the encoded bytes
+  * @param length the number of bytes available
+  * @param value receives the decoded value
+  * @return the number of bytes consumed, or 0 if the input ended before the varint did, or it was longer
+  *         than three bytes.
+  */
+size_t series_codec_get_varint(const uint8_t *in, size_t length, uint16_t *value);
@@ -0,0 +1,80 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 Second Movement contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include <string.h>
+#include "sleep_tracker.h"
+
+static sleep_tracker_bucket_t _sleep_tracker_open(uint32_t now) {
+    sleep_tracker_bucket_t bucket;
+
+    bucket.reg = 0;
+    bucket.bit.index = now / SLEEP_TRACKER_BUCKET_SECONDS;
+
+    return bucket;
+}
+
+static void _sleep_tracker_push(sleep_tracker_t *tracker, sleep_tracker_bucket_t bucket) {
+    if (tracker->count == SLEEP_TRACKER_RING_SIZE) {
+        // nobody has taken the buckets in two hours; make room by dropping the oldest.
+        tracker->first = (tracker->first + 1) % SLEEP_TRACKER_RING_SIZE;
+        tracker->count--;
+        if (tracker->dropped < 255) tracker->dropped++;
+    }
+    tracker->ring[(tracker->first + tracker->count) % SLEEP_TRACKER_RING_SIZE] = bucket;
+    tracker->count++;
+}
+
+void sleep_tracker_init(sleep_tracker_t *tracker, uint32_t now) {
+    memset(tracker, 0, sizeof(sleep_tracker_t));
+    tracker->current = _sleep_tracker_open(now);
+}
+
+void sleep_tracker_count(sleep_tracker_t *tracker, uint32_t now, uint16_t changes) {
+    uint32_t total = tracker->current.bit.changes + changes;
+
+    tracker->current.bit.changes = total > 255 ? 255 : total;
+
+    // this also covers the clock being set, forward or back: the open bucket ends, and a new one starts at now.
+    if (now / SLEEP_TRACKER_BUCKET_SECONDS != tracker->current.bit.index) {
+        _sleep_tracker_push(tracker, tracker->current);
+        tracker->current = _sleep_tracker_open(now);
+    }
+}
+
+void sleep_tracker_close(sleep_tracker_t *tracker) {
+    _sleep_tracker_push(tracker, tracker->current);
+}
+
+uint8_t sleep_tracker_take(sleep_tracker_t *tracker, sleep_tracker_bucket_t *buckets, uint8_t max_count) {
+    uint8_t taken = 0;
+
+    while (taken < max_count && tracker->count > 0) {
+        buckets[taken++] = tracker->ring[tracker->first];
+        tracker->first = (tracker->first + 1) % SLEEP_TRACKER_RING_SIZE;
+        tracker->count--;
+    }
+
+    return taken;
+}
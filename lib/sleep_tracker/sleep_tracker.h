@@ -0,0 +1,99 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 Second Movement contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#pragma once
+
+#include <stdint.h>
+
+// Sleep tracker:
+// Tallies the accelerometer's orientation changes (its 6D interrupt) into five minute buckets. A sleeper who
+// rolls over a few times an hour leaves mostly empty buckets; restless or waking periods fill them up. The
+// counting itself happens in an interrupt handler that only increments a counter; once a minute, the owner
+// hands the new changes to sleep_tracker_count, and once in a while takes the finished buckets out with
+// sleep_tracker_take to store them. Finished buckets wait in a small ring, so a missed store only costs the
+// oldest ones. The same code runs on the watch and in utils/sleep_tracker_replay on recorded nights.
+
+#define SLEEP_TRACKER_BUCKET_SECONDS (5 * 60)
+
+/// finished buckets the ring can hold: two hours' worth, so an hourly store has an hour to spare.
+#define SLEEP_TRACKER_RING_SIZE 24
+
+// Current budget:
+// Each orientation change wakes the processor from STANDBY for the interrupt handler and nothing else, for
+// about SLEEP_TRACKER_WAKE_MICROSECONDS at SLEEP_TRACKER_ACTIVE_MICROAMPS. An hour's buckets cost one filesystem
+// append, about SLEEP_TRACKER_STORE_MICROCOULOMBS. The accelerometer itself has to stay on to see orientation
+// changes. In low energy mode, where nights are spent, Movement runs it at its lowest data rate with its own
+// sleep on, and that holds with step counting enabled too, since step counting pauses there. While the watch is
+// awake with step counting on, the accelerometer runs at 25 Hz for the pedometer instead; that is step counting's
+// cost, so the budget leaves it out. Altogether, tracking should add less than SLEEP_TRACKER_BUDGET_NANOAMPS to
+// the watch's average current in low energy mode; utils/sleep_tracker_replay checks a night's events against
+// that. On hardware, compare the current in low energy mode with tracking on and off.
+#define SLEEP_TRACKER_WAKE_MICROSECONDS 30
+#define SLEEP_TRACKER_ACTIVE_MICROAMPS 250
+#define SLEEP_TRACKER_STORE_MICROCOULOMBS 50
+#define SLEEP_TRACKER_ACCELEROMETER_NANOAMPS 500    // LIS2DW low power mode 1 at 1.6 Hz, per the data sheet
+#define SLEEP_TRACKER_BUDGET_NANOAMPS 1000
+
+typedef union {
+    struct {
+        uint32_t changes : 8;   // orientation changes, saturating at 255
+        uint32_t index : 24;    // the bucket's start, in SLEEP_TRACKER_BUCKET_SECONDS since 1970
+    } bit;
+    uint32_t reg;
+} sleep_tracker_bucket_t;
+
+typedef struct {
+    sleep_tracker_bucket_t ring[SLEEP_TRACKER_RING_SIZE];
+    uint8_t first;              // the oldest finished bucket in the ring
+    uint8_t count;              // finished buckets waiting to be taken
+    uint8_t dropped;            // buckets lost because the ring was full, saturating; the owner may reset it
+    sleep_tracker_bucket_t current;
+} sleep_tracker_t;
+
+/** @brief Empties the tracker and opens the bucket containing a time.
+  * @param tracker The tracker.
+  * @param now The current UNIX time.
+  */
+void sleep_tracker_init(sleep_tracker_t *tracker, uint32_t now);
+
+/** @brief Adds orientation changes to the open bucket and, if now is past its end, finishes it and opens the
+  *        bucket containing now. Call it at least once per bucket, ideally at the top of every minute.
+  * @param tracker The tracker.
+  * @param now The current UNIX time; all of the changes happened before it.
+  * @param changes Orientation changes since the last call.
+  */
+void sleep_tracker_count(sleep_tracker_t *tracker, uint32_t now, uint16_t changes);
+
+/** @brief Finishes the open bucket early, as when tracking stops. Call sleep_tracker_init to start again.
+  */
+void sleep_tracker_close(sleep_tracker_t *tracker);
+
+/** @brief Moves finished buckets, oldest first, out of the ring.
+  * @param tracker The tracker.
+  * @param buckets Receives the buckets.
+  * @param max_count How many buckets fit in the buffer; SLEEP_TRACKER_RING_SIZE will always take them all.
+  * @return The number of buckets taken.
+  */
+uint8_t sleep_tracker_take(sleep_tracker_t *tracker, sleep_tracker_bucket_t *buckets, uint8_t max_count);
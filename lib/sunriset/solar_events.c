@@ -0,0 +1,129 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 Second Movement contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "solar_events.h"
+#include "sunriset_fixed.h"
+#include "watch_utility.h"
+
+// the altitude and limb for each pair of events, from sunrise/sunset outward. See sunriset_fixed.h.
+static const struct {
+    sunriset_angle_t altitude;
+    int upper_limb;
+} _solar_events_altitudes[SOLAR_EVENT_COUNT / 2] = {
+    { SUNRISET_ALTITUDE_RISE_SET, 1 },
+    { SUNRISET_ALTITUDE_CIVIL, 0 },
+    { SUNRISET_ALTITUDE_NAUTICAL, 0 },
+    { SUNRISET_ALTITUDE_ASTRONOMICAL, 0 },
+};
+
+static solar_events_t _solar_events[SOLAR_EVENTS_NUM_LOCATIONS];
+static uint8_t _solar_events_count;
+static uint8_t _solar_events_next_to_replace;
+// the local date that days[0] refers to, in days since 1970.
+static uint32_t _solar_events_today;
+
+// rounds seconds to the nearest minute. The times can be up to a day either side of 00:00 UTC, so offset them to
+// keep the division unsigned (and rounding down).
+static int16_t _solar_events_round_to_minutes(int32_t seconds) {
+    return (int16_t)((uint32_t)(seconds + 2 * 86400 + 30) / 60) - 2 * 1440;
+}
+
+void solar_events_compute_day(solar_events_day_t *events, uint16_t year, uint8_t month, uint8_t day, movement_location_t location) {
+    sunriset_angle_t lat = sunriset_fixed_angle_from_hundredths((int16_t)location.bit.latitude);
+    sunriset_angle_t lon = sunriset_fixed_angle_from_hundredths((int16_t)location.bit.longitude);
+
+    events->day_start = watch_utility_days_from_civil(year, month, day) * 86400;
+    events->stays_above = 0;
+
+    for (uint8_t i = 0; i < SOLAR_EVENT_COUNT / 2; i++) {
+        solar_event_t rise_event = SOLAR_EVENT_SUNRISE - i;
+        solar_event_t set_event = SOLAR_EVENT_SUNSET + i;
+        int32_t rise, set;
+        // rise and set come back as seconds after 00:00 UTC on this date.
+        int result = sunriset_fixed(year, month, day, lon, lat, _solar_events_altitudes[i].altitude, _solar_events_altitudes[i].upper_limb, &rise, &set);
+
+        if (result == 0) {
+            events->minutes[rise_event] = _solar_events_round_to_minutes(rise);
+            events->minutes[set_event] = _solar_events_round_to_minutes(set);
+        } else {
+            events->minutes[rise_event] = SOLAR_EVENT_NONE;
+            events->minutes[set_event] = SOLAR_EVENT_NONE;
+            if (result > 0) events->stays_above |= (1 << rise_event) | (1 << set_event);
+        }
+    }
+}
+
+static void _solar_events_compute_for_date(solar_events_day_t *events, uint32_t date, movement_location_t location) {
+    uint16_t year;
+    uint8_t month, day;
+
+    watch_utility_civil_from_days(date, &year, &month, &day);
+    solar_events_compute_day(events, year, month, day, location);
+}
+
+void solar_events_refresh(void) {
+    watch_date_time_t date_time = movement_get_local_date_time();
+    uint32_t today = watch_utility_days_from_civil(date_time.unit.year + WATCH_RTC_REFERENCE_YEAR, date_time.unit.month, date_time.unit.day);
+
+    if (today == _solar_events_today) return;
+
+    for (uint8_t i = 0; i < _solar_events_count; i++) {
+        solar_events_t *entry = &_solar_events[i];
+        // the usual case, just after midnight: yesterday's tomorrow is today.
+        if (today == _solar_events_today + 1) entry->days[0] = entry->days[1];
+        else _solar_events_compute_for_date(&entry->days[0], today, entry->location);
+        _solar_events_compute_for_date(&entry->days[1], today + 1, entry->location);
+    }
+
+    _solar_events_today = today;
+}
+
+const solar_events_t *solar_events_get(movement_location_t location) {
+    solar_events_refresh();
+
+    for (uint8_t i = 0; i < _solar_events_count; i++) {
+        if (_solar_events[i].location.reg == location.reg) return &_solar_events[i];
+    }
+
+    // not cached yet; take a free slot, or the one that was filled longest ago.
+    solar_events_t *entry;
+    if (_solar_events_count < SOLAR_EVENTS_NUM_LOCATIONS) {
+        entry = &_solar_events[_solar_events_count++];
+    } else {
+        entry = &_solar_events[_solar_events_next_to_replace];
+        _solar_events_next_to_replace = (_solar_events_next_to_replace + 1) % SOLAR_EVENTS_NUM_LOCATIONS;
+    }
+
+    entry->location = location;
+    _solar_events_compute_for_date(&entry->days[0], _solar_events_today, location);
+    _solar_events_compute_for_date(&entry->days[1], _solar_events_today + 1, location);
+
+    return entry;
+}
+
+uint32_t solar_events_get_time(const solar_events_day_t *events, solar_event_t event) {
+    if (events->minutes[event] == SOLAR_EVENT_NONE) return 0;
+
+    return events->day_start + (int32_t)events->minutes[event] * 60;
+}
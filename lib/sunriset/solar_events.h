@@ -0,0 +1,95 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 Second Movement contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "movement.h"
+
+// Solar events:
+// A shared cache of sunrise, sunset and the three twilights, for today and tomorrow in local time, for a handful
+// of locations. Even in fixed point, sunriset costs a few thousand cycles per event, so rather than have every
+// face that cares about the sun recompute them on every activation, the events are computed once per location
+// per day and kept here. Any face can read them with solar_events_get.
+//
+// When the local date changes, tomorrow's events become today's and only the new tomorrow is computed. A face
+// that wants this to happen ahead of time (rather than on the first read of the day) can ask for a background
+// task at local midnight and call solar_events_refresh from it; see sunrise_sunset_face for an example.
+
+// the number of locations to keep events for. Each costs 52 bytes of RAM.
+#define SOLAR_EVENTS_NUM_LOCATIONS 4
+
+typedef enum {
+    SOLAR_EVENT_ASTRONOMICAL_DAWN = 0,  // the Sun's center rises to 18 degrees below the horizon
+    SOLAR_EVENT_NAUTICAL_DAWN,          // 12 degrees below
+    SOLAR_EVENT_CIVIL_DAWN,             // 6 degrees below
+    SOLAR_EVENT_SUNRISE,                // the upper limb clears the horizon, allowing for refraction
+    SOLAR_EVENT_SUNSET,
+    SOLAR_EVENT_CIVIL_DUSK,
+    SOLAR_EVENT_NAUTICAL_DUSK,
+    SOLAR_EVENT_ASTRONOMICAL_DUSK,
+    SOLAR_EVENT_COUNT
+} solar_event_t;
+
+// stored in place of a time when the event doesn't happen on that day, as in polar summer or winter.
+#define SOLAR_EVENT_NONE INT16_MIN
+
+typedef struct {
+    uint32_t day_start;                 // UNIX time of 00:00 UTC on this calendar date
+    int16_t minutes[SOLAR_EVENT_COUNT]; // minutes after day_start (may be negative or past 1440), or SOLAR_EVENT_NONE
+    uint8_t stays_above;                // bit n set if the Sun stays above the altitude of event n all day
+} solar_events_day_t;
+
+typedef struct {
+    movement_location_t location;
+    solar_events_day_t days[2];         // today and tomorrow, by the local calendar
+} solar_events_t;
+
+/** @brief Computes the solar events for one calendar date and location. This is the expensive part; most code
+  *        should call solar_events_get instead.
+  * @param events Receives the events.
+  * @param year The year.
+  * @param month The month (1-12).
+  * @param day The day of the month.
+  * @param location The location.
+  */
+void solar_events_compute_day(solar_events_day_t *events, uint16_t year, uint8_t month, uint8_t day, movement_location_t location);
+
+/** @brief Returns today's and tomorrow's solar events for a location, computing them if they aren't cached.
+  * @param location The location, as stored in location.u32 or a face's own presets.
+  * @return A pointer into the cache. It stays valid until the next call to solar_events_get or solar_events_refresh.
+  */
+const solar_events_t *solar_events_get(movement_location_t location);
+
+/** @brief Brings every cached location up to the current local date. Call it from a background task at local
+  *        midnight, so that the first face to look in the morning doesn't pay for the computation.
+  */
+void solar_events_refresh(void);
+
+/** @brief Returns the UNIX time of an event, or 0 if it doesn't happen on that day.
+  * @param events The day to look in.
+  * @param event The event you want.
+  */
+uint32_t solar_events_get_time(const solar_events_day_t *events, solar_event_t event);
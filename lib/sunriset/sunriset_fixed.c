@@ -0,0 +1,262 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 Second Movement contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+// Based on SUNRISET.C by Paul Schlyter, released to the public domain in December 1992. The comments in sunriset.c
+// explain the astronomy; this file only changes the number representation.
+
+#include <stdbool.h>
+#include "sunriset_fixed.h"
+
+// unit values (sines, cosines, distances in AU, eccentricity) are Q2.30 fixed point.
+#define ONE (1L << 30)
+#define MUL(a, b) ((int32_t)(((int64_t)(a) * (b)) >> 30))
+
+#define HALF_TURN ((uint32_t)1 << 31)
+#define QUARTER_TURN ((int32_t)1 << 30)
+
+// the rate of a linear term, in binary angle units per day, times 256. Multiplied by a 16.16 day count and
+// shifted right 24, this gives an angle.
+#define PER_DAY(deg) ((int64_t)((deg) * (4294967296.0 / 360.0) * 256.0))
+// the same for a Q2.30 value.
+#define PER_DAY_Q30(x) ((int64_t)((x) * 1073741824.0 * 256.0))
+
+// 1/K, where K is the gain of the CORDIC, so rotations come out with unit length.
+#define CORDIC_INVERSE_GAIN 652032874
+// converts radians in Q2.30 to a binary angle, also in Q2.30: 2^32 / 2pi / 2^30.
+#define RADIANS_TO_ANGLE 683565276
+
+// atan(2^-i) as binary angles.
+static const int32_t _cordic_atan[] = {
+    536870912, 316933406, 167458907, 85004756, 42667331, 21354465, 10679838, 5340245,
+    2670163, 1335087, 667544, 333772, 166886, 83443, 41722, 20861,
+    10430, 5215, 2608, 1304, 652, 326, 163, 81,
+    41, 20, 10, 5, 3, 1
+};
+
+#define CORDIC_STEPS (sizeof(_cordic_atan) / sizeof(_cordic_atan[0]))
+
+/// Computes the cosine and sine of an angle, in Q2.30.
+static void _cordic_rotate(sunriset_angle_t angle, int32_t *cos_out, int32_t *sin_out) {
+    int32_t x = CORDIC_INVERSE_GAIN;
+    int32_t y = 0;
+    int32_t z = angle;
+    bool flip = false;
+
+    // the CORDIC only converges within about 99 degrees of zero; rotate the rest by half a turn.
+    if (z > QUARTER_TURN || z < -QUARTER_TURN) {
+        z = (int32_t)((uint32_t)z + HALF_TURN);
+        flip = true;
+    }
+
+    for (uint8_t i = 0; i < CORDIC_STEPS; i++) {
+        int32_t dx = y >> i;
+        int32_t dy = x >> i;
+        if (z >= 0) {
+            x -= dx;
+            y += dy;
+            z -= _cordic_atan[i];
+        } else {
+            x += dx;
+            y -= dy;
+            z += _cordic_atan[i];
+        }
+    }
+
+    *cos_out = flip ? -x : x;
+    *sin_out = flip ? -y : y;
+}
+
+/// Computes atan2(y, x) as a binary angle and, optionally, the length of (x, y). Inputs must be no longer than
+/// about 1.2 in Q2.30, so that the CORDIC's gain doesn't overflow.
+static sunriset_angle_t _cordic_vector(int32_t x, int32_t y, int32_t *length_out) {
+    uint32_t z = 0;
+
+    if (x < 0) {
+        x = -x;
+        y = -y;
+        z = HALF_TURN;
+    }
+
+    for (uint8_t i = 0; i < CORDIC_STEPS; i++) {
+        int32_t dx = y >> i;
+        int32_t dy = x >> i;
+        if (y < 0) {
+            x -= dx;
+            y += dy;
+            z -= _cordic_atan[i];
+        } else {
+            x += dx;
+            y -= dy;
+            z += _cordic_atan[i];
+        }
+    }
+
+    if (length_out) *length_out = MUL(x, CORDIC_INVERSE_GAIN);
+
+    return (sunriset_angle_t)z;
+}
+
+static uint32_t _isqrt64(uint64_t x) {
+    uint64_t result = 0;
+    uint64_t bit = (uint64_t)1 << 62;
+
+    while (bit > x) bit >>= 2;
+    while (bit) {
+        if (x >= result + bit) {
+            x -= result + bit;
+            result = (result >> 1) + bit;
+        } else {
+            result >>= 1;
+        }
+        bit >>= 2;
+    }
+
+    return (uint32_t)result;
+}
+
+/// Evaluates c0 + rate * d, where d is in days as 16.16 fixed point and rate comes from PER_DAY or PER_DAY_Q30.
+/// The result wraps around, so for angles this is also the reduction to one revolution.
+static uint32_t _linear(uint32_t c0, int64_t rate, int32_t d) {
+    return c0 + (uint32_t)((rate * d) >> 24);
+}
+
+/// Days since 2000 Jan 0.0, as in the days_since_2000_Jan_0 macro in sunriset.c; the divisions are by constants and
+/// only ever see small positive numbers, so they can be shifts.
+static int32_t _days_since_2000_jan_0(int year, int month, int day) {
+    return 367L * year - ((7 * (year + (month >= 3))) >> 2) + ((275 * month * 3641) >> 15) + day - 730530L;
+}
+
+/// The Sun's ecliptic longitude and distance at an instant; see sunpos in sunriset.c.
+static void _sunpos(int32_t d, uint32_t *lon, int32_t *r) {
+    uint32_t M = _linear(SUNRISET_DEGREES(356.0470), PER_DAY(0.9856002585), d);
+    uint32_t w = _linear(SUNRISET_DEGREES(282.9404), PER_DAY(4.70935E-5), d);
+    int32_t e = (int32_t)_linear((uint32_t)(0.016709 * ONE), PER_DAY_Q30(-1.151E-9), d);
+    int32_t cos_M, sin_M, cos_E, sin_E;
+
+    _cordic_rotate(M, &cos_M, &sin_M);
+    // E = M + e * sin(M) * (1 + e * cos(M)), in radians
+    int32_t correction = MUL(MUL(e, sin_M), ONE + MUL(e, cos_M));
+    uint32_t E = M + MUL(correction, RADIANS_TO_ANGLE);
+
+    _cordic_rotate(E, &cos_E, &sin_E);
+    int32_t x = cos_E - e;
+    // sqrt(1 - e^2) is 1 - e^2 / 2 to well within a part in 10^8 for an orbit this round.
+    int32_t y = MUL(ONE - MUL(e, e) / 2, sin_E);
+
+    uint32_t v = _cordic_vector(x, y, r);
+    *lon = v + w;
+}
+
+/// The Sun's right ascension, and the sine and cosine of its declination; see sun_RA_dec in sunriset.c.
+static void _sun_ra_dec(int32_t d, uint32_t *ra, int32_t *sin_dec, int32_t *cos_dec, int32_t *r) {
+    uint32_t lon;
+    uint32_t obl_ecl = _linear(SUNRISET_DEGREES(23.4393), PER_DAY(-3.563E-7), d);
+    int32_t cos_lon, sin_lon, cos_obl, sin_obl;
+
+    _sunpos(d, &lon, r);
+    _cordic_rotate(lon, &cos_lon, &sin_lon);
+    _cordic_rotate(obl_ecl, &cos_obl, &sin_obl);
+
+    // the distance doesn't change either angle, so work with the unit vector. Its length in the equatorial
+    // plane is the cosine of the declination.
+    *sin_dec = MUL(sin_lon, sin_obl);
+    *ra = _cordic_vector(cos_lon, MUL(sin_lon, cos_obl), cos_dec);
+}
+
+/// Computes the diurnal arc for the Sun to reach altit, as a binary angle; the Sun takes this long to travel from
+/// the altitude to the meridian. Returns -1 if it's always below altit, +1 if it's always above, 0 otherwise.
+static int _diurnal_arc(int32_t d, sunriset_angle_t lat, sunriset_angle_t altit, int upper_limb, uint32_t *ra, uint32_t *arc) {
+    int32_t sin_dec, cos_dec, r, cos_lat, sin_lat, cos_alt, sin_alt;
+
+    _sun_ra_dec(d, ra, &sin_dec, &cos_dec, &r);
+
+    if (upper_limb) {
+        // the Sun's apparent radius is 0.2666 degrees / r, and r is within 2% of 1 AU, so 0.2666 * (2 - r).
+        altit -= MUL(SUNRISET_DEGREES(0.2666), 2 * ONE - r);
+    }
+
+    _cordic_rotate(lat, &cos_lat, &sin_lat);
+    _cordic_rotate(altit, &cos_alt, &sin_alt);
+
+    // cos(arc) = num / den. Rather than divide, take acos(num / den) as atan2(sqrt(den^2 - num^2), num).
+    int32_t num = sin_alt - MUL(sin_lat, sin_dec);
+    int32_t den = MUL(cos_lat, cos_dec);
+
+    if (num >= den) {
+        *arc = 0;
+        return -1;
+    }
+    if (num <= -den) {
+        *arc = HALF_TURN;
+        return 1;
+    }
+
+    uint32_t opposite = _isqrt64((uint64_t)((int64_t)den * den - (int64_t)num * num));
+    *arc = (uint32_t)_cordic_vector(num, opposite, 0);
+
+    return 0;
+}
+
+/// Converts a binary angle to seconds of time, where a full revolution is 24 hours.
+static int32_t _angle_to_seconds(int64_t angle) {
+    return (int32_t)((angle * 86400) >> 32);
+}
+
+/// Days since 2000 Jan 0.0 at 12h local mean solar time, as 16.16 fixed point.
+static int32_t _local_noon(int year, int month, int day, sunriset_angle_t lon) {
+    // lon / 360 is just the top half of the binary angle.
+    return _days_since_2000_jan_0(year, month, day) * 65536 + 32768 - (lon >> 16);
+}
+
+sunriset_angle_t sunriset_fixed_angle_from_hundredths(int32_t hundredths) {
+    // 2^48 / 36000
+    return (sunriset_angle_t)(uint32_t)((hundredths * 7818749353LL) >> 16);
+}
+
+int sunriset_fixed(int year, int month, int day, sunriset_angle_t lon, sunriset_angle_t lat,
+                   sunriset_angle_t altit, int upper_limb, int32_t *trise, int32_t *tset) {
+    int32_t d = _local_noon(year, month, day, lon);
+    uint32_t ra, arc;
+
+    int rc = _diurnal_arc(d, lat, altit, upper_limb, &ra, &arc);
+
+    // the local sidereal time, and the time the Sun is at south, in seconds
+    uint32_t sidtime = _linear(SUNRISET_DEGREES(180.0 + 356.0470 + 282.9404 + 180.0), PER_DAY(0.9856002585 + 4.70935E-5), d) + lon;
+    int32_t tsouth = 43200 - _angle_to_seconds((int32_t)(sidtime - ra));
+    int32_t t = _angle_to_seconds(arc);
+
+    *trise = tsouth - t;
+    *tset = tsouth + t;
+
+    return rc;
+}
+
+int32_t daylen_fixed(int year, int month, int day, sunriset_angle_t lon, sunriset_angle_t lat,
+                     sunriset_angle_t altit, int upper_limb) {
+    uint32_t ra, arc;
+
+    _diurnal_arc(_local_noon(year, month, day, lon), lat, altit, upper_limb, &ra, &arc);
+
+    return 2 * _angle_to_seconds(arc);
+}
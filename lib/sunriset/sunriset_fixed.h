@@ -0,0 +1,83 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 Second Movement contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+// Fixed-point sunriset:
+// The same algorithm as Paul Schlyter's public domain SUNRISET.C (see sunriset.c), in integer math only, so that
+// computing a sunrise doesn't pull soft-double sin, cos, atan2, acos and sqrt into the firmware. Angles are binary
+// angles, where 2^32 is one full revolution, so reducing to 0..360 or -180..180 degrees is just integer overflow.
+// Trig goes through a 30-step CORDIC. Results agree with the double precision version to within a few seconds
+// between latitudes 65 S and 65 N; utils/sunriset_bench checks this over a year of dates and a sweep of locations.
+//
+// Dates must fall between 1911 and 2088 (days since 2000 are kept as a 16.16 fixed-point value), which covers
+// everything the watch's RTC can represent.
+
+// an angle, where 2^32 is one revolution. Interpret as int32_t for -180..180 degrees, uint32_t for 0..360.
+typedef int32_t sunriset_angle_t;
+
+// converts a constant number of degrees to a sunriset_angle_t at compile time. Don't use with a variable.
+#define SUNRISET_DEGREES(deg) ((sunriset_angle_t)(uint32_t)(int64_t)((deg) * (4294967296.0 / 360.0)))
+
+// the reference altitudes for sun_rise_set, and for civil, nautical and astronomical twilight.
+#define SUNRISET_ALTITUDE_RISE_SET SUNRISET_DEGREES(-35.0 / 60.0)
+#define SUNRISET_ALTITUDE_CIVIL SUNRISET_DEGREES(-6.0)
+#define SUNRISET_ALTITUDE_NAUTICAL SUNRISET_DEGREES(-12.0)
+#define SUNRISET_ALTITUDE_ASTRONOMICAL SUNRISET_DEGREES(-18.0)
+
+/** @brief Converts hundredths of a degree, as stored in movement_location_t, to a sunriset_angle_t.
+  * @param hundredths The angle in hundredths of a degree.
+  */
+sunriset_angle_t sunriset_fixed_angle_from_hundredths(int32_t hundredths);
+
+/** @brief Computes rise and set times for the Sun crossing an altitude; the fixed-point equivalent of __sunriset__.
+  * @param year The year.
+  * @param month The month (1-12).
+  * @param day The day of the month.
+  * @param lon Longitude, east positive.
+  * @param lat Latitude, north positive.
+  * @param altit The altitude the Sun should cross, e.g. SUNRISET_ALTITUDE_CIVIL.
+  * @param upper_limb Non-zero to time the upper limb (for sunrise and sunset), zero for the Sun's center.
+  * @param trise Receives the rise time, in seconds after 00:00 UTC on this date. May be negative.
+  * @param tset Receives the set time, in seconds after 00:00 UTC on this date. May be 86400 or more.
+  * @return 0 if the Sun crosses the altitude; +1 if it stays above all day and -1 if it stays below, in which
+  *         case the times are set the same way as __sunriset__ sets them.
+  */
+int sunriset_fixed(int year, int month, int day, sunriset_angle_t lon, sunriset_angle_t lat,
+                   sunriset_angle_t altit, int upper_limb, int32_t *trise, int32_t *tset);
+
+/** @brief Computes how long the Sun stays above an altitude; the fixed-point equivalent of __daylen__.
+  * @param year The year.
+  * @param month The month (1-12).
+  * @param day The day of the month.
+  * @param lon Longitude, east positive.
+  * @param lat Latitude, north positive.
+  * @param altit The altitude the Sun should cross, e.g. SUNRISET_ALTITUDE_RISE_SET.
+  * @param upper_limb Non-zero to time the upper limb, zero for the Sun's center.
+  * @return The length of the day in seconds, from 0 to 86400.
+  */
+int32_t daylen_fixed(int year, int month, int day, sunriset_angle_t lon, sunriset_angle_t lat,
+                     sunriset_angle_t altit, int upper_limb);
@@ -0,0 +1,99 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 Second Movement contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "trace.h"
+
+_Static_assert((TRACE_BUFFER_RECORDS & (TRACE_BUFFER_RECORDS - 1)) == 0, "TRACE_BUFFER_RECORDS must be a power of two");
+
+static trace_record_t trace_buffer[TRACE_BUFFER_RECORDS];
+static volatile uint16_t trace_oldest;
+static volatile uint16_t trace_next;
+
+// records come from interrupt callbacks as well as the main loop, and the Cortex-M0+ has no atomic
+// read-modify-write, so claiming a slot masks interrupts for the few instructions it takes.
+#if defined(__arm__)
+static inline uint32_t _trace_lock(void) {
+    uint32_t primask;
+    __asm__ volatile ("mrs %0, primask\n\tcpsid i" : "=r" (primask) :: "memory");
+    return primask;
+}
+
+static inline void _trace_unlock(uint32_t primask) {
+    __asm__ volatile ("msr primask, %0" :: "r" (primask) : "memory");
+}
+#else
+static inline uint32_t _trace_lock(void) {
+    return 0;
+}
+
+static inline void _trace_unlock(uint32_t primask) {
+    (void) primask;
+}
+#endif
+
+#if __EMSCRIPTEN__
+void trace_print(const char *format, int32_t a, int32_t b) {
+    printf(format, a, b);
+}
+#endif
+
+void trace_record(uint16_t id, int32_t a, int32_t b) {
+    uint32_t timestamp = trace_get_time();
+    uint32_t primask = _trace_lock();
+
+    uint16_t sequence = trace_next++;
+    if ((uint16_t)(trace_next - trace_oldest) > TRACE_BUFFER_RECORDS) trace_oldest++;
+    trace_record_t *record = &trace_buffer[sequence % TRACE_BUFFER_RECORDS];
+    record->timestamp = timestamp;
+    record->id = id;
+    record->sequence = sequence;
+    record->args[0] = a;
+    record->args[1] = b;
+
+    _trace_unlock(primask);
+}
+
+void trace_get_range(uint16_t *oldest, uint16_t *next) {
+    uint32_t primask = _trace_lock();
+    *oldest = trace_oldest;
+    *next = trace_next;
+    _trace_unlock(primask);
+}
+
+bool trace_get_record(uint16_t sequence, trace_record_t *record) {
+    uint32_t primask = _trace_lock();
+    bool present = (uint16_t)(sequence - trace_oldest) < (uint16_t)(trace_next - trace_oldest);
+    if (present) memcpy(record, &trace_buffer[sequence % TRACE_BUFFER_RECORDS], sizeof(trace_record_t));
+    _trace_unlock(primask);
+
+    return present;
+}
+
+void trace_clear(void) {
+    uint32_t primask = _trace_lock();
+    trace_oldest = trace_next;
+    _trace_unlock(primask);
+}
@@ -0,0 +1,100 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 Second Movement contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// Deferred binary tracing:
+// TRACE(format, ...) stores a 16-byte record in a RAM ring buffer: a timestamp, an event ID, a sequence number
+// and up to two integer arguments. Nothing is formatted on the watch. The format string goes in .trace_fmt, which
+// trace.ld makes a non-allocated section at address 0: the linker keeps it in the ELF but leaves it out of the
+// firmware image, and the event ID is the string's offset in that section. So a trace costs a few dozen cycles
+// and no flash for its text, and it's safe to call from an interrupt callback, cheap enough to leave in release
+// builds. Once the buffer is full, new records overwrite the oldest; the gaps show up in the sequence numbers.
+//
+// The `trace` shell command dumps the buffer as base64, and utils/trace_decode/trace_decode.py prints it against
+// the ELF of the same build. Arguments are stored as 32-bit integers, so use %d, %u, %x, %c and their l variants;
+// strings and floats aren't supported.
+//
+// In the simulator, where WebAssembly has no such sections, TRACE prints right away instead.
+
+// must be a power of two. 64 records are 1 KB of RAM.
+#ifndef TRACE_BUFFER_RECORDS
+#define TRACE_BUFFER_RECORDS 64
+#endif
+
+typedef struct {
+    uint32_t timestamp;     // from trace_get_time
+    uint16_t id;            // offset of the format string in .trace_fmt
+    uint16_t sequence;      // counts every record written, wrapping at 65536
+    int32_t args[2];
+} trace_record_t;
+
+#if __EMSCRIPTEN__
+
+#define TRACE(...) _TRACE_PRINT(__VA_ARGS__, 0, 0, 0)
+#define _TRACE_PRINT(format, a, b, ...) trace_print(format "\n", (int32_t)(a), (int32_t)(b))
+
+/** @brief Prints a trace in the simulator. Use the TRACE macro rather than calling this directly. */
+void trace_print(const char *format, int32_t a, int32_t b);
+
+#else
+
+#define TRACE(...) _TRACE_RECORD(__VA_ARGS__, 0, 0, 0)
+#define _TRACE_RECORD(format, a, b, ...) do { \
+    static const char _trace_format[] __attribute__((section(".trace_fmt"), used)) = format; \
+    trace_record((uint16_t)(uintptr_t)_trace_format, (int32_t)(a), (int32_t)(b)); \
+} while (0)
+
+#endif
+
+/** @brief Returns the time for a new record, e.g. a Unix timestamp. The application provides this; it's called
+  *        from interrupt context, so it should just return a value that's already at hand.
+  */
+uint32_t trace_get_time(void);
+
+/** @brief Stores a record. Use the TRACE macro rather than calling this directly.
+  * @param id The event ID.
+  * @param a The first argument, or 0.
+  * @param b The second argument, or 0.
+  */
+void trace_record(uint16_t id, int32_t a, int32_t b);
+
+/** @brief Gets the range of records in the buffer, by sequence number.
+  * @param oldest Receives the sequence number of the oldest record still in the buffer.
+  * @param next Receives the sequence number the next record will get. If it's equal to oldest, the buffer is empty.
+  */
+void trace_get_range(uint16_t *oldest, uint16_t *next);
+
+/** @brief Copies out a record, if it hasn't been overwritten yet.
+  * @param sequence The record's sequence number.
+  * @param record Receives the record.
+  * @return true if the record was still in the buffer; false otherwise.
+  */
+bool trace_get_record(uint16_t sequence, trace_record_t *record);
+
+/** @brief Empties the buffer. Sequence numbers carry on from where they were. */
+void trace_clear(void);
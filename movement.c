@@ -44,6 +44,7 @@
 #include "evsys.h"
 #include "delay.h"
 #include "thermistor_driver.h"
+#include "trace.h"
 
 #include "movement_config.h"
 
@@ -51,6 +52,7 @@
 
 #if __EMSCRIPTEN__
 #include <emscripten.h>
+#include "watch_sim_power.h"
 #else
 #include "watch_usb_cdc.h"
 #endif
@@ -65,6 +67,40 @@ movement_event_t event;
 int8_t _movement_dst_offset_cache[NUM_ZONE_NAMES] = {0};
 #define TIMEZONE_DOES_NOT_OBSERVE (-127)
 
+// Local calendars for the zones that faces have asked about recently (the local zone, plus one per world
+// clock on screen). Each one is carried forward a second at a time on the tick, instead of being converted
+// from the RTC on every call to movement_get_date_time_in_zone.
+#define MOVEMENT_NUM_ZONE_CLOCKS 4
+// a zone clock that nobody has asked for in this many seconds is no longer advanced on the tick.
+#define MOVEMENT_ZONE_CLOCK_IDLE_SECONDS 60
+
+typedef struct {
+    watch_utility_zone_clock_t clock;
+    uint32_t last_used;
+    uint8_t zone_index;
+} movement_zone_clock_t;
+
+static movement_zone_clock_t _movement_zone_clocks[MOVEMENT_NUM_ZONE_CLOCKS];
+
+// Step counting. Minutes with steps are buffered here and written to MOVEMENT_STEPS_FILE once an hour, or when
+// the buffer fills, rather than every minute.
+#define MOVEMENT_STEP_RECORD_BUFFER 16
+
+static pedometer_t _movement_pedometer;
+static pedometer_minute_t _movement_last_minute_activity;
+static movement_step_record_t _movement_step_records[MOVEMENT_STEP_RECORD_BUFFER];
+static uint8_t _movement_num_step_records;
+static lis2dw_data_rate_t _movement_rate_before_step_counting;
+// in low energy mode, when nothing drains the FIFO; see _movement_pause_step_counting.
+static bool _movement_step_counting_paused;
+static bool _movement_previous_minute_awake;
+
+// Sleep tracking. The A3 interrupt handler only increments _movement_orientation_changes; once a minute, the
+// changes since the last tally go to the tracker, and its finished buckets are stored once an hour.
+static sleep_tracker_t _movement_sleep_tracker;
+static volatile uint16_t _movement_orientation_changes;
+static uint16_t _movement_orientation_changes_tallied;
+
 void cb_mode_btn_interrupt(void);
 void cb_light_btn_interrupt(void);
 void cb_alarm_btn_interrupt(void);
@@ -102,11 +138,12 @@ static bool _movement_update_dst_offset_cache(void) {
     uzone_t local_zone;
     udatetime_t udate_time;
     bool dst_changed = false;
-    watch_date_time_t system_date_time = watch_rtc_get_date_time();
+    // convert the RTC once, rather than once per zone.
+    uint32_t now = watch_utility_date_time_to_unix_time(watch_rtc_get_date_time(), 0);
 
     for (uint8_t i = 0; i < NUM_ZONE_NAMES; i++) {
         unpack_zone(&zone_defns[i], "", &local_zone);
-        watch_date_time_t date_time = watch_utility_date_time_convert_zone(system_date_time, 0, local_zone.offset.hours * 3600 + local_zone.offset.minutes * 60);
+        watch_date_time_t date_time = watch_utility_date_time_from_unix_time(now, local_zone.offset.hours * 3600 + local_zone.offset.minutes * 60);
 
         if (!!local_zone.rules_len) {
             // if local zone has DST rules, we need to see if DST applies.
@@ -149,14 +186,241 @@ static inline void _movement_disable_fast_tick_if_possible(void) {
     }
 }
 
+// 256 conversions, averaged in hardware, take about a millisecond.
+#define MOVEMENT_BATTERY_SAMPLES 256
+
+static void _movement_update_battery_estimate(void) {
+    watch_adc_reading_t reading = { .pin = WATCH_ADC_VCC };
+    watch_get_analog_levels(&reading, 1, MOVEMENT_BATTERY_SAMPLES);
+    uint32_t sample = (uint32_t)reading.value << 4;
+
+    // exponential moving average with a weight of 1/4, i.e. a time constant of about four hours.
+    if (movement_state.battery_estimate == 0) movement_state.battery_estimate = sample;
+    else movement_state.battery_estimate = movement_state.battery_estimate - (movement_state.battery_estimate >> 2) + (sample >> 2);
+}
+
+uint16_t movement_get_battery_voltage(void) {
+    if (movement_state.battery_estimate == 0) _movement_update_battery_estimate();
+
+    return (movement_state.battery_estimate + 8) >> 4;
+}
+
+static uint32_t _movement_local_day_number(watch_date_time_t local) {
+    return watch_utility_days_from_civil(local.unit.year + WATCH_RTC_REFERENCE_YEAR, local.unit.month, local.unit.day);
+}
+
+static void _movement_count_dropped(uint8_t *dropped, uint16_t count) {
+    *dropped = (*dropped + count > 255) ? 255 : *dropped + count;
+}
+
+// Appends records to a log that starts with a uint32_t saying what it covers, starting it over if that's changed,
+// and keeping it to max_size. Returns the number of records stored.
+static uint16_t _movement_append_log(char *filename, uint32_t covers, void *records, uint16_t count, uint16_t record_size, int32_t max_size) {
+    uint32_t file_covers = 0;
+
+    filesystem_read_file_at(filename, (char *)&file_covers, 0, sizeof(file_covers));
+    if (file_covers != covers && !filesystem_write_file(filename, (char *)&covers, sizeof(covers))) return 0;
+
+    int32_t room = (max_size - filesystem_get_file_size(filename)) / record_size;
+    if (room <= 0) return 0;
+    if (count > room) count = room;
+
+    return filesystem_append_file(filename, (char *)records, count * record_size) ? count : 0;
+}
+
+static void _movement_flush_step_records(void) {
+    if (_movement_num_step_records == 0) return;
+
+    uint16_t stored = _movement_append_log(MOVEMENT_STEPS_FILE, movement_state.steps_date, _movement_step_records,
+                                           _movement_num_step_records, sizeof(movement_step_record_t),
+                                           MOVEMENT_STEPS_FILE_MAX_SIZE);
+    _movement_count_dropped(&movement_state.step_records_dropped, _movement_num_step_records - stored);
+    _movement_num_step_records = 0;
+}
+
+static void _movement_restore_steps_today(void) {
+    uint32_t file_date = 0;
+    movement_step_record_t record;
+    int32_t size = filesystem_get_file_size(MOVEMENT_STEPS_FILE);
+
+    // after a reset, pick up today's count from the log.
+    movement_state.steps_date = _movement_local_day_number(movement_get_local_date_time());
+    filesystem_read_file_at(MOVEMENT_STEPS_FILE, (char *)&file_date, 0, sizeof(file_date));
+    if (file_date != movement_state.steps_date) return;
+
+    for (int32_t offset = sizeof(file_date); offset + (int32_t)sizeof(record) <= size; offset += sizeof(record)) {
+        if (!filesystem_read_file_at(MOVEMENT_STEPS_FILE, (char *)&record, offset, sizeof(record))) break;
+        _movement_pedometer.total_steps += record.steps;
+    }
+}
+
+static void _movement_drain_accelerometer_fifo(void) {
+    static lis2dw_fifo_t fifo;
+
+    // an overrun means samples were lost, most likely while we were in low energy mode; start the filters over.
+    if (lis2dw_read_fifo(&fifo)) pedometer_restart(&_movement_pedometer);
+    if (fifo.count > 0) pedometer_process(&_movement_pedometer, fifo.readings, fifo.count);
+}
+
+static void _movement_finish_step_minute(void) {
+    watch_date_time_t local = movement_get_local_date_time();
+    // this runs at the top of the minute, so the minute that just ended is the one before this one.
+    uint16_t minute_of_day = local.unit.hour * 60 + local.unit.minute;
+
+    _movement_last_minute_activity = pedometer_finish_minute(&_movement_pedometer);
+    if (_movement_step_counting_paused && _movement_last_minute_activity.steps == 0) {
+        // no samples in low energy mode, so go by the accelerometer's sleep state on A4 (low while it's awake)
+        // and, to skip the odd bump, only count a minute as active if the one before it was too.
+        bool awake = !HAL_GPIO_A4_read();
+        if (awake && _movement_previous_minute_awake) _movement_last_minute_activity.activity = PEDOMETER_ACTIVITY_WALK;
+        _movement_previous_minute_awake = awake;
+    }
+    if (_movement_last_minute_activity.steps) {
+        movement_step_record_t *record = &_movement_step_records[_movement_num_step_records++];
+        record->minute = minute_of_day ? minute_of_day - 1 : 24 * 60 - 1;
+        record->steps = _movement_last_minute_activity.steps;
+        record->activity = _movement_last_minute_activity.activity;
+    }
+
+    if (minute_of_day == 0) {
+        // midnight: close out yesterday, and start counting today.
+        _movement_flush_step_records();
+        movement_state.steps_date = _movement_local_day_number(local);
+        _movement_pedometer.total_steps = 0;
+    } else if (local.unit.minute == 0 || _movement_num_step_records == MOVEMENT_STEP_RECORD_BUFFER) {
+        _movement_flush_step_records();
+    }
+}
+
+static uint16_t _movement_take_orientation_changes(void) {
+    // the interrupt handler is the only one that writes the count, so take the difference rather than resetting it.
+    uint16_t changes = _movement_orientation_changes;
+    uint16_t new_changes = changes - _movement_orientation_changes_tallied;
+
+    _movement_orientation_changes_tallied = changes;
+
+    return new_changes;
+}
+
+static void _movement_store_sleep_buckets(void) {
+    sleep_tracker_bucket_t buckets[SLEEP_TRACKER_RING_SIZE];
+    uint8_t count = sleep_tracker_take(&_movement_sleep_tracker, buckets, SLEEP_TRACKER_RING_SIZE);
+
+    // buckets the ring had no room for are lost too.
+    _movement_count_dropped(&movement_state.sleep_buckets_dropped, _movement_sleep_tracker.dropped);
+    _movement_sleep_tracker.dropped = 0;
+    if (count == 0) return;
+
+    // nights run from noon to noon, so a file never starts over in the middle of one. Go by the last bucket, so
+    // that the buckets stored at noon still count toward the night that's ending.
+    uint32_t end = buckets[count - 1].bit.index * SLEEP_TRACKER_BUCKET_SECONDS;
+    uint32_t night = (end + movement_get_current_timezone_offset() - 12 * 60 * 60) / (24 * 60 * 60);
+
+    uint16_t stored = _movement_append_log(MOVEMENT_SLEEP_FILE, night, buckets, count, sizeof(sleep_tracker_bucket_t),
+                                           MOVEMENT_SLEEP_FILE_MAX_SIZE);
+    _movement_count_dropped(&movement_state.sleep_buckets_dropped, count - stored);
+}
+
+static lis2dw_data_rate_t _movement_accelerometer_data_rate(lis2dw_data_rate_t background_rate) {
+    // orientation changes only happen while the accelerometer is sampling; the lowest rate is enough to see them.
+    if (movement_state.sleep_tracking_enabled && background_rate == LIS2DW_DATA_RATE_POWERDOWN) {
+        return LIS2DW_DATA_RATE_LOWEST;
+    }
+
+    return background_rate;
+}
+
+#ifndef MOVEMENT_LOW_ENERGY_MODE_FORBIDDEN
+
+// Nothing drains the FIFO in low energy mode, so there's no point sampling at 25 Hz: let the accelerometer sleep
+// at its lowest rate until we wake, which keeps its sleep state on A4 current for _movement_finish_step_minute.
+static void _movement_pause_step_counting(void) {
+    if (!movement_state.step_counting_enabled) return;
+
+    _movement_step_counting_paused = true;
+    _movement_previous_minute_awake = false;
+    // with tap detection on, the FIFO is already off, and the data rate isn't ours to change.
+    if (movement_state.tap_detection_enabled) return;
+
+    lis2dw_configure_fifo(LIS2DW_FIFO_MODE_OFF, 0);
+    lis2dw_set_data_rate(LIS2DW_DATA_RATE_LOWEST);
+    lis2dw_enable_sleep();
+}
+
+static void _movement_resume_step_counting(void) {
+    if (!_movement_step_counting_paused) return;
+
+    _movement_step_counting_paused = false;
+#ifdef I2C_SERCOM
+    // low energy mode turned the I2C pins off along with the rest.
+    watch_enable_i2c();
+#endif
+    if (movement_state.tap_detection_enabled) return;
+
+    lis2dw_disable_sleep();
+    lis2dw_set_data_rate(_movement_accelerometer_data_rate(movement_state.accelerometer_background_rate));
+    pedometer_restart(&_movement_pedometer);
+    lis2dw_configure_fifo(LIS2DW_FIFO_MODE_COLLECT_CONTINUOUS, 0);
+}
+
+#endif
+
+static void _movement_update_unix_time(watch_date_time_t date_time) {
+    uint32_t minute = date_time.reg >> 6;
+
+    // once a minute, or whenever someone sets the clock, find the unix time at the start of the minute.
+    // thanks to the day cache, this only converts the date once a day.
+    if (minute != movement_state.unix_time_minute) {
+        date_time.unit.second = 0;
+        movement_state.unix_time_minute = minute;
+        movement_state.unix_time_minute_start = watch_utility_date_time_to_unix_time_cached(date_time, 0, &movement_state.unix_time_day_cache);
+    }
+
+    movement_state.unix_time = movement_state.unix_time_minute_start + date_time.unit.second;
+}
+
+static watch_date_time_t _movement_update_zone_clock(movement_zone_clock_t *zone_clock) {
+    // the offset comes from the DST cache, so a DST change shows up here as a new offset and forces a rebuild.
+    int32_t offset = movement_get_current_timezone_offset_for_zone(zone_clock->zone_index);
+    return watch_utility_zone_clock_update(&zone_clock->clock, movement_state.unix_time, offset);
+}
+
+static void _movement_advance_zone_clocks(void) {
+    for (uint8_t i = 0; i < MOVEMENT_NUM_ZONE_CLOCKS; i++) {
+        movement_zone_clock_t *zone_clock = &_movement_zone_clocks[i];
+        if (zone_clock->clock.date_time.reg == 0) continue;
+        if (movement_state.unix_time - zone_clock->last_used > MOVEMENT_ZONE_CLOCK_IDLE_SECONDS) continue;
+        _movement_update_zone_clock(zone_clock);
+    }
+}
+
 static void _movement_handle_top_of_minute(void) {
     watch_date_time_t date_time = watch_rtc_get_date_time();
 
+    // ticks don't run in low energy mode, so this is what keeps the unix time current while we sleep.
+    _movement_update_unix_time(date_time);
+
     // update the DST offset cache every 30 minutes, since someplace in the world could change.
     if (date_time.unit.minute % 30 == 0) {
         _movement_update_dst_offset_cache();
     }
 
+    // and fold a fresh battery reading into the running estimate once an hour.
+    if (date_time.unit.minute == 0) {
+        _movement_update_battery_estimate();
+    }
+
+    // close out the minute's step count before faces ask for it in their advisories.
+    if (movement_state.step_counting_enabled) {
+        _movement_finish_step_minute();
+    }
+
+    // tally the minute's orientation changes; this runs in low energy mode too, which is where most nights are spent.
+    if (movement_state.sleep_tracking_enabled) {
+        sleep_tracker_count(&_movement_sleep_tracker, movement_state.unix_time, _movement_take_orientation_changes());
+        if (date_time.unit.minute == 0) _movement_store_sleep_buckets();
+    }
+
     for(uint8_t i = 0; i < MOVEMENT_NUM_FACES; i++) {
         // For each face that offers an advisory...
         if (watch_faces[i].advise != NULL) {
@@ -405,19 +669,45 @@ watch_date_time_t movement_get_utc_date_time(void) {
 }
 
 watch_date_time_t movement_get_date_time_in_zone(uint8_t zone_index) {
-    int32_t offset = movement_get_current_timezone_offset_for_zone(zone_index);
-    return watch_utility_date_time_convert_zone(watch_rtc_get_date_time(), 0, offset);
+    movement_zone_clock_t *zone_clock = NULL;
+    movement_zone_clock_t *least_recently_used = &_movement_zone_clocks[0];
+
+    for (uint8_t i = 0; i < MOVEMENT_NUM_ZONE_CLOCKS; i++) {
+        movement_zone_clock_t *candidate = &_movement_zone_clocks[i];
+        if (candidate->clock.date_time.reg != 0 && candidate->zone_index == zone_index) {
+            zone_clock = candidate;
+            break;
+        }
+        if (movement_state.unix_time - candidate->last_used > movement_state.unix_time - least_recently_used->last_used) {
+            least_recently_used = candidate;
+        }
+    }
+
+    if (zone_clock == NULL) {
+        // not a zone we're tracking yet; take over the slot that has gone longest without being asked for.
+        zone_clock = least_recently_used;
+        memset(zone_clock, 0, sizeof(movement_zone_clock_t));
+        zone_clock->zone_index = zone_index;
+    }
+
+    zone_clock->last_used = movement_state.unix_time;
+
+    return _movement_update_zone_clock(zone_clock);
 }
 
 watch_date_time_t movement_get_local_date_time(void) {
-    watch_date_time_t date_time = watch_rtc_get_date_time();
-    return watch_utility_date_time_convert_zone(date_time, 0, movement_get_current_timezone_offset());
+    return movement_get_date_time_in_zone(movement_state.settings.bit.time_zone);
 }
 
 void movement_set_local_date_time(watch_date_time_t date_time) {
     int32_t current_offset = movement_get_current_timezone_offset();
-    watch_date_time_t utc_date_time = watch_utility_date_time_convert_zone(date_time, current_offset, 0);
-    watch_rtc_set_date_time(utc_date_time);
+    movement_set_utc_date_time(watch_utility_date_time_convert_zone(date_time, current_offset, 0));
+}
+
+void movement_set_utc_date_time(watch_date_time_t date_time) {
+    watch_rtc_set_date_time(date_time);
+    // the unix time is only resynchronized to the RTC once a minute, so bring it along now.
+    _movement_update_unix_time(date_time);
 
     // this may seem wasteful, but if the user's local time is in a zone that observes DST,
     // they may have just crossed a DST boundary, which means the next call to this function
@@ -425,6 +715,18 @@ void movement_set_local_date_time(watch_date_time_t date_time) {
     _movement_update_dst_offset_cache();
 }
 
+uint32_t movement_get_unix_time(void) {
+    return movement_state.unix_time;
+}
+
+uint32_t trace_get_time(void) {
+    return movement_state.unix_time;
+}
+
+uint8_t movement_get_subsecond(void) {
+    return movement_state.subsecond;
+}
+
 bool movement_button_should_sound(void) {
     return movement_state.settings.bit.button_should_sound;
 }
@@ -527,6 +829,11 @@ bool movement_enable_tap_detection_if_available(void) {
 
         // enable tap detection on INT1/A3.
         lis2dw_configure_int1(LIS2DW_CTRL4_INT1_SINGLE_TAP | LIS2DW_CTRL4_INT1_6D);
+        movement_state.tap_detection_enabled = true;
+
+        // at 400 Hz the FIFO would overrun between drains, and the pedometer's filters are tuned for 25 Hz
+        // anyway; stop collecting until tap detection ends.
+        if (movement_state.step_counting_enabled) lis2dw_configure_fifo(LIS2DW_FIFO_MODE_OFF, 0);
 
         return true;
     }
@@ -538,10 +845,19 @@ bool movement_disable_tap_detection_if_available(void) {
     if (movement_state.has_lis2dw) {
         // Ramp data rate back down to the usual lowest rate to save power.
         lis2dw_set_low_noise_mode(false);
-        lis2dw_set_data_rate(movement_state.accelerometer_background_rate);
+        lis2dw_set_data_rate(_movement_accelerometer_data_rate(movement_state.accelerometer_background_rate));
         lis2dw_set_mode(LIS2DW_MODE_LOW_POWER);
         // ...disable Z axis (not sure if this is needed, does this save power?)...
         lis2dw_configure_tap_threshold(0, 0, 0, 0);
+        // ...and leave INT1 with just the orientation changes, if sleep tracking wants them.
+        lis2dw_configure_int1(movement_state.sleep_tracking_enabled ? LIS2DW_CTRL4_INT1_6D : 0);
+        movement_state.tap_detection_enabled = false;
+
+        // back at the background rate, so pick step counting up again with fresh filters.
+        if (movement_state.step_counting_enabled) {
+            pedometer_restart(&_movement_pedometer);
+            lis2dw_configure_fifo(LIS2DW_FIFO_MODE_COLLECT_CONTINUOUS, 0);
+        }
 
         return true;
     }
@@ -549,6 +865,100 @@ bool movement_disable_tap_detection_if_available(void) {
     return false;
 }
 
+bool movement_enable_step_counting_if_available(void) {
+    if (!movement_state.has_lis2dw) return false;
+    if (movement_state.step_counting_enabled) return true;
+
+    pedometer_init(&_movement_pedometer);
+    _movement_restore_steps_today();
+
+    // the accelerometer's own sleep mode drops to 1.6 Hz until it sees a 1 g jolt, which a walking wrist
+    // doesn't always deliver; keep it at the pedometer's rate instead.
+    lis2dw_disable_sleep();
+    _movement_rate_before_step_counting = movement_state.accelerometer_background_rate;
+    movement_set_accelerometer_background_rate(LIS2DW_DATA_RATE_25_HZ);
+    // if a face has tap detection on, the FIFO starts when it turns it off.
+    if (!movement_state.tap_detection_enabled) lis2dw_configure_fifo(LIS2DW_FIFO_MODE_COLLECT_CONTINUOUS, 0);
+    movement_state.step_counting_enabled = true;
+
+    return true;
+}
+
+bool movement_disable_step_counting_if_available(void) {
+    if (!movement_state.step_counting_enabled) return false;
+
+    _movement_flush_step_records();
+    lis2dw_configure_fifo(LIS2DW_FIFO_MODE_OFF, 0);
+    movement_set_accelerometer_background_rate(_movement_rate_before_step_counting);
+    lis2dw_enable_sleep();
+    movement_state.step_counting_enabled = false;
+
+    return true;
+}
+
+uint8_t movement_get_dropped_step_records(void) {
+    return movement_state.step_records_dropped;
+}
+
+uint32_t movement_get_steps_today(void) {
+    if (!movement_state.step_counting_enabled) return 0;
+
+    return _movement_pedometer.total_steps;
+}
+
+pedometer_minute_t movement_get_last_minute_activity(void) {
+    return _movement_last_minute_activity;
+}
+
+bool movement_enable_sleep_tracking_if_available(void) {
+#ifdef FILESYSTEM_EXTERNAL_FLASH
+    // A3 is the flash chip select on these boards, so the accelerometer's INT1 never reaches us.
+    return false;
+#else
+    if (!movement_state.has_lis2dw) return false;
+    if (movement_state.sleep_tracking_enabled) return true;
+
+    sleep_tracker_init(&_movement_sleep_tracker, movement_get_unix_time());
+    _movement_take_orientation_changes();
+    movement_state.sleep_tracking_enabled = true;
+
+    // without latching, each orientation change is a pulse on INT1, so the A3 handler never has to ask the
+    // accelerometer what happened; that's what lets it run in low energy mode, with the I2C pins off.
+    if (!movement_state.tap_detection_enabled) {
+        lis2dw_configure_int1(LIS2DW_CTRL4_INT1_6D);
+        lis2dw_set_data_rate(_movement_accelerometer_data_rate(movement_state.accelerometer_background_rate));
+    }
+    watch_set_sleep_mode_external_interrupts(true);
+
+    return true;
+#endif
+}
+
+bool movement_disable_sleep_tracking_if_available(void) {
+    if (!movement_state.sleep_tracking_enabled) return false;
+
+    sleep_tracker_count(&_movement_sleep_tracker, movement_get_unix_time(), _movement_take_orientation_changes());
+    sleep_tracker_close(&_movement_sleep_tracker);
+    _movement_store_sleep_buckets();
+    movement_state.sleep_tracking_enabled = false;
+
+    watch_set_sleep_mode_external_interrupts(false);
+    if (!movement_state.tap_detection_enabled) {
+        lis2dw_configure_int1(0);
+        lis2dw_set_data_rate(_movement_accelerometer_data_rate(movement_state.accelerometer_background_rate));
+    }
+
+    return true;
+}
+
+uint16_t movement_get_orientation_changes(void) {
+    return _movement_orientation_changes;
+}
+
+uint8_t movement_get_dropped_sleep_buckets(void) {
+    return movement_state.sleep_buckets_dropped;
+}
+
 lis2dw_data_rate_t movement_get_accelerometer_background_rate(void) {
     if (movement_state.has_lis2dw) return movement_state.accelerometer_background_rate;
     else return LIS2DW_DATA_RATE_POWERDOWN;
@@ -557,7 +967,8 @@ lis2dw_data_rate_t movement_get_accelerometer_background_rate(void) {
 bool movement_set_accelerometer_background_rate(lis2dw_data_rate_t new_rate) {
     if (movement_state.has_lis2dw) {
         if (movement_state.accelerometer_background_rate != new_rate) {
-            lis2dw_set_data_rate(new_rate);
+            // tap detection owns the data rate while it's on; the new rate takes effect when it's turned off.
+            if (!movement_state.tap_detection_enabled) lis2dw_set_data_rate(_movement_accelerometer_data_rate(new_rate));
             movement_state.accelerometer_background_rate = new_rate;
 
             return true;
@@ -583,6 +994,25 @@ float movement_get_temperature(void) {
     return temperature_c;
 }
 
+bool movement_get_thermistor_calibration(thermistor_calibration_t *calibration) {
+    memset(calibration, 0, sizeof(thermistor_calibration_t));
+    if (filesystem_get_file_size(MOVEMENT_THERMISTOR_CALIBRATION_FILE) != sizeof(thermistor_calibration_t)) return false;
+
+    return filesystem_read_file(MOVEMENT_THERMISTOR_CALIBRATION_FILE, (char *)calibration, sizeof(thermistor_calibration_t));
+}
+
+bool movement_set_thermistor_calibration(const thermistor_calibration_t *calibration) {
+    if (!movement_state.has_thermistor) return false;
+
+    thermistor_driver_set_calibration(calibration);
+    if (calibration == NULL || calibration->num_points == 0) {
+        if (filesystem_file_exists(MOVEMENT_THERMISTOR_CALIBRATION_FILE)) return filesystem_rm(MOVEMENT_THERMISTOR_CALIBRATION_FILE);
+        return true;
+    }
+
+    return filesystem_write_file(MOVEMENT_THERMISTOR_CALIBRATION_FILE, (char *)calibration, sizeof(thermistor_calibration_t));
+}
+
 void app_init(void) {
     _watch_init();
 
@@ -600,6 +1030,10 @@ void app_init(void) {
     memset(&movement_state, 0, sizeof(movement_state));
 
     movement_state.has_thermistor = thermistor_driver_init();
+    if (movement_state.has_thermistor) {
+        thermistor_calibration_t calibration;
+        if (movement_get_thermistor_calibration(&calibration)) thermistor_driver_set_calibration(&calibration);
+    }
 
     bool settings_file_exists = filesystem_file_exists("settings.u32");
     movement_settings_t maybe_settings;
@@ -704,6 +1138,9 @@ void app_setup(void) {
         watch_rtc_register_alarm_callback(cb_alarm_fired, alarm_time, ALARM_MATCH_SS);
     }
 
+    // we may have been asleep for a while; bring the unix time up to date before any face asks for it.
+    _movement_update_unix_time(watch_rtc_get_date_time());
+
     // LCD autodetect uses the buttons as a a failsafe, so we should run it before we enable the button interrupts
     watch_enable_display();
 
@@ -732,12 +1169,9 @@ void app_setup(void) {
                 lis2dw_configure_6d_threshold(3);               // 0-3 is 80, 70, 60, or 50 degrees. 50 is least precise, hopefully most sensitive?
 
                 // set up interrupts:
-                // INT1 is wired to pin A3. We'll configure the accelerometer to output an interrupt on INT1 when it detects an orientation change.
-                /// TODO: We had routed this interrupt to TC2 to count orientation changes, but TC2 consumed too much power.
-                /// Orientation changes helped with sleep tracking; would love to bring this back if we can find a low power solution.
-                /// For now, commenting these lines out; check commit 27f0c629d865f4bc56bc6e678da1eb8f4b919093 for power-hungry but working code.
-                // lis2dw_configure_int1(LIS2DW_CTRL4_INT1_6D);
-                // HAL_GPIO_A3_in();
+                // INT1 is wired to pin A3. Nothing is routed to it until tap detection or sleep tracking asks for it.
+                // (Counting orientation changes with TC2 drew too much power; sleep tracking counts them in the A3
+                // interrupt handler instead, which can keep running in low energy mode.)
 
                 // next: INT2 is wired to pin A4. We'll configure the accelerometer to output the sleep state on INT2.
                 // a falling edge on INT2 indicates the accelerometer has woken up.
@@ -748,10 +1182,6 @@ void app_setup(void) {
                 // Still if you want to wake on motion, you can do it by uncommenting this line:
                 // watch_register_extwake_callback(HAL_GPIO_A4_pin(), cb_accelerometer_wake, false);
 
-                // later on, we are going to use INT1 for tap detection. We'll set up that interrupt here,
-                // but it will only fire once tap recognition is enabled.
-                watch_register_interrupt_callback(HAL_GPIO_A3_pin(), cb_accelerometer_event, INTERRUPT_TRIGGER_RISING);
-
                 // Enable the interrupts...
                 lis2dw_enable_interrupts();
 
@@ -764,6 +1194,15 @@ void app_setup(void) {
                 watch_disable_i2c();
             }
         }
+
+        // the A3 interrupt, for tap detection and sleep tracking, only fires once one of them routes something to INT1.
+        // Like the buttons', it has to be registered again each time external interrupts are enabled.
+        // (On boards with SPI flash, A3 is the flash chip select instead, so neither is available there.)
+#ifndef FILESYSTEM_EXTERNAL_FLASH
+        if (movement_state.has_lis2dw) {
+            watch_register_interrupt_callback(HAL_GPIO_A3_pin(), cb_accelerometer_event, INTERRUPT_TRIGGER_RISING);
+        }
+#endif
 #endif
 
         watch_enable_buzzer();
@@ -813,6 +1252,9 @@ bool app_loop(void) {
         }
         wf->resign(watch_face_contexts[movement_state.current_face_idx]);
         movement_state.current_face_idx = movement_state.next_face_idx;
+#if __EMSCRIPTEN__
+        watch_sim_power_set_face(movement_state.current_face_idx);
+#endif
         // we have just updated the face idx, so we must recache the watch face pointer.
         wf = &watch_faces[movement_state.current_face_idx];
         watch_clear_display();
@@ -836,6 +1278,17 @@ bool app_loop(void) {
     // handle top-of-minute tasks, if the alarm handler told us we need to
     if (movement_state.woke_from_alarm_handler) _movement_handle_top_of_minute();
 
+    // carry the zone clocks forward before the face asks for them. (Not in cb_tick, which runs in interrupt
+    // context and could land in the middle of movement_get_date_time_in_zone.)
+    if (event.event_type == EVENT_TICK) _movement_advance_zone_clocks();
+
+    // the FIFO holds 32 samples, a little over a second at 25 Hz, so drain it once a second. (It's off while
+    // tap detection has the accelerometer at 400 Hz.)
+    if (event.event_type == EVENT_TICK && movement_state.subsecond == 0 && movement_state.step_counting_enabled &&
+        !movement_state.tap_detection_enabled) {
+        _movement_drain_accelerometer_fifo();
+    }
+
     // if we have a scheduled background task, handle that here:
     if (event.event_type == EVENT_TICK && movement_state.has_scheduled_background_task) _movement_handle_scheduled_tasks();
 
@@ -849,6 +1302,7 @@ bool app_loop(void) {
 
         // _sleep_mode_app_loop takes over at this point and loops until le_mode_ticks is reset by the extwake handler,
         // or wake is requested using the movement_request_wake function.
+        _movement_pause_step_counting();
         _sleep_mode_app_loop();
         // as soon as _sleep_mode_app_loop returns, we prepare to reactivate
         // ourselves, but first, we check to see if we woke up for the buzzer:
@@ -859,6 +1313,7 @@ bool app_loop(void) {
         // this is a hack tho: waking from sleep mode, app_setup does get called, but it happens before we have reset our ticks.
         // need to figure out if there's a better heuristic for determining how we woke up.
         app_setup();
+        _movement_resume_step_counting();
     }
 #endif
 
@@ -1031,21 +1486,33 @@ void cb_tick(void) {
 
         movement_state.last_second = date_time.unit.second;
         movement_state.subsecond = 0;
+        _movement_update_unix_time(date_time);
     } else {
         movement_state.subsecond++;
     }
 }
 
 void cb_accelerometer_event(void) {
+    // unless tap detection is on, INT1 only carries orientation changes, so count them without a trip over I2C.
+    // This also runs in low energy mode, where the I2C pins are off.
+    if (!movement_state.tap_detection_enabled || movement_state.le_mode_ticks == -1) {
+        _movement_orientation_changes++;
+        return;
+    }
+
     uint8_t int_src = lis2dw_get_interrupt_source();
 
+    if (int_src & LIS2DW_REG_ALL_INT_SRC_6D_IA) {
+        _movement_orientation_changes++;
+    }
+
     if (int_src & LIS2DW_REG_ALL_INT_SRC_DOUBLE_TAP) {
         event.event_type = EVENT_DOUBLE_TAP;
-        printf("Double tap!\n");
+        TRACE("Double tap! (INT source 0x%02x)", int_src);
     }
     if (int_src & LIS2DW_REG_ALL_INT_SRC_SINGLE_TAP) {
         event.event_type = EVENT_SINGLE_TAP;
-        printf("Single tap!\n");
+        TRACE("Single tap! (INT source 0x%02x)", int_src);
     }
 }
 
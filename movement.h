@@ -27,8 +27,12 @@
 #include <stdio.h>
 #include <stdbool.h>
 #include "watch.h"
+#include "watch_utility.h"
 #include "utz.h"
 #include "lis2dw.h"
+#include "pedometer.h"
+#include "sleep_tracker.h"
+#include "thermistor_driver.h"
 
 /// @brief A struct that allows a watch face to report its state back to Movement.
 typedef struct {
@@ -281,6 +285,12 @@ typedef struct {
     uint8_t last_second;
     uint8_t subsecond;
 
+    // UTC unix time as of the last tick, and the minute it was last resynchronized to (date_time.reg >> 6)
+    uint32_t unix_time;
+    uint32_t unix_time_minute;
+    uint32_t unix_time_minute_start;
+    watch_utility_day_cache_t unix_time_day_cache;
+
     // backup register stuff
     uint8_t next_available_backup_register;
 
@@ -290,10 +300,25 @@ typedef struct {
     // boolean set if thermistor is detected
     bool has_thermistor;
 
+    // filtered battery voltage in 1/16 millivolts, or 0 if we haven't measured it yet
+    uint32_t battery_estimate;
+
     // boolean set if accelerometer is detected
     bool has_lis2dw;
     // data rate for background accelerometer sensing
     lis2dw_data_rate_t accelerometer_background_rate;
+    // boolean set if the accelerometer's FIFO is being fed to the pedometer
+    bool step_counting_enabled;
+    // the local date the step count is for, in days since 1970
+    uint32_t steps_date;
+    // minutes of steps that couldn't be logged, saturating
+    uint8_t step_records_dropped;
+    // boolean set while tap detection has the accelerometer's INT1 pin
+    bool tap_detection_enabled;
+    // boolean set if orientation changes are being tallied for sleep tracking
+    bool sleep_tracking_enabled;
+    // sleep tracker buckets that couldn't be logged, saturating
+    uint8_t sleep_buckets_dropped;
 } movement_state_t;
 
 void movement_move_to_face(uint8_t watch_face_index);
@@ -339,6 +364,17 @@ watch_date_time_t movement_get_local_date_time(void);
 watch_date_time_t movement_get_date_time_in_zone(uint8_t zone_index);
 
 void movement_set_local_date_time(watch_date_time_t date_time);
+// Sets the RTC. Faces should use this (or movement_set_local_date_time) rather than watch_rtc_set_date_time, so
+// that movement_get_unix_time and the local time derived from it follow right away.
+void movement_set_utc_date_time(watch_date_time_t date_time);
+
+// Returns the current UTC unix time. Movement keeps this up to date on every tick, so unlike converting
+// movement_get_utc_date_time yourself, calling it costs nothing. Faces that need more resolution than one
+// second can combine it with movement_get_subsecond.
+uint32_t movement_get_unix_time(void);
+
+// Returns the number of ticks since the last whole second, at the rate set with movement_request_tick_frequency.
+uint8_t movement_get_subsecond(void);
 
 bool movement_button_should_sound(void);
 void movement_set_button_should_sound(bool value);
@@ -380,7 +416,66 @@ bool movement_disable_tap_detection_if_available(void);
 lis2dw_data_rate_t movement_get_accelerometer_background_rate(void);
 bool movement_set_accelerometer_background_rate(lis2dw_data_rate_t new_rate);
 
+// if the board has an accelerometer, these functions will enable or disable step counting (see lib/pedometer).
+// While it's enabled, the accelerometer runs at 25 Hz into its FIFO, and Movement drains the FIFO through the
+// pedometer on every tick. Ticks stop in low energy mode, so there the accelerometer goes back to sleeping at
+// its lowest rate; steps taken then aren't counted, but a minute in which the accelerometer stayed awake (as on
+// the A4 sleep state) two minutes running is still reported as PEDOMETER_ACTIVITY_WALK, with no steps.
+bool movement_enable_step_counting_if_available(void);
+bool movement_disable_step_counting_if_available(void);
+
+// the number of steps counted since local midnight, and the steps and activity for the last full minute.
+uint32_t movement_get_steps_today(void);
+pedometer_minute_t movement_get_last_minute_activity(void);
+
+// Each minute with steps in it is logged to MOVEMENT_STEPS_FILE: a uint32_t with the local date in days since
+// 1970, then one of these records per minute. The file starts over each day, and lives on the small internal
+// filesystem, so it stops growing at MOVEMENT_STEPS_FILE_MAX_SIZE; minutes after that are dropped and counted.
+#define MOVEMENT_STEPS_FILE "steps.bin"
+#define MOVEMENT_STEPS_FILE_MAX_SIZE 1024
+
+typedef struct {
+    uint16_t minute;            // minute of the local day, 0-1439
+    uint8_t steps;
+    uint8_t activity;           // a pedometer_activity_t
+} movement_step_record_t;
+
+// the number of minutes that didn't make it into MOVEMENT_STEPS_FILE, because it was full or a write failed,
+// since the watch started. Saturates at 255.
+uint8_t movement_get_dropped_step_records(void);
+
+// if the board has an accelerometer on pin A3, these functions will enable or disable sleep tracking (see
+// lib/sleep_tracker). While it's enabled, the accelerometer's orientation changes are counted by an interrupt
+// that keeps running in low energy mode, and tallied into five minute buckets. Not available on boards with
+// external flash, where A3 is the flash chip select.
+bool movement_enable_sleep_tracking_if_available(void);
+bool movement_disable_sleep_tracking_if_available(void);
+
+// a running count of orientation changes, which wraps around; subtract two readings to count changes between them.
+uint16_t movement_get_orientation_changes(void);
+
+// The buckets are logged to MOVEMENT_SLEEP_FILE once an hour: a uint32_t with the night they belong to, as the
+// local date of its evening in days since 1970, then sleep_tracker_bucket_t records. The file starts over each
+// night, at local noon, so it never holds more than a day's worth, MOVEMENT_SLEEP_FILE_MAX_SIZE.
+#define MOVEMENT_SLEEP_FILE "sleep.bin"
+#define MOVEMENT_SLEEP_FILE_MAX_SIZE (4 + (24 * 60 * 60 / SLEEP_TRACKER_BUCKET_SECONDS) * 4)
+
+// the number of buckets that didn't make it into MOVEMENT_SLEEP_FILE, because the tracker's ring filled up before
+// a store, the file was full, or a write failed, since the watch started. Saturates at 255.
+uint8_t movement_get_dropped_sleep_buckets(void);
+
 // If the board has a temperature sensor, this function will give you the temperature in degrees celsius.
 // If the board has multiple temperature sensors, it will use the most accurate one available.
 // If the board has no temperature sensors, it will return 0xFFFFFFFF.
 float movement_get_temperature(void);
+
+// Returns the battery voltage in millivolts, smoothed over the last few hours. Movement takes an oversampled
+// reading once an hour and folds it into a running average, so momentary sags (from the buzzer or the LED,
+// say) don't trip low battery warnings. Use watch_get_vcc_voltage if you need an instantaneous reading.
+uint16_t movement_get_battery_voltage(void);
+
+// If the board has a thermistor, these get and set a per-unit calibration for it (see thermistor_driver.h).
+// The calibration is saved to the filesystem, and restored at boot. Pass NULL to remove it.
+#define MOVEMENT_THERMISTOR_CALIBRATION_FILE "thermcal.bin"
+bool movement_get_thermistor_calibration(thermistor_calibration_t *calibration);
+bool movement_set_thermistor_calibration(const thermistor_calibration_t *calibration);
@@ -24,17 +24,33 @@
 
 #include "shell_cmd_list.h"
 
+#include <inttypes.h>
 #include <stddef.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 
 #include "filesystem.h"
+#include "movement.h"
+#include "thermistor_driver.h"
 #include "watch.h"
 #include "delay.h"
+#include "base64.h"
+#include "trace.h"
+#if __EMSCRIPTEN__
+#include "watch_sim_power.h"
+#endif
 
 static int help_cmd(int argc, char *argv[]);
 static int flash_cmd(int argc, char *argv[]);
 static int stress_cmd(int argc, char *argv[]);
+static int nvmstat_cmd(int argc, char *argv[]);
+static int nvmdump_cmd(int argc, char *argv[]);
+static int thermcal_cmd(int argc, char *argv[]);
+static int trace_cmd(int argc, char *argv[]);
+#if __EMSCRIPTEN__
+static int power_cmd(int argc, char *argv[]);
+#endif
 
 shell_command_t g_shell_commands[] = {
     {
@@ -107,6 +123,47 @@ shell_command_t g_shell_commands[] = {
         .max_args = 3,
         .cb = filesystem_cmd_echo,
     },
+    {
+        .name = "nvmstat",
+#if __EMSCRIPTEN__
+        .help = "print flash operation counters; usage: nvmstat [reset|rows]",
+#else
+        .help = "print flash operation counters; usage: nvmstat [reset]",
+#endif
+        .min_args = 0,
+        .max_args = 1,
+        .cb = nvmstat_cmd,
+    },
+    {
+        .name = "nvmdump",
+        .help = "print the raw storage area as base64, for the simulator",
+        .min_args = 0,
+        .max_args = 0,
+        .cb = nvmdump_cmd,
+    },
+    {
+        .name = "thermcal",
+        .help = "calibrate the thermistor; usage: thermcal [ACTUAL_DEGREES_C|clear]",
+        .min_args = 0,
+        .max_args = 1,
+        .cb = thermcal_cmd,
+    },
+    {
+        .name = "trace",
+        .help = "print the trace buffer as base64; usage: trace [clear]",
+        .min_args = 0,
+        .max_args = 1,
+        .cb = trace_cmd,
+    },
+#if __EMSCRIPTEN__
+    {
+        .name = "power",
+        .help = "print the simulator's power estimate; usage: power [reset]",
+        .min_args = 0,
+        .max_args = 1,
+        .cb = power_cmd,
+    },
+#endif
     {
         .name = "stress",
         .help = "test CDC write; usage: stress [LEN] [DELAY_MS]",
@@ -141,6 +198,201 @@ static int flash_cmd(int argc, char *argv[]) {
     return 0;
 }
 
+static int nvmstat_cmd(int argc, char *argv[]) {
+    watch_storage_stats_t stats;
+    watch_storage_get_stats(&stats);
+
+    printf("reads:  %" PRIu32 " (%" PRIu32 " bytes)\r\n", stats.reads, stats.bytes_read);
+    printf("writes: %" PRIu32 " (%" PRIu32 " bytes)\r\n", stats.writes, stats.bytes_written);
+    printf("erases: %" PRIu32 "\r\n", stats.erases);
+    printf("syncs:  %" PRIu32 "\r\n", stats.syncs);
+
+    if (argc >= 2 && !strcmp(argv[1], "reset")) {
+        watch_storage_reset_stats();
+    }
+#if __EMSCRIPTEN__
+    // only the simulator keeps per-row counters.
+    if (argc >= 2 && !strcmp(argv[1], "rows")) {
+        watch_storage_block_stats_t block_stats;
+        printf("row\treads\twrites\terases\tbusy_us\r\n");
+        for (uint32_t row = 0; watch_storage_get_block_stats(row, &block_stats); row++) {
+            printf("%" PRIu32 "\t%" PRIu32 "\t%" PRIu32 "\t%" PRIu32 "\t%" PRIu32 "\r\n",
+                   row, block_stats.reads, block_stats.writes, block_stats.erases, block_stats.busy_us);
+        }
+    }
+#endif
+
+    return 0;
+}
+
+static void _print_base64_line(const uint8_t *data, uint8_t length) {
+    char base64_line[65];
+    b64_encode(data, length, (unsigned char *)base64_line);
+    printf("%s\r\n", base64_line);
+    delay_ms(10);
+}
+
+// decode the output with utils/flash_image/nvmdump_to_image.py to get an image for the simulator's SIM_FLASH
+// or its Import button.
+static int nvmdump_cmd(int argc, char *argv[]) {
+    (void) argc;
+    (void) argv;
+
+    uint8_t row_buffer[NVMCTRL_ROW_SIZE];
+    // 48 bytes make a 64-character line of base64 with no padding, so the lines can be decoded as one.
+    uint8_t line[48];
+    uint8_t line_length = 0;
+
+    for (uint32_t row = 0; row < NVMCTRL_RWWEE_PAGES / 4; row++) {
+        watch_storage_read(row, 0, row_buffer, NVMCTRL_ROW_SIZE);
+        for (uint16_t i = 0; i < NVMCTRL_ROW_SIZE; i++) {
+            line[line_length++] = row_buffer[i];
+            if (line_length == sizeof(line)) {
+                _print_base64_line(line, line_length);
+                line_length = 0;
+            }
+        }
+    }
+    if (line_length) _print_base64_line(line, line_length);
+
+    return 0;
+}
+
+// parses a decimal like "21.5" or "-3.25" into hundredths, without pulling in floating point parsing.
+static bool _parse_centi(const char *s, int32_t *value) {
+    bool negative = *s == '-';
+    if (negative) s++;
+    int32_t result = 0;
+    int8_t decimals = -1;
+    for (; *s; s++) {
+        if (*s == '.' && decimals < 0) {
+            decimals = 0;
+        } else if (*s >= '0' && *s <= '9' && decimals < 2 && result < 100000) {
+            result = result * 10 + (*s - '0');
+            if (decimals >= 0) decimals++;
+        } else {
+            return false;
+        }
+    }
+    if (decimals < 1) result *= 10;
+    if (decimals < 2) result *= 10;
+    *value = negative ? -result : result;
+    return true;
+}
+
+static void _print_centi(const char *label, int32_t value) {
+    printf("%s%s%ld.%02ld C\r\n", label, value < 0 ? "-" : "", labs(value) / 100, labs(value) % 100);
+}
+
+// the most a calibration point can claim the temperature is, either side of zero, in hundredths of a degree.
+#define THERMCAL_MAX_CENTI 10000
+
+static int thermcal_cmd(int argc, char *argv[]) {
+    thermistor_calibration_t calibration;
+    movement_get_thermistor_calibration(&calibration);
+
+    thermistor_driver_enable();
+    int16_t uncalibrated = thermistor_driver_get_uncalibrated_temperature_centidegrees();
+    int16_t calibrated = thermistor_driver_get_temperature_centidegrees();
+    thermistor_driver_disable();
+
+    if (uncalibrated == THERMISTOR_INVALID_TEMPERATURE) {
+        printf("no thermistor\r\n");
+        return 1;
+    }
+
+    if (argc >= 2 && !strcmp(argv[1], "clear")) {
+        movement_set_thermistor_calibration(NULL);
+        printf("calibration cleared\r\n");
+        return 0;
+    }
+
+    if (argc >= 2) {
+        int32_t actual;
+        if (!_parse_centi(argv[1], &actual)) {
+            printf("usage: thermcal [ACTUAL_DEGREES_C|clear]\r\n");
+            return 1;
+        }
+        // the calibration stores hundredths in an int16_t; anything past the thermistor's range is a typo anyway.
+        if (actual < -THERMCAL_MAX_CENTI || actual > THERMCAL_MAX_CENTI) {
+            printf("thermcal: %s C is out of range\r\n", argv[1]);
+            return 1;
+        }
+        // add a point; with two already, replace the one closest to this reading.
+        uint8_t i = calibration.num_points;
+        if (i == 2) i = abs(calibration.measured[0] - uncalibrated) < abs(calibration.measured[1] - uncalibrated) ? 0 : 1;
+        else calibration.num_points++;
+        calibration.measured[i] = uncalibrated;
+        calibration.actual[i] = actual;
+        if (!movement_set_thermistor_calibration(&calibration)) {
+            printf("could not save calibration\r\n");
+            return 1;
+        }
+        thermistor_driver_enable();
+        calibrated = thermistor_driver_get_temperature_centidegrees();
+        thermistor_driver_disable();
+    }
+
+    _print_centi("uncalibrated: ", uncalibrated);
+    _print_centi("calibrated:   ", calibrated);
+    for (uint8_t i = 0; i < calibration.num_points; i++) {
+        printf("point %d: ", i + 1);
+        _print_centi("measured ", calibration.measured[i]);
+        _print_centi("         actual   ", calibration.actual[i]);
+    }
+
+    return 0;
+}
+
+// decode the output with utils/trace_decode/trace_decode.py and the ELF of the firmware that's running.
+static int trace_cmd(int argc, char *argv[]) {
+    if (argc >= 2) {
+        if (strcmp(argv[1], "clear")) {
+            printf("usage: trace [clear]\r\n");
+            return 1;
+        }
+        trace_clear();
+        return 0;
+    }
+
+    uint16_t oldest, next;
+    trace_get_range(&oldest, &next);
+    printf("%u records\r\n", (unsigned)(uint16_t)(next - oldest));
+
+    // three records make a 64-character line of base64 with no padding, so the lines can be decoded as one.
+    trace_record_t records[3];
+    uint8_t count = 0;
+    for (uint16_t sequence = oldest; sequence != next; sequence++) {
+        // anything overwritten while we print is skipped; the decoder sees the gap in sequence numbers.
+        if (!trace_get_record(sequence, &records[count])) continue;
+        if (++count == 3) {
+            _print_base64_line((uint8_t *)records, sizeof(records));
+            count = 0;
+        }
+    }
+    if (count) _print_base64_line((uint8_t *)records, count * sizeof(trace_record_t));
+
+    return 0;
+}
+
+#if __EMSCRIPTEN__
+static int power_cmd(int argc, char *argv[]) {
+    if (argc >= 2) {
+        if (strcmp(argv[1], "reset")) {
+            printf("usage: power [reset]\r\n");
+            return 1;
+        }
+        watch_sim_power_reset();
+        printf("power estimate reset\r\n");
+        return 0;
+    }
+
+    watch_sim_power_print_report();
+
+    return 0;
+}
+#endif
+
 #define STRESS_CMD_MAX_LEN  (512)
 static int stress_cmd(int argc, char *argv[]) {
     char test_str[STRESS_CMD_MAX_LEN+1] = {0};
@@ -0,0 +1,336 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 Second Movement contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+// Checks the day-number date arithmetic in watch_utility.c exhaustively over the range it supports, then
+// times it against the musl-derived code it replaced. Build and run with:
+//   cc -O2 -Ihost date_bench.c -lm -o date_bench && ./date_bench
+// Host timings only show the relative cost; on the Cortex-M0+ the gap is wider, since every division in
+// the reference code becomes a call to __aeabi_uidiv or __aeabi_idiv.
+
+#include <stdio.h>
+#include <time.h>
+#include "../../watch-library/shared/watch/watch_utility.c"
+
+watch_lcd_type_t watch_get_lcd_type(void) {
+    return WATCH_LCD_TYPE_CLASSIC;
+}
+
+// The previous implementation, kept here for timing.
+// Function taken from `src/time/__year_to_secs.c` of musl libc
+// https://musl.libc.org
+static uint32_t __year_to_secs(uint32_t year, int *is_leap)
+{
+	if (year-2ULL <= 136) {
+		int y = year;
+		int leaps = (y-68)>>2;
+		if (!((y-68)&3)) {
+			leaps--;
+			if (is_leap) *is_leap = 1;
+		} else if (is_leap) *is_leap = 0;
+		return 31536000*(y-70) + 86400*leaps;
+	}
+
+	int cycles, centuries, leaps, rem, dummy;
+
+	if (!is_leap) is_leap = &dummy;
+	cycles = (year-100) / 400;
+	rem = (year-100) % 400;
+	if (rem < 0) {
+		cycles--;
+		rem += 400;
+	}
+	if (!rem) {
+		*is_leap = 1;
+		centuries = 0;
+		leaps = 0;
+	} else {
+		if (rem >= 200) {
+			if (rem >= 300) centuries = 3, rem -= 300;
+			else centuries = 2, rem -= 200;
+		} else {
+			if (rem >= 100) centuries = 1, rem -= 100;
+			else centuries = 0;
+		}
+		if (!rem) {
+			*is_leap = 0;
+			leaps = 0;
+		} else {
+			leaps = rem / 4U;
+			rem %= 4U;
+			*is_leap = !rem;
+		}
+	}
+
+	leaps += 97*cycles + 24*centuries - *is_leap;
+
+	return (year-100) * 31536000LL + leaps * 86400LL + 946684800 + 86400;
+}
+
+// Function taken from `src/time/__month_to_secs.c` of musl libc
+// https://musl.libc.org
+static int __month_to_secs(int month, int is_leap)
+{
+	static const int secs_through_month[] = {
+		0, 31*86400, 59*86400, 90*86400,
+		120*86400, 151*86400, 181*86400, 212*86400,
+		243*86400, 273*86400, 304*86400, 334*86400 };
+	int t = secs_through_month[month];
+	if (is_leap && month >= 2) t+=86400;
+	return t;
+}
+
+// Function adapted from `src/time/__tm_to_secs.c` of musl libc
+// https://musl.libc.org
+static uint32_t musl_convert_to_unix_time(uint16_t year, uint8_t month, uint8_t day, uint8_t hour, uint8_t minute, uint8_t second, int32_t utc_offset) {
+    int is_leap;
+
+    // POSIX tm struct starts year at 1900 and month at 0
+    // https://pubs.opengroup.org/onlinepubs/9699919799/basedefs/time.h.html 
+    uint32_t timestamp = __year_to_secs(year - 1900, &is_leap);
+    timestamp += __month_to_secs(month - 1, is_leap);
+
+    // Regular conversion from musl libc
+    timestamp += (day - 1) * 86400;
+    timestamp += hour * 3600;
+    timestamp += minute * 60;
+    timestamp += second;
+    timestamp -= utc_offset;
+
+    return timestamp;
+}
+
+static uint32_t musl_date_time_to_unix_time(watch_date_time_t date_time, int32_t utc_offset) {
+    return musl_convert_to_unix_time(date_time.unit.year + WATCH_RTC_REFERENCE_YEAR, date_time.unit.month, date_time.unit.day, date_time.unit.hour, date_time.unit.minute, date_time.unit.second, utc_offset);
+}
+
+#define LEAPOCH (946684800LL + 86400*(31+29))
+
+#define DAYS_PER_400Y (365*400 + 97)
+#define DAYS_PER_100Y (365*100 + 24)
+#define DAYS_PER_4Y   (365*4   + 1)
+
+static watch_date_time_t musl_date_time_from_unix_time(uint32_t timestamp, int32_t utc_offset) {
+    watch_date_time_t retval;
+    retval.reg = 0;
+    int32_t days, secs;
+    int32_t remdays, remsecs, remyears;
+    int32_t qc_cycles, c_cycles, q_cycles;
+    int32_t years, months;
+    int32_t wday, yday, leap;
+    static const int8_t days_in_month[] = {31,30,31,30,31,31,30,31,30,31,31,29};
+    timestamp += utc_offset;
+
+    secs = timestamp - LEAPOCH;
+    days = secs / 86400;
+    remsecs = secs % 86400;
+    if (remsecs < 0) {
+        remsecs += 86400;
+        days--;
+    }
+
+    wday = (3+days)%7;
+    if (wday < 0) wday += 7;
+
+    qc_cycles = (int)(days / DAYS_PER_400Y);
+    remdays = days % DAYS_PER_400Y;
+    if (remdays < 0) {
+        remdays += DAYS_PER_400Y;
+        qc_cycles--;
+    }
+
+    c_cycles = remdays / DAYS_PER_100Y;
+    if (c_cycles == 4) c_cycles--;
+    remdays -= c_cycles * DAYS_PER_100Y;
+
+    q_cycles = remdays / DAYS_PER_4Y;
+    if (q_cycles == 25) q_cycles--;
+    remdays -= q_cycles * DAYS_PER_4Y;
+
+    remyears = remdays / 365;
+    if (remyears == 4) remyears--;
+    remdays -= remyears * 365;
+
+    leap = !remyears && (q_cycles || !c_cycles);
+    yday = remdays + 31 + 28 + leap;
+    if (yday >= 365+leap) yday -= 365+leap;
+
+    years = remyears + 4*q_cycles + 100*c_cycles + 400*qc_cycles;
+
+    for (months=0; days_in_month[months] <= remdays; months++)
+        remdays -= days_in_month[months];
+
+    years += 2000;
+
+    months += 2;
+    if (months >= 12) {
+        months -=12;
+        years++;
+    }
+
+    if (years < 2020 || years > 2083) return retval;
+    retval.unit.year = years - WATCH_RTC_REFERENCE_YEAR;
+    retval.unit.month = months + 1;
+    retval.unit.day = remdays + 1;
+
+    retval.unit.hour = remsecs / 3600;
+    retval.unit.minute = remsecs / 60 % 60;
+    retval.unit.second = remsecs % 60;
+
+    return retval;
+}
+
+static uint32_t failures;
+
+static void check(bool condition, const char *what, uint32_t value) {
+    if (condition) return;
+    if (failures++ < 10) printf("FAIL: %s (%u)\n", what, (unsigned)value);
+}
+
+static bool is_leap_year(uint16_t year) {
+    return (year % 4 == 0 && year % 100 != 0) || year % 400 == 0;
+}
+
+// Walks the calendar one day at a time from 1970-01-01 to 2106-02-07, the last day of 32-bit UNIX time.
+static void test_day_numbers(void) {
+    static const uint8_t month_lengths[12] = {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+    uint16_t year = 1970;
+    uint8_t month = 1, day = 1;
+
+    for (uint32_t days = 0; days <= 49710; days++) {
+        check(watch_utility_days_from_civil(year, month, day) == days, "days_from_civil", days);
+
+        uint16_t y;
+        uint8_t m, d;
+        watch_utility_civil_from_days(days, &y, &m, &d);
+        check(y == year && m == month && d == day, "civil_from_days", days);
+
+        uint8_t length = month_lengths[month - 1] + (month == 2 && is_leap_year(year));
+        if (++day > length) {
+            day = 1;
+            if (++month > 12) {
+                month = 1;
+                year++;
+            }
+        }
+    }
+    check(year == 2106 && month == 2 && day == 8, "walk ended on the wrong day", year);
+}
+
+// The C library's gmtime is the reference, since the musl-derived code overflowed after 2068-01-19.
+static watch_date_time_t expected_date_time(uint32_t timestamp) {
+    watch_date_time_t retval = {0};
+    time_t t = timestamp;
+    struct tm *tm = gmtime(&t);
+    if (tm->tm_year + 1900 < 2020 || tm->tm_year + 1900 > 2083) return retval;
+    retval.unit.year = tm->tm_year + 1900 - WATCH_RTC_REFERENCE_YEAR;
+    retval.unit.month = tm->tm_mon + 1;
+    retval.unit.day = tm->tm_mday;
+    retval.unit.hour = tm->tm_hour;
+    retval.unit.minute = tm->tm_min;
+    retval.unit.second = tm->tm_sec;
+    return retval;
+}
+
+// Every second of every day is too many; instead check every second of a few days, and a spread of times
+// on every day that watch_date_time_t can represent.
+static void test_unix_time(void) {
+    static const uint32_t interesting_days[] = {0, 11016, 11017, 18262, 18321, 47540, 49710};
+    for (uint32_t i = 0; i < sizeof(interesting_days) / sizeof(interesting_days[0]); i++) {
+        uint32_t start = interesting_days[i] * 86400;
+        for (uint32_t second = 0; second < 86400; second++) {
+            uint32_t timestamp = start + second;
+            watch_date_time_t expected = expected_date_time(timestamp);
+            watch_date_time_t actual = watch_utility_date_time_from_unix_time(timestamp, 0);
+            check(expected.reg == actual.reg, "from_unix_time", timestamp);
+        }
+    }
+
+    watch_utility_day_cache_t to_cache = {0}, from_cache = {0};
+    uint32_t first = watch_utility_days_from_civil(2020, 1, 1) - 1;
+    uint32_t last = watch_utility_days_from_civil(2084, 1, 1) + 1;
+    for (uint32_t days = first; days <= last; days++) {
+        for (uint32_t second = 0; second < 86400; second += 3607) {
+            uint32_t timestamp = days * 86400 + second;
+            watch_date_time_t expected = expected_date_time(timestamp);
+            watch_date_time_t actual = watch_utility_date_time_from_unix_time(timestamp, 0);
+            check(expected.reg == actual.reg, "from_unix_time", timestamp);
+            check(watch_utility_date_time_from_unix_time_cached(timestamp, 0, &from_cache).reg == expected.reg, "from_unix_time_cached", timestamp);
+            if (expected.reg == 0) continue;
+            check(watch_utility_date_time_to_unix_time(expected, 0) == timestamp, "to_unix_time", timestamp);
+            check(watch_utility_date_time_to_unix_time_cached(expected, 0, &to_cache) == timestamp, "to_unix_time_cached", timestamp);
+        }
+    }
+
+    // a change of UTC offset must invalidate the caches.
+    watch_date_time_t noon = watch_utility_date_time_from_unix_time(1700000000, 0);
+    check(watch_utility_date_time_to_unix_time_cached(noon, 3600, &to_cache) == 1700000000 - 3600, "cached offset change", 0);
+    check(watch_utility_date_time_from_unix_time_cached(1700000000, -3600, &from_cache).reg == watch_utility_date_time_from_unix_time(1700000000, -3600).reg, "cached offset change", 1);
+}
+
+static volatile uint32_t sink;
+
+static double time_ns(void (*fn)(uint32_t), uint32_t iterations) {
+    struct timespec start, end;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (uint32_t i = 0; i < iterations; i++) fn(i);
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    return ((end.tv_sec - start.tv_sec) * 1e9 + (end.tv_nsec - start.tv_nsec)) / iterations;
+}
+
+// a timestamp that advances by one second per call from 2024-01-01, like a face converting on every tick.
+#define TICK(i) (1704067200u + (i))
+
+static void bench_musl_from(uint32_t i) { sink += musl_date_time_from_unix_time(TICK(i), 0).reg; }
+static void bench_new_from(uint32_t i) { sink += watch_utility_date_time_from_unix_time(TICK(i), 0).reg; }
+static watch_utility_day_cache_t bench_cache;
+static void bench_cached_from(uint32_t i) { sink += watch_utility_date_time_from_unix_time_cached(TICK(i), 0, &bench_cache).reg; }
+
+static watch_date_time_t tick_date_time(uint32_t i) {
+    return watch_utility_date_time_from_unix_time_cached(TICK(i), 0, &bench_cache);
+}
+static void bench_musl_to(uint32_t i) { sink += musl_date_time_to_unix_time(tick_date_time(i), 0); }
+static void bench_new_to(uint32_t i) { sink += watch_utility_date_time_to_unix_time(tick_date_time(i), 0); }
+static watch_utility_day_cache_t bench_to_cache;
+static void bench_cached_to(uint32_t i) { sink += watch_utility_date_time_to_unix_time_cached(tick_date_time(i), 0, &bench_to_cache); }
+static void bench_overhead(uint32_t i) { sink += tick_date_time(i).reg; }
+
+int main(void) {
+    test_day_numbers();
+    test_unix_time();
+    if (failures) {
+        printf("%u failures\n", (unsigned)failures);
+        return 1;
+    }
+    printf("round trips OK from 1970-01-01 to 2106-02-07\n\n");
+
+    const uint32_t iterations = 10000000;
+    double overhead = time_ns(bench_overhead, iterations);
+    printf("%-28s %8s %8s %8s\n", "ns per call", "musl", "new", "cached");
+    printf("%-28s %8.2f %8.2f %8.2f\n", "date_time_from_unix_time",
+           time_ns(bench_musl_from, iterations), time_ns(bench_new_from, iterations), time_ns(bench_cached_from, iterations));
+    printf("%-28s %8.2f %8.2f %8.2f\n", "date_time_to_unix_time",
+           time_ns(bench_musl_to, iterations) - overhead, time_ns(bench_new_to, iterations) - overhead, time_ns(bench_cached_to, iterations) - overhead);
+
+    return 0;
+}
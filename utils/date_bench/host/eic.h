@@ -0,0 +1,9 @@
+// Host stand-in for gossamer's eic.h; see pins.h.
+#pragma once
+
+typedef enum {
+    INTERRUPT_TRIGGER_NONE = 0,
+    INTERRUPT_TRIGGER_RISING,
+    INTERRUPT_TRIGGER_FALLING,
+    INTERRUPT_TRIGGER_BOTH,
+} eic_interrupt_trigger_t;
@@ -0,0 +1,3 @@
+// Host stand-ins for the gossamer and generated headers that watch.h and watch_utility.c pull in, so that
+// date_bench.c can build watch_utility.c on a desktop machine. Only the types it needs are defined.
+#pragma once
@@ -0,0 +1,22 @@
+// Host stand-in for gossamer's rtc.h; see pins.h.
+#pragma once
+#include <stdint.h>
+
+typedef union {
+    struct {
+        uint32_t second : 6;
+        uint32_t minute : 6;
+        uint32_t hour : 5;
+        uint32_t day : 5;
+        uint32_t month : 4;
+        uint32_t year : 6;
+    } unit;
+    uint32_t reg;
+} rtc_date_time_t;
+
+typedef enum {
+    ALARM_MATCH_DISABLED = 0,
+    ALARM_MATCH_SS,
+    ALARM_MATCH_MMSS,
+    ALARM_MATCH_HHMMSS,
+} rtc_alarm_match_t;
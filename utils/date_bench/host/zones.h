@@ -0,0 +1,4 @@
+// Host stand-in for the generated zones.h; see pins.h.
+#pragma once
+
+static const char zone_names[] = "UTC    ";
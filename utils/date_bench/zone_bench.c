@@ -0,0 +1,109 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 Second Movement contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+// Measures what a tick costs as the number of zones on display grows: converting the RTC to each zone with
+// watch_utility_date_time_convert_zone, as movement_get_date_time_in_zone used to, versus carrying a
+// watch_utility_zone_clock_t forward. Also checks the zone clocks against a full conversion for every second
+// of fourteen months, across a leap day and two new years. Build and run with:
+//   cc -O2 -Ihost zone_bench.c -lm -o zone_bench && ./zone_bench
+// As with date_bench, a desktop CPU's hardware divider flatters the conversion; expect a wider gap on the watch.
+
+#include <stdio.h>
+#include <time.h>
+#include "../../watch-library/shared/watch/watch_utility.c"
+
+watch_lcd_type_t watch_get_lcd_type(void) {
+    return WATCH_LCD_TYPE_CLASSIC;
+}
+
+#define MAX_ZONES 8
+// a spread of offsets, including half and quarter hours.
+static const int32_t offsets[MAX_ZONES] = {0, -18000, 3600, 19800, -12600, 20700, 32400, -36000};
+
+static uint32_t failures;
+
+static void test_zone_clocks(void) {
+    watch_utility_zone_clock_t clocks[MAX_ZONES] = {0};
+    uint32_t start = watch_utility_convert_to_unix_time(2023, 12, 25, 0, 0, 0, 0);
+    uint32_t end = watch_utility_convert_to_unix_time(2025, 3, 5, 0, 0, 0, 0);
+    uint32_t step = 0;
+
+    for (uint32_t now = start; now < end; now++, step++) {
+        // now and then, jump ahead as if we had slept, and flip one zone to DST and back.
+        if (step % 100003 == 0) now += step % 7919;
+        int32_t dst = (step / 500009) % 2 ? 3600 : 0;
+
+        for (uint8_t i = 0; i < MAX_ZONES; i++) {
+            int32_t offset = offsets[i] + (i == 1 ? dst : 0);
+            watch_date_time_t actual = watch_utility_zone_clock_update(&clocks[i], now, offset);
+            watch_date_time_t expected = watch_utility_date_time_from_unix_time(now, offset);
+            if (actual.reg != expected.reg && failures++ < 10) {
+                printf("FAIL: zone %d at %u\n", i, (unsigned)now);
+            }
+        }
+    }
+}
+
+static volatile uint32_t sink;
+
+static double ns_per_tick(uint8_t zones, bool use_zone_clocks) {
+    watch_utility_zone_clock_t clocks[MAX_ZONES] = {0};
+    watch_utility_day_cache_t rtc_cache = {0};
+    uint32_t start = watch_utility_convert_to_unix_time(2024, 6, 1, 0, 0, 0, 0);
+    const uint32_t ticks = 86400 * 4;
+    struct timespec t0, t1;
+
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    for (uint32_t tick = 0; tick < ticks; tick++) {
+        uint32_t now = start + tick;
+        // stands in for the RTC read, which both approaches make once per tick.
+        watch_date_time_t rtc = watch_utility_date_time_from_unix_time_cached(now, 0, &rtc_cache);
+        for (uint8_t i = 0; i < zones; i++) {
+            if (use_zone_clocks) {
+                sink += watch_utility_zone_clock_update(&clocks[i], now, offsets[i]).reg;
+            } else {
+                sink += watch_utility_date_time_convert_zone(rtc, 0, offsets[i]).reg;
+            }
+        }
+    }
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+
+    return ((t1.tv_sec - t0.tv_sec) * 1e9 + (t1.tv_nsec - t0.tv_nsec)) / ticks;
+}
+
+int main(void) {
+    test_zone_clocks();
+    if (failures) {
+        printf("%u failures\n", (unsigned)failures);
+        return 1;
+    }
+    printf("zone clocks OK\n\n");
+
+    printf("%6s %14s %14s\n", "zones", "convert ns", "zone clock ns");
+    for (uint8_t zones = 1; zones <= MAX_ZONES; zones++) {
+        printf("%6d %14.1f %14.1f\n", zones, ns_per_tick(zones, false), ns_per_tick(zones, true));
+    }
+
+    return 0;
+}
@@ -0,0 +1,32 @@
+#!/usr/bin/env python3
+# Turns the output of the shell's nvmdump command into a raw 8 KB image of the watch's storage area, which the
+# simulator can load: under node with SIM_FLASH=image, or in the browser with the Import button under Flash.
+# Paste the output into a file as-is; the prompt, the command and anything else that isn't base64 is skipped.
+#
+# Usage: nvmdump_to_image.py DUMP.txt IMAGE.img
+import base64
+import re
+import sys
+
+IMAGE_SIZE = 8192
+BASE64_LINE = re.compile(r'^[A-Za-z0-9+/]+={0,2}$')
+
+
+def main():
+    if len(sys.argv) != 3:
+        sys.exit('usage: nvmdump_to_image.py DUMP.txt IMAGE.img')
+
+    with open(sys.argv[1]) as f:
+        lines = [line.strip() for line in f]
+    encoded = ''.join(line for line in lines if BASE64_LINE.match(line) and len(line) % 4 == 0)
+    image = base64.b64decode(encoded)
+    if len(image) != IMAGE_SIZE:
+        sys.exit(f'decoded {len(image)} bytes, expected {IMAGE_SIZE}; was the dump cut short?')
+
+    with open(sys.argv[2], 'wb') as f:
+        f.write(image)
+    print(f'wrote {sys.argv[2]}')
+
+
+if __name__ == '__main__':
+    main()
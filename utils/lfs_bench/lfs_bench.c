@@ -0,0 +1,225 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 Second Movement contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+// Replays typical Movement storage workloads against the 8 KB RWWEE filesystem with one of the
+// configuration profiles in filesystem/filesystem_profiles.h, and reports write amplification,
+// wear and modeled flash time. Build and run for one profile with:
+//   cc -O2 -I../../littlefs -I../../filesystem -DFILESYSTEM_PROFILE=FILESYSTEM_PROFILE_BALANCED
+//      lfs_bench.c ../../littlefs/lfs.c ../../littlefs/lfs_util.c -o lfs_bench && ./lfs_bench
+// or use run_all.sh to compare every profile.
+
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include "lfs.h"
+
+// same geometry as the SAM L22's RWWEE area; see watch-library/shared/watch/watch_storage.h
+#define NVMCTRL_ROW_SIZE 256
+#define NVMCTRL_PAGE_SIZE 64
+#define NVMCTRL_RWWEE_PAGES 128
+#define NUM_ROWS (NVMCTRL_RWWEE_PAGES / 4)
+
+#include "filesystem_profiles.h"
+
+// same latency model as watch-library/simulator/watch/watch_storage.c
+#define READ_US_PER_CALL 2
+#define READ_BYTES_PER_US 4
+#define PAGE_PROGRAM_US 2500
+#define ROW_ERASE_US 6000
+
+static uint8_t flash[NUM_ROWS * NVMCTRL_ROW_SIZE];
+
+static struct {
+    uint32_t reads;
+    uint32_t bytes_programmed;
+    uint32_t erases;
+    uint32_t row_erases[NUM_ROWS];
+    uint64_t busy_us;
+} counters;
+
+static int bench_read(const struct lfs_config *cfg, lfs_block_t block, lfs_off_t off, void *buffer, lfs_size_t size) {
+    (void) cfg;
+    memcpy(buffer, flash + block * NVMCTRL_ROW_SIZE + off, size);
+    counters.reads++;
+    counters.busy_us += READ_US_PER_CALL + size / READ_BYTES_PER_US;
+    return 0;
+}
+
+static int bench_prog(const struct lfs_config *cfg, lfs_block_t block, lfs_off_t off, const void *buffer, lfs_size_t size) {
+    (void) cfg;
+    uint8_t *dst = flash + block * NVMCTRL_ROW_SIZE + off;
+    const uint8_t *src = buffer;
+    // NOR semantics: programming can only clear bits.
+    for (lfs_size_t i = 0; i < size; i++) dst[i] &= src[i];
+    counters.bytes_programmed += size;
+    counters.busy_us += ((size + NVMCTRL_PAGE_SIZE - 1) / NVMCTRL_PAGE_SIZE) * PAGE_PROGRAM_US;
+    return 0;
+}
+
+static int bench_erase(const struct lfs_config *cfg, lfs_block_t block) {
+    (void) cfg;
+    memset(flash + block * NVMCTRL_ROW_SIZE, 0xff, NVMCTRL_ROW_SIZE);
+    counters.erases++;
+    counters.row_erases[block]++;
+    counters.busy_us += ROW_ERASE_US;
+    return 0;
+}
+
+static int bench_sync(const struct lfs_config *cfg) {
+    (void) cfg;
+    return 0;
+}
+
+static const struct lfs_config bench_cfg = {
+    .read  = bench_read,
+    .prog  = bench_prog,
+    .erase = bench_erase,
+    .sync  = bench_sync,
+
+    .read_size = FILESYSTEM_READ_SIZE,
+    .prog_size = NVMCTRL_PAGE_SIZE,
+    .block_size = NVMCTRL_ROW_SIZE,
+    .block_count = NUM_ROWS,
+    .cache_size = FILESYSTEM_CACHE_SIZE,
+    .lookahead_size = FILESYSTEM_LOOKAHEAD_SIZE,
+    .block_cycles = FILESYSTEM_BLOCK_CYCLES,
+};
+
+static lfs_t lfs;
+static lfs_file_t file;
+
+// mirrors filesystem_append_file: open, append, close.
+static uint32_t append(const char *filename, const void *data, lfs_size_t length) {
+    lfs_file_open(&lfs, &file, filename, LFS_O_WRONLY | LFS_O_CREAT | LFS_O_APPEND);
+    lfs_file_write(&lfs, &file, data, length);
+    lfs_file_close(&lfs, &file);
+    return length;
+}
+
+// mirrors filesystem_write_file: open, truncate, write, close.
+static uint32_t rewrite(const char *filename, const void *data, lfs_size_t length) {
+    lfs_file_open(&lfs, &file, filename, LFS_O_RDWR | LFS_O_CREAT | LFS_O_TRUNC);
+    lfs_file_write(&lfs, &file, data, length);
+    lfs_file_close(&lfs, &file);
+    return length;
+}
+
+static lfs_ssize_t file_size(const char *filename) {
+    struct lfs_info info;
+    if (lfs_stat(&lfs, filename, &info) < 0) return 0;
+    return info.size;
+}
+
+// A day of once-a-minute 4-byte samples, as the activity logger would write them. The log is
+// cleared when it reaches 2 KB, so the filesystem never fills up.
+static uint32_t workload_minutely_appends(void) {
+    uint32_t user_bytes = 0;
+    for (uint32_t minute = 0; minute < 1440; minute++) {
+        uint32_t sample = minute * 2654435761u;
+        if (file_size("activity.bin") >= 2048) lfs_remove(&lfs, "activity.bin");
+        user_bytes += append("activity.bin", &sample, sizeof(sample));
+    }
+    return user_bytes;
+}
+
+// Settings changes, as movement_store_settings writes them.
+static uint32_t workload_settings_rewrites(void) {
+    uint32_t user_bytes = 0;
+    for (uint32_t i = 0; i < 500; i++) {
+        uint32_t settings = 0x12345678 ^ i;
+        user_bytes += rewrite("settings.u32", &settings, sizeof(settings));
+    }
+    return user_bytes;
+}
+
+// A day of once-a-minute 16-byte text records, rotated to a .old file at 1 KB.
+static uint32_t workload_log_rotation(void) {
+    uint32_t user_bytes = 0;
+    char line[17];
+    for (uint32_t minute = 0; minute < 1440; minute++) {
+        snprintf(line, sizeof(line), "%02u:%02u,+21.50C\n", (unsigned)(minute / 60), (unsigned)(minute % 60));
+        if (file_size("temp.log") >= 1024) {
+            lfs_remove(&lfs, "temp.old");
+            lfs_rename(&lfs, "temp.log", "temp.old");
+        }
+        user_bytes += append("temp.log", line, 16);
+    }
+    return user_bytes;
+}
+
+static int count_block_cb(void *p, lfs_block_t block) {
+    (void) block;
+    *(uint32_t *)p += 1;
+    return 0;
+}
+
+static void run(const char *name, uint32_t (*workload)(void)) {
+    memset(flash, 0xff, sizeof(flash));
+    lfs_format(&lfs, &bench_cfg);
+    lfs_mount(&lfs, &bench_cfg);
+    // a settings file is always present on the watch.
+    uint32_t settings = 0;
+    rewrite("settings.u32", &settings, sizeof(settings));
+
+    memset(&counters, 0, sizeof(counters));
+    uint32_t user_bytes = workload();
+
+    uint32_t max_row_erases = 0;
+    for (uint32_t i = 0; i < NUM_ROWS; i++) {
+        if (counters.row_erases[i] > max_row_erases) max_row_erases = counters.row_erases[i];
+    }
+    uint32_t bytes_programmed = counters.bytes_programmed;
+    uint32_t erases = counters.erases;
+    uint64_t busy_us = counters.busy_us;
+    lfs_unmount(&lfs);
+
+    // now measure what filesystem_init costs at boot: a mount, plus the traversal for free space.
+    memset(&counters, 0, sizeof(counters));
+    lfs_mount(&lfs, &bench_cfg);
+    uint32_t used_blocks = 0;
+    lfs_fs_traverse(&lfs, count_block_cb, &used_blocks);
+    uint32_t mount_reads = counters.reads;
+    uint64_t mount_us = counters.busy_us;
+    lfs_unmount(&lfs);
+
+    printf("%-18s %6.2f %7u %8u %10.1f %7u %9.2f\n",
+           name,
+           (double)bytes_programmed / user_bytes,
+           erases,
+           max_row_erases,
+           busy_us / 1000.0,
+           mount_reads,
+           mount_us / 1000.0);
+}
+
+int main(void) {
+    printf("profile %d: read_size %d, cache_size %d, lookahead_size %d, block_cycles %d\n",
+           FILESYSTEM_PROFILE, FILESYSTEM_READ_SIZE, FILESYSTEM_CACHE_SIZE, FILESYSTEM_LOOKAHEAD_SIZE, FILESYSTEM_BLOCK_CYCLES);
+    printf("%-18s %6s %7s %8s %10s %7s %9s\n", "workload", "WA", "erases", "max/row", "flash ms", "mount", "mount ms");
+    run("minutely appends", workload_minutely_appends);
+    run("settings rewrites", workload_settings_rewrites);
+    run("log rotation", workload_log_rotation);
+
+    return 0;
+}
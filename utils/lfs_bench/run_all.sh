@@ -0,0 +1,13 @@
+#!/bin/bash
+# Builds lfs_bench once for each profile in filesystem/filesystem_profiles.h and runs it.
+set -e
+cd "$(dirname "$0")"
+
+for profile in BALANCED LOW_WEAR FAST_MOUNT; do
+    echo "=== $profile ==="
+    cc -O2 -I../../littlefs -I../../filesystem -DFILESYSTEM_PROFILE=FILESYSTEM_PROFILE_$profile \
+        lfs_bench.c ../../littlefs/lfs.c ../../littlefs/lfs_util.c -o lfs_bench_$profile
+    ./lfs_bench_$profile
+    rm -f lfs_bench_$profile
+    echo
+done
@@ -0,0 +1,252 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 Second Movement contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+// Replays accelerometer recordings through lib/pedometer, the same code the watch runs, in FIFO-sized batches.
+// Build with:
+//   cc -O2 -I../../lib/pedometer -I../../watch-library/shared/driver pedometer_replay.c ../../lib/pedometer/pedometer.c
+//      -lm -o pedometer_replay
+// Then:
+//   ./pedometer_replay                     runs synthetic still, walking, running and gesturing scenarios, and
+//                                          fails if any step count is off by more than 5% or a minute is misclassified
+//   ./pedometer_replay file.csv [-s scale] [-e expected_steps]
+//                                          replays a recording, such as the CSV files that
+//                                          utils/motion_express_utilities/process_motion_dump.py writes out
+// A CSV is read one row per sample at 25 Hz. Rows with three numbers are x, y, z; with four or more, the first is
+// taken to be an index or timestamp and the next three are x, y, z. Values are multiplied by scale to get raw
+// LIS2DW counts at ±2g (16384 per g); for a recording in m/s², that's -s 1670.7. With -e, the exit status says
+// whether the total came within 5% of the expected count.
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "pedometer.h"
+
+#define MAX_SAMPLES (PEDOMETER_SAMPLE_RATE * 60 * 60 * 4)
+#define FIFO_DEPTH 32
+#define COUNTS_PER_G 16384.0
+
+static lis2dw_reading_t samples[MAX_SAMPLES];
+
+static const char *activity_names[] = { "still", "walk", "run" };
+
+static int16_t clamp16(double v) {
+    v = round(v);
+    return v > INT16_MAX ? INT16_MAX : (v < INT16_MIN ? INT16_MIN : (int16_t)v);
+}
+
+static size_t load_csv(const char *path, double scale) {
+    FILE *f = fopen(path, "r");
+    if (f == NULL) {
+        perror(path);
+        exit(1);
+    }
+    char line[512];
+    size_t count = 0;
+    while (fgets(line, sizeof(line), f) && count < MAX_SAMPLES) {
+        double row[8];
+        int n = 0;
+        char *p = line;
+        while (*p && n < 8) {
+            char *end;
+            double v = strtod(p, &end);
+            if (end == p) break;
+            row[n++] = v;
+            p = end;
+            while (*p == ',' || *p == ' ' || *p == '\t') p++;
+        }
+        if (n < 3) continue;
+        double *xyz = n == 3 ? row : row + 1;
+        samples[count].x = clamp16(xyz[0] * scale);
+        samples[count].y = clamp16(xyz[1] * scale);
+        samples[count].z = clamp16(xyz[2] * scale);
+        count++;
+    }
+    fclose(f);
+
+    return count;
+}
+
+// runs samples through a pedometer the way Movement does: up to a FIFO's worth at a time, and a minute boundary
+// every 60 seconds. Samples from tap_start up to tap_end are lost, as they are while a face has tap detection on
+// and Movement turns the FIFO off; the filters restart after. Returns the total, and optionally the per-minute
+// results.
+static uint32_t replay(const lis2dw_reading_t *in, size_t count, size_t tap_start, size_t tap_end,
+                       pedometer_minute_t *minutes, size_t *num_minutes, bool verbose) {
+    pedometer_t pedometer;
+    size_t minute = 0;
+    size_t in_minute = 0;
+
+    pedometer_init(&pedometer);
+    for (size_t i = 0; i < count; ) {
+        // the watch drains the FIFO once a second.
+        size_t batch = PEDOMETER_SAMPLE_RATE;
+        if (batch > count - i) batch = count - i;
+        if (batch > FIFO_DEPTH) batch = FIFO_DEPTH;
+        if (i >= tap_start && i < tap_end) {
+            if (batch > tap_end - i) batch = tap_end - i;
+            if (i + batch == tap_end) pedometer_restart(&pedometer);
+        } else {
+            if (i < tap_start && batch > tap_start - i) batch = tap_start - i;
+            pedometer_process(&pedometer, in + i, batch);
+        }
+        i += batch;
+        in_minute += batch;
+        if (in_minute >= PEDOMETER_SAMPLE_RATE * 60 || i == count) {
+            pedometer_minute_t result = pedometer_finish_minute(&pedometer);
+            if (verbose) printf("minute %3zu: %3u steps, %s\n", minute, result.steps, activity_names[result.activity]);
+            if (minutes) minutes[minute] = result;
+            minute++;
+            in_minute = 0;
+        }
+    }
+    if (num_minutes) *num_minutes = minute;
+
+    return pedometer.total_steps;
+}
+
+// appends a synthetic recording: the wrist held at an angle, swinging with the arms at half the step rate, with an
+// impact at every heel strike. step_hz of zero is standing still; a negative step_hz makes isolated gestures
+// instead, an arm raised and lowered every few seconds.
+static size_t synthesize(size_t count, double seconds, double step_hz, double impact_g, unsigned *expected_steps) {
+    double last_step = -10;
+    double next_step = 0.3;
+    size_t end = count + (size_t)(seconds * PEDOMETER_SAMPLE_RATE);
+    *expected_steps = 0;
+
+    for (size_t i = count; i < end && i < MAX_SAMPLES; i++) {
+        double t = (double)(i - count) / PEDOMETER_SAMPLE_RATE;
+        double pitch = 0.6, roll = 0.2;
+        double extra = 0;
+
+        if (step_hz > 0) {
+            pitch += 0.35 * sin(M_PI * step_hz * t);
+            if (t >= next_step) {
+                (*expected_steps)++;
+                last_step = next_step;
+                // a little jitter in the pace, as in real walking.
+                next_step += (1.0 + 0.06 * ((rand() % 200) / 100.0 - 1.0)) / step_hz;
+            }
+            // a short, sharp impact, then a smaller rebound.
+            double since = t - last_step;
+            extra = impact_g * exp(-pow((since - 0.03) / 0.05, 2)) - 0.3 * impact_g * exp(-pow((since - 0.15) / 0.06, 2));
+        } else if (step_hz < 0) {
+            // raise the arm over a second, every five seconds.
+            double phase = fmod(t, 5.0);
+            if (phase < 1.0) {
+                pitch += 1.2 * sin(M_PI * phase);
+                extra = 0.25 * sin(2 * M_PI * phase);
+            }
+        }
+
+        double g = 1.0 + extra;
+        double noise = 0.008;
+        samples[i].x = clamp16(COUNTS_PER_G * (g * sin(roll) * cos(pitch) + noise * ((rand() % 200) / 100.0 - 1.0)));
+        samples[i].y = clamp16(COUNTS_PER_G * (g * sin(pitch) + noise * ((rand() % 200) / 100.0 - 1.0)));
+        samples[i].z = clamp16(COUNTS_PER_G * (g * cos(roll) * cos(pitch) + noise * ((rand() % 200) / 100.0 - 1.0)));
+    }
+
+    return end;
+}
+
+static int self_test(void) {
+    static const struct {
+        const char *name;
+        double minutes;
+        double step_hz;
+        double impact_g;
+        pedometer_activity_t activity;
+        double tap_seconds;     // seconds of tap detection, starting a minute in; those steps aren't expected
+    } scenarios[] = {
+        { "standing still", 2, 0, 0, PEDOMETER_ACTIVITY_STILL, 0 },
+        { "gesturing", 2, -1, 0, PEDOMETER_ACTIVITY_STILL, 0 },
+        { "slow walk", 3, 1.4, 0.25, PEDOMETER_ACTIVITY_WALK, 0 },
+        { "walk", 3, 1.8, 0.35, PEDOMETER_ACTIVITY_WALK, 0 },
+        { "brisk walk", 3, 2.1, 0.45, PEDOMETER_ACTIVITY_WALK, 0 },
+        { "run", 3, 2.7, 0.9, PEDOMETER_ACTIVITY_RUN, 0 },
+        { "walk, taps on", 3, 1.8, 0.35, PEDOMETER_ACTIVITY_WALK, 20 },
+    };
+    int failures = 0;
+
+    srand(1);
+    printf("%-16s %8s %8s %7s  %s\n", "scenario", "expected", "counted", "error", "minutes classified correctly");
+    for (size_t s = 0; s < sizeof(scenarios) / sizeof(scenarios[0]); s++) {
+        unsigned expected, lost = 0, after = 0;
+        size_t count, tap_start = 0, tap_end = 0;
+        if (scenarios[s].tap_seconds > 0) {
+            // three pieces, so the steps in the middle one are known.
+            tap_start = synthesize(0, 60, scenarios[s].step_hz, scenarios[s].impact_g, &expected);
+            tap_end = synthesize(tap_start, scenarios[s].tap_seconds, scenarios[s].step_hz, scenarios[s].impact_g, &lost);
+            count = synthesize(tap_end, scenarios[s].minutes * 60 - 60 - scenarios[s].tap_seconds,
+                               scenarios[s].step_hz, scenarios[s].impact_g, &after);
+            expected += after;
+        } else {
+            count = synthesize(0, scenarios[s].minutes * 60, scenarios[s].step_hz, scenarios[s].impact_g, &expected);
+        }
+        pedometer_minute_t minutes[16];
+        size_t num_minutes;
+        uint32_t counted = replay(samples, count, tap_start, tap_end, minutes, &num_minutes, false);
+        double error = expected ? 100.0 * ((double)counted - expected) / expected : 0;
+        bool count_ok = expected ? fabs(error) <= 5.0 : counted <= 4;
+
+        // the first minute includes the few steps it takes to start counting; judge the ones after.
+        unsigned correct = 0;
+        for (size_t m = 1; m < num_minutes; m++) if (minutes[m].activity == scenarios[s].activity) correct++;
+        bool class_ok = correct == num_minutes - 1;
+
+        printf("%-16s %8u %8u %6.1f%%  %u/%zu%s\n", scenarios[s].name, expected, counted, error, correct, num_minutes - 1,
+               count_ok && class_ok ? "" : "  FAIL");
+        if (!count_ok || !class_ok) failures++;
+    }
+
+    return failures ? 1 : 0;
+}
+
+int main(int argc, char *argv[]) {
+    const char *input = NULL;
+    double scale = 1;
+    long expected = -1;
+
+    for (int i = 1; i < argc; i++) {
+        if (!strcmp(argv[i], "-s") && i + 1 < argc) scale = atof(argv[++i]);
+        else if (!strcmp(argv[i], "-e") && i + 1 < argc) expected = atol(argv[++i]);
+        else input = argv[i];
+    }
+
+    if (input == NULL) return self_test();
+
+    size_t count = load_csv(input, scale);
+    printf("%s: %zu samples, %.1f minutes at %d Hz\n", input, count, count / (60.0 * PEDOMETER_SAMPLE_RATE), PEDOMETER_SAMPLE_RATE);
+    uint32_t total = replay(samples, count, 0, 0, NULL, NULL, true);
+    printf("total: %u steps\n", total);
+
+    if (expected >= 0) {
+        double error = expected ? 100.0 * ((double)total - expected) / expected : 0;
+        printf("expected %ld, off by %.1f%%\n", expected, error);
+        return fabs(error) <= 5.0 ? 0 : 1;
+    }
+
+    return 0;
+}
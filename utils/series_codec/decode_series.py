@@ -0,0 +1,82 @@
+#!/usr/bin/env python3
+# Decodes a file written with filesystem_append_series into CSV, one row per sample.
+# Pull the file off the watch with the shell's b64encode command and paste the output into a file,
+# or pass a raw binary file with --raw. See lib/series_codec/series_codec.h for the encoding.
+#
+# Usage: decode_series.py [--raw] FILE [--names x,y,z]
+import argparse
+import base64
+import sys
+
+
+def read_varint(data, pos):
+    value = 0
+    for i in range(3):
+        if pos + i >= len(data):
+            raise ValueError(f'truncated varint at offset {pos}')
+        byte = data[pos + i]
+        value |= (byte & 0x7f) << (7 * i)
+        if not byte & 0x80:
+            return value, pos + i + 1
+    raise ValueError(f'varint too long at offset {pos}')
+
+
+def zigzag_decode(value):
+    return (value >> 1) ^ -(value & 1)
+
+
+def to_int16(value):
+    value &= 0xffff
+    return value - 0x10000 if value & 0x8000 else value
+
+
+def decode_frames(data):
+    pos = 0
+    while pos < len(data):
+        count, pos = read_varint(data, pos)
+        channels = data[pos]
+        pos += 1
+        payload_length, pos = read_varint(data, pos)
+        payload = data[pos:pos + payload_length]
+        if len(payload) != payload_length:
+            raise ValueError(f'truncated frame at offset {pos}')
+        pos += payload_length
+
+        previous = [0] * channels
+        values = []
+        p = 0
+        while len(values) < count:
+            zz, p = read_varint(payload, p)
+            channel = len(values) % channels
+            previous[channel] = to_int16(previous[channel] + zigzag_decode(zz))
+            values.append(previous[channel])
+        yield channels, values
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Decode a compressed series file from the watch.')
+    parser.add_argument('file')
+    parser.add_argument('--raw', action='store_true', help='the file is raw binary, not base64')
+    parser.add_argument('--names', help='comma-separated column names for the CSV header')
+    args = parser.parse_args()
+
+    with open(args.file, 'rb') as f:
+        data = f.read()
+    if not args.raw:
+        data = base64.b64decode(b''.join(data.split()))
+
+    out = sys.stdout
+    if args.names:
+        out.write(args.names + '\n')
+    frames = 0
+    samples = 0
+    for channels, values in decode_frames(data):
+        frames += 1
+        for i in range(0, len(values), channels):
+            out.write(','.join(str(v) for v in values[i:i + channels]) + '\n')
+            samples += 1
+    print(f'Decoded {samples} samples in {frames} frames from {len(data)} bytes.', file=sys.stderr)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,209 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 Second Movement contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+// Measures lib/series_codec on recorded or synthetic data: compression ratio with the same framing that
+// filesystem_append_series uses, and encode/decode speed. Build and run with:
+//   cc -O2 -I../../lib/series_codec series_bench.c ../../lib/series_codec/series_codec.c -lm -o series_bench
+//   ./series_bench [file.csv [scale]] [-o out.bin]
+// A CSV is read one row per sample, every numeric column a channel (up to eight), for instance the files
+// that utils/motion_express_utilities/process_motion_dump.py produces. Values are multiplied by scale
+// (default 1) and rounded to 16 bits. Without a file, a synthetic walking-wrist accelerometer trace is used.
+// With -o, the compressed frames are written out so that decode_series.py --raw can be checked against them.
+//
+// Cycle counts are host cycles where the CPU exposes a cycle counter, and only useful for comparing codecs
+// with each other; on the watch, expect something like 40-60 cycles per input byte at 4 MHz on the M0+.
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include "series_codec.h"
+
+#define FILESYSTEM_SERIES_MAX_VALUES 96 // see filesystem/filesystem.h
+#define MAX_VALUES (1 << 20)
+#define REPEATS 50
+
+static int16_t values[MAX_VALUES];
+static int16_t decoded[MAX_VALUES];
+static uint8_t encoded[SERIES_CODEC_MAX_ENCODED_SIZE(MAX_VALUES) + MAX_VALUES / FILESYSTEM_SERIES_MAX_VALUES * 6 + 6];
+
+static uint64_t now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + ts.tv_nsec;
+}
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define HAVE_CYCLES 1
+static uint64_t now_cycles(void) { return __rdtsc(); }
+#else
+#define HAVE_CYCLES 0
+static uint64_t now_cycles(void) { return 0; }
+#endif
+
+static size_t load_csv(const char *path, double scale, uint8_t *channels) {
+    FILE *f = fopen(path, "r");
+    if (f == NULL) {
+        perror(path);
+        exit(1);
+    }
+    char line[512];
+    size_t count = 0;
+    *channels = 0;
+    while (fgets(line, sizeof(line), f) && count + SERIES_CODEC_MAX_CHANNELS < MAX_VALUES) {
+        int16_t row[SERIES_CODEC_MAX_CHANNELS];
+        uint8_t n = 0;
+        char *p = line;
+        while (*p && n < SERIES_CODEC_MAX_CHANNELS) {
+            char *end;
+            double v = strtod(p, &end);
+            if (end == p) break;
+            v = round(v * scale);
+            row[n++] = v > INT16_MAX ? INT16_MAX : (v < INT16_MIN ? INT16_MIN : (int16_t)v);
+            p = end;
+            while (*p == ',' || *p == ' ' || *p == '\t') p++;
+        }
+        // skip headers, and any row that doesn't match the first one.
+        if (n == 0) continue;
+        if (*channels == 0) *channels = n;
+        if (n != *channels) continue;
+        memcpy(values + count, row, n * sizeof(int16_t));
+        count += n;
+    }
+    fclose(f);
+
+    return count;
+}
+
+// 25 Hz, three axes in LIS2DW 14-bit counts: gravity mostly on z, a 1 Hz arm swing, and sensor noise.
+static size_t synthesize(uint8_t *channels) {
+    size_t count = 0;
+    srand(1);
+    for (int i = 0; i < 25 * 60 * 10; i++) {
+        double t = i / 25.0;
+        double swing = sin(2 * M_PI * t);
+        values[count++] = (int16_t)(300 * swing + rand() % 24 - 12);
+        values[count++] = (int16_t)(120 * cos(2 * M_PI * t) + rand() % 24 - 12);
+        values[count++] = (int16_t)(4096 - 200 * swing * swing + rand() % 24 - 12);
+    }
+    *channels = 3;
+
+    return count;
+}
+
+// frames exactly as filesystem_append_series writes them.
+static size_t encode_frames(const int16_t *in, size_t count, uint8_t channels, uint8_t *out) {
+    size_t length = 0;
+    size_t per_frame = FILESYSTEM_SERIES_MAX_VALUES - FILESYSTEM_SERIES_MAX_VALUES % channels;
+    for (size_t i = 0; i < count; i += per_frame) {
+        size_t n = count - i < per_frame ? count - i : per_frame;
+        uint8_t payload[SERIES_CODEC_MAX_ENCODED_SIZE(FILESYSTEM_SERIES_MAX_VALUES)];
+        series_codec_state_t state;
+        series_codec_init(&state, channels);
+        size_t payload_length = series_codec_encode(&state, in + i, n, payload);
+        length += series_codec_put_varint(out + length, n);
+        out[length++] = channels;
+        length += series_codec_put_varint(out + length, payload_length);
+        memcpy(out + length, payload, payload_length);
+        length += payload_length;
+    }
+
+    return length;
+}
+
+static size_t decode_frames(const uint8_t *in, size_t length, int16_t *out) {
+    size_t pos = 0;
+    size_t count = 0;
+    while (pos < length) {
+        uint16_t n, payload_length;
+        pos += series_codec_get_varint(in + pos, length - pos, &n);
+        uint8_t channels = in[pos++];
+        pos += series_codec_get_varint(in + pos, length - pos, &payload_length);
+        series_codec_state_t state;
+        series_codec_init(&state, channels);
+        count += series_codec_decode(&state, in + pos, payload_length, out + count, n);
+        pos += payload_length;
+    }
+
+    return count;
+}
+
+int main(int argc, char **argv) {
+    const char *input = NULL;
+    const char *output = NULL;
+    double scale = 1;
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "-o") == 0 && i + 1 < argc) output = argv[++i];
+        else if (input == NULL) input = argv[i];
+        else scale = atof(argv[i]);
+    }
+
+    uint8_t channels;
+    size_t count = input ? load_csv(input, scale, &channels) : synthesize(&channels);
+    if (count == 0) {
+        fprintf(stderr, "no samples\n");
+        return 1;
+    }
+
+    size_t raw_bytes = count * sizeof(int16_t);
+    size_t length = 0;
+    uint64_t t0 = now_ns(), c0 = now_cycles();
+    for (int r = 0; r < REPEATS; r++) length = encode_frames(values, count, channels, encoded);
+    uint64_t encode_ns = now_ns() - t0, encode_cycles = now_cycles() - c0;
+
+    size_t decoded_count = 0;
+    t0 = now_ns(); c0 = now_cycles();
+    for (int r = 0; r < REPEATS; r++) decoded_count = decode_frames(encoded, length, decoded);
+    uint64_t decode_ns = now_ns() - t0, decode_cycles = now_cycles() - c0;
+
+    if (decoded_count != count || memcmp(values, decoded, raw_bytes) != 0) {
+        fprintf(stderr, "round trip FAILED\n");
+        return 1;
+    }
+
+    double total_bytes = (double)raw_bytes * REPEATS;
+    printf("%s: %zu samples x %u channels\n", input ? input : "synthetic accelerometer", count / channels, channels);
+    printf("raw %zu bytes, compressed %zu bytes, ratio %.2f:1 (%.2f bits/value)\n",
+           raw_bytes, length, (double)raw_bytes / length, 8.0 * length / count);
+    printf("encode %.2f ns/byte", encode_ns / total_bytes);
+    if (HAVE_CYCLES) printf(", %.2f cycles/byte", encode_cycles / total_bytes);
+    printf("\ndecode %.2f ns/byte", decode_ns / total_bytes);
+    if (HAVE_CYCLES) printf(", %.2f cycles/byte", decode_cycles / total_bytes);
+    printf("\n");
+
+    if (output) {
+        FILE *f = fopen(output, "wb");
+        if (f == NULL) {
+            perror(output);
+            return 1;
+        }
+        fwrite(encoded, 1, length, f);
+        fclose(f);
+    }
+
+    return 0;
+}
@@ -0,0 +1,256 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 Second Movement contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+// Replays nights of orientation changes through lib/sleep_tracker, the same code the watch runs, minute by
+// minute the way Movement drives it, and checks the stored buckets and the current budget.
+// Build with:
+//   cc -O2 -I../../lib/sleep_tracker sleep_tracker_replay.c ../../lib/sleep_tracker/sleep_tracker.c
+//      -o sleep_tracker_replay
+// Then:
+//   ./sleep_tracker_replay                 runs synthetic nights (restful, restless, with missed stores, and a
+//                                          day of wear), and fails if a bucket disagrees with a direct count of
+//                                          its events, changes go missing, or a night goes over budget
+//   ./sleep_tracker_replay events.txt      replays a recording: one UNIX time per line for each change
+// The budget is the one in sleep_tracker.h: each change costs one wake of SLEEP_TRACKER_WAKE_MICROSECONDS, each
+// hourly store SLEEP_TRACKER_STORE_MICROCOULOMBS, and the accelerometer draws SLEEP_TRACKER_ACCELEROMETER_NANOAMPS,
+// its low energy mode figure, for the whole replay.
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+#include "sleep_tracker.h"
+
+#define MAX_EVENTS 100000
+#define MAX_BUCKETS (24 * 60 * 60 / SLEEP_TRACKER_BUCKET_SECONDS * 2)
+
+// 2024-06-01 21:00 UTC
+#define EVENING 1717275600
+
+static uint32_t events[MAX_EVENTS];
+static size_t num_events;
+
+// what would be in sleep.bin, plus the number of stores it took.
+static sleep_tracker_bucket_t stored[MAX_BUCKETS];
+static size_t num_stored;
+static uint32_t num_stores;
+
+static uint32_t rng_state = 1;
+
+static uint32_t rng(uint32_t range) {
+    rng_state = rng_state * 1664525 + 1013904223;
+    return (rng_state >> 8) % range;
+}
+
+static void add_event(uint32_t t) {
+    if (num_events < MAX_EVENTS) events[num_events++] = t;
+}
+
+static int compare_times(const void *a, const void *b) {
+    uint32_t x = *(const uint32_t *)a, y = *(const uint32_t *)b;
+    return x < y ? -1 : x > y;
+}
+
+static void store(sleep_tracker_t *tracker) {
+    num_stores++;
+    num_stored += sleep_tracker_take(tracker, stored + num_stored, SLEEP_TRACKER_RING_SIZE);
+}
+
+/// Drives the tracker through [start, end) a minute at a time, storing at the top of each hour except in
+/// [skip_stores_from, skip_stores_until).
+static void replay(uint32_t start, uint32_t end, uint32_t skip_stores_from, uint32_t skip_stores_until, uint8_t *dropped) {
+    sleep_tracker_t tracker;
+    size_t next_event = 0;
+
+    num_stored = 0;
+    num_stores = 0;
+    sleep_tracker_init(&tracker, start);
+
+    for (uint32_t now = start + 60; now <= end; now += 60) {
+        uint16_t changes = 0;
+        while (next_event < num_events && events[next_event] < now) {
+            next_event++;
+            changes++;
+        }
+        sleep_tracker_count(&tracker, now, changes);
+        if (now % 3600 == 0 && !(now >= skip_stores_from && now < skip_stores_until)) store(&tracker);
+    }
+
+    // as when tracking is turned off.
+    sleep_tracker_close(&tracker);
+    store(&tracker);
+    *dropped = tracker.dropped;
+}
+
+/// Checks every stored bucket against a direct count of the events in it. Returns the number of mismatches.
+static uint32_t check_buckets(void) {
+    uint32_t mismatches = 0;
+
+    for (size_t i = 0; i < num_stored; i++) {
+        uint32_t from = stored[i].bit.index * SLEEP_TRACKER_BUCKET_SECONDS;
+        uint32_t to = from + SLEEP_TRACKER_BUCKET_SECONDS;
+        uint32_t expected = 0;
+        for (size_t j = 0; j < num_events; j++) {
+            if (events[j] >= from && events[j] < to) expected++;
+        }
+        if (expected > 255) expected = 255;
+        if (stored[i].bit.changes != expected) mismatches++;
+    }
+
+    return mismatches;
+}
+
+static double average_nanoamps(uint32_t seconds) {
+    // microseconds times microamps is picocoulombs.
+    double picocoulombs = (double)num_events * SLEEP_TRACKER_WAKE_MICROSECONDS * SLEEP_TRACKER_ACTIVE_MICROAMPS
+                        + (double)num_stores * SLEEP_TRACKER_STORE_MICROCOULOMBS * 1e6;
+
+    return picocoulombs / seconds / 1000.0 + SLEEP_TRACKER_ACCELEROMETER_NANOAMPS;
+}
+
+static void print_buckets(void) {
+    // one character per bucket, an hour to a line: . for none, then 1-9, then # for ten or more.
+    for (size_t i = 0; i < num_stored; i++) {
+        uint32_t changes = stored[i].bit.changes;
+        if (i % 12 == 0) {
+            uint32_t t = stored[i].bit.index * SLEEP_TRACKER_BUCKET_SECONDS;
+            printf("  %02u:%02u ", (unsigned)(t / 3600 % 24), (unsigned)(t / 60 % 60));
+        }
+        putchar(changes == 0 ? '.' : (changes < 10 ? '0' + changes : '#'));
+        if (i % 12 == 11 || i == num_stored - 1) putchar('\n');
+    }
+}
+
+/// Scatters changes through [from, to): every so often a burst of them, as a sleeper rolls over.
+static void synthesize(uint32_t from, uint32_t to, uint32_t mean_gap, uint32_t max_burst) {
+    uint32_t t = from + rng(mean_gap);
+    while (t < to) {
+        uint32_t burst = 1 + rng(max_burst);
+        for (uint32_t i = 0; i < burst && t < to; i++) {
+            add_event(t);
+            t += 1 + rng(4);
+        }
+        t += mean_gap / 2 + rng(mean_gap);
+    }
+}
+
+typedef struct {
+    const char *name;
+    uint32_t hours;
+    uint32_t skip_stores_from, skip_stores_until;   // hours after the start
+    bool expect_drops;
+} scenario_t;
+
+static bool run_scenario(const scenario_t *s) {
+    uint32_t start = EVENING;
+    uint32_t end = start + s->hours * 3600;
+    uint8_t dropped;
+
+    qsort(events, num_events, sizeof(events[0]), compare_times);
+    replay(start, end, start + s->skip_stores_from * 3600, start + s->skip_stores_until * 3600, &dropped);
+
+    uint32_t stored_changes = 0;
+    for (size_t i = 0; i < num_stored; i++) stored_changes += stored[i].bit.changes;
+    uint32_t mismatches = check_buckets();
+    double nanoamps = average_nanoamps(end - start);
+    bool ok = mismatches == 0 && nanoamps <= SLEEP_TRACKER_BUDGET_NANOAMPS;
+    if (!s->expect_drops) ok = ok && dropped == 0 && stored_changes == num_events;
+    else ok = ok && dropped > 0;
+
+    printf("%s: %zu changes, %zu buckets in %u stores, %u dropped, %u mismatched; %.0f nA average (budget %d)%s\n",
+           s->name, num_events, num_stored, num_stores, dropped, mismatches, nanoamps, SLEEP_TRACKER_BUDGET_NANOAMPS,
+           ok ? "" : "  FAIL");
+    print_buckets();
+
+    return ok;
+}
+
+static int self_test(void) {
+    bool ok = true;
+
+    // settling in, a few roll-overs a night, and up at seven.
+    num_events = 0;
+    synthesize(EVENING, EVENING + 2 * 3600, 20, 3);
+    synthesize(EVENING + 2 * 3600, EVENING + 10 * 3600, 40 * 60, 4);
+    synthesize(EVENING + 10 * 3600, EVENING + 12 * 3600, 20, 3);
+    ok &= run_scenario(&(scenario_t){ "restful night", 12, 0, 0, false });
+
+    // tossing and turning, and up for a while at three.
+    num_events = 0;
+    synthesize(EVENING, EVENING + 2 * 3600, 20, 3);
+    synthesize(EVENING + 2 * 3600, EVENING + 6 * 3600, 5 * 60, 5);
+    synthesize(EVENING + 6 * 3600, EVENING + 6 * 3600 + 1800, 15, 3);
+    synthesize(EVENING + 6 * 3600 + 1800, EVENING + 10 * 3600, 8 * 60, 5);
+    synthesize(EVENING + 10 * 3600, EVENING + 12 * 3600, 20, 3);
+    ok &= run_scenario(&(scenario_t){ "restless night", 12, 0, 0, false });
+
+    // the filesystem was busy for an hour: the ring holds on until the next store.
+    ok &= run_scenario(&(scenario_t){ "one store missed", 12, 3, 4, false });
+
+    // three missed stores are more than the ring holds, so the oldest buckets go.
+    ok &= run_scenario(&(scenario_t){ "three stores missed", 12, 3, 6, true });
+
+    // the worst case for current: a busy day, awake and moving, wearing the watch throughout.
+    num_events = 0;
+    synthesize(EVENING, EVENING + 24 * 3600, 6, 3);
+    ok &= run_scenario(&(scenario_t){ "day of wear", 24, 0, 0, false });
+
+    printf(ok ? "all scenarios passed\n" : "some scenarios FAILED\n");
+
+    return ok ? 0 : 1;
+}
+
+int main(int argc, char *argv[]) {
+    if (argc < 2) return self_test();
+
+    FILE *f = fopen(argv[1], "r");
+    if (f == NULL) {
+        perror(argv[1]);
+        return 1;
+    }
+    unsigned long t;
+    num_events = 0;
+    while (fscanf(f, "%lu", &t) == 1) add_event(t);
+    fclose(f);
+    if (num_events == 0) {
+        printf("%s: no events\n", argv[1]);
+        return 1;
+    }
+    qsort(events, num_events, sizeof(events[0]), compare_times);
+
+    // start at the top of the hour before the first change, and run to the top of the hour after the last.
+    uint32_t start = events[0] - events[0] % 3600;
+    uint32_t hours = (events[num_events - 1] - start) / 3600 + 1;
+    uint8_t dropped;
+    replay(start, start + hours * 3600, 0, 0, &dropped);
+    uint32_t mismatches = check_buckets();
+    double nanoamps = average_nanoamps(hours * 3600);
+    printf("%s: %zu changes over %u hours, %zu buckets, %u mismatched; %.0f nA average (budget %d)\n",
+           argv[1], num_events, hours, num_stored, mismatches, nanoamps, SLEEP_TRACKER_BUDGET_NANOAMPS);
+    print_buckets();
+
+    return (mismatches == 0 && nanoamps <= SLEEP_TRACKER_BUDGET_NANOAMPS) ? 0 : 1;
+}
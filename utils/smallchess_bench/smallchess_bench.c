@@ -0,0 +1,261 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 Second Movement contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+// Checks smallchesslib's move generator with perft counts from well known positions, then compares the AI the
+// smallchess face used to call (SCL_getAIMove at a fixed depth 3) with the sliced iterative-deepening search
+// (SCL_searchInit/SCL_searchStep) on node counts, time and the depth reached, and plays the two against each
+// other with the search limited to the face's node budget. Build and run with:
+//   cc -O2 -I../../legacy/lib/smallchesslib smallchess_bench.c -o smallchess_bench && ./smallchess_bench
+// Pass -q to skip the match, which takes a while.
+
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+
+#define SCL_COUNT_EVALUATED_POSITIONS 1
+#include "smallchesslib.h"
+
+// the face's search limits; see legacy/watch_faces/complication/smallchess_face.c
+#define FACE_MAX_DEPTH 6
+#define FACE_EXTENSION_DEPTH 2
+#define FACE_NODES_PER_TICK 24
+#define FACE_THINK_TICKS 160
+
+#define MATCH_MAX_PLY 160
+
+static double now_ms(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e3 + ts.tv_nsec / 1e6;
+}
+
+static uint64_t perft(SCL_Board board, uint8_t depth) {
+    if (depth == 0) return 1;
+
+    uint64_t total = 0;
+    uint8_t white = SCL_boardWhitesTurn(board);
+
+    for (uint8_t i = 0; i < SCL_BOARD_SQUARES; i++) {
+        if (board[i] == '.' || SCL_pieceIsWhite(board[i]) != white) continue;
+
+        SCL_SquareSet moves;
+        SCL_squareSetClear(moves);
+        SCL_boardGetMoves(board, i, moves);
+
+        SCL_SQUARE_SET_ITERATE_BEGIN(moves)
+            if (depth == 1) {
+                total++;
+            } else {
+                SCL_MoveUndo undo = SCL_boardMakeMove(board, i, iteratedSquare, 'q');
+                total += perft(board, depth - 1);
+                SCL_boardUndoMove(board, undo);
+            }
+        SCL_SQUARE_SET_ITERATE_END
+    }
+
+    return total;
+}
+
+// Perft counts from the Chess Programming Wiki. smallchesslib only ever promotes to a queen, so these stop before
+// the first promotion.
+static const struct {
+    const char *name;
+    const char *fen;
+    uint64_t counts[5];
+} perft_positions[] = {
+    { "start", SCL_FEN_START, { 20, 400, 8902, 197281, 0 } },
+    { "kiwipete", "r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1", { 48, 2039, 97862, 0, 0 } },
+    { "position 3", "8/2p5/3p4/KP5r/1R3p1k/8/4P1P1/8 w - - 0 1", { 14, 191, 2812, 43238, 674624 } },
+};
+
+static int check_perft(void) {
+    int failures = 0;
+
+    printf("%-12s %5s %10s %10s %9s\n", "perft", "depth", "expected", "counted", "ms");
+    for (size_t p = 0; p < sizeof(perft_positions) / sizeof(perft_positions[0]); p++) {
+        SCL_Board board;
+        SCL_boardFromFEN(board, perft_positions[p].fen);
+        for (uint8_t depth = 1; depth <= 5 && perft_positions[p].counts[depth - 1]; depth++) {
+            double start = now_ms();
+            uint64_t count = perft(board, depth);
+            double elapsed = now_ms() - start;
+            uint64_t expected = perft_positions[p].counts[depth - 1];
+            printf("%-12s %5u %10llu %10llu %9.1f%s\n", perft_positions[p].name, depth, (unsigned long long)expected,
+                   (unsigned long long)count, elapsed, count == expected ? "" : "  MISMATCH");
+            if (count != expected) failures++;
+        }
+    }
+
+    return failures;
+}
+
+typedef struct {
+    uint8_t from, to;
+    uint32_t nodes;
+    uint8_t depth;
+    double ms;
+} ai_result_t;
+
+static SCL_Search search;
+
+static void old_ai(SCL_Game *game, ai_result_t *result) {
+    uint8_t rep_from, rep_to;
+    char prom;
+
+    SCL_gameGetRepetiotionMove(game, &rep_from, &rep_to);
+    SCL_positionsEvaluated = 0;
+    double start = now_ms();
+    SCL_getAIMove(game->board, 3, 0, 0, SCL_boardEvaluateStatic, NULL, 0, rep_from, rep_to,
+                  &result->from, &result->to, &prom);
+    result->ms = now_ms() - start;
+    result->nodes = SCL_positionsEvaluated;
+    result->depth = 3;
+}
+
+// searches the way the face does: FACE_NODES_PER_TICK nodes a tick, for at most FACE_THINK_TICKS ticks.
+static void new_ai(SCL_Game *game, uint8_t max_depth, uint16_t ticks, ai_result_t *result) {
+    uint8_t rep_from, rep_to;
+    char prom;
+
+    SCL_gameGetRepetiotionMove(game, &rep_from, &rep_to);
+    double start = now_ms();
+    SCL_searchInit(&search, game->board, max_depth, FACE_EXTENSION_DEPTH, SCL_boardEvaluateStatic, rep_from, rep_to);
+    for (uint16_t tick = 0; tick < ticks; tick++) {
+        if (SCL_searchStep(&search, FACE_NODES_PER_TICK)) break;
+    }
+    SCL_searchGetMove(&search, &result->from, &result->to, &prom);
+    result->ms = now_ms() - start;
+    result->nodes = search.nodes;
+    result->depth = search.completedDepth;
+}
+
+static const char *test_positions[] = {
+    SCL_FEN_START,
+    "r1bqkbnr/pppp1ppp/2n5/4p3/4P3/5N2/PPPP1PPP/RNBQKB1R w KQkq - 2 3",
+    "r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1",
+    "6k1/5ppp/8/8/8/8/5PPP/3R2K1 w - - 0 1", // back rank mate in one
+    "r1bqkb1r/pppp1ppp/2n2n2/4p2Q/2B1P3/8/PPPP1PPP/RNB1K1NR w KQkq - 4 4", // scholar's mate
+    "8/8/4k3/8/2K5/8/3Q4/8 w - - 0 1",
+};
+
+static void compare_nodes(void) {
+    char move[8];
+
+    printf("\n%-6s %-8s %8s %8s  %-8s %8s %8s %5s  %-8s %8s %8s\n", "pos", "depth 3", "nodes", "ms",
+           "search 3", "nodes", "ms", "depth", "face", "nodes", "ms");
+    for (size_t p = 0; p < sizeof(test_positions) / sizeof(test_positions[0]); p++) {
+        SCL_Game game;
+        SCL_Board board;
+        ai_result_t old_result, fixed_result, face_result;
+
+        SCL_boardFromFEN(board, test_positions[p]);
+        SCL_gameInit(&game, board);
+        old_ai(&game, &old_result);
+        new_ai(&game, 3, UINT16_MAX, &fixed_result);
+        new_ai(&game, FACE_MAX_DEPTH, FACE_THINK_TICKS, &face_result);
+
+        printf("%-6zu %-8s %8u %8.1f", p, SCL_moveToString(board, old_result.from, old_result.to, 'q', move),
+               old_result.nodes, old_result.ms);
+        printf("  %-8s %8u %8.1f", SCL_moveToString(board, fixed_result.from, fixed_result.to, 'q', move),
+               fixed_result.nodes, fixed_result.ms);
+        printf(" %5u  %-8s %8u %8.1f\n", face_result.depth, SCL_moveToString(board, face_result.from, face_result.to, 'q', move),
+               face_result.nodes, face_result.ms);
+    }
+}
+
+// a few openings, so that the deterministic engines don't play the same game over and over.
+static const char *openings[] = {
+    "",
+    "e2e4 e7e5",
+    "d2d4 d7d5",
+    "e2e4 c7c5",
+    "d2d4 g8f6 c2c4 e7e6",
+    "c2c4 e7e5",
+    "g1f3 d7d5",
+    "e2e4 e7e6 d2d4 d7d5",
+};
+
+// plays one game; returns 1 if the sliced search won, -1 if the fixed depth AI won, 0 for a draw.
+static int play(const char *opening, uint8_t search_is_white, double *old_ms, double *new_ms, uint32_t *old_moves,
+                uint32_t *new_moves) {
+    SCL_Game game;
+    SCL_gameInit(&game, 0);
+
+    while (*opening) {
+        uint8_t from, to;
+        char prom;
+        SCL_stringToMove(opening, &from, &to, &prom);
+        SCL_gameMakeMove(&game, from, to, 'q');
+        opening += 4;
+        while (*opening == ' ') opening++;
+    }
+
+    while (game.state == SCL_GAME_STATE_PLAYING && game.ply < MATCH_MAX_PLY) {
+        ai_result_t result;
+        if (SCL_boardWhitesTurn(game.board) == search_is_white) {
+            new_ai(&game, FACE_MAX_DEPTH, FACE_THINK_TICKS, &result);
+            *new_ms += result.ms;
+            (*new_moves)++;
+        } else {
+            old_ai(&game, &result);
+            *old_ms += result.ms;
+            (*old_moves)++;
+        }
+        SCL_gameMakeMove(&game, result.from, result.to, 'q');
+    }
+
+    if (game.state == SCL_GAME_STATE_WHITE_WIN) return search_is_white ? 1 : -1;
+    if (game.state == SCL_GAME_STATE_BLACK_WIN) return search_is_white ? -1 : 1;
+    return 0;
+}
+
+static void match(void) {
+    int wins = 0, draws = 0, losses = 0;
+    double old_ms = 0, new_ms = 0;
+    uint32_t old_moves = 0, new_moves = 0;
+
+    printf("\nsliced search (face budget) vs depth 3, %u ply limit:\n", MATCH_MAX_PLY);
+    for (size_t o = 0; o < sizeof(openings) / sizeof(openings[0]); o++) {
+        for (uint8_t white = 0; white < 2; white++) {
+            int result = play(openings[o], white, &old_ms, &new_ms, &old_moves, &new_moves);
+            if (result > 0) wins++;
+            else if (result < 0) losses++;
+            else draws++;
+        }
+    }
+    printf("  +%d =%d -%d\n", wins, draws, losses);
+    printf("  average time per move: depth 3 %.1f ms, sliced search %.1f ms\n", old_ms / old_moves, new_ms / new_moves);
+}
+
+int main(int argc, char **argv) {
+    int failures = check_perft();
+
+    compare_nodes();
+    if (!(argc > 1 && !strcmp(argv[1], "-q"))) match();
+
+    if (failures) printf("\n%d perft mismatches\n", failures);
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,54 @@
+#!/bin/bash
+# Builds and runs sunriset_bench, then, if the ARM toolchain is installed, links each implementation into a
+# minimal Cortex-M0+ program and compares their size including whatever they pull in from libm and libgcc.
+set -e
+cd "$(dirname "$0")"
+
+cc -O2 -I../../lib/sunriset sunriset_bench.c ../../lib/sunriset/sunriset.c ../../lib/sunriset/sunriset_fixed.c \
+    -lm -o sunriset_bench
+./sunriset_bench
+rm -f sunriset_bench
+
+if ! command -v arm-none-eabi-gcc > /dev/null; then
+    echo
+    echo "arm-none-eabi-gcc not found; skipping the size comparison."
+    exit 0
+fi
+
+TMP=$(mktemp -d)
+trap 'rm -rf "$TMP"' EXIT
+ARMFLAGS="-mcpu=cortex-m0plus -mthumb -Os -ffunction-sections -fdata-sections -I../../lib/sunriset"
+LDFLAGS="-specs=nano.specs -specs=nosys.specs -Wl,--gc-sections"
+
+cat > "$TMP/double.c" << 'END'
+#include "sunriset.h"
+volatile int year = 2025, month = 6, day = 21;
+volatile double lon = -73.97, lat = 40.78, rise, set;
+int main(void) { double r, s; sun_rise_set(year, month, day, lon, lat, &r, &s); rise = r; set = s; return 0; }
+END
+cat > "$TMP/fixed.c" << 'END'
+#include "sunriset_fixed.h"
+volatile int year = 2025, month = 6, day = 21;
+volatile int lon = -7397, lat = 4078, rise, set;
+int main(void) {
+    int32_t r, s;
+    sunriset_fixed(year, month, day, sunriset_fixed_angle_from_hundredths(lon), sunriset_fixed_angle_from_hundredths(lat),
+                   SUNRISET_ALTITUDE_RISE_SET, 1, &r, &s);
+    rise = r; set = s; return 0;
+}
+END
+cat > "$TMP/empty.c" << 'END'
+int main(void) { return 0; }
+END
+
+arm-none-eabi-gcc $ARMFLAGS $LDFLAGS "$TMP/empty.c" -o "$TMP/empty.elf"
+arm-none-eabi-gcc $ARMFLAGS $LDFLAGS "$TMP/double.c" ../../lib/sunriset/sunriset.c -lm -o "$TMP/double.elf"
+arm-none-eabi-gcc $ARMFLAGS $LDFLAGS "$TMP/fixed.c" ../../lib/sunriset/sunriset_fixed.c -o "$TMP/fixed.elf"
+
+base=$(arm-none-eabi-size -A "$TMP/empty.elf" | awk '$1 == ".text" { print $2 }')
+echo
+echo "flash used on a Cortex-M0+, over an empty program:"
+for impl in double fixed; do
+    text=$(arm-none-eabi-size -A "$TMP/$impl.elf" | awk '$1 == ".text" { print $2 }')
+    echo "  $impl: $((text - base)) bytes"
+done
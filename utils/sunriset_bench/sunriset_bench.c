@@ -0,0 +1,178 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 Second Movement contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+// Compares lib/sunriset/sunriset_fixed.c against the double precision sunriset.c it was ported from: every day of
+// a year, plus one day a month across the RTC's whole range, for latitudes from 65 S to 65 N and longitudes all the
+// way around, at all four reference altitudes. Fails if any rise, set or day length differs by more than a minute.
+// Then times both. Build and run with:
+//   cc -O2 -I../../lib/sunriset sunriset_bench.c ../../lib/sunriset/sunriset.c ../../lib/sunriset/sunriset_fixed.c
+//      -lm -o sunriset_bench && ./sunriset_bench
+// or use run.sh, which also compares code size for the watch when arm-none-eabi-gcc is installed.
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <math.h>
+#include <time.h>
+#include "sunriset.h"
+#include "sunriset_fixed.h"
+
+#define TOLERANCE_SECONDS 60
+
+static const struct {
+    const char *name;
+    double altitude;
+    sunriset_angle_t fixed_altitude;
+    int upper_limb;
+} altitudes[] = {
+    { "rise/set", -35.0 / 60.0, SUNRISET_ALTITUDE_RISE_SET, 1 },
+    { "civil", -6.0, SUNRISET_ALTITUDE_CIVIL, 0 },
+    { "nautical", -12.0, SUNRISET_ALTITUDE_NAUTICAL, 0 },
+    { "astronomical", -18.0, SUNRISET_ALTITUDE_ASTRONOMICAL, 0 },
+};
+
+#define NUM_ALTITUDES (sizeof(altitudes) / sizeof(altitudes[0]))
+
+static struct {
+    uint32_t cases;
+    uint32_t boundary_flips;
+    uint32_t failures;
+    double max_error[NUM_ALTITUDES];
+    double sum_error[NUM_ALTITUDES];
+    uint32_t count[NUM_ALTITUDES];
+} results;
+
+static const int days_in_month[] = { 31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31 };
+
+static void record(size_t a, double error, int year, int month, int day, int lat, int lon, const char *what) {
+    error = fabs(error);
+    if (error > results.max_error[a]) results.max_error[a] = error;
+    results.sum_error[a] += error;
+    results.count[a]++;
+    if (error > TOLERANCE_SECONDS) {
+        if (results.failures++ < 10) {
+            printf("FAIL %04d-%02d-%02d lat %+.2f lon %+.2f %s %s: off by %.0f s\n",
+                   year, month, day, lat / 100.0, lon / 100.0, altitudes[a].name, what, error);
+        }
+    }
+}
+
+// lat and lon in hundredths of a degree, as movement_location_t stores them.
+static void compare(int year, int month, int day, int lat, int lon) {
+    sunriset_angle_t fixed_lat = sunriset_fixed_angle_from_hundredths(lat);
+    sunriset_angle_t fixed_lon = sunriset_fixed_angle_from_hundredths(lon);
+
+    for (size_t a = 0; a < NUM_ALTITUDES; a++) {
+        double rise, set;
+        int32_t fixed_rise, fixed_set;
+        int rc = __sunriset__(year, month, day, lon / 100.0, lat / 100.0, altitudes[a].altitude, altitudes[a].upper_limb, &rise, &set);
+        int fixed_rc = sunriset_fixed(year, month, day, fixed_lon, fixed_lat, altitudes[a].fixed_altitude, altitudes[a].upper_limb, &fixed_rise, &fixed_set);
+        double len = __daylen__(year, month, day, lon / 100.0, lat / 100.0, altitudes[a].altitude, altitudes[a].upper_limb);
+        int32_t fixed_len = daylen_fixed(year, month, day, fixed_lon, fixed_lat, altitudes[a].fixed_altitude, altitudes[a].upper_limb);
+
+        results.cases++;
+        record(a, fixed_len - len * 3600.0, year, month, day, lat, lon, "day length");
+
+        if (rc != fixed_rc) {
+            // the Sun just grazes the altitude: one version rounded to "always above" or "always below", and the
+            // other found a rise and set that should be within moments of each other or a day apart.
+            double arc = rc == 0 ? (set - rise) * 1800.0 : (fixed_set - fixed_rise) / 2.0;
+            if (arc > TOLERANCE_SECONDS && arc < 43200 - TOLERANCE_SECONDS) {
+                if (results.failures++ < 10) {
+                    printf("FAIL %04d-%02d-%02d lat %+.2f lon %+.2f %s: returned %d, expected %d\n",
+                           year, month, day, lat / 100.0, lon / 100.0, altitudes[a].name, fixed_rc, rc);
+                }
+            }
+            results.boundary_flips++;
+            continue;
+        }
+        record(a, fixed_rise - rise * 3600.0, year, month, day, lat, lon, "rise");
+        record(a, fixed_set - set * 3600.0, year, month, day, lat, lon, "set");
+    }
+}
+
+static void sweep(int year, int month, int day) {
+    for (int lat = -6500; lat <= 6500; lat += 250) {
+        for (int lon = -18000; lon < 18000; lon += 1125) {
+            compare(year, month, day, lat, lon);
+        }
+    }
+}
+
+static void benchmark(void) {
+    const int iterations = 200000;
+    volatile double sink_double = 0;
+    volatile int32_t sink_fixed = 0;
+    clock_t start;
+
+    start = clock();
+    for (int i = 0; i < iterations; i++) {
+        double rise, set;
+        __sunriset__(2025, 1 + i % 12, 1 + i % 28, -73.97 + (i % 50), 40.78 - (i % 80), -35.0 / 60.0, 1, &rise, &set);
+        sink_double += rise + set;
+    }
+    double double_ns = (double)(clock() - start) / CLOCKS_PER_SEC * 1e9 / iterations;
+
+    start = clock();
+    for (int i = 0; i < iterations; i++) {
+        int32_t rise, set;
+        sunriset_fixed(2025, 1 + i % 12, 1 + i % 28, sunriset_fixed_angle_from_hundredths(-7397 + (i % 50) * 100),
+                       sunriset_fixed_angle_from_hundredths(4078 - (i % 80) * 100), SUNRISET_ALTITUDE_RISE_SET, 1, &rise, &set);
+        sink_fixed += rise + set;
+    }
+    double fixed_ns = (double)(clock() - start) / CLOCKS_PER_SEC * 1e9 / iterations;
+
+    printf("\nhost time per call: double %.0f ns, fixed %.0f ns\n", double_ns, fixed_ns);
+    printf("(the host has an FPU; on the watch, every double operation is a libgcc call.)\n");
+}
+
+int main(void) {
+    // every day of one year...
+    for (int month = 1; month <= 12; month++) {
+        for (int day = 1; day <= days_in_month[month - 1]; day++) {
+            sweep(2025, month, day);
+        }
+    }
+    // ...and around the solstices and equinoxes of every year the RTC can represent.
+    for (int year = 2020; year <= 2083; year++) {
+        for (int month = 3; month <= 12; month += 3) {
+            sweep(year, month, 21);
+        }
+    }
+
+    printf("%u comparisons, %u where the Sun just grazes the altitude\n", results.cases, results.boundary_flips);
+    printf("%-14s %12s %12s\n", "altitude", "max err (s)", "mean err (s)");
+    for (size_t a = 0; a < NUM_ALTITUDES; a++) {
+        printf("%-14s %12.1f %12.2f\n", altitudes[a].name, results.max_error[a], results.sum_error[a] / results.count[a]);
+    }
+
+    benchmark();
+
+    if (results.failures) {
+        printf("\n%u results off by more than %d seconds\n", results.failures, TOLERANCE_SECONDS);
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,13 @@
+// Host stand-in for the board's pins.h, so that thermistor_driver.c can be compiled by thermistor_test.c.
+#pragma once
+#include <stdint.h>
+#include <stdbool.h>
+#define HAL_GPIO_PMUX_ADC 0
+#define HAL_GPIO_TEMPSENSE_in()
+#define HAL_GPIO_TEMPSENSE_off()
+#define HAL_GPIO_TEMPSENSE_pin() 0
+#define HAL_GPIO_TEMPSENSE_pmuxen(x)
+#define HAL_GPIO_TEMPSENSE_pmuxdis()
+#define HAL_GPIO_TS_ENABLE_out()
+#define HAL_GPIO_TS_ENABLE_off()
+#define HAL_GPIO_TS_ENABLE_write(x)
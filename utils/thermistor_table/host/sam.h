@@ -0,0 +1,2 @@
+// Host stand-in for sam.h; see pins.h.
+#pragma once
@@ -0,0 +1,8 @@
+// Host stand-in for watch.h; see pins.h.
+#pragma once
+#include <stdint.h>
+static inline void watch_enable_adc(void) {}
+static inline void watch_disable_adc(void) {}
+uint16_t watch_get_analog_pin_level(uint8_t pin);
+typedef struct { uint16_t pin; uint16_t value; } watch_adc_reading_t;
+void watch_get_analog_levels(watch_adc_reading_t *readings, uint8_t count, uint16_t samples);
@@ -0,0 +1,95 @@
+#!/usr/bin/env python3
+# Generates watch-library/shared/driver/thermistor_table.h, the lookup table that thermistor_driver.c uses to
+# turn ADC readings into temperatures without floating point math. The thermistor's constants are read from
+# thermistor_driver.h; rerun this script whenever you change them (the build will refuse to compile with a
+# stale table):
+#   python3 utils/thermistor_table/thermistor_table.py
+import math
+import re
+from pathlib import Path
+
+DRIVER_DIR = Path(__file__).resolve().parents[2] / 'watch-library' / 'shared' / 'driver'
+HEADER = DRIVER_DIR / 'thermistor_driver.h'
+OUTPUT = DRIVER_DIR / 'thermistor_table.h'
+
+# one entry every 2^TABLE_SHIFT ADC counts, plus one at the end so that the last interval can be interpolated.
+TABLE_SHIFT = 8
+TABLE_SIZE = (65536 >> TABLE_SHIFT) + 1
+# readings outside this range are clamped; the thermistor circuit can't measure them meaningfully anyway.
+MIN_CENTIDEGREES = -5500
+MAX_CENTIDEGREES = 15000
+
+
+def read_constants():
+    constants = {}
+    for line in HEADER.read_text().splitlines():
+        match = re.match(r'#define\s+(THERMISTOR_\w+)\s+\((.*)\)', line)
+        if match:
+            value = match.group(2).strip()
+            if value in ('true', 'false'):
+                constants[match.group(1)] = 1.0 if value == 'true' else 0.0
+            else:
+                constants[match.group(1)] = float(value)
+    return constants
+
+
+def temperature(value, c):
+    """Same formula as watch_utility_thermistor_temperature, in double precision."""
+    series = c['THERMISTOR_SERIES_RESISTANCE']
+    if c['THERMISTOR_HIGH_SIDE']:
+        if value == 0:
+            return MIN_CENTIDEGREES / 100
+        resistance = (1023.0 * series) / (value / 64.0) - series
+    else:
+        if value == 0:
+            return MAX_CENTIDEGREES / 100
+        if value >= 65535:
+            return MIN_CENTIDEGREES / 100
+        resistance = series / (65535.0 / value - 1.0)
+    if resistance <= 0:
+        return MAX_CENTIDEGREES / 100
+    reading = math.log(resistance / c['THERMISTOR_NOMINAL_RESISTANCE'])
+    reading /= c['THERMISTOR_B_COEFFICIENT']
+    reading += 1.0 / (c['THERMISTOR_NOMINAL_TEMPERATURE'] + 273.15)
+    return 1.0 / reading - 273.15
+
+
+def main():
+    c = read_constants()
+    entries = []
+    for i in range(TABLE_SIZE):
+        centidegrees = round(temperature(min(i << TABLE_SHIFT, 65535), c) * 100)
+        entries.append(max(MIN_CENTIDEGREES, min(MAX_CENTIDEGREES, centidegrees)))
+
+    lines = [
+        '// Generated by utils/thermistor_table/thermistor_table.py from the constants in thermistor_driver.h.',
+        '// Do not edit; rerun the script instead.',
+        '',
+        '#pragma once',
+        '',
+        '#include <stdint.h>',
+        '',
+        '// the constants this table was generated from, to catch a stale table at compile time.',
+        f'#define THERMISTOR_TABLE_HIGH_SIDE ({int(c["THERMISTOR_HIGH_SIDE"])})',
+        f'#define THERMISTOR_TABLE_B_COEFFICIENT ({int(c["THERMISTOR_B_COEFFICIENT"])})',
+        f'#define THERMISTOR_TABLE_NOMINAL_TEMPERATURE ({int(c["THERMISTOR_NOMINAL_TEMPERATURE"])})',
+        f'#define THERMISTOR_TABLE_NOMINAL_RESISTANCE ({int(c["THERMISTOR_NOMINAL_RESISTANCE"])})',
+        f'#define THERMISTOR_TABLE_SERIES_RESISTANCE ({int(c["THERMISTOR_SERIES_RESISTANCE"])})',
+        '',
+        f'#define THERMISTOR_TABLE_SHIFT ({TABLE_SHIFT})',
+        f'#define THERMISTOR_TABLE_SIZE ({TABLE_SIZE})',
+        '',
+        '// temperature in hundredths of a degree Celsius at ADC reading (index << THERMISTOR_TABLE_SHIFT).',
+        'static const int16_t thermistor_table[THERMISTOR_TABLE_SIZE] = {',
+    ]
+    for i in range(0, TABLE_SIZE, 8):
+        lines.append('    ' + ' '.join(f'{v},' for v in entries[i:i + 8]))
+    lines.append('};')
+    lines.append('')
+
+    OUTPUT.write_bytes('\r\n'.join(lines).encode())
+    print(f'Wrote {OUTPUT}')
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,153 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 Second Movement contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+// Checks the lookup-table thermistor conversion in thermistor_driver.c against the floating point formula it
+// replaced, for every possible ADC reading, and checks the calibration math. Build and run with:
+//   cc -O2 -Ihost -I../../watch-library/shared/driver thermistor_test.c -lm -o thermistor_test && ./thermistor_test
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include "../../watch-library/shared/driver/thermistor_driver.c"
+
+// the range the watch actually sees (thermistor_driver_init rejects readings outside 15000-55000).
+#define WORKING_MIN 15000
+#define WORKING_MAX 55000
+// the table must agree with the formula to within this many hundredths of a degree in the working range.
+#define MAX_ERROR 3
+
+static uint16_t fake_adc_value;
+
+uint16_t watch_get_analog_pin_level(uint8_t pin) {
+    (void) pin;
+    return fake_adc_value;
+}
+
+void watch_get_analog_levels(watch_adc_reading_t *readings, uint8_t count, uint16_t samples) {
+    (void) samples;
+    for (uint8_t i = 0; i < count; i++) readings[i].value = fake_adc_value;
+}
+
+// watch_utility_thermistor_temperature, verbatim but in double precision.
+static double reference_temperature(uint16_t value) {
+    double reading = (double)value;
+
+    if (THERMISTOR_HIGH_SIDE) {
+        reading = (1023.0 * THERMISTOR_SERIES_RESISTANCE) / (reading / 64.0);
+        reading -= THERMISTOR_SERIES_RESISTANCE;
+    } else {
+        reading = THERMISTOR_SERIES_RESISTANCE / (65535.0 / value - 1.0);
+    }
+
+    reading = reading / THERMISTOR_NOMINAL_RESISTANCE;
+    reading = log(reading);
+    reading /= THERMISTOR_B_COEFFICIENT;
+    reading += 1.0 / (THERMISTOR_NOMINAL_TEMPERATURE + 273.15);
+    reading = 1.0 / reading;
+    reading -= 273.15;
+
+    return reading;
+}
+
+static int check_conversion(void) {
+    double worst_working = 0, worst_overall = 0;
+    uint16_t worst_working_value = 0, worst_overall_value = 0;
+    int16_t previous = thermistor_driver_convert(0);
+    int failures = 0;
+
+    for (uint32_t value = 1; value <= 65535; value++) {
+        int16_t centidegrees = thermistor_driver_convert(value);
+        // an NTC thermistor on the high side reads warmer as the ADC value rises; never backwards.
+        if (THERMISTOR_HIGH_SIDE ? centidegrees < previous : centidegrees > previous) {
+            printf("not monotonic at %u: %d after %d\n", value, centidegrees, previous);
+            failures++;
+        }
+        previous = centidegrees;
+
+        double expected = reference_temperature(value) * 100;
+        if (isnan(expected) || expected < -5500 || expected > 15000) continue; // clamped
+        double error = fabs(centidegrees - expected);
+        if (error > worst_overall) {
+            worst_overall = error;
+            worst_overall_value = value;
+        }
+        if (value >= WORKING_MIN && value <= WORKING_MAX && error > worst_working) {
+            worst_working = error;
+            worst_working_value = value;
+        }
+    }
+
+    printf("table: %d entries, %u bytes\n", THERMISTOR_TABLE_SIZE, (unsigned)sizeof(thermistor_table));
+    printf("worst error %u-%u:  %.2f hundredths of a degree at %u (%.2f C)\n",
+           WORKING_MIN, WORKING_MAX, worst_working, worst_working_value, reference_temperature(worst_working_value));
+    printf("worst error -55-150 C: %.2f hundredths of a degree at %u (%.2f C)\n",
+           worst_overall, worst_overall_value, reference_temperature(worst_overall_value));
+    if (worst_working > MAX_ERROR) {
+        printf("FAIL: error exceeds %d hundredths of a degree\n", MAX_ERROR);
+        failures++;
+    }
+
+    return failures;
+}
+
+static int expect(const char *what, int16_t actual, int16_t expected) {
+    if (abs(actual - expected) <= 1) return 0;
+    printf("FAIL: %s: got %d, expected %d\n", what, actual, expected);
+    return 1;
+}
+
+static int check_calibration(void) {
+    int failures = 0;
+    has_thermistor = true;
+    fake_adc_value = 32768; // about 25 C
+    int16_t raw = thermistor_driver_get_uncalibrated_temperature_centidegrees();
+
+    failures += expect("uncalibrated", thermistor_driver_get_temperature_centidegrees(), raw);
+
+    thermistor_calibration_t calibration = { .measured = { raw }, .actual = { raw + 150 }, .num_points = 1 };
+    thermistor_driver_set_calibration(&calibration);
+    failures += expect("one point", thermistor_driver_get_temperature_centidegrees(), raw + 150);
+
+    // two points 20 degrees apart, where the sensor reads 10% high: a reading halfway should come out halfway.
+    calibration = (thermistor_calibration_t){ .measured = { 1000, 3200 }, .actual = { 1000, 3000 }, .num_points = 2 };
+    thermistor_driver_set_calibration(&calibration);
+    failures += expect("two point", thermistor_driver_get_temperature_centidegrees(), 1000 + (raw - 1000) * 2000 / 2200);
+
+    // points too close together: offset only, through the first point.
+    calibration = (thermistor_calibration_t){ .measured = { 2000, 2100 }, .actual = { 2100, 2900 }, .num_points = 2 };
+    thermistor_driver_set_calibration(&calibration);
+    failures += expect("close points", thermistor_driver_get_temperature_centidegrees(), raw + 100);
+
+    thermistor_driver_set_calibration(NULL);
+    failures += expect("cleared", thermistor_driver_get_temperature_centidegrees(), raw);
+
+    return failures;
+}
+
+int main(void) {
+    int failures = check_conversion() + check_calibration();
+    printf(failures ? "FAILED\n" : "OK\n");
+
+    return failures ? 1 : 0;
+}
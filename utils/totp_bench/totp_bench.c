@@ -0,0 +1,203 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 Second Movement contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+// Checks the prepared-key TOTP path in legacy/lib/TOTP against the RFC 6238 test vectors and against the one-shot
+// TOTP_HMAC_* functions, then times code generation for each hash algorithm three ways: hashing the key blocks for
+// every code, as the TOTP faces used to; from a prepared key; and scrolling through 30 records with the per-record
+// code cache that totp_face_lfs keeps. Build and run with:
+//   cc -O2 -I../../legacy/lib/TOTP totp_bench.c ../../legacy/lib/TOTP/TOTP.c ../../legacy/lib/TOTP/sha1.c
+//      ../../legacy/lib/TOTP/sha256.c ../../legacy/lib/TOTP/sha512.c -o totp_bench && ./totp_bench
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "TOTP.h"
+
+#define NUM_RECORDS 30
+#define PERIOD 30
+
+static const char *names[] = { "SHA1", "SHA224", "SHA256", "SHA384", "SHA512" };
+
+static double now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static uint32_t one_shot(const uint8_t *secret, uint8_t length, hmac_alg algorithm, uint32_t steps) {
+    uint8_t counter[8] = { 0, 0, 0, 0, steps >> 24, steps >> 16, steps >> 8, steps };
+
+    switch (algorithm) {
+        case SHA1: return TOTP_HMAC_SHA1(secret, length, counter, 8);
+        case SHA224: return TOTP_HMAC_SHA256(secret, length, counter, 8, 1);
+        case SHA256: return TOTP_HMAC_SHA256(secret, length, counter, 8, 0);
+        case SHA384: return TOTP_HMAC_SHA512(secret, length, counter, 8, 1);
+        case SHA512: return TOTP_HMAC_SHA512(secret, length, counter, 8, 0);
+    }
+
+    return 0;
+}
+
+// RFC 6238, appendix B. The RFC's codes have eight digits; the last six are what the watch shows.
+static int check_rfc6238(void) {
+    static const struct {
+        uint32_t time;
+        uint32_t codes[3];
+    } vectors[] = {
+        { 59,         { 94287082, 46119246, 90693936 } },
+        { 1111111109, {  7081804, 68084774, 25091201 } },
+        { 1111111111, { 14050471, 67062674, 99943326 } },
+        { 1234567890, { 89005924, 91819424, 93441116 } },
+        { 2000000000, { 69279037, 90698825, 38618901 } },
+    };
+    const char *seeds[] = {
+        "12345678901234567890",
+        "12345678901234567890123456789012",
+        "1234567890123456789012345678901234567890123456789012345678901234",
+    };
+    const hmac_alg algorithms[] = { SHA1, SHA256, SHA512 };
+    int failures = 0;
+
+    for (int a = 0; a < 3; a++) {
+        totp_key key;
+        prepareKey(&key, (const uint8_t *)seeds[a], strlen(seeds[a]), 30, algorithms[a]);
+        for (size_t v = 0; v < sizeof(vectors) / sizeof(vectors[0]); v++) {
+            uint32_t expected = vectors[v].codes[a] % 1000000;
+            uint32_t code = getCodeFromKey(&key, vectors[v].time / 30);
+            if (code != expected) {
+                printf("RFC 6238 %s at %u: got %06u, expected %06u\n", names[algorithms[a]], vectors[v].time, code, expected);
+                failures++;
+            }
+        }
+    }
+
+    return failures;
+}
+
+// random secrets of every length up to and past the block size, so that long keys get hashed first.
+static int check_against_one_shot(void) {
+    uint8_t secret[200];
+    int failures = 0;
+
+    srand(1);
+    for (int algorithm = SHA1; algorithm <= SHA512; algorithm++) {
+        for (int length = 1; length <= 200; length += 7) {
+            for (int i = 0; i < length; i++) secret[i] = rand();
+            totp_key key;
+            totp_codes codes = { 0 };
+            prepareKey(&key, secret, length, PERIOD, algorithm);
+            for (uint32_t t = 1700000000; t < 1700000000 + 10 * PERIOD; t += 7) {
+                uint32_t steps = t / PERIOD;
+                uint32_t expected = one_shot(secret, length, algorithm, steps);
+                updateCodes(&key, &codes, t);
+                if (getCodeFromKey(&key, steps) != expected || codes.current != expected ||
+                    codes.next != one_shot(secret, length, algorithm, steps + 1)) {
+                    printf("%s, %d byte key, time %u: prepared key disagrees\n", names[algorithm], length, t);
+                    failures++;
+                }
+            }
+        }
+    }
+
+    return failures;
+}
+
+static volatile uint32_t sink;
+
+static void bench(hmac_alg algorithm) {
+    uint8_t secrets[NUM_RECORDS][20];
+    const int iterations = 20000;
+
+    for (int r = 0; r < NUM_RECORDS; r++) {
+        for (int i = 0; i < 20; i++) secrets[r][i] = rand();
+    }
+
+    // before: every code hashes the key blocks again.
+    double start = now_ns();
+    for (int i = 0; i < iterations; i++) sink = one_shot(secrets[i % NUM_RECORDS], 20, algorithm, 56666666 + i);
+    double one_shot_ns = (now_ns() - start) / iterations;
+
+    // preparing a key, and generating a code from it.
+    totp_key key;
+    start = now_ns();
+    for (int i = 0; i < iterations; i++) prepareKey(&key, secrets[i % NUM_RECORDS], 20, PERIOD, algorithm);
+    double prepare_ns = (now_ns() - start) / iterations;
+    start = now_ns();
+    for (int i = 0; i < iterations; i++) sink = getCodeFromKey(&key, 56666666 + i);
+    double code_ns = (now_ns() - start) / iterations;
+
+    // ten minutes of scrolling, four presses a second, through 30 records, with the display redrawn on every
+    // press and every tick. Before, each press prepared the key and generated a code, and so did each tick (the
+    // faces kept the time step in a uint8_t, so it never matched). Now the face only prepares a key when a record's
+    // cached codes run out. Work is counted in compression-function calls: a one-shot code takes four, preparing
+    // a key two, and each code from a prepared key two.
+    totp_codes codes[NUM_RECORDS] = { 0 };
+    int key_index = -1, index = 0;
+    uint32_t compressions = 0, compressions_before = 0;
+    start = now_ns();
+    for (uint32_t t = 1700000000; t < 1700000000 + 600; t++) {
+        for (int press = 0; press <= 4; press++) {
+            // the fifth time around is the tick.
+            if (press < 4) index = (index + 1) % NUM_RECORDS;
+            compressions_before += 4;
+            if (!codesAreCurrent(&codes[index], t, PERIOD)) {
+                if (key_index != index) {
+                    prepareKey(&key, secrets[index], 20, PERIOD, algorithm);
+                    key_index = index;
+                    compressions += 2;
+                }
+                compressions += (codes[index].steps && codes[index].steps + 1 == t / PERIOD) ? 2 : 4;
+                updateCodes(&key, &codes[index], t);
+            }
+            sink = codes[index].current;
+        }
+    }
+    double scroll_ns = now_ns() - start;
+    index = 0;
+    start = now_ns();
+    for (uint32_t t = 1700000000; t < 1700000000 + 600; t++) {
+        for (int press = 0; press <= 4; press++) {
+            if (press < 4) index = (index + 1) % NUM_RECORDS;
+            sink = one_shot(secrets[index], 20, algorithm, t / PERIOD);
+        }
+    }
+    double scroll_before_ns = now_ns() - start;
+
+    printf("%-7s %9.0f %9.0f %9.0f %9u %9u %9.0f %9.0f\n", names[algorithm], one_shot_ns, prepare_ns, code_ns,
+           compressions_before, compressions, scroll_before_ns / 1000, scroll_ns / 1000);
+}
+
+int main(void) {
+    int failures = check_rfc6238() + check_against_one_shot();
+
+    printf("%s\n\n", failures ? "FAILED" : "RFC 6238 vectors and one-shot HMACs agree");
+    printf("%-7s %9s %9s %9s %19s %19s\n", "", "one-shot", "prepare", "code", "scroll compressions", "scroll time (us)");
+    printf("%-7s %9s %9s %9s %9s %9s %9s %9s\n", "", "ns/code", "ns/key", "ns/code", "before", "after", "before", "after");
+    for (int algorithm = SHA1; algorithm <= SHA512; algorithm++) bench(algorithm);
+
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,90 @@
+#!/usr/bin/env python3
+# Prints the output of the shell's trace command as text. The watch only stores an event ID and two integers for
+# each TRACE; the format strings are in the .trace_fmt section of the firmware's ELF, so pass the ELF from the
+# same build (e.g. build/firmware.elf). Paste the output into a file as-is; the prompt, the command and anything
+# else that isn't base64 is skipped. See lib/trace/trace.h.
+#
+# Usage: trace_decode.py FIRMWARE.elf DUMP.txt
+import base64
+import datetime
+import re
+import struct
+import sys
+
+RECORD = struct.Struct('<IHHii')
+BASE64_LINE = re.compile(r'^[A-Za-z0-9+/]+={0,2}$')
+# a printf conversion, with flags, width and precision, and any length modifier, which Python doesn't take.
+CONVERSION = re.compile(r'%([-+ #0]*\d*(?:\.\d+)?)(?:hh|h|ll|l|j|z|t)?([diouxXc%])')
+
+
+def read_format_section(path):
+    """Returns the address and contents of .trace_fmt in a 32- or 64-bit little-endian ELF."""
+    with open(path, 'rb') as f:
+        elf = f.read()
+    if elf[:4] != b'\x7fELF' or elf[5] != 1:
+        sys.exit(f'{path} is not a little-endian ELF file')
+    if elf[4] == 1:
+        shoff, = struct.unpack_from('<I', elf, 0x20)
+        shentsize, shnum, shstrndx = struct.unpack_from('<HHH', elf, 0x2e)
+        section = struct.Struct('<IIIIII')
+    else:
+        shoff, = struct.unpack_from('<Q', elf, 0x28)
+        shentsize, shnum, shstrndx = struct.unpack_from('<HHH', elf, 0x3a)
+        section = struct.Struct('<IIQQQQ')
+
+    headers = [section.unpack_from(elf, shoff + i * shentsize) for i in range(shnum)]
+    names = headers[shstrndx]
+    for name, _type, _flags, addr, offset, size in headers:
+        start = names[4] + name
+        if elf[start:elf.index(b'\0', start)] == b'.trace_fmt':
+            return addr, elf[offset:offset + size]
+    sys.exit(f'{path} has no .trace_fmt section; was it built with any TRACE calls?')
+
+
+def format_record(formats, event_id, args):
+    if event_id >= len(formats):
+        return f'unknown event {event_id} {args}; is this the right ELF?'
+    text = formats[event_id:formats.index(b'\0', event_id)].decode('utf-8', 'replace')
+    remaining = list(args)
+
+    def convert(match):
+        flags, conversion = match.groups()
+        if conversion == '%':
+            return '%'
+        value = remaining.pop(0) if remaining else 0
+        if conversion in 'ouxX':
+            value &= 0xffffffff
+        elif conversion == 'c':
+            value = chr(value & 0xff)
+        else:
+            conversion = 'd'
+        return ('%' + flags + conversion) % value
+
+    return CONVERSION.sub(convert, text)
+
+
+def main():
+    if len(sys.argv) != 3:
+        sys.exit('usage: trace_decode.py FIRMWARE.elf DUMP.txt')
+
+    # trace.ld puts the section at address 0, so IDs are already offsets, but an ELF linked without it still works.
+    address, formats = read_format_section(sys.argv[1])
+    with open(sys.argv[2]) as f:
+        lines = [line.strip() for line in f]
+    encoded = ''.join(line for line in lines if BASE64_LINE.match(line) and len(line) % 4 == 0)
+    data = base64.b64decode(encoded)
+    if len(data) % RECORD.size:
+        sys.exit(f'decoded {len(data)} bytes, which is not a whole number of records; was the dump cut short?')
+
+    expected = None
+    for i in range(0, len(data), RECORD.size):
+        timestamp, event_id, sequence, a, b = RECORD.unpack_from(data, i)
+        if expected is not None and sequence != expected:
+            print(f'... {(sequence - expected) & 0xffff} lost ...')
+        expected = (sequence + 1) & 0xffff
+        when = datetime.datetime.fromtimestamp(timestamp, datetime.timezone.utc).strftime('%Y-%m-%d %H:%M:%S')
+        print(f'{when} {sequence:5d}  {format_record(formats, (event_id - address) & 0xffff, (a, b))}')
+
+
+if __name__ == '__main__':
+    main()
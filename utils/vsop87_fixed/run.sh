@@ -0,0 +1,59 @@
+#!/bin/bash
+# Regenerates the tables if they're stale, builds and runs vsop87_bench, then, if the ARM toolchain is installed,
+# links each implementation into a minimal Cortex-M0+ program and compares their size including whatever they pull
+# in from libm and libgcc.
+set -e
+cd "$(dirname "$0")"
+VSOP87=../../legacy/lib/vsop87
+
+python3 vsop87_tables.py
+cc -O2 -I$VSOP87 vsop87_bench.c $VSOP87/vsop87a_milli.c $VSOP87/vsop87a_micro.c -lm -o vsop87_bench
+./vsop87_bench
+rm -f vsop87_bench
+
+if ! command -v arm-none-eabi-gcc > /dev/null; then
+    echo
+    echo "arm-none-eabi-gcc not found; skipping the size comparison."
+    exit 0
+fi
+
+TMP=$(mktemp -d)
+trap 'rm -rf "$TMP"' EXIT
+ARMFLAGS="-mcpu=cortex-m0plus -mthumb -Os -ffunction-sections -fdata-sections -I$VSOP87"
+LDFLAGS="-specs=nano.specs -specs=nosys.specs -Wl,--gc-sections"
+
+cat > "$TMP/double.c" << 'END'
+#include "vsop87a_milli.h"
+volatile double t = 0.025, x;
+int main(void) {
+    double r[3];
+    vsop87a_milli_getMercury(t, r); x = r[0]; vsop87a_milli_getVenus(t, r); x = r[0];
+    vsop87a_milli_getEarth(t, r); x = r[0]; vsop87a_milli_getMars(t, r); x = r[0];
+    vsop87a_milli_getJupiter(t, r); x = r[0]; vsop87a_milli_getSaturn(t, r); x = r[0];
+    vsop87a_milli_getUranus(t, r); x = r[0]; vsop87a_milli_getNeptune(t, r); x = r[0];
+    double earth[3], emb[3];
+    vsop87a_milli_getEarth(t, earth); vsop87a_milli_getEmb(t, emb); vsop87a_milli_getMoon(earth, emb, r); x = r[0];
+    return 0;
+}
+END
+cat > "$TMP/fixed.c" << 'END'
+#include "vsop87a_fixed.h"
+volatile int32_t days = 600000, x;
+volatile int body = 0;
+int main(void) { int32_t r[3]; vsop87a_fixed_get_position(body, days, VSOP87A_FIXED_PRECISION_MILLI, r); x = r[0]; return 0; }
+END
+cat > "$TMP/empty.c" << 'END'
+int main(void) { return 0; }
+END
+
+arm-none-eabi-gcc $ARMFLAGS $LDFLAGS "$TMP/empty.c" -o "$TMP/empty.elf"
+arm-none-eabi-gcc $ARMFLAGS $LDFLAGS "$TMP/double.c" $VSOP87/vsop87a_milli.c -lm -o "$TMP/double.elf"
+arm-none-eabi-gcc $ARMFLAGS $LDFLAGS "$TMP/fixed.c" $VSOP87/vsop87a_fixed.c -o "$TMP/fixed.elf"
+
+base=$(arm-none-eabi-size -A "$TMP/empty.elf" | awk '$1 == ".text" { print $2 }')
+echo
+echo "flash used on a Cortex-M0+, over an empty program:"
+for impl in double fixed; do
+    text=$(arm-none-eabi-size -A "$TMP/$impl.elf" | awk '$1 == ".text" { print $2 }')
+    echo "  $impl: $((text - base)) bytes"
+done
@@ -0,0 +1,216 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 Second Movement contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+// Compares legacy/lib/vsop87/vsop87a_fixed.c against the double precision vsop87a_milli.c and vsop87a_micro.c it's
+// generated from: every body, at both precisions, every 5 days and 7 hours from 1911 to 2088. Fails if any
+// coordinate differs by more than TOLERANCE_AU. Then counts the work each version does per position, and times
+// both; this host has an FPU, so the times flatter the double version compared to the watch. Build and run with:
+//   cc -O2 -I../../legacy/lib/vsop87 vsop87_bench.c ../../legacy/lib/vsop87/vsop87a_milli.c
+//      ../../legacy/lib/vsop87/vsop87a_micro.c -lm -o vsop87_bench && ./vsop87_bench
+// or use run.sh, which also compares code size for the watch when arm-none-eabi-gcc is installed.
+
+#include <stdio.h>
+#include <stdint.h>
+#include <math.h>
+#include <time.h>
+// included rather than linked, to count the work in its tables.
+#include "vsop87a_fixed.c"
+#include "vsop87a_milli.h"
+#include "vsop87a_micro.h"
+
+#define TOLERANCE_AU 1e-5
+// 1911 to 2088, as 16.16 days since J2000.0.
+#define FIRST_DAY (-32767L * 65536)
+#define LAST_DAY (32767L * 65536)
+#define STEP ((5L * 24 + 7) * 65536 / 24)
+
+static const char *body_names[VSOP87A_FIXED_NUM_BODIES] = {
+    "Mercury", "Venus", "Earth", "Moon", "Mars", "Jupiter", "Saturn", "Uranus", "Neptune", "EMB"
+};
+
+static void (*const milli[VSOP87A_FIXED_NUM_BODIES])(double, double[]) = {
+    vsop87a_milli_getMercury, vsop87a_milli_getVenus, vsop87a_milli_getEarth, NULL, vsop87a_milli_getMars,
+    vsop87a_milli_getJupiter, vsop87a_milli_getSaturn, vsop87a_milli_getUranus, vsop87a_milli_getNeptune,
+    vsop87a_milli_getEmb,
+};
+
+static void (*const micro[VSOP87A_FIXED_NUM_BODIES])(double, double[]) = {
+    vsop87a_micro_getMercury, vsop87a_micro_getVenus, vsop87a_micro_getEarth, NULL, vsop87a_micro_getMars,
+    vsop87a_micro_getJupiter, vsop87a_micro_getSaturn, vsop87a_micro_getUranus, vsop87a_micro_getNeptune,
+    vsop87a_micro_getEmb,
+};
+
+static void double_position(vsop87a_fixed_body_t body, vsop87a_fixed_precision_t precision, int32_t days, double r[3]) {
+    double t = days / 65536.0 / 365250.0;
+    if (body == VSOP87A_FIXED_MOON) {
+        double earth[3], emb[3];
+        if (precision == VSOP87A_FIXED_PRECISION_MILLI) {
+            vsop87a_milli_getEarth(t, earth);
+            vsop87a_milli_getEmb(t, emb);
+            vsop87a_milli_getMoon(earth, emb, r);
+        } else {
+            vsop87a_micro_getEarth(t, earth);
+            vsop87a_micro_getEmb(t, emb);
+            vsop87a_micro_getMoon(earth, emb, r);
+        }
+        return;
+    }
+    (precision == VSOP87A_FIXED_PRECISION_MILLI ? milli : micro)[body](t, r);
+}
+
+static uint32_t check_accuracy(vsop87a_fixed_precision_t precision) {
+    uint32_t failures = 0;
+
+    printf("%s precision: largest difference from the double version, and from double milli, in AU\n",
+           precision == VSOP87A_FIXED_PRECISION_MILLI ? "milli" : "micro");
+    for (vsop87a_fixed_body_t body = 0; body < VSOP87A_FIXED_NUM_BODIES; body++) {
+        double max_error = 0;
+        double max_truncation = 0;
+        for (int32_t days = FIRST_DAY; days <= LAST_DAY; days += STEP) {
+            int32_t fixed[3];
+            double expected[3], reference[3];
+            vsop87a_fixed_evaluate(body, days, precision, fixed);
+            double_position(body, precision, days, expected);
+            double_position(body, VSOP87A_FIXED_PRECISION_MILLI, days, reference);
+            for (int i = 0; i < 3; i++) {
+                double value = (double)fixed[i] / VSOP87A_FIXED_AU;
+                double error = fabs(value - expected[i]);
+                if (error > max_error) max_error = error;
+                if (fabs(value - reference[i]) > max_truncation) max_truncation = fabs(value - reference[i]);
+                if (error > TOLERANCE_AU) failures++;
+            }
+        }
+        printf("  %-8s %.2e  %.2e\n", body_names[body], max_error, max_truncation);
+    }
+
+    return failures;
+}
+
+static uint32_t check_cache(void) {
+    uint32_t failures = 0;
+    int32_t days = 9000L * 65536;
+    int32_t first[3], cached[3], later[3];
+
+    // within Mercury's hour, the cached position comes back; a day later, it's recomputed.
+    vsop87a_fixed_get_position(VSOP87A_FIXED_MERCURY, days, VSOP87A_FIXED_PRECISION_MILLI, first);
+    vsop87a_fixed_get_position(VSOP87A_FIXED_MERCURY, days + 65536 / 48, VSOP87A_FIXED_PRECISION_MILLI, cached);
+    vsop87a_fixed_get_position(VSOP87A_FIXED_MERCURY, days + 65536, VSOP87A_FIXED_PRECISION_MILLI, later);
+    for (int i = 0; i < 3; i++) {
+        if (cached[i] != first[i]) failures++;
+    }
+    if (later[0] == first[0] && later[1] == first[1]) failures++;
+
+    // a different precision is never served from the cache.
+    vsop87a_fixed_evaluate(VSOP87A_FIXED_MERCURY, days, VSOP87A_FIXED_PRECISION_MICRO, first);
+    vsop87a_fixed_get_position(VSOP87A_FIXED_MERCURY, days + 65536, VSOP87A_FIXED_PRECISION_MICRO, cached);
+    vsop87a_fixed_evaluate(VSOP87A_FIXED_MERCURY, days + 65536, VSOP87A_FIXED_PRECISION_MICRO, later);
+    for (int i = 0; i < 3; i++) {
+        if (cached[i] != later[i]) failures++;
+    }
+
+    printf("cache: %s\n", failures ? "FAILED" : "ok");
+    return failures;
+}
+
+static void count_work(vsop87a_fixed_precision_t precision) {
+    bool is_micro = precision == VSOP87A_FIXED_PRECISION_MICRO;
+
+    printf("%s precision, work per position: double cos() calls; fixed CORDICs, angle additions\n",
+           is_micro ? "micro" : "milli");
+    for (vsop87a_fixed_body_t body = 0; body < VSOP87A_FIXED_NUM_BODIES; body++) {
+        uint32_t terms = 0, cordics = 0, additions = 0;
+        // the Moon costs the Earth plus the EMB.
+        for (vsop87a_fixed_body_t part = 0; part < VSOP87A_FIXED_NUM_BODIES; part++) {
+            if (part == VSOP87A_FIXED_MOON) continue;
+            if (part != body && !(body == VSOP87A_FIXED_MOON && (part == VSOP87A_FIXED_EARTH || part == VSOP87A_FIXED_EMB))) continue;
+            const vsop87a_fixed_series_t *series = &_vsop87a_fixed_series[part < VSOP87A_FIXED_MOON ? part : part - 1];
+            for (uint16_t i = 0; i < series->num_terms; i++) {
+                if (!is_micro || (series->terms[i].series & VSOP87A_FIXED_MICRO)) terms++;
+            }
+            for (uint8_t i = 0; i < series->num_frequencies; i++) {
+                uint8_t op = series->frequencies[i].op;
+                if (is_micro && !(op & VSOP87A_FIXED_MICRO)) continue;
+                op &= ~VSOP87A_FIXED_MICRO;
+                if (op == VSOP87A_FIXED_OP_BASE) cordics++;
+                if (op == VSOP87A_FIXED_OP_SUM || op == VSOP87A_FIXED_OP_DIFFERENCE) additions++;
+            }
+        }
+        printf("  %-8s %4u  %4u %4u\n", body_names[body], terms, cordics, additions);
+    }
+}
+
+static double seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static void benchmark(vsop87a_fixed_precision_t precision) {
+    const int32_t iterations = 2000;
+    volatile double sink_double = 0;
+    volatile int32_t sink_fixed = 0;
+
+    printf("%s precision, microseconds per position on this host (double, fixed):\n",
+           precision == VSOP87A_FIXED_PRECISION_MILLI ? "milli" : "micro");
+    for (vsop87a_fixed_body_t body = 0; body < VSOP87A_FIXED_NUM_BODIES; body++) {
+        double start = seconds();
+        for (int32_t i = 0; i < iterations; i++) {
+            double r[3];
+            double_position(body, precision, i * 977 * 65536L / 10, r);
+            sink_double += r[0];
+        }
+        double double_us = (seconds() - start) * 1e6 / iterations;
+
+        start = seconds();
+        for (int32_t i = 0; i < iterations; i++) {
+            int32_t r[3];
+            vsop87a_fixed_evaluate(body, i * 977 * 65536L / 10, precision, r);
+            sink_fixed += r[0];
+        }
+        double fixed_us = (seconds() - start) * 1e6 / iterations;
+
+        printf("  %-8s %7.2f %7.2f\n", body_names[body], double_us, fixed_us);
+    }
+}
+
+int main(void) {
+    uint32_t failures = 0;
+
+    failures += check_accuracy(VSOP87A_FIXED_PRECISION_MILLI);
+    failures += check_accuracy(VSOP87A_FIXED_PRECISION_MICRO);
+    failures += check_cache();
+    printf("\n");
+    count_work(VSOP87A_FIXED_PRECISION_MILLI);
+    count_work(VSOP87A_FIXED_PRECISION_MICRO);
+    printf("\n");
+    benchmark(VSOP87A_FIXED_PRECISION_MILLI);
+    benchmark(VSOP87A_FIXED_PRECISION_MICRO);
+
+    if (failures) {
+        printf("\n%u coordinates differ by more than %g AU\n", failures, TOLERANCE_AU);
+        return 1;
+    }
+    return 0;
+}
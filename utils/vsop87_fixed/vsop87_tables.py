@@ -0,0 +1,175 @@
+#!/usr/bin/env python3
+# Generates legacy/lib/vsop87/vsop87a_fixed_tables.h, the fixed-point series tables that vsop87a_fixed.c walks,
+# from the double precision sources in the same directory. Every term of vsop87a_milli.c is included; terms that
+# vsop87a_micro.c also has are flagged, so the evaluator can choose the precision at runtime. Rerun this script
+# if either source changes:
+#   python3 utils/vsop87_fixed/vsop87_tables.py
+import math
+import re
+from collections import OrderedDict
+from pathlib import Path
+
+VSOP87_DIR = Path(__file__).resolve().parents[2] / 'legacy' / 'lib' / 'vsop87'
+MILLI = VSOP87_DIR / 'vsop87a_milli.c'
+MICRO = VSOP87_DIR / 'vsop87a_micro.c'
+OUTPUT = VSOP87_DIR / 'vsop87a_fixed_tables.h'
+
+# in the order of vsop87a_body_t in vsop87a_fixed.h. The Moon isn't here; it's derived from the Earth and the EMB.
+BODIES = ['mercury', 'venus', 'earth', 'mars', 'jupiter', 'saturn', 'uranus', 'neptune', 'emb']
+COORDINATES = ['x', 'y', 'z']
+
+# amplitudes are stored in units of 2^-AMPLITUDE_BITS AU.
+AMPLITUDE_BITS = 24
+# a frequency is derived from two others if it matches their sum or difference this closely, in radians per
+# millennium. Over the +/- 89 years the evaluator supports, that's well under a microradian of phase.
+FREQUENCY_TOLERANCE = 1e-6
+# base frequencies are stored in binary angle units (2^32 per revolution) per day, in 48.16 fixed point.
+DAYS_PER_MILLENNIUM = 365250
+
+OP_ZERO, OP_BASE, OP_SUM, OP_DIFFERENCE = range(4)
+OP_NAMES = ['VSOP87A_FIXED_OP_ZERO', 'VSOP87A_FIXED_OP_BASE', 'VSOP87A_FIXED_OP_SUM', 'VSOP87A_FIXED_OP_DIFFERENCE']
+MICRO_FLAG = 0x80
+
+
+def parse(path):
+    '''
+    Returns {(body, coordinate, power): [(A, B, C), ...]} for every series in a vsop87a_*.c file.
+    '''
+    series = OrderedDict()
+    current = None
+    for line in path.read_text().splitlines():
+        match = re.match(r'\s*double (\w+)_([xyz])_(\d)=0\.0;', line)
+        if match:
+            current = (match.group(1), match.group(2), int(match.group(3)))
+            series[current] = []
+            continue
+        match = re.match(r'\s*\w+_[xyz]_\d\+=\s*([-\d.]+) \* cos\(\s*([-\d.]+) \+\s*([-\d.]+)\*t\);', line)
+        if match:
+            series[current].append(tuple(float(x) for x in match.groups()))
+    return series
+
+
+def find_recurrence(frequency, known):
+    '''
+    Looks for two already computed frequencies that sum to, or differ by, this one.
+    '''
+    for i, (a, _) in enumerate(known):
+        for j, (b, _) in enumerate(known[:i + 1]):
+            if abs(a + b - frequency) < FREQUENCY_TOLERANCE:
+                return OP_SUM, i, j
+            if abs(a - b - frequency) < FREQUENCY_TOLERANCE:
+                return OP_DIFFERENCE, i, j
+    return None
+
+
+def build_body(body, milli, micro):
+    terms = []
+    for coordinate_index, coordinate in enumerate(COORDINATES):
+        for power in range(6):
+            key = (body, coordinate, power)
+            micro_terms = set(micro.get(key, []))
+            for a, b, c in milli.get(key, []):
+                terms.append((coordinate_index * 6 + power, a, b, c, (a, b, c) in micro_terms))
+
+    # frequencies in ascending order, so that most can be built from smaller ones. A frequency is needed for
+    # micro precision if a micro term uses it or another micro frequency is built from it.
+    frequencies = sorted(set(c for _, _, _, c, _ in terms))
+    known = []
+    ops = []
+    rates = []
+    for frequency in frequencies:
+        if frequency == 0:
+            op = (OP_ZERO, 0, 0)
+        else:
+            op = find_recurrence(frequency, known)
+            if op is None:
+                rate = frequency / (2 * math.pi) / DAYS_PER_MILLENNIUM * 2 ** 32
+                op = (OP_BASE, len(rates), 0)
+                rates.append(round(rate * 2 ** 16))
+        known.append((frequency, op))
+        ops.append(op)
+
+    needed = [False] * len(frequencies)
+
+    def need(index):
+        if needed[index]:
+            return
+        needed[index] = True
+        op, a, b = ops[index]
+        if op in (OP_SUM, OP_DIFFERENCE):
+            need(a)
+            need(b)
+
+    for _, _, _, c, in_micro in terms:
+        if in_micro:
+            need(frequencies.index(c))
+
+    table_terms = []
+    for series, a, b, c, in_micro in terms:
+        a_cos = round(a * math.cos(b) * 2 ** AMPLITUDE_BITS)
+        a_sin = round(a * math.sin(b) * 2 ** AMPLITUDE_BITS)
+        table_terms.append((a_cos, a_sin, frequencies.index(c), series | (MICRO_FLAG if in_micro else 0),
+                            f'{a:.11f} * cos({b:.11f} + {c:.11f} * t)'))
+    max_power = max(power for (name, _, power) in milli if name == body)
+    return ops, needed, rates, table_terms, max_power
+
+
+def main():
+    milli = parse(MILLI)
+    micro = parse(MICRO)
+    lines = []
+    out = lines.append
+    out('// Generated by utils/vsop87_fixed/vsop87_tables.py from vsop87a_milli.c and vsop87a_micro.c; do not edit.')
+    out('// VSOP87-Multilang http://www.astrogreg.com/vsop87-multilang/index.html')
+    out('// Greg Miller (gmiller@gregmiller.net) 2019.  Released as Public Domain')
+    out('')
+    out('#ifndef VSOP87A_FIXED_TABLES_H_')
+    out('#define VSOP87A_FIXED_TABLES_H_')
+    out('')
+    out(f'#define VSOP87A_FIXED_AMPLITUDE_BITS {AMPLITUDE_BITS}')
+    out('')
+
+    bodies = []
+    max_frequencies = 0
+    for body in BODIES:
+        ops, needed, rates, terms, max_power = build_body(body, milli, micro)
+        max_frequencies = max(max_frequencies, len(ops))
+        bodies.append((body, len(ops), len(terms), max_power))
+        num_micro = sum(1 for t in terms if t[3] & MICRO_FLAG)
+        out(f'// {body}: {len(terms)} terms ({num_micro} at micro precision) over {len(ops)} frequencies, '
+            f'{len(rates)} of them computed directly')
+        out(f'static const int64_t _vsop87a_fixed_{body}_rates[] = {{')
+        for rate in rates:
+            out(f'    {rate}LL,')
+        out('};')
+        out(f'static const vsop87a_fixed_frequency_t _vsop87a_fixed_{body}_frequencies[] = {{')
+        for (op, a, b), is_needed in zip(ops, needed):
+            flag = ' | VSOP87A_FIXED_MICRO' if is_needed else ''
+            out(f'    {{ {OP_NAMES[op]}{flag}, {a}, {b} }},')
+        out('};')
+        out(f'static const vsop87a_fixed_term_t _vsop87a_fixed_{body}_terms[] = {{')
+        for a_cos, a_sin, frequency, series, comment in terms:
+            coordinate = COORDINATES[(series & 0x7F) // 6]
+            power = (series & 0x7F) % 6
+            flag = ' | VSOP87A_FIXED_MICRO' if series & MICRO_FLAG else ''
+            out(f'    {{ {a_cos}, {a_sin}, {frequency}, VSOP87A_FIXED_SERIES({coordinate.upper()}, {power}){flag} }},'
+                f'  // {comment}')
+        out('};')
+        out('')
+
+    out(f'#define VSOP87A_FIXED_MAX_FREQUENCIES {max_frequencies}')
+    out('')
+    out('static const vsop87a_fixed_series_t _vsop87a_fixed_series[] = {')
+    for body, num_frequencies, num_terms, max_power in bodies:
+        out(f'    {{ _vsop87a_fixed_{body}_rates, _vsop87a_fixed_{body}_frequencies, _vsop87a_fixed_{body}_terms, '
+            f'{num_frequencies}, {num_terms}, {max_power} }},')
+    out('};')
+    out('')
+    out('#endif // VSOP87A_FIXED_TABLES_H_')
+
+    with open(OUTPUT, 'w', newline='\r\n') as f:
+        f.write('\n'.join(lines) + '\n')
+
+
+if __name__ == '__main__':
+    main()
@@ -1153,73 +1153,106 @@ def clean_chars(string):
     return string
 
 
+def pack_word(word, letters):
+    '''
+    Packs a word into an integer, four bits per letter with the first letter in the highest nibble.
+    letters must be sorted, so that sorting packed words also sorts them alphabetically.
+    '''
+    packed = 0
+    for letter in word:
+        packed = (packed << 4) | letters.index(letter.upper())
+    return packed
+
+
+def pack_words(words, letters):
+    '''
+    Packs 20-bit words two to every five bytes, in the layout wordle_face.c's get_packed_word reads.
+    '''
+    nibbles = []
+    for word in words:
+        packed = pack_word(word, letters)
+        nibbles += [(packed >> shift) & 0xF for shift in range(16, -1, -4)]
+    if len(nibbles) % 2:
+        nibbles.append(0)
+    return [(nibbles[i] << 4) | nibbles[i + 1] for i in range(0, len(nibbles), 2)]
+
+
+def print_packed_words(name, words, letters, items_per_row=10):
+    '''
+    Prints words as a packed byte array, with the words each row holds in a trailing comment.
+    items_per_row must be even so that every row starts on a byte boundary.
+    '''
+    print(f"static const uint8_t {name}[] = {{")
+    for i in range(0, len(words), items_per_row):
+        row = words[i:i + items_per_row]
+        packed = ", ".join(f"0x{byte:02X}" for byte in pack_words(row, letters))
+        print(f"    {packed},  // {' '.join(clean_chars(word) for word in row)}")
+    print("};")
+
+
 def print_valid_words(letters=alphabet):
     '''
-    Prints the array of valid words that the wordle_face.c can use
+    Prints the packed dictionary that the wordle_face.c can use
     '''
+    letters = sorted(letter.upper() for letter in letters)
     print("#ifndef WORDLE_FACE_DICT_H_")
     print("#define WORDLE_FACE_DICT_H_")
 
     print("\n#ifndef WORDLE_LENGTH")
     print("#define WORDLE_LENGTH 5")
     print("#endif")
+    print("\n#if (WORDLE_LENGTH != 5)")
+    print("#error \"The packed dictionary holds 5-letter words; regenerate it with utils/wordle_face/wordle_list.py.\"")
+    print("#endif")
 
     print("\n#ifndef WORDLE_USE_RANDOM_GUESS")
     print("#define WORDLE_USE_RANDOM_GUESS 2")
     print("#endif\n")
     
-    items_per_row = 9
     top_words_percent = 3
     valid_words = list_of_valid_words(letters, valid_list)
     valid_words = capitalize_all_and_remove_duplicates(valid_words)
-    random.shuffle(valid_words) 
-    # Just in case the watch's random function is too pseudo, better to shuffle th elist so it's less likely to always have the same starting letter
     valid_words, num_uniq = rearrange_words_by_uniqueness(valid_words)
     best_words = list(best_first_word(letters=letters, print_result=False).keys())  
     num_best_words = round(len(valid_words) * top_words_percent / 100)
-    for i in range(num_best_words, 0, -1):
-        valid_words.insert(0, valid_words.pop(valid_words.index(best_words[i-1])))
+    best_words = best_words[:num_best_words]
+    # Random guesses are picked from the start of the list, so it goes best words, then the rest of the words
+    # with unique letters, then everything else. Each of those runs is sorted so it can be binary searched.
+    unique_words = [word for word in valid_words[:num_uniq] if word not in best_words]
+    repeat_words = valid_words[num_uniq:]
+    valid_words = sorted(best_words) + sorted(unique_words) + sorted(repeat_words)
             
     print("static const char _valid_letters[] = {", end='')
-    letters = sorted(letters)
     for letter in letters[:-1]:
         print(f"'{clean_chars(letter)}', ", end='')
     print(f"'{letters[-1]}'" + "};")
     print("")
+    print("// Words are packed as 20-bit integers: each letter is its 4-bit index in _valid_letters, first letter")
+    print("// highest, so sorting the integers sorts the words. Two words share every five bytes.")
     print(f"// From: {source_link}")
     print(f"// Number of words found: {len(valid_words)}")
-    print("static const char _valid_words[][WORDLE_LENGTH + 1] = {")
-    i = 0
-    while i < len(valid_words):
-        print("    ", end='')
-        for _ in range(min(items_per_row, len(valid_words)-i)):
-            print(f'"{clean_chars(valid_words[i])}", ', end='')
-            i+=1
-        print('')
+    print(f"#define WORDLE_NUM_WORDS {len(valid_words)}")
+    print(f"#define WORDLE_NUM_BEST_WORDS {num_best_words}  // The valid_words array begins with this many words that are considered the top {top_words_percent}% best options.")
+    print(f"#define WORDLE_NUM_UNIQUE_WORDS {num_uniq}  // The valid_words array begins with this many words where each letter is different.")
+    print_packed_words("_valid_words", valid_words, letters)
     possible_words = list_of_valid_words(letters, possible_list)
     possible_words = [word for word in possible_words if word not in valid_list]
-    possible_words = capitalize_all_and_remove_duplicates(possible_words)
-    print("};")
+    possible_words = sorted(capitalize_all_and_remove_duplicates(possible_words))
     print("\n// These are words that'll never be used, but still need to be in the dictionary for guesses.")
     print(f"// Number of words found: {len(possible_words)}")
-    print("static const char _possible_words[][WORDLE_LENGTH + 1] = {")
     print("#if !WORDLE_ALLOW_NON_WORD_AND_REPEAT_GUESSES")
-    i = 0
-    while i < len(possible_words):
-        print("    ", end='')
-        for j in range(min(items_per_row, len(possible_words)-i)):
-            print(f'"{clean_chars(possible_words[i])}", ', end='')
-            i+=1
-        print('')
-    print("#endif")
-    print("};\n")
+    print(f"#define WORDLE_NUM_POSSIBLE_WORDS {len(possible_words)}")
+    print_packed_words("_possible_words", possible_words, letters)
+    print("#else")
+    print("#define WORDLE_NUM_POSSIBLE_WORDS 0")
+    print("#endif\n")
     
     print("#if (WORDLE_USE_RANDOM_GUESS == 3)")
-    print(f"static const uint16_t _num_random_guess_words = {num_best_words};  // The valid_words array begins with this many words that are considered the top {top_words_percent}% best options.")
+    print("static const uint16_t _num_random_guess_words = WORDLE_NUM_BEST_WORDS;")
     print("#elif (WORDLE_USE_RANDOM_GUESS == 2)")
-    print(f"static const uint16_t _num_random_guess_words = {num_uniq};  // The valid_words array begins with this many words where each letter is different.")
+    print("static const uint16_t _num_random_guess_words = WORDLE_NUM_UNIQUE_WORDS;")
     print("#elif (WORDLE_USE_RANDOM_GUESS == 1)")
-    print("static const uint16_t _num_random_guess_words = _num_words;")
+    print("static const uint16_t _num_random_guess_words = WORDLE_NUM_WORDS;")
     print("#endif")
     print("\n#endif // WORDLE_FACE_DICT_H_")
 
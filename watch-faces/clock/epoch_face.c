@@ -77,8 +77,7 @@ void _update_j2000(uint32_t seconds, bool significant) {
 }
 
 static void _update(epoch_state_t *state) {
-    watch_date_time_t date_time = movement_get_utc_date_time();
-    uint32_t now_unix = watch_utility_date_time_to_unix_time(date_time, 0);
+    uint32_t now_unix = movement_get_unix_time();
 
     switch (state->current_mode) {
         case EPOCH_UNIX:            
@@ -87,8 +87,7 @@ void _change_leap_sec(gps_time_state_t *state) {
 }
 
 static void _update(gps_time_state_t *state) {
-    watch_date_time_t date_time = movement_get_utc_date_time();
-    uint32_t now = watch_utility_date_time_to_unix_time(date_time, 0);
+    uint32_t now = movement_get_unix_time();
     uint32_t seconds = now - unix_to_gps + (uint32_t) state->leap_seconds;
 
     switch (state->current_mode) {
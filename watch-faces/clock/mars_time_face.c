@@ -69,8 +69,7 @@ static void _h_to_hms(mars_clock_hms_t *date_time, double h) {
 
 static void _update(mars_time_state_t *state, bool low_energy_mode) {
     char buf[8];
-    watch_date_time_t date_time = movement_get_local_date_time();
-    uint32_t now = watch_utility_date_time_to_unix_time(date_time, movement_get_current_timezone_offset());
+    uint32_t now = movement_get_unix_time();
     // TODO: I'm skipping over some steps here.
     // https://www.giss.nasa.gov/tools/mars24/help/algorithm.html
     double jdut = 2440587.5 + ((double)now / 86400.0);
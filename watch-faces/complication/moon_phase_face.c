@@ -30,17 +30,9 @@
 #include <stdlib.h>
 #include <string.h>
 #include <stdio.h>
-#include <math.h>
 #include "moon_phase_face.h"
 #include "watch_utility.h"
 
-#define LUNAR_DAYS 29.53058770576
-#define LUNAR_SECONDS (LUNAR_DAYS * (24 * 60 * 60))
-#define FIRST_MOON 947182440 // Saturday, 6 January 2000 18:14:00 in unix epoch time
-#define NUM_PHASES 8
-
-static const float phase_changes[] = {0, 1, 6.38264692644, 8.38264692644, 13.76529385288, 15.76529385288, 21.14794077932, 23.14794077932, 28.53058770576, 29.53058770576};
-
 void moon_phase_face_setup(uint8_t watch_face_index, void ** context_ptr) {
     (void) watch_face_index;
     if (*context_ptr == NULL) {
@@ -53,38 +45,37 @@ void moon_phase_face_activate(void *context) {
     (void) context;
 }
 
-static void _update(moon_phase_state_t *state, uint32_t offset) {
-    (void)state;
+static void _update(moon_phase_state_t *state, uint16_t days_ahead) {
     char buf[4];
-    watch_date_time_t date_time = watch_rtc_get_date_time();
-    uint32_t now = watch_utility_date_time_to_unix_time(date_time, movement_get_current_timezone_offset()) + offset;
-    date_time = watch_utility_date_time_from_unix_time(now, movement_get_current_timezone_offset());
-    double currentfrac = fmod(now - FIRST_MOON, LUNAR_SECONDS) / LUNAR_SECONDS;
-    double currentday = currentfrac * LUNAR_DAYS;
-    uint8_t phase_index = 0;
+    uint32_t now = movement_get_unix_time() + days_ahead * 86400;
+    watch_date_time_t date_time = movement_get_local_date_time();
+    uint16_t year;
+    uint8_t month, day;
 
-    for(phase_index = 0; phase_index <= NUM_PHASES; phase_index++) {
-        if (currentday > phase_changes[phase_index] && currentday <= phase_changes[phase_index + 1]) break;
-    }
+    // the offset is in whole days, so the date to show is just that many days after today.
+    watch_utility_civil_from_days(watch_utility_days_from_civil(date_time.unit.year + WATCH_RTC_REFERENCE_YEAR, date_time.unit.month, date_time.unit.day) + days_ahead,
+                                  &year, &month, &day);
+    // after the first call, this is a comparison until the phase actually changes.
+    moon_phase_update(&state->tracker, now);
+    uint32_t age = moon_phase_get_age(&state->tracker, now);
 
-    sprintf(buf, "%2d", date_time.unit.day);
+    sprintf(buf, "%2d", day);
     watch_display_text(WATCH_POSITION_TOP_RIGHT, buf);
-    switch (phase_index) {
-        case 0:
-        case 8:
+    switch (state->tracker.phase) {
+        case MOON_PHASE_NEW:
             watch_display_text_with_fallback(WATCH_POSITION_BOTTOM, "NE!J  ", " Neu  ");
             watch_display_text_with_fallback(WATCH_POSITION_TOP_LEFT, "   ", "  ");
             break;
-        case 1:
+        case MOON_PHASE_WAXING_CRESCENT:
             watch_display_text(WATCH_POSITION_BOTTOM, "CresNt");
             watch_display_text_with_fallback(WATCH_POSITION_TOP_LEFT, "WAX", "  ");
             if (watch_get_lcd_type() == WATCH_LCD_TYPE_CLASSIC) {
                 watch_set_pixel(2, 13);
                 watch_set_pixel(2, 15);
-                if (currentfrac > 0.125) watch_set_pixel(1, 13);
+                if (age > MOON_PHASE_SYNODIC_MONTH / 8) watch_set_pixel(1, 13);
             }
             break;
-        case 2:
+        case MOON_PHASE_FIRST_QUARTER:
             watch_display_text_with_fallback(WATCH_POSITION_BOTTOM, "1stQtr", " 1st q");
             watch_display_text_with_fallback(WATCH_POSITION_TOP_LEFT, "WAX", "  ");
             if (watch_get_lcd_type() == WATCH_LCD_TYPE_CLASSIC) {
@@ -94,7 +85,7 @@ static void _update(moon_phase_state_t *state, uint32_t offset) {
                 watch_set_pixel(1, 14);
             }
             break;
-        case 3:
+        case MOON_PHASE_WAXING_GIBBOUS:
             watch_display_text_with_fallback(WATCH_POSITION_BOTTOM, "GbboUs", " Gibb ");
             watch_display_text_with_fallback(WATCH_POSITION_TOP_LEFT, "WAX", "  ");
             if (watch_get_lcd_type() == WATCH_LCD_TYPE_CLASSIC) {
@@ -105,7 +96,7 @@ static void _update(moon_phase_state_t *state, uint32_t offset) {
                 watch_set_pixel(1, 15);
             }
             break;
-        case 4:
+        case MOON_PHASE_FULL:
             watch_display_text_with_fallback(WATCH_POSITION_BOTTOM, "FULL  ", " FULL ");
             watch_display_text_with_fallback(WATCH_POSITION_TOP_LEFT, "   ", "  ");
             if (watch_get_lcd_type() == WATCH_LCD_TYPE_CLASSIC) {
@@ -119,7 +110,7 @@ static void _update(moon_phase_state_t *state, uint32_t offset) {
                 watch_set_pixel(1, 13);
             }
             break;
-        case 5:
+        case MOON_PHASE_WANING_GIBBOUS:
             watch_display_text_with_fallback(WATCH_POSITION_BOTTOM, "GbboUs", " Gibb ");
             watch_display_text_with_fallback(WATCH_POSITION_TOP_LEFT, "WAN", "  ");
             if (watch_get_lcd_type() == WATCH_LCD_TYPE_CLASSIC) {
@@ -130,7 +121,7 @@ static void _update(moon_phase_state_t *state, uint32_t offset) {
                 watch_set_pixel(0, 13);
             }
             break;
-        case 6:
+        case MOON_PHASE_THIRD_QUARTER:
             watch_display_text_with_fallback(WATCH_POSITION_BOTTOM, "3rdQtr", " 3rd q");
             watch_display_text_with_fallback(WATCH_POSITION_TOP_LEFT, "WAN", "  ");
             if (watch_get_lcd_type() == WATCH_LCD_TYPE_CLASSIC) {
@@ -140,15 +131,17 @@ static void _update(moon_phase_state_t *state, uint32_t offset) {
                 watch_set_pixel(0, 13);
             }
             break;
-        case 7:
+        case MOON_PHASE_WANING_CRESCENT:
             watch_display_text(WATCH_POSITION_BOTTOM, "CresNt");
             watch_display_text_with_fallback(WATCH_POSITION_TOP_LEFT, "WAN", "  ");
             if (watch_get_lcd_type() == WATCH_LCD_TYPE_CLASSIC) {
                 watch_set_pixel(0, 14);
                 watch_set_pixel(0, 13);
-                if (currentfrac < 0.875) watch_set_pixel(2, 14);
+                if (age < MOON_PHASE_SYNODIC_MONTH / 8 * 7) watch_set_pixel(2, 14);
             }
             break;
+        case MOON_PHASE_COUNT:
+            break;
     }
 }
 
@@ -159,19 +152,19 @@ bool moon_phase_face_loop(movement_event_t event, void *context) {
     switch (event.event_type) {
         case EVENT_ACTIVATE:
             if (watch_sleep_animation_is_running()) watch_stop_sleep_animation();
-            _update(state, state->offset);
+            _update(state, state->days_ahead);
             break;
         case EVENT_TICK:
             // only update once an hour
             date_time = watch_rtc_get_date_time();
-            if ((date_time.unit.minute == 0) && (date_time.unit.second == 0)) _update(state, state->offset);
+            if ((date_time.unit.minute == 0) && (date_time.unit.second == 0)) _update(state, state->days_ahead);
             break;
         case EVENT_LOW_ENERGY_UPDATE:
             // update at the top of the hour OR if we're entering sleep mode with an offset.
             // also, in sleep mode, always show the current moon phase (offset = 0).
-            if (state->offset || (watch_rtc_get_date_time().unit.minute == 0)) _update(state, 0);
+            if (state->days_ahead || (watch_rtc_get_date_time().unit.minute == 0)) _update(state, 0);
             // and kill the offset so when the wearer wakes up, it matches what's on screen.
-            state->offset = 0;
+            state->days_ahead = 0;
             if (watch_get_lcd_type() == WATCH_LCD_TYPE_CLASSIC) {
                 // clear out the last two digits and replace them with the sleep mode indicator
                 watch_display_text(WATCH_POSITION_SECONDS, "  ");
@@ -181,12 +174,12 @@ bool moon_phase_face_loop(movement_event_t event, void *context) {
         case EVENT_ALARM_BUTTON_UP:
             // Pressing the alarm adds an offset of one day to the displayed value,
             // so you can see moon phases in the future.
-            state->offset += 86400;
-            _update(state, state->offset);
+            state->days_ahead++;
+            _update(state, state->days_ahead);
             break;
 	case EVENT_ALARM_LONG_PRESS:
-	    state->offset = 0;
-            _update(state, state->offset);
+	    state->days_ahead = 0;
+            _update(state, state->days_ahead);
 	    break;
         case EVENT_TIMEOUT:
             // QUESTION: Should timeout reset offset to 0?
@@ -200,5 +193,5 @@ bool moon_phase_face_loop(movement_event_t event, void *context) {
 
 void moon_phase_face_resign(void *context) {
     moon_phase_state_t *state = (moon_phase_state_t *)context;
-    state->offset = 0;
+    state->days_ahead = 0;
 }
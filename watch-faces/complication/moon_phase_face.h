@@ -50,9 +50,11 @@
  */
 
 #include "movement.h"
+#include "moon_phase.h"
 
 typedef struct {
-    uint32_t offset;
+    moon_phase_tracker_t tracker;
+    uint16_t days_ahead;
 } moon_phase_state_t;
 
 void moon_phase_face_setup(uint8_t watch_face_index, void ** context_ptr);
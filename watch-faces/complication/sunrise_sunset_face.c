@@ -27,13 +27,12 @@
 
 #include <stdlib.h>
 #include <string.h>
-#include <math.h>
 #include "sunrise_sunset_face.h"
 #include "watch.h"
 #include "watch_utility.h"
 #include "watch_common_display.h"
 #include "filesystem.h"
-#include "sunriset.h"
+#include "solar_events.h"
 
 #if __EMSCRIPTEN__
 #include <emscripten.h>
@@ -58,15 +57,25 @@ static movement_location_t load_location_from_filesystem() {
     return location;
 }
 
-static void _sunrise_sunset_set_expiration(sunrise_sunset_state_t *state, watch_date_time_t next_rise_set) {
-    uint32_t timestamp = watch_utility_date_time_to_unix_time(next_rise_set, 0);
-    state->rise_set_expires = watch_utility_date_time_from_unix_time(timestamp + 60, 0);
+static void _sunrise_sunset_face_display_event(sunrise_sunset_state_t *state, solar_event_t event, uint32_t timestamp) {
+    char buf[14];
+    watch_date_time_t date_time = watch_utility_date_time_from_unix_time(timestamp, movement_get_current_timezone_offset());
+
+    watch_set_colon();
+    if (movement_clock_mode_24h()) watch_set_indicator(WATCH_INDICATOR_24H);
+    else if (watch_utility_convert_to_12_hour(&date_time)) watch_set_indicator(WATCH_INDICATOR_PM);
+    else watch_clear_indicator(WATCH_INDICATOR_PM);
+
+    if (event == SOLAR_EVENT_SUNRISE) watch_display_text_with_fallback(WATCH_POSITION_TOP_LEFT, "RIS", "rI");
+    else watch_display_text_with_fallback(WATCH_POSITION_TOP_LEFT, "SET", "SE");
+    sprintf(buf, "%2d", date_time.unit.day);
+    watch_display_text(WATCH_POSITION_TOP_RIGHT, buf);
+    sprintf(buf, "%2d%02d%s", date_time.unit.hour, date_time.unit.minute, longLatPresets[state->longLatToUse].name);
+    watch_display_text(WATCH_POSITION_BOTTOM, buf);
 }
 
 static void _sunrise_sunset_face_update(sunrise_sunset_state_t *state) {
     char buf[14];
-    double rise, set, minutes, seconds;
-    bool show_next_match = false;
     movement_location_t movement_location;
     if (state->longLatToUse == 0 || _location_count <= 1)
         movement_location = load_location_from_filesystem();
@@ -81,110 +90,43 @@ static void _sunrise_sunset_face_update(sunrise_sunset_state_t *state) {
         return;
     }
 
-    watch_date_time_t date_time = movement_get_local_date_time(); // the current local date / time
-    watch_date_time_t utc_now = watch_utility_date_time_convert_zone(date_time, movement_get_current_timezone_offset(), 0); // the current date / time in UTC
-    watch_date_time_t scratch_time; // scratchpad, contains different values at different times
-    scratch_time.reg = utc_now.reg;
-
-    // Weird quirky unsigned things were happening when I tried to cast these directly to doubles below.
-    // it looks redundant, but extracting them to local int16's seemed to fix it.
-    int16_t lat_centi = (int16_t)movement_location.bit.latitude;
-    int16_t lon_centi = (int16_t)movement_location.bit.longitude;
-
-    double lat = (double)lat_centi / 100.0;
-    double lon = (double)lon_centi / 100.0;
-
-    // sunriset returns the rise/set times as signed decimal hours in UTC.
-    // this can mean hours below 0 or above 31, which won't fit into a watch_date_time_t struct.
-    // to deal with this, we set aside the offset in hours, and add it back before converting it to a watch_date_time_t.
-    double hours_from_utc = ((double)movement_get_current_timezone_offset()) / 3600.0;
+    // the rise and set times come from the shared cache, which only runs sunriset once a day per location.
+    const solar_events_t *events = solar_events_get(movement_location);
+    uint32_t now = movement_get_unix_time();
+    uint8_t events_to_skip = state->rise_index;
 
-    // we loop twice because if it's after sunset today, we need to recalculate to display values for tomorrow.
-    for(int i = 0; i < 2; i++) {
-        uint8_t result = sun_rise_set(scratch_time.unit.year + WATCH_RTC_REFERENCE_YEAR, scratch_time.unit.month, scratch_time.unit.day, lon, lat, &rise, &set);
+    // look through today and tomorrow for the next rise or set (or the one after that, if rise_index is 1).
+    for (uint8_t i = 0; i < 2; i++) {
+        const solar_events_day_t *day = &events->days[i];
 
-        if (result != 0) {
+        if (day->minutes[SOLAR_EVENT_SUNRISE] == SOLAR_EVENT_NONE) {
+            // the sun stays up (or down) all day, so there's nothing to count down to.
+            watch_date_time_t date_time = watch_utility_date_time_from_unix_time(day->day_start, 0);
             watch_clear_colon();
             watch_clear_indicator(WATCH_INDICATOR_PM);
             watch_clear_indicator(WATCH_INDICATOR_24H);
-            if (result == 1) watch_display_text_with_fallback(WATCH_POSITION_TOP_LEFT, "SET", "SE");
+            if (day->stays_above & (1 << SOLAR_EVENT_SUNRISE)) watch_display_text_with_fallback(WATCH_POSITION_TOP_LEFT, "SET", "SE");
             else watch_display_text_with_fallback(WATCH_POSITION_TOP_LEFT, "RIS", "rI");
-            sprintf(buf, "%2d", scratch_time.unit.day);
+            sprintf(buf, "%2d", date_time.unit.day);
             watch_display_text(WATCH_POSITION_TOP_RIGHT, buf);
             watch_display_text(WATCH_POSITION_BOTTOM, "None  ");
+            // day_start is 00:00 UTC on this date; check again at the next local midnight.
+            state->rise_set_expires = day->day_start + 86400 - movement_get_current_timezone_offset();
             return;
         }
 
-        watch_set_colon();
-        if (movement_clock_mode_24h()) watch_set_indicator(WATCH_INDICATOR_24H);
-
-        rise += hours_from_utc;
-        set += hours_from_utc;
-
-        minutes = 60.0 * fmod(rise, 1);
-        seconds = 60.0 * fmod(minutes, 1);
-        scratch_time.unit.hour = floor(rise);
-        if (seconds < 30) scratch_time.unit.minute = floor(minutes);
-        else scratch_time.unit.minute = ceil(minutes);
-
-        if (scratch_time.unit.minute == 60) {
-            scratch_time.unit.minute = 0;
-            scratch_time.unit.hour = (scratch_time.unit.hour + 1) % 24;
-        }
-
-        if (date_time.reg < scratch_time.reg) _sunrise_sunset_set_expiration(state, scratch_time);
-
-        if (date_time.reg < scratch_time.reg || show_next_match) {
-            if (state->rise_index == 0 || show_next_match) {
-                if (!movement_clock_mode_24h()) {
-                    if (watch_utility_convert_to_12_hour(&scratch_time)) watch_set_indicator(WATCH_INDICATOR_PM);
-                    else watch_clear_indicator(WATCH_INDICATOR_PM);
-                }
-                watch_display_text_with_fallback(WATCH_POSITION_TOP_LEFT, "RIS", "rI");
-                sprintf(buf, "%2d", scratch_time.unit.day);
-                watch_display_text(WATCH_POSITION_TOP_RIGHT, buf);
-                sprintf(buf, "%2d%02d%s", scratch_time.unit.hour, scratch_time.unit.minute,longLatPresets[state->longLatToUse].name);
-                watch_display_text(WATCH_POSITION_BOTTOM, buf);
-                return;
-            } else {
-                show_next_match = true;
-            }
-        }
-
-        minutes = 60.0 * fmod(set, 1);
-        seconds = 60.0 * fmod(minutes, 1);
-        scratch_time.unit.hour = floor(set);
-        if (seconds < 30) scratch_time.unit.minute = floor(minutes);
-        else scratch_time.unit.minute = ceil(minutes);
-
-        if (scratch_time.unit.minute == 60) {
-            scratch_time.unit.minute = 0;
-            scratch_time.unit.hour = (scratch_time.unit.hour + 1) % 24;
-        }
-
-        if (date_time.reg < scratch_time.reg) _sunrise_sunset_set_expiration(state, scratch_time);
-
-        if (date_time.reg < scratch_time.reg || show_next_match) {
-            if (state->rise_index == 0 || show_next_match) {
-                if (!movement_clock_mode_24h()) {
-                    if (watch_utility_convert_to_12_hour(&scratch_time)) watch_set_indicator(WATCH_INDICATOR_PM);
-                    else watch_clear_indicator(WATCH_INDICATOR_PM);
-                }
-                watch_display_text_with_fallback(WATCH_POSITION_TOP_LEFT, "SET", "SE");
-                sprintf(buf, "%2d", scratch_time.unit.day);
-                watch_display_text(WATCH_POSITION_TOP_RIGHT, buf);
-                sprintf(buf, "%2d%02d%s", scratch_time.unit.hour, scratch_time.unit.minute,longLatPresets[state->longLatToUse].name);
-                watch_display_text(WATCH_POSITION_BOTTOM, buf);
-                return;
-            } else {
-                show_next_match = true;
+        for (solar_event_t event = SOLAR_EVENT_SUNRISE; event <= SOLAR_EVENT_SUNSET; event++) {
+            uint32_t timestamp = solar_events_get_time(day, event);
+            if (timestamp <= now) continue;
+            // update the display a minute after the next event has passed.
+            if (events_to_skip == state->rise_index) state->rise_set_expires = timestamp + 60;
+            if (events_to_skip) {
+                events_to_skip--;
+                continue;
             }
+            _sunrise_sunset_face_display_event(state, event, timestamp);
+            return;
         }
-
-        // it's after sunset. we need to display sunrise/sunset for tomorrow.
-        uint32_t timestamp = watch_utility_date_time_to_unix_time(utc_now, 0);
-        timestamp += 86400;
-        scratch_time = watch_utility_date_time_from_unix_time(timestamp, 0);
     }
 }
 
@@ -468,8 +410,7 @@ bool sunrise_sunset_face_loop(movement_event_t event, void *context) {
                 // if entering low energy mode, start tick animation
                 if (event.event_type == EVENT_LOW_ENERGY_UPDATE && !watch_sleep_animation_is_running()) watch_start_sleep_animation(1000);
                 // check if we need to update the display
-                watch_date_time_t date_time = movement_get_local_date_time();
-                if (date_time.reg >= state->rise_set_expires.reg) {
+                if (movement_get_unix_time() >= state->rise_set_expires) {
                     // and on the off chance that this happened before EVENT_TIMEOUT snapped us back to rise/set 0, go back now
                     state->rise_index = 0;
                     _sunrise_sunset_face_update(state);
@@ -544,6 +485,9 @@ bool sunrise_sunset_face_loop(movement_event_t event, void *context) {
                 _sunrise_sunset_face_update(state);
             }
             break;
+        case EVENT_BACKGROUND_TASK:
+            solar_events_refresh();
+            break;
         case EVENT_TIMEOUT:
             if (load_location_from_filesystem().reg == 0) {
                 // if no location set, return home
@@ -563,6 +507,17 @@ bool sunrise_sunset_face_loop(movement_event_t event, void *context) {
     return true;
 }
 
+movement_watch_face_advisory_t sunrise_sunset_face_advise(void *context) {
+    (void) context;
+    movement_watch_face_advisory_t retval = { 0 };
+
+    // at local midnight, move the solar events cache on to the new day.
+    watch_date_time_t date_time = movement_get_local_date_time();
+    retval.wants_background_task = date_time.unit.hour == 0 && date_time.unit.minute == 0;
+
+    return retval;
+}
+
 void sunrise_sunset_face_resign(void *context) {
     sunrise_sunset_state_t *state = (sunrise_sunset_state_t *)context;
     state->page = 0;
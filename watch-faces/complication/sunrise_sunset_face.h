@@ -52,7 +52,7 @@ typedef struct {
     uint8_t rise_index;
     uint8_t active_digit;
     bool location_changed;
-    watch_date_time_t rise_set_expires;
+    uint32_t rise_set_expires;
     sunrise_sunset_lat_lon_settings_t working_latitude;
     sunrise_sunset_lat_lon_settings_t working_longitude;
     uint8_t longLatToUse;
@@ -62,13 +62,14 @@ void sunrise_sunset_face_setup(uint8_t watch_face_index, void ** context_ptr);
 void sunrise_sunset_face_activate(void *context);
 bool sunrise_sunset_face_loop(movement_event_t event, void *context);
 void sunrise_sunset_face_resign(void *context);
+movement_watch_face_advisory_t sunrise_sunset_face_advise(void *context);
 
 #define sunrise_sunset_face ((const watch_face_t){ \
     sunrise_sunset_face_setup, \
     sunrise_sunset_face_activate, \
     sunrise_sunset_face_loop, \
     sunrise_sunset_face_resign, \
-    NULL, \
+    sunrise_sunset_face_advise, \
 })
 
 typedef struct {
@@ -29,17 +29,29 @@
 #include "watch.h"
 #include "watch_utility.h"
 
+static const tiered_history_config_t _activity_logging_history_config = {
+    .filename = TIERED_HISTORY_PATH("activity.hst"),
+    .sample_minutes = ACTIVITY_LOGGING_SAMPLE_MINUTES,
+    .hours = TIERED_HISTORY_DEFAULT_HOURS,
+    .days = TIERED_HISTORY_DEFAULT_DAYS,
+};
+
 static void _activity_logging_face_update_display(activity_logging_state_t *state) {
     char buf[8];
-    watch_date_time_t timestamp = movement_get_local_date_time();
+    watch_date_time_t now = movement_get_local_date_time();
+    tiered_history_entry_t entry;
+    bool has_data = tiered_history_get(&state->history, TIERED_HISTORY_DAILY, now, state->display_index, &entry);
+    watch_date_time_t timestamp = watch_utility_date_time_from_unix_time(entry.timestamp, 0);
 
     watch_display_text_with_fallback(WATCH_POSITION_TOP_LEFT, "ACT", "AC");
 
+    // display date
+    snprintf(buf, 8, "%2d", timestamp.unit.day);
+    watch_display_text(WATCH_POSITION_TOP_RIGHT, buf);
+
     if (state->display_index == 0) {
-        // if we are at today, just show the count so far
-        snprintf(buf, 8, "%2d", timestamp.unit.day);
-        watch_display_text(WATCH_POSITION_TOP_RIGHT, buf);
-        snprintf(buf, 8, "%4d  ", state->active_minutes_today);
+        // if we are at today, show the count so far, including the minutes that haven't been logged yet.
+        snprintf(buf, 8, "%4d  ", (int)entry.sum + state->active_minutes_in_sample);
         watch_display_text(WATCH_POSITION_BOTTOM, buf);
 
         // also indicate that this is the active day — we are still sensing active minutes!
@@ -47,22 +59,13 @@ static void _activity_logging_face_update_display(activity_logging_state_t *stat
     } else {
         // otherwise we need to go into the log.
         watch_clear_indicator(WATCH_INDICATOR_SIGNAL);
-        int32_t pos = ((int16_t)state->data_points - (int32_t)state->display_index) % ACTIVITY_LOGGING_NUM_DAYS;
-        // get day of month for today - display_index
-        uint32_t unixtime = watch_utility_date_time_to_unix_time(timestamp, movement_get_current_timezone_offset());
-        unixtime -= 86400 * state->display_index;
-        timestamp = watch_utility_date_time_from_unix_time(unixtime, movement_get_current_timezone_offset());    
-
-        // display date
-        snprintf(buf, 8, "%2d", timestamp.unit.day);
-        watch_display_text(WATCH_POSITION_TOP_RIGHT, buf);
 
-        if (pos < 0) {
+        if (!has_data) {
             // no data at this index
             watch_display_text(WATCH_POSITION_BOTTOM, "no dat");
         } else {
             // we are displaying the number active minutes
-            snprintf(buf, 8, "%4d  ", state->activity_log[pos]);
+            snprintf(buf, 8, "%4d  ", (int)entry.sum);
             watch_display_text(WATCH_POSITION_BOTTOM, buf);
         }
     }
@@ -73,8 +76,12 @@ void activity_logging_face_setup(uint8_t watch_face_index, void ** context_ptr)
     if (*context_ptr == NULL) {
         *context_ptr = malloc(sizeof(activity_logging_state_t));
         memset(*context_ptr, 0, sizeof(activity_logging_state_t));
-        // At first run, tell Movement to run the accelerometer in the background. It will now run at this rate forever.
-        movement_set_accelerometer_background_rate(LIS2DW_DATA_RATE_LOWEST);
+        activity_logging_state_t *state = (activity_logging_state_t *)*context_ptr;
+        tiered_history_init(&state->history, &_activity_logging_history_config, movement_get_local_date_time());
+        // At first run, tell Movement to count steps in the background. It will now run the accelerometer forever.
+        movement_enable_step_counting_if_available();
+        // The accelerometer is on anyway, so have Movement log restless nights to MOVEMENT_SLEEP_FILE too.
+        movement_enable_sleep_tracking_if_available();
     }
 }
 
@@ -87,7 +94,7 @@ bool activity_logging_face_loop(movement_event_t event, void *context) {
     activity_logging_state_t *state = (activity_logging_state_t *)context;
     switch (event.event_type) {
         case EVENT_ALARM_BUTTON_DOWN:
-            state->display_index = (state->display_index + 1) % ACTIVITY_LOGGING_NUM_DAYS;
+            state->display_index = (state->display_index + 1) % tiered_history_get_capacity(&state->history, TIERED_HISTORY_DAILY);
             // fall through
         case EVENT_ACTIVATE:
             if (watch_sleep_animation_is_running()) {
@@ -104,10 +111,11 @@ bool activity_logging_face_loop(movement_event_t event, void *context) {
             break;
         case EVENT_BACKGROUND_TASK:
             {
-                size_t pos = state->data_points % ACTIVITY_LOGGING_NUM_DAYS;
-                state->activity_log[pos] = state->active_minutes_today;
-                state->data_points++;
-                state->active_minutes_today = 0;
+                // the sample covers the minutes up to now, so file it under the minute that just ended; that way the
+                // last bucket of the day lands on the right day.
+                uint32_t now = watch_utility_date_time_to_unix_time(movement_get_local_date_time(), 0);
+                tiered_history_add_sample(&state->history, watch_utility_date_time_from_unix_time(now - 60, 0), state->active_minutes_in_sample);
+                state->active_minutes_in_sample = 0;
             }
             break;
         case EVENT_LOW_ENERGY_UPDATE:
@@ -137,20 +145,11 @@ movement_watch_face_advisory_t activity_logging_face_advise(void *context) {
     activity_logging_state_t *state = (activity_logging_state_t *)context;
     movement_watch_face_advisory_t retval = { 0 };
 
-    if (!HAL_GPIO_A4_read()) {
-        // only count this as an active minute if the previous minute was also active.
-        // otherwise, set the flag and we'll count the next minute if the wearer is still active.
-        if (state->previous_minute_was_active) state->active_minutes_today++;
-        else state->previous_minute_was_active = true;
-    } else {
-        state->previous_minute_was_active = false;
-    }
+    // Movement has just closed out the minute's step count, so it knows whether we were walking or running.
+    if (movement_get_last_minute_activity().activity != PEDOMETER_ACTIVITY_STILL) state->active_minutes_in_sample++;
 
-    watch_date_time_t datetime = movement_get_local_date_time();
-    // request a background task at midnight to shuffle the data into the log
-    if (datetime.unit.hour == 0 && datetime.unit.minute == 0) {
-        retval.wants_background_task = true;
-    }
+    // request a background task at the end of each bucket to log the active minutes in it.
+    retval.wants_background_task = tiered_history_wants_sample(&state->history, movement_get_local_date_time());
 
     return retval;
 }
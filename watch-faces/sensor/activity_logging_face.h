@@ -29,8 +29,9 @@
 /*
  * ACTIVITY LOGGING
  *
- * This watch face works with Movement's built-in tracking of accelerometer state to log activity over time.
- * The watch face shows the number of active minutes counted for each of the last 14 days. Layout:
+ * This watch face works with Movement's built-in step counter to log activity over time. It counts a minute as
+ * active if the step counter classified it as walking or running. The watch face shows the number of active
+ * minutes counted for each of the last 14 days (a year if your board has external flash). Layout:
  *
  *  - Top left is display title (ACT or AC for Activity)
  *  - Top right is the day of the month corresponding to the data point shown on screen.
@@ -39,21 +40,27 @@
  *    that the accelerometer sensor is sensing, and the watch face is still counting today's active minutes.
  *
  * A short press of the Alarm button moves backwards in the data log, showing yesterday's active minutes,
- * then the day before, etc. going back 14 days.
+ * then the day before, etc.
+ *
+ * Active minutes are stored in 15-minute buckets in a tiered history (see filesystem/tiered_history.h), so
+ * the same file also holds the last day in quarter hours and the last few days in hours. The step counts
+ * themselves are logged minute by minute to steps.bin; see movement.h.
+ *
+ * With this face installed, Movement also tracks sleep, on boards where the accelerometer's interrupt reaches
+ * the watch: restlessness is logged in five minute buckets to sleep.bin, again see movement.h.
  *
  */
 
 #include "movement.h"
 #include "watch.h"
+#include "tiered_history.h"
 
-#define ACTIVITY_LOGGING_NUM_DAYS (14)
+#define ACTIVITY_LOGGING_SAMPLE_MINUTES (15)
 
 typedef struct {
-    uint16_t activity_log[ACTIVITY_LOGGING_NUM_DAYS];   // the activity log
-    uint16_t data_points;                               // the number of days logged
-    uint8_t display_index;                              // the index we are displaying on screen
-    uint16_t active_minutes_today;                      // the number of active minutes logged today
-    bool previous_minute_was_active;                    // we only want to count two or more consecutive active minutes
+    uint16_t display_index;                             // the index we are displaying on screen
+    uint8_t active_minutes_in_sample;                   // the number of active minutes logged since the last sample
+    tiered_history_t history;                           // active minutes per ACTIVITY_LOGGING_SAMPLE_MINUTES
 } activity_logging_state_t;
 
 void activity_logging_face_setup(uint8_t watch_face_index, void ** context_ptr);
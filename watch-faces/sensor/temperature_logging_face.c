@@ -26,35 +26,63 @@
 #include <string.h>
 #include "temperature_logging_face.h"
 #include "watch.h"
+#include "watch_utility.h"
 
 static bool skip = false;
 
+static const tiered_history_config_t _temperature_logging_history_config = {
+    .filename = TIERED_HISTORY_PATH("temp.hst"),
+    .sample_minutes = 30,
+    .hours = TIERED_HISTORY_DEFAULT_HOURS,
+    .days = TIERED_HISTORY_DEFAULT_DAYS,
+};
+
 static void _temperature_logging_face_log_data(temperature_logging_state_t *logger_state) {
-    watch_date_time_t date_time = watch_rtc_get_date_time();
-    size_t pos = logger_state->data_points % TEMPERATURE_LOGGING_NUM_DATA_POINTS;
+    float temperature_c = movement_get_temperature();
+    tiered_history_add_sample(&logger_state->history, movement_get_local_date_time(), (int16_t)(temperature_c * 100));
+}
 
-    logger_state->data[pos].timestamp.reg = date_time.reg;
-    logger_state->data[pos].temperature_c = movement_get_temperature();
-    logger_state->data_points++;
+static void _temperature_logging_face_display_temperature(int16_t centidegrees, bool in_fahrenheit) {
+    float temperature_c = centidegrees / 100.0;
+    if (in_fahrenheit) {
+        watch_display_float_with_best_effort(temperature_c * 1.8 + 32.0, "#F");
+    } else {
+        watch_display_float_with_best_effort(temperature_c, "#C");
+    }
 }
 
 static void _temperature_logging_face_update_display(temperature_logging_state_t *logger_state, bool in_fahrenheit, bool clock_mode_24h) {
-    int8_t pos = (logger_state->data_points - 1 - logger_state->display_index) % TEMPERATURE_LOGGING_NUM_DATA_POINTS;
+    tiered_history_entry_t entry;
+    bool has_data = tiered_history_get(&logger_state->history, logger_state->tier, movement_get_local_date_time(), logger_state->display_index, &entry);
+    watch_date_time_t date_time = watch_utility_date_time_from_unix_time(entry.timestamp, 0);
     char buf[7];
 
     watch_clear_indicator(WATCH_INDICATOR_24H);
     watch_clear_indicator(WATCH_INDICATOR_PM);
     watch_clear_colon();
 
-    if (pos < 0) {
+    // readings are numbered; summaries are labeled with their hour or day of the month.
+    switch (logger_state->tier) {
+        case TIERED_HISTORY_SAMPLES:
+            watch_display_text_with_fallback(WATCH_POSITION_TOP_LEFT, "LOG", "TL");
+            sprintf(buf, "%2d", logger_state->display_index);
+            break;
+        case TIERED_HISTORY_HOURLY:
+            watch_display_text_with_fallback(WATCH_POSITION_TOP_LEFT, "HR ", "TH");
+            sprintf(buf, "%2d", date_time.unit.hour);
+            break;
+        default:
+            watch_display_text_with_fallback(WATCH_POSITION_TOP_LEFT, "DAY", "TD");
+            sprintf(buf, "%2d", date_time.unit.day);
+            break;
+    }
+    watch_display_text(WATCH_POSITION_TOP_RIGHT, buf);
+
+    if (!has_data) {
         // no data at this index
-        watch_display_text_with_fallback(WATCH_POSITION_TOP_LEFT, "LOG", "TL");
         watch_display_text(WATCH_POSITION_BOTTOM, "no dat");
-        sprintf(buf, "%2d", logger_state->display_index);
-        watch_display_text(WATCH_POSITION_TOP_RIGHT, buf);
-    } else if (logger_state->ts_ticks) {
+    } else if (logger_state->detail == TEMPERATURE_LOGGING_DETAIL_TIMESTAMP) {
         // we are displaying the timestamp in response to a button press
-        watch_date_time_t date_time = logger_state->data[pos].timestamp;
         watch_set_colon();
         if (clock_mode_24h) {
             watch_set_indicator(WATCH_INDICATOR_24H);
@@ -68,16 +96,15 @@ static void _temperature_logging_face_update_display(temperature_logging_state_t
         watch_display_text(WATCH_POSITION_TOP_RIGHT, buf);
         sprintf(buf, "%2d%02d%02d", date_time.unit.hour, date_time.unit.minute, date_time.unit.second);
         watch_display_text(WATCH_POSITION_BOTTOM, buf);
+    } else if (logger_state->detail == TEMPERATURE_LOGGING_DETAIL_MIN) {
+        watch_display_text(WATCH_POSITION_TOP_LEFT, "LO");
+        _temperature_logging_face_display_temperature(entry.min, in_fahrenheit);
+    } else if (logger_state->detail == TEMPERATURE_LOGGING_DETAIL_MAX) {
+        watch_display_text(WATCH_POSITION_TOP_LEFT, "HI");
+        _temperature_logging_face_display_temperature(entry.max, in_fahrenheit);
     } else {
         // we are displaying the temperature
-        watch_display_text_with_fallback(WATCH_POSITION_TOP_LEFT, "LOG", "TL");
-        sprintf(buf, "%2d", logger_state->display_index);
-        watch_display_text(WATCH_POSITION_TOP_RIGHT, buf);
-        if (in_fahrenheit) {
-            watch_display_float_with_best_effort(logger_state->data[pos].temperature_c * 1.8 + 32.0, "#F");
-        } else {
-            watch_display_float_with_best_effort(logger_state->data[pos].temperature_c, "#C");
-        }
+        _temperature_logging_face_display_temperature(entry.mean, in_fahrenheit);
     }
 }
 
@@ -90,6 +117,8 @@ void temperature_logging_face_setup(uint8_t watch_face_index, void ** context_pt
     if (*context_ptr == NULL) {
         *context_ptr = malloc(sizeof(temperature_logging_state_t));
         memset(*context_ptr, 0, sizeof(temperature_logging_state_t));
+        temperature_logging_state_t *logger_state = (temperature_logging_state_t *)*context_ptr;
+        if (!skip) tiered_history_init(&logger_state->history, &_temperature_logging_history_config, movement_get_local_date_time());
     }
 }
 
@@ -97,6 +126,7 @@ void temperature_logging_face_activate(void *context) {
     temperature_logging_state_t *logger_state = (temperature_logging_state_t *)context;
     logger_state->display_index = 0;
     logger_state->ts_ticks = 0;
+    logger_state->detail = TEMPERATURE_LOGGING_DETAIL_MEAN;
 }
 
 bool temperature_logging_face_loop(movement_event_t event, void *context) {
@@ -110,12 +140,23 @@ bool temperature_logging_face_loop(movement_event_t event, void *context) {
             movement_illuminate_led();
             break;
         case EVENT_LIGHT_BUTTON_DOWN:
+            // readings only have a timestamp; summaries also have a low and a high.
+            if (logger_state->detail == TEMPERATURE_LOGGING_DETAIL_MEAN) logger_state->detail = TEMPERATURE_LOGGING_DETAIL_TIMESTAMP;
+            else if (logger_state->tier != TIERED_HISTORY_SAMPLES && logger_state->detail != TEMPERATURE_LOGGING_DETAIL_MAX) logger_state->detail++;
             logger_state->ts_ticks = 2;
             _temperature_logging_face_update_display(logger_state, movement_use_imperial_units(), movement_clock_mode_24h());
             break;
-        case EVENT_ALARM_BUTTON_DOWN:
-            logger_state->display_index = (logger_state->display_index + 1) % TEMPERATURE_LOGGING_NUM_DATA_POINTS;
+        case EVENT_ALARM_LONG_PRESS:
+            logger_state->tier = (logger_state->tier + 1) % TIERED_HISTORY_NUM_TIERS;
+            logger_state->display_index = 0;
             logger_state->ts_ticks = 0;
+            logger_state->detail = TEMPERATURE_LOGGING_DETAIL_MEAN;
+            _temperature_logging_face_update_display(logger_state, movement_use_imperial_units(), movement_clock_mode_24h());
+            break;
+        case EVENT_ALARM_BUTTON_UP:
+            logger_state->display_index = (logger_state->display_index + 1) % tiered_history_get_capacity(&logger_state->history, logger_state->tier);
+            logger_state->ts_ticks = 0;
+            logger_state->detail = TEMPERATURE_LOGGING_DETAIL_MEAN;
             // fall through
         case EVENT_ACTIVATE:
             if (skip) {
@@ -126,6 +167,7 @@ bool temperature_logging_face_loop(movement_event_t event, void *context) {
             break;
         case EVENT_TICK:
             if (logger_state->ts_ticks && --logger_state->ts_ticks == 0) {
+                logger_state->detail = TEMPERATURE_LOGGING_DETAIL_MEAN;
                 _temperature_logging_face_update_display(logger_state, movement_use_imperial_units(), movement_clock_mode_24h());
             }
             break;
@@ -145,12 +187,11 @@ void temperature_logging_face_resign(void *context) {
 }
 
 movement_watch_face_advisory_t temperature_logging_face_advise(void *context) {
-    (void) context;
+    temperature_logging_state_t *logger_state = (temperature_logging_state_t *)context;
     movement_watch_face_advisory_t retval = { 0 };
 
-    // this will get called at the top of each minute, so all we check is if we're at the top of the hour as well.
-    // if we are, we ask for a background task.
-    retval.wants_background_task = watch_rtc_get_date_time().unit.minute == 0;
+    // this will get called at the top of each minute; the history knows when it's time for another sample.
+    retval.wants_background_task = !skip && tiered_history_wants_sample(&logger_state->history, movement_get_local_date_time());
 
     return retval;
 }
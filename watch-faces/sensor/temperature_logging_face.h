@@ -29,26 +29,33 @@
 /*
  * THERMISTOR LOGGING (aka Temperature Log)
  *
- * This watch face automatically logs the temperature once an hour, and
- * maintains a 36-hour log of readings. This watch face is admittedly rather
+ * This watch face automatically logs the temperature every half hour, and
+ * keeps a long-term history in flash: every reading from the last day, the
+ * hourly low, average and high for the last 36 hours (a month if your board
+ * has external flash), and the daily low, average and high for the last
+ * two weeks (a year with external flash). This watch face is admittedly rather
  * complex, and bears some explanation.
  *
  * The main display shows the letters “TL” in the top left, indicating the
  * name of the watch face. At the top right, it displays the index of the
- * reading; 0 represents the most recent reading taken, 1 represents one
+ * reading; 0 represents the most recent reading taken, 1 represents half an
  * hour earlier, etc. The bottom line in this mode displays the logged
  * temperature.
  *
- * A short press of the “Alarm” button advances to the next oldest reading;
- * you will see the number at the top right advance from 0 to 1 to 2, all
- * the way to 35, the oldest reading available.
+ * A short press of the “Alarm” button advances to the next oldest reading.
+ *
+ * A long press of the “Alarm” button switches between readings (“TL”),
+ * hourly summaries (“TH”) and daily summaries (“TD”). For summaries, the
+ * bottom line shows the average temperature, and the top right shows the
+ * hour or the day of the month. Entry 0 is the hour or day in progress.
  *
  * A short press of the “Light” button will briefly display the timestamp
  * of the reading. The letters at the top left will display the word “At”,
  * and the main line will display the timestamp of the currently displayed
  * data point. The number in the top right will display the day of the month
  * for the given data point; for example, you can read “At 22 3:00 PM” as
- * ”At 3:00 PM on the 22nd”.
+ * ”At 3:00 PM on the 22nd”. For summaries, pressing “Light” again shows the
+ * low (“LO”) and then the high (“HI”) temperature for that period.
  *
  * If you need to illuminate the LED to read the data point, long press the
  * Light button and release it.
@@ -56,19 +63,21 @@
 
 #include "movement.h"
 #include "watch.h"
+#include "tiered_history.h"
 
-#define TEMPERATURE_LOGGING_NUM_DATA_POINTS (36)
-
-typedef struct {
-    watch_date_time_t timestamp;
-    float temperature_c;
-} thermistor_logger_data_point_t;
+typedef enum {
+    TEMPERATURE_LOGGING_DETAIL_MEAN = 0,
+    TEMPERATURE_LOGGING_DETAIL_TIMESTAMP,
+    TEMPERATURE_LOGGING_DETAIL_MIN,
+    TEMPERATURE_LOGGING_DETAIL_MAX,
+} temperature_logging_detail_t;
 
 typedef struct {
-    uint8_t display_index;  // the index we are displaying on screen
-    uint8_t ts_ticks;       // when the user taps the LIGHT button, we show the timestamp for a few ticks.
-    int32_t data_points;    // the absolute number of data points logged
-    thermistor_logger_data_point_t data[TEMPERATURE_LOGGING_NUM_DATA_POINTS];
+    uint16_t display_index;                 // the index we are displaying on screen
+    uint8_t ts_ticks;                       // when the user taps the LIGHT button, we show details for a few ticks.
+    temperature_logging_detail_t detail;    // which detail we are showing
+    tiered_history_tier_t tier;             // which tier of the history we are browsing
+    tiered_history_t history;               // temperatures in hundredths of a degree Celsius
 } temperature_logging_state_t;
 
 void temperature_logging_face_setup(uint8_t watch_face_index, void ** context_ptr);
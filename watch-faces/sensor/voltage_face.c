@@ -26,6 +26,18 @@
 #include <string.h>
 #include "voltage_face.h"
 #include "watch.h"
+#include "watch_utility.h"
+
+#ifdef VOLTAGE_FACE_LOG_HISTORY
+
+static const tiered_history_config_t _voltage_history_config = {
+    .filename = TIERED_HISTORY_PATH("voltage.hst"),
+    .sample_minutes = 30,
+    .hours = TIERED_HISTORY_DEFAULT_HOURS,
+    .days = TIERED_HISTORY_DEFAULT_DAYS,
+};
+
+#endif
 
 static void _voltage_face_update_display(void) {
     float voltage = (float)watch_get_vcc_voltage() / 1000.0;
@@ -34,24 +46,78 @@ static void _voltage_face_update_display(void) {
     watch_display_float_with_best_effort(voltage, " V");
 }
 
+#ifdef VOLTAGE_FACE_LOG_HISTORY
+
+static void _voltage_face_display_history(voltage_state_t *state) {
+    tiered_history_entry_t entry;
+    char buf[3];
+    bool has_data = tiered_history_get(&state->history, state->tier, movement_get_local_date_time(), state->display_index - 1, &entry);
+    watch_date_time_t date_time = watch_utility_date_time_from_unix_time(entry.timestamp, 0);
+
+    watch_display_text_with_fallback(WATCH_POSITION_TOP_LEFT, state->tier == TIERED_HISTORY_HOURLY ? "HR " : "DAY", "BA");
+    sprintf(buf, "%2d", state->tier == TIERED_HISTORY_HOURLY ? date_time.unit.hour : date_time.unit.day);
+    watch_display_text(WATCH_POSITION_TOP_RIGHT, buf);
+    if (has_data) watch_display_float_with_best_effort(entry.mean / 1000.0, " V");
+    else watch_display_text(WATCH_POSITION_BOTTOM, "no dat");
+}
+
+#endif
+
 void voltage_face_setup(uint8_t watch_face_index, void ** context_ptr) {
     (void) watch_face_index;
+#ifdef VOLTAGE_FACE_LOG_HISTORY
+    if (*context_ptr == NULL) {
+        *context_ptr = malloc(sizeof(voltage_state_t));
+        memset(*context_ptr, 0, sizeof(voltage_state_t));
+        voltage_state_t *state = (voltage_state_t *)*context_ptr;
+        state->tier = TIERED_HISTORY_HOURLY;
+        tiered_history_init(&state->history, &_voltage_history_config, movement_get_local_date_time());
+    }
+#else
     (void) context_ptr;
+#endif
 }
 
 void voltage_face_activate(void *context) {
+#ifdef VOLTAGE_FACE_LOG_HISTORY
+    voltage_state_t *state = (voltage_state_t *)context;
+    state->display_index = 0;
+#else
     (void) context;
+#endif
 }
 
 bool voltage_face_loop(movement_event_t event, void *context) {
+#ifdef VOLTAGE_FACE_LOG_HISTORY
+    voltage_state_t *state = (voltage_state_t *)context;
+#else
     (void) context;
+#endif
     watch_date_time_t date_time;
     switch (event.event_type) {
         case EVENT_ACTIVATE:
             if (watch_sleep_animation_is_running()) watch_stop_sleep_animation();
             _voltage_face_update_display();
             break;
+#ifdef VOLTAGE_FACE_LOG_HISTORY
+        case EVENT_ALARM_BUTTON_UP:
+            state->display_index = (state->display_index + 1) % (tiered_history_get_capacity(&state->history, state->tier) + 1);
+            watch_clear_indicator(WATCH_INDICATOR_SIGNAL);
+            if (state->display_index) _voltage_face_display_history(state);
+            else _voltage_face_update_display();
+            break;
+        case EVENT_ALARM_LONG_PRESS:
+            state->tier = state->tier == TIERED_HISTORY_HOURLY ? TIERED_HISTORY_DAILY : TIERED_HISTORY_HOURLY;
+            state->display_index = 1;
+            watch_clear_indicator(WATCH_INDICATOR_SIGNAL);
+            _voltage_face_display_history(state);
+            break;
+#endif
         case EVENT_TICK:
+#ifdef VOLTAGE_FACE_LOG_HISTORY
+            // while browsing the history, leave the display alone.
+            if (state->display_index) break;
+#endif
             date_time = movement_get_local_date_time();
             if (date_time.unit.second % 5 == 4) {
                 watch_set_indicator(WATCH_INDICATOR_SIGNAL);
@@ -60,9 +126,24 @@ bool voltage_face_loop(movement_event_t event, void *context) {
                 watch_clear_indicator(WATCH_INDICATOR_SIGNAL);
             }
             break;
+#ifdef VOLTAGE_FACE_LOG_HISTORY
+        case EVENT_BACKGROUND_TASK:
+            tiered_history_add_sample(&state->history, movement_get_local_date_time(), watch_get_vcc_voltage());
+            break;
+        case EVENT_TIMEOUT:
+            if (state->display_index) {
+                state->display_index = 0;
+                _voltage_face_update_display();
+            }
+            break;
+#endif
         case EVENT_LOW_ENERGY_UPDATE:
+            date_time = movement_get_local_date_time();
             // clear seconds area (on classic LCD) and start tick animation if necessary
             if (!watch_sleep_animation_is_running()) {
+#ifdef VOLTAGE_FACE_LOG_HISTORY
+                state->display_index = 0;
+#endif
                 watch_display_text_with_fallback(WATCH_POSITION_SECONDS, " V", "  ");
                 watch_start_sleep_animation(1000);
             }
@@ -84,3 +165,16 @@ bool voltage_face_loop(movement_event_t event, void *context) {
 void voltage_face_resign(void *context) {
     (void) context;
 }
+
+movement_watch_face_advisory_t voltage_face_advise(void *context) {
+    movement_watch_face_advisory_t retval = { 0 };
+
+#ifdef VOLTAGE_FACE_LOG_HISTORY
+    voltage_state_t *state = (voltage_state_t *)context;
+    retval.wants_background_task = tiered_history_wants_sample(&state->history, movement_get_local_date_time());
+#else
+    (void) context;
+#endif
+
+    return retval;
+}
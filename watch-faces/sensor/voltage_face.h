@@ -28,8 +28,20 @@
 /*
  * VOLTAGE face
  *
- * This watch face is very simple and has no controls to speak of. It displays
- * the battery voltage as measured by the SAM L22’s ADC.
+ * This watch face displays the battery voltage as measured by the SAM L22’s
+ * ADC.
+ *
+ * Built with VOLTAGE_LOG=1 (which defines VOLTAGE_FACE_LOG_HISTORY), it also
+ * keeps a history of it: every half hour, the voltage is logged to a tiered
+ * history (see filesystem/tiered_history.h), which takes about 800 bytes of
+ * the filesystem. It's off by default, since the internal filesystem is small.
+ *
+ * With the history, a short press of the Alarm button steps back through it:
+ * the top right shows the hour of each hourly average, starting with the
+ * current hour. A long press of the Alarm button switches between hourly and
+ * daily averages; for daily averages, the top right shows the day of the
+ * month. Keep pressing past the oldest entry, or wait for the face to time
+ * out, to get back to the live reading.
  *
  * Note that the Simple Clock watch face includes a low battery warning, so you
  * don’t technically need to this watch face unless you want to track the
@@ -37,18 +49,28 @@
  */
 
 #include "movement.h"
+#include "tiered_history.h"
+
+#ifdef VOLTAGE_FACE_LOG_HISTORY
+typedef struct {
+    uint16_t display_index;         // 0 for the live reading, otherwise 1 + how far back in the history
+    tiered_history_tier_t tier;     // TIERED_HISTORY_HOURLY or TIERED_HISTORY_DAILY
+    tiered_history_t history;       // battery voltage in millivolts
+} voltage_state_t;
+#endif
 
 void voltage_face_setup(uint8_t watch_face_index, void ** context_ptr);
 void voltage_face_activate(void *context);
 bool voltage_face_loop(movement_event_t event, void *context);
 void voltage_face_resign(void *context);
+movement_watch_face_advisory_t voltage_face_advise(void *context);
 
 #define voltage_face ((const watch_face_t){ \
     voltage_face_setup, \
     voltage_face_activate, \
     voltage_face_loop, \
     voltage_face_resign, \
-    NULL, \
+    voltage_face_advise, \
 })
 
 #endif // VOLTAGE_FACE_H_
@@ -116,7 +116,7 @@ static void finetune_adjust_subseconds(int delta) {
                     date_time.unit.day++;
             }
         }
-        watch_rtc_set_date_time(date_time);
+        movement_set_utc_date_time(date_time);
     }
     watch_rtc_enable(true);
 }
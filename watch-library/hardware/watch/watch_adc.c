@@ -88,6 +88,43 @@ uint16_t watch_get_vcc_voltage(void) {
     return (uint16_t)((raw_val * 1000) / (1024 * 1 << ADC->AVGCTRL.bit.SAMPLENUM));
 }
 
+void watch_get_analog_levels(watch_adc_reading_t *readings, uint8_t count, uint16_t samples) {
+    bool adc_was_disabled = !adc_is_enabled();
+    if (adc_was_disabled) watch_enable_adc();
+
+    // with 16 or more samples, the ADC shifts the accumulated result back down to 16 bits, so the scale of
+    // the result is the same as with the default setting of 16 samples.
+    uint8_t samplenum = ADC_AVGCTRL_SAMPLENUM_16_Val;
+    while (samplenum < ADC_AVGCTRL_SAMPLENUM_1024_Val && (1u << (samplenum + 1)) <= samples) samplenum++;
+    uint8_t old_avgctrl = ADC->AVGCTRL.reg;
+    ADC->AVGCTRL.reg = ADC_AVGCTRL_SAMPLENUM(samplenum);
+    while (ADC->SYNCBUSY.reg);
+
+    // read the pins first, against the reference that's already selected...
+    bool wants_vcc = false;
+    for (uint8_t i = 0; i < count; i++) {
+        if (readings[i].pin == WATCH_ADC_VCC) wants_vcc = true;
+        else readings[i].value = adc_get_analog_value(readings[i].pin);
+    }
+
+    // ...then switch to the internal reference once for all the VCC readings.
+    if (wants_vcc) {
+        uint8_t oldref = ADC->REFCTRL.bit.REFSEL;
+        if (oldref != ADC_REFCTRL_REFSEL_INTREF_Val) _watch_set_analog_reference_voltage(ADC_REFCTRL_REFSEL_INTREF_Val);
+        for (uint8_t i = 0; i < count; i++) {
+            if (readings[i].pin != WATCH_ADC_VCC) continue;
+            uint32_t raw_val = adc_get_analog_value_for_channel(ADC_INPUTCTRL_MUXPOS_SCALEDIOVCC_Val);
+            readings[i].value = (uint16_t)((raw_val * 1000) / (1024 * 16));
+        }
+        if (oldref != ADC_REFCTRL_REFSEL_INTREF_Val) _watch_set_analog_reference_voltage(oldref);
+    }
+
+    ADC->AVGCTRL.reg = old_avgctrl;
+    while (ADC->SYNCBUSY.reg);
+
+    if (adc_was_disabled) watch_disable_adc();
+}
+
 inline void watch_disable_analog_input(const uint16_t port_pin) {
     uint8_t port = port_pin >> 8;
     uint16_t pin = port_pin & 0xF;
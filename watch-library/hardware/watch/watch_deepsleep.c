@@ -27,6 +27,8 @@
 #include "watch.h"
 #include "watch_private.h"
 
+static bool _external_interrupts_in_sleep_mode = false;
+
 void sleep(const uint8_t mode) {
     PM->SLEEPCFG.bit.SLEEPMODE = mode;
 
@@ -153,7 +155,7 @@ static void _watch_disable_all_pins_except_rtc(void) {
 static void _watch_disable_all_peripherals_except_slcd(void) {
     _watch_disable_tcc();
     watch_disable_adc();
-    watch_disable_external_interrupts();
+    if (!_external_interrupts_in_sleep_mode) watch_disable_external_interrupts();
 
     /// TODO: Actually disable all these peripherals? Disabling I2C seems to have no impact fwiw.
     // watch_disable_i2c();
@@ -174,8 +176,19 @@ void watch_enter_sleep_mode(void) {
     // disable all pins
     _watch_disable_all_pins_except_rtc();
 
+    // external interrupts that are still enabled only need their handlers run, so return straight to sleep
+    // after them; the RTC handler clears this, so only the RTC brings us back out here. Interrupts stay masked
+    // from here to the WFI: a handler that ran in between would go back to sleep on exit, and when the RTC woke
+    // us, we'd return here only to sleep through the minute. A pending interrupt still ends the WFI while masked,
+    // and its handler runs as soon as we unmask.
+    __disable_irq();
+    if (_external_interrupts_in_sleep_mode) SCB->SCR |= SCB_SCR_SLEEPONEXIT_Msk;
+
     // enter standby (4); we basically hang out here until an interrupt wakes us.
     sleep(4);
+    __enable_irq();
+
+    SCB->SCR &= ~SCB_SCR_SLEEPONEXIT_Msk;
 
     // and we awake! re-enable the brownout detector
     SUPC->INTENSET.bit.BOD33DET = 1;
@@ -184,6 +197,10 @@ void watch_enter_sleep_mode(void) {
     app_setup();
 }
 
+void watch_set_sleep_mode_external_interrupts(bool enabled) {
+    _external_interrupts_in_sleep_mode = enabled;
+}
+
 void watch_enter_backup_mode(void) {
     watch_rtc_disable_all_periodic_callbacks();
     _watch_disable_all_pins_except_rtc();
@@ -113,6 +113,9 @@ void watch_rtc_disable_alarm_callback(void) {
 void watch_rtc_callback(uint16_t interrupt_status) {
     uint16_t interrupt_enabled = RTC->MODE2.INTENSET.reg;
 
+    // if we were in sleep mode with external interrupts left on, this is the wake that should reach the app.
+    SCB->SCR &= ~SCB_SCR_SLEEPONEXIT_Msk;
+
     if ((interrupt_status & interrupt_enabled) & RTC_MODE2_INTFLAG_PER_Msk) {
         // handle the tick callback first, it's what we do the most.
         // start from PER7, the 1 Hz tick.
@@ -25,9 +25,90 @@
 #include "watch_spi.h"
 #include "spi.h"
 
+#ifdef SPI_SERCOM
+
+// Transfers of at least this many bytes go through the DMA controller; anything shorter (commands,
+// addresses, status polls) isn't worth setting up descriptors for.
+#define WATCH_SPI_DMA_MIN_LENGTH 16
+#define WATCH_SPI_DMA_RX_CHANNEL 0
+#define WATCH_SPI_DMA_TX_CHANNEL 1
+
+#define _WATCH_SPI_CONCAT(a, b, c) a ## b ## c
+#define WATCH_SPI_CONCAT(a, b, c) _WATCH_SPI_CONCAT(a, b, c)
+#define WATCH_SPI_SERCOM WATCH_SPI_CONCAT(SERCOM, SPI_SERCOM, )
+#define WATCH_SPI_DMAC_ID_RX WATCH_SPI_CONCAT(SERCOM, SPI_SERCOM, _DMAC_ID_RX)
+#define WATCH_SPI_DMAC_ID_TX WATCH_SPI_CONCAT(SERCOM, SPI_SERCOM, _DMAC_ID_TX)
+
+static DmacDescriptor _dma_descriptors[2] __attribute__((aligned(16)));
+static DmacDescriptor _dma_writeback[2] __attribute__((aligned(16)));
+static bool _dma_available = false;
+
+static void _watch_spi_dma_init(void) {
+    if (_dma_available) return;
+
+    MCLK->AHBMASK.reg |= MCLK_AHBMASK_DMAC;
+    // if something else has already claimed the DMA controller, stick with polled transfers.
+    if (DMAC->CTRL.bit.DMAENABLE) return;
+
+    DMAC->BASEADDR.reg = (uint32_t)_dma_descriptors;
+    DMAC->WRBADDR.reg = (uint32_t)_dma_writeback;
+    DMAC->CTRL.reg = DMAC_CTRL_DMAENABLE | DMAC_CTRL_LVLEN(0xf);
+    _dma_available = true;
+}
+
+static void _watch_spi_dma_start_channel(uint8_t channel, uint8_t trigger) {
+    DMAC->CHID.reg = DMAC_CHID_ID(channel);
+    DMAC->CHCTRLA.reg = 0;
+    DMAC->CHINTFLAG.reg = DMAC_CHINTFLAG_MASK;
+    DMAC->CHCTRLB.reg = DMAC_CHCTRLB_LVL(0) | DMAC_CHCTRLB_TRIGSRC(trigger) | DMAC_CHCTRLB_TRIGACT_BEAT;
+    DMAC->CHCTRLA.reg = DMAC_CHCTRLA_ENABLE;
+}
+
+static bool _watch_spi_dma_transfer(const uint8_t *data_out, uint8_t *data_in, uint16_t length) {
+    // when only reading, we clock out zeroes; when only writing, we discard what comes back.
+    static uint8_t filler = 0;
+    static uint8_t discard;
+    uint32_t data_register = (uint32_t)&WATCH_SPI_SERCOM->SPI.DATA.reg;
+    DmacDescriptor *rx = &_dma_descriptors[WATCH_SPI_DMA_RX_CHANNEL];
+    DmacDescriptor *tx = &_dma_descriptors[WATCH_SPI_DMA_TX_CHANNEL];
+
+    // note that when an address increments, the DMA controller wants the address of the end of the buffer.
+    rx->BTCTRL.reg = DMAC_BTCTRL_VALID | DMAC_BTCTRL_BEATSIZE_BYTE | (data_in ? DMAC_BTCTRL_DSTINC : 0);
+    rx->BTCNT.reg = length;
+    rx->SRCADDR.reg = data_register;
+    rx->DSTADDR.reg = data_in ? (uint32_t)(data_in + length) : (uint32_t)&discard;
+    rx->DESCADDR.reg = 0;
+
+    tx->BTCTRL.reg = DMAC_BTCTRL_VALID | DMAC_BTCTRL_BEATSIZE_BYTE | (data_out ? DMAC_BTCTRL_SRCINC : 0);
+    tx->BTCNT.reg = length;
+    tx->SRCADDR.reg = data_out ? (uint32_t)(data_out + length) : (uint32_t)&filler;
+    tx->DSTADDR.reg = data_register;
+    tx->DESCADDR.reg = 0;
+
+    // start listening before we start talking, so we can't miss the first byte.
+    _watch_spi_dma_start_channel(WATCH_SPI_DMA_RX_CHANNEL, WATCH_SPI_DMAC_ID_RX);
+    _watch_spi_dma_start_channel(WATCH_SPI_DMA_TX_CHANNEL, WATCH_SPI_DMAC_ID_TX);
+
+    // the receive channel finishes last, once the final byte has been clocked in.
+    DMAC->CHID.reg = DMAC_CHID_ID(WATCH_SPI_DMA_RX_CHANNEL);
+    while (!(DMAC->CHINTFLAG.reg & (DMAC_CHINTFLAG_TCMPL | DMAC_CHINTFLAG_TERR)));
+    bool success = !(DMAC->CHINTFLAG.reg & DMAC_CHINTFLAG_TERR);
+
+    DMAC->CHCTRLA.reg = 0;
+    DMAC->CHID.reg = DMAC_CHID_ID(WATCH_SPI_DMA_TX_CHANNEL);
+    DMAC->CHCTRLA.reg = 0;
+
+    return success;
+}
+
+#endif
+
 void watch_enable_spi(void) {
     spi_init(1000000);
     spi_enable();
+#ifdef SPI_SERCOM
+    _watch_spi_dma_init();
+#endif
 }
 
 void watch_disable_spi(void) {
@@ -35,6 +116,10 @@ void watch_disable_spi(void) {
 }
 
 bool watch_spi_write(const uint8_t *buf, uint16_t length) {
+#ifdef SPI_SERCOM
+    if (_dma_available && length >= WATCH_SPI_DMA_MIN_LENGTH) return _watch_spi_dma_transfer(buf, NULL, length);
+#endif
+
     for (uint16_t i = 0; i < length; i++) {
         spi_transfer(buf[i]);
     }
@@ -43,6 +128,10 @@ bool watch_spi_write(const uint8_t *buf, uint16_t length) {
 }
 
 bool watch_spi_read(uint8_t *buf, uint16_t length) {
+#ifdef SPI_SERCOM
+    if (_dma_available && length >= WATCH_SPI_DMA_MIN_LENGTH) return _watch_spi_dma_transfer(NULL, buf, length);
+#endif
+
     for (uint16_t i = 0; i < length; i++) {
         buf[i] = spi_transfer(0);
     }
@@ -51,6 +140,10 @@ bool watch_spi_read(uint8_t *buf, uint16_t length) {
 }
 
 bool watch_spi_transfer(const uint8_t *data_out, uint8_t *data_in, uint16_t length) {
+#ifdef SPI_SERCOM
+    if (_dma_available && length >= WATCH_SPI_DMA_MIN_LENGTH) return _watch_spi_dma_transfer(data_out, data_in, length);
+#endif
+
     for (uint16_t i = 0; i < length; i++) {
         data_in[i] = spi_transfer(data_out[i]);
     }
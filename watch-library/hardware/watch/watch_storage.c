@@ -7,6 +7,10 @@
 #define RWWEE_ADDR_END (NVMCTRL_RWW_EEPROM_ADDR + NVMCTRL_PAGE_SIZE * NVMCTRL_RWWEE_PAGES)
 #define NVM_MEMORY ((volatile uint16_t *)FLASH_ADDR)
 
+// set when a write or erase has been issued and the NVM controller may still be busy.
+static bool _storage_dirty = false;
+static watch_storage_stats_t _storage_stats = {0};
+
 static bool _is_valid_address(uint32_t addr, uint32_t size) {
     if ((addr < NVMCTRL_RWW_EEPROM_ADDR) || (addr > (NVMCTRL_RWW_EEPROM_ADDR + NVMCTRL_PAGE_SIZE * NVMCTRL_RWWEE_PAGES))) {
         return false;
@@ -22,28 +26,47 @@ bool watch_storage_read(uint32_t row, uint32_t offset, uint8_t *buffer, uint32_t
     uint32_t address = RWWEE_ADDR_START + row * NVMCTRL_ROW_SIZE + offset;
     if (!_is_valid_address(address, size)) return false;
 
-    uint32_t nvm_address = address / 2;
-    uint32_t i;
-    uint16_t data;
+    // the RWWEE area is memory mapped, so once any pending write or erase has finished, we can read it directly.
+    if (_storage_dirty) watch_storage_sync();
 
-    watch_storage_sync();
+    _storage_stats.reads++;
+    _storage_stats.bytes_read += size;
 
-    if (address % 2) {
-        data      = NVM_MEMORY[nvm_address++];
-        buffer[0] = data >> 8;
-        i         = 1;
-    } else {
-        i = 0;
+    const uint8_t *src = (const uint8_t *)address;
+
+    // copy bytes until the source is word-aligned...
+    while (size && ((uint32_t)src & 3)) {
+        *buffer++ = *src++;
+        size--;
     }
 
-    while (i < size) {
-        data = NVM_MEMORY[nvm_address++];
-        buffer[i] = (data & 0xFF);
-        if (i < (size - 1)) {
-            buffer[i + 1] = (data >> 8);
+    // ...then copy whole words. littlefs buffers are almost always aligned, but handle the case where they aren't.
+    const uint32_t *src_words = (const uint32_t *)src;
+    if (((uint32_t)buffer & 3) == 0) {
+        uint32_t *dst_words = (uint32_t *)buffer;
+        while (size >= 4) {
+            *dst_words++ = *src_words++;
+            size -= 4;
         }
-        i += 2;
+        buffer = (uint8_t *)dst_words;
+    } else {
+        while (size >= 4) {
+            uint32_t data = *src_words++;
+            buffer[0] = data;
+            buffer[1] = data >> 8;
+            buffer[2] = data >> 16;
+            buffer[3] = data >> 24;
+            buffer += 4;
+            size -= 4;
+        }
+    }
+
+    // and finally any trailing bytes.
+    src = (const uint8_t *)src_words;
+    while (size--) {
+        *buffer++ = *src++;
     }
+
     return true;
 }
 
@@ -57,6 +80,7 @@ bool watch_storage_write(uint32_t row, uint32_t offset, const uint8_t *buffer, u
     uint16_t i, data;
 
     NVMCTRL->CTRLA.reg = NVMCTRL_CTRLA_CMD_PBC | NVMCTRL_CTRLA_CMDEX_KEY;
+    _storage_dirty = true;
     watch_storage_sync();
 
     for (i = 0; i < size; i += 2) {
@@ -68,6 +92,10 @@ bool watch_storage_write(uint32_t row, uint32_t offset, const uint8_t *buffer, u
     }
     NVMCTRL->ADDR.reg = address / 2;
     NVMCTRL->CTRLA.reg = NVMCTRL_CTRLA_CMD_RWWEEWP | NVMCTRL_CTRLA_CMDEX_KEY;
+    _storage_dirty = true;
+
+    _storage_stats.writes++;
+    _storage_stats.bytes_written += size;
 
     return true;
 }
@@ -79,16 +107,32 @@ bool watch_storage_erase(uint32_t row) {
     watch_storage_sync();
     NVMCTRL->ADDR.reg = address / 2;
     NVMCTRL->CTRLA.reg = NVMCTRL_CTRLA_CMD_RWWEEER | NVMCTRL_CTRLA_CMDEX_KEY;
+    _storage_dirty = true;
+
+    _storage_stats.erases++;
 
     return true;
 }
 
 bool watch_storage_sync(void) {
+    if (!_storage_dirty) return true;
+
+    _storage_stats.syncs++;
+
     while (!NVMCTRL->INTFLAG.bit.READY) {
         // wait for flash to become ready
     }
 
     NVMCTRL->STATUS.reg = NVMCTRL_STATUS_MASK;
+    _storage_dirty = false;
 
     return true;
 }
+
+void watch_storage_get_stats(watch_storage_stats_t *stats) {
+    *stats = _storage_stats;
+}
+
+void watch_storage_reset_stats(void) {
+    memset(&_storage_stats, 0, sizeof(_storage_stats));
+}
@@ -302,6 +302,15 @@ void lis2dw_clear_fifo(void) {
 #endif
 }
 
+void lis2dw_configure_fifo(lis2dw_fifo_mode_t mode, uint8_t threshold) {
+#ifdef I2C_SERCOM
+    watch_i2c_write8(LIS2DW_ADDRESS, LIS2DW_REG_FIFO_CTRL, (mode << 5) | (threshold & LIS2DW_FIFO_CTRL_FTH));
+#else
+    (void)mode;
+    (void)threshold;
+#endif
+}
+
 void lis2dw_enable_sleep(void) {
 #ifdef I2C_SERCOM
     uint8_t configuration = watch_i2c_read8(LIS2DW_ADDRESS, LIS2DW_REG_WAKE_UP_THS);
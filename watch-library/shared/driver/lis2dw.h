@@ -343,6 +343,8 @@ bool lis2dw_read_fifo(lis2dw_fifo_t *fifo_data);
 
 void lis2dw_clear_fifo(void);
 
+void lis2dw_configure_fifo(lis2dw_fifo_mode_t mode, uint8_t threshold);
+
 void lis2dw_enable_sleep(void);
 
 void lis2dw_disable_sleep(void);
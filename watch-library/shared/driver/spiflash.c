@@ -39,6 +39,7 @@ static void flash_disable(void) {
 }
 
 static bool transfer(uint8_t *command, uint32_t command_length, uint8_t *data_in, uint8_t *data_out, uint32_t data_length) {
+    flash_enable();
     bool status = watch_spi_write(command, command_length);
     if (status) {
         if (data_in != NULL && data_out != NULL) {
@@ -114,7 +115,56 @@ bool spi_flash_read_data(uint32_t address, uint8_t *data, uint32_t data_length)
 }
 
 void spi_flash_init(void) {
-	gpio_set_pin_level(A3, true);
-	gpio_set_pin_direction(A3, GPIO_DIRECTION_OUT);
+    HAL_GPIO_A3_set();
+    HAL_GPIO_A3_out();
     watch_enable_spi();
 }
+
+bool spi_flash_wait_while_busy(void) {
+    uint8_t status = 0;
+    do {
+        if (!spi_flash_read_command(CMD_READ_STATUS, &status, 1)) return false;
+    } while (status & 0x01);
+
+    return true;
+}
+
+bool spi_flash_program(uint32_t address, const uint8_t *data, uint32_t data_length) {
+    // a page program can't cross a page boundary, so split the write up into page-sized chunks.
+    while (data_length > 0) {
+        uint32_t chunk = SPI_FLASH_PAGE_SIZE - (address % SPI_FLASH_PAGE_SIZE);
+        if (chunk > data_length) chunk = data_length;
+
+        if (!spi_flash_command(CMD_ENABLE_WRITE)) return false;
+        if (!spi_flash_write_data(address, (uint8_t *)data, chunk)) return false;
+        if (!spi_flash_wait_while_busy()) return false;
+
+        address += chunk;
+        data += chunk;
+        data_length -= chunk;
+    }
+
+    return true;
+}
+
+bool spi_flash_erase_sector(uint32_t address) {
+    if (!spi_flash_command(CMD_ENABLE_WRITE)) return false;
+    if (!spi_flash_sector_command(CMD_SECTOR_ERASE, address)) return false;
+
+    return spi_flash_wait_while_busy();
+}
+
+uint32_t spi_flash_get_capacity(void) {
+    uint8_t jedec_id[3] = {0};
+    if (!spi_flash_read_command(CMD_READ_JEDEC_ID, jedec_id, 3)) return 0;
+
+    // the third byte of the JEDEC ID is log2 of the capacity in bytes for every part we're likely to see.
+    // anything outside of 64 KB to 128 MB is probably a missing chip (0x00 or 0xFF).
+    if (jedec_id[2] < 0x10 || jedec_id[2] > 0x1B) return 0;
+
+    // we only send three address bytes, so past 16 MB the addresses would wrap around onto the start of the chip.
+    // Larger parts still work, we just can't use more than their first 16 MB.
+    if (jedec_id[2] > 0x18) return 1ul << 0x18;
+
+    return 1ul << jedec_id[2];
+}
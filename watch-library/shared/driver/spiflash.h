@@ -48,6 +48,10 @@
 #define CMD_ENABLE_RESET 0x66
 #define CMD_RESET 0x99
 #define CMD_WAKE 0xab
+#define CMD_DEEP_POWER_DOWN 0xb9
+
+#define SPI_FLASH_PAGE_SIZE 256
+#define SPI_FLASH_SECTOR_SIZE 4096
 
 bool spi_flash_command(uint8_t command);
 bool spi_flash_read_command(uint8_t command, uint8_t *response, uint32_t length);
@@ -56,3 +60,9 @@ bool spi_flash_sector_command(uint8_t command, uint32_t address);
 bool spi_flash_write_data(uint32_t address, uint8_t *data, uint32_t data_length);
 bool spi_flash_read_data(uint32_t address, uint8_t *data, uint32_t data_length);
 void spi_flash_init(void);
+
+// Higher level helpers that take care of write enable and busy waiting.
+bool spi_flash_wait_while_busy(void);
+bool spi_flash_program(uint32_t address, const uint8_t *data, uint32_t data_length);
+bool spi_flash_erase_sector(uint32_t address);
+uint32_t spi_flash_get_capacity(void);
@@ -23,13 +23,25 @@
  */
 
 #include "thermistor_driver.h"
+#include "thermistor_table.h"
 #include "sam.h"
 #include "watch.h"
-#include "watch_utility.h"
+
+_Static_assert((int)THERMISTOR_HIGH_SIDE == THERMISTOR_TABLE_HIGH_SIDE &&
+               (int)THERMISTOR_B_COEFFICIENT == THERMISTOR_TABLE_B_COEFFICIENT &&
+               (int)THERMISTOR_NOMINAL_TEMPERATURE == THERMISTOR_TABLE_NOMINAL_TEMPERATURE &&
+               (int)THERMISTOR_NOMINAL_RESISTANCE == THERMISTOR_TABLE_NOMINAL_RESISTANCE &&
+               (int)THERMISTOR_SERIES_RESISTANCE == THERMISTOR_TABLE_SERIES_RESISTANCE,
+               "thermistor_table.h is stale; run utils/thermistor_table/thermistor_table.py");
 
 // assume we have no thermistor until thermistor_driver_init is called.
 static bool has_thermistor = false;
 
+// calibration, precomputed as actual = offset + ((measured - origin) * gain) >> 12.
+static int16_t calibration_origin = 0;
+static int16_t calibration_offset = 0;
+static int32_t calibration_gain = 1 << 12;
+
 bool thermistor_driver_init(void) {
     // once called, assume we have a thermistor unless proven otherwise
     has_thermistor = true;
@@ -104,15 +116,65 @@ void thermistor_driver_disable(void) {
     HAL_GPIO_TS_ENABLE_off();
 }
 
-float thermistor_driver_get_temperature(void) {
-    if (!has_thermistor) return (float) 0xFFFFFFFF;
+int16_t thermistor_driver_convert(uint16_t value) {
+    uint16_t index = value >> THERMISTOR_TABLE_SHIFT;
+    int32_t fraction = value & ((1 << THERMISTOR_TABLE_SHIFT) - 1);
+    int32_t low = thermistor_table[index];
+    int32_t high = thermistor_table[index + 1];
+
+    return low + ((high - low) * fraction) / (1 << THERMISTOR_TABLE_SHIFT);
+}
+
+void thermistor_driver_set_calibration(const thermistor_calibration_t *calibration) {
+    calibration_origin = 0;
+    calibration_offset = 0;
+    calibration_gain = 1 << 12;
+    if (calibration == NULL || calibration->num_points == 0) return;
+
+    calibration_origin = calibration->measured[0];
+    calibration_offset = calibration->actual[0];
+    if (calibration->num_points < 2) return;
+
+    // scale only if the points are far enough apart for the slope to mean something (5°C), and the slope is
+    // plausible; otherwise, fall back to an offset through the first point.
+    int32_t measured_span = calibration->measured[1] - calibration->measured[0];
+    int32_t actual_span = calibration->actual[1] - calibration->actual[0];
+    if (measured_span < 0) {
+        measured_span = -measured_span;
+        actual_span = -actual_span;
+    }
+    if (measured_span < 500) return;
+    int32_t gain = (actual_span * (1 << 12)) / measured_span;
+    if (gain >= (1 << 11) && gain <= (1 << 13)) calibration_gain = gain;
+}
 
+static uint16_t _thermistor_driver_read(void) {
     // set the enable pin to the level that powers the thermistor circuit.
     HAL_GPIO_TS_ENABLE_write(THERMISTOR_ENABLE_VALUE);
-    // get the sense pin level
-    uint16_t value = watch_get_analog_pin_level(HAL_GPIO_TEMPSENSE_pin());
+    // get the sense pin level, averaged over 64 conversions to smooth out noise.
+    watch_adc_reading_t reading = { .pin = HAL_GPIO_TEMPSENSE_pin() };
+    watch_get_analog_levels(&reading, 1, 64);
     // and then set the enable pin to the opposite value to power down the thermistor circuit.
     HAL_GPIO_TS_ENABLE_write(!THERMISTOR_ENABLE_VALUE);
 
-    return watch_utility_thermistor_temperature(value, THERMISTOR_HIGH_SIDE, THERMISTOR_B_COEFFICIENT, THERMISTOR_NOMINAL_TEMPERATURE, THERMISTOR_NOMINAL_RESISTANCE, THERMISTOR_SERIES_RESISTANCE);
+    return reading.value;
+}
+
+int16_t thermistor_driver_get_uncalibrated_temperature_centidegrees(void) {
+    if (!has_thermistor) return THERMISTOR_INVALID_TEMPERATURE;
+
+    return thermistor_driver_convert(_thermistor_driver_read());
+}
+
+int16_t thermistor_driver_get_temperature_centidegrees(void) {
+    int16_t measured = thermistor_driver_get_uncalibrated_temperature_centidegrees();
+    if (measured == THERMISTOR_INVALID_TEMPERATURE) return measured;
+
+    return calibration_offset + (((int32_t)measured - calibration_origin) * calibration_gain) / (1 << 12);
+}
+
+float thermistor_driver_get_temperature(void) {
+    if (!has_thermistor) return (float) 0xFFFFFFFF;
+
+    return thermistor_driver_get_temperature_centidegrees() / 100.0f;
 }
@@ -24,6 +24,9 @@
 
 #pragma once
 
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
 #include "pins.h"
 
 // TODO: Do these belong in movement_config.h? In settings we can set on the watch? In an EEPROM configuration area?
@@ -35,7 +38,34 @@
 #define THERMISTOR_NOMINAL_RESISTANCE (10000.0)
 #define THERMISTOR_SERIES_RESISTANCE (10000.0)
 
+// Readings are converted with a lookup table generated from the constants above, so if you change them,
+// rerun utils/thermistor_table/thermistor_table.py to regenerate thermistor_table.h.
+
+#define THERMISTOR_INVALID_TEMPERATURE INT16_MIN
+
+// An optional per-unit correction, from one or two comparisons against a reference thermometer.
+// With one point, readings are offset; with two, they are also scaled to pass through both points.
+typedef struct {
+    int16_t measured[2];    // what this thermistor read, in hundredths of a degree Celsius
+    int16_t actual[2];      // what the reference read at the same time
+    uint8_t num_points;     // 0 (uncalibrated), 1 or 2
+} thermistor_calibration_t;
+
 bool thermistor_driver_init(void);
 void thermistor_driver_enable(void);
 void thermistor_driver_disable(void);
+
+/// Returns the calibrated temperature in degrees Celsius. Call thermistor_driver_enable first.
 float thermistor_driver_get_temperature(void);
+
+/// Returns the calibrated temperature in hundredths of a degree Celsius, or THERMISTOR_INVALID_TEMPERATURE.
+int16_t thermistor_driver_get_temperature_centidegrees(void);
+
+/// Returns the temperature without calibration applied, in hundredths of a degree Celsius.
+int16_t thermistor_driver_get_uncalibrated_temperature_centidegrees(void);
+
+/// Converts a raw ADC reading to hundredths of a degree Celsius, without calibration. Needs no hardware.
+int16_t thermistor_driver_convert(uint16_t value);
+
+/// Sets the calibration applied to subsequent readings; pass NULL or zero points to remove it.
+void thermistor_driver_set_calibration(const thermistor_calibration_t *calibration);
@@ -65,6 +65,28 @@ uint16_t watch_get_analog_pin_level(const uint16_t pin);
   */
 uint16_t watch_get_vcc_voltage(void);
 
+/// Pass this instead of a pin to watch_get_analog_levels to measure VCC (in millivolts, like watch_get_vcc_voltage).
+#define WATCH_ADC_VCC (0xFFFF)
+
+typedef struct {
+    uint16_t pin;       ///< One of the analog pins (HAL_GPIO_Ax_pin()), or WATCH_ADC_VCC.
+    uint16_t value;     ///< The result: a 16-bit level for pins, or millivolts for WATCH_ADC_VCC.
+} watch_adc_reading_t;
+
+/** @brief Reads several analog channels in one session, averaging many conversions for each in hardware.
+  * @details Reading channels one at a time with watch_get_analog_pin_level and watch_get_vcc_voltage
+  *          powers the ADC up and down and switches the reference voltage (with a throwaway conversion)
+  *          for every call. This function does it once: it enables the ADC if needed, reads all pins
+  *          against the current reference, then switches to the internal reference once for any VCC
+  *          readings, and puts everything back the way it found it.
+  * @param readings The channels to read; each reading's value is filled in.
+  * @param count The number of readings.
+  * @param samples How many conversions to average per reading, from 16 to 1024; rounded down to a power
+  *                of two. Pin levels stay on the same 0-65535 scale regardless. Each conversion takes
+  *                a few microseconds, so 1024 samples per channel is a few milliseconds of ADC time.
+  */
+void watch_get_analog_levels(watch_adc_reading_t *readings, uint8_t count, uint16_t samples);
+
 /** @brief Disables the analog circuitry on the selected pin.
   * @param pin One of pins A0-A4.
   */
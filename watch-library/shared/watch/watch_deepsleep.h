@@ -116,6 +116,19 @@ uint32_t watch_get_backup_data(uint8_t reg);
   */
 void watch_enter_sleep_mode(void);
 
+/** @brief Leaves the external interrupt controller running in Sleep Mode, so that an interrupt callback
+  *        on pin A3 or A4 can go on counting events while the watch sleeps.
+  * @details Sleep Mode disconnects every pin but the RTC pins and A3/A4, so those are the only external
+  *          interrupts that can fire. When one does, the processor wakes just long enough to run your
+  *          callback, then goes straight back to sleep without returning to your app (the Cortex-M0+'s
+  *          sleep-on-exit), so an event costs a few microseconds awake. watch_enter_sleep_mode still only
+  *          returns for the RTC alarm and the extwake pins. Callbacks registered this way must be short,
+  *          and must not use the I2C bus or any other peripheral that Sleep Mode turns off.
+  * @param enabled true to keep external interrupts running in Sleep Mode; false (the default) to disable
+  *                the external interrupt controller on the way into Sleep Mode.
+  */
+void watch_set_sleep_mode_external_interrupts(bool enabled);
+
 /** @brief Enters the SAM L22's lowest-power mode, BACKUP.
   * @details This function does some housekeeping before entering BACKUP mode. It first disables all pins
   *          and peripherals except for the RTC, and disables the tick interrupt (since that would wake
@@ -31,6 +31,9 @@
 /** @addtogroup spi SPI Controller Driver
   * @brief This section covers functions related to the SAM L22's built-in SPI driver, including
   *        configuring the SPI bus and writing to / reading from devices.
+  * @details On hardware, longer transfers (16 bytes or more) are handed off to the DMA controller,
+  *          which keeps the bus busy back-to-back instead of waiting on the CPU between bytes.
+  *          The functions still block until the transfer is complete.
   */
 /// @{
 /** @brief Enables the SPI peripheral. Call this before attempting to interface with SPI devices.
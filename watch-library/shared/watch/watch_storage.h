@@ -52,7 +52,8 @@
   *          The functions in this section are very basic, and only cover reading and writing data
   *          in this area. The region is laid out as 32 rows consisting of 4 pages of 64 bytes.
   *          32*4*64 = 8192 bytes. The area can be written one page at a time, but it can only be
-  *          erased one row at a time. You can read at arbitrary word-aligned offsets within a row.
+  *          erased one row at a time. You can read at arbitrary offsets within a row, but reads are
+  *          fastest when the offset and the buffer are both word-aligned.
   *
   *                 ┌──────────────┬──────────────┬──────────────┬──────────────┐
   *          Row 0  │   64 bytes   │   64 bytes   │   64 bytes   │   64 bytes   │
@@ -65,6 +66,28 @@
   *                 └──────────────┴──────────────┴──────────────┴──────────────┘
   */
 /// @{
+
+/// @brief Counters for flash operations since boot (or since the last call to watch_storage_reset_stats).
+typedef struct {
+    uint32_t reads;         ///< number of calls to watch_storage_read
+    uint32_t bytes_read;    ///< total bytes copied out of the storage area
+    uint32_t writes;        ///< number of page program operations
+    uint32_t bytes_written; ///< total bytes programmed
+    uint32_t erases;        ///< number of row erase operations
+    uint32_t syncs;         ///< number of times we actually had to wait for the NVM controller
+} watch_storage_stats_t;
+
+#if __EMSCRIPTEN__
+/// @brief Per-row counters. Only the simulator, which models wear and latency, keeps them; on hardware they
+///        would cost 512 bytes of RAM.
+typedef struct {
+    uint32_t reads;         ///< number of reads that touched this row
+    uint32_t writes;        ///< number of page program operations on this row
+    uint32_t erases;        ///< number of times this row was erased
+    uint32_t busy_us;       ///< modeled time spent reading, programming and erasing this row, in microseconds
+} watch_storage_block_stats_t;
+#endif
+
 /** @brief Reads a range of bytes from the storage area.
   * @param row The row you want to read.
   * @param offset The offset from the beginning of the row.
@@ -87,6 +110,25 @@ bool watch_storage_write(uint32_t row, uint32_t offset, const uint8_t *buffer, u
 bool watch_storage_erase(uint32_t row);
 
 /** @brief Waits for any pending writes to complete.
+  * @note This returns immediately if no write or erase has been issued since the last sync.
   */
 bool watch_storage_sync(void);
+
+/** @brief Gets the flash operation counters.
+  * @param stats A struct that will be populated with the current counter values.
+  */
+void watch_storage_get_stats(watch_storage_stats_t *stats);
+
+#if __EMSCRIPTEN__
+/** @brief Gets the counters for a single row of the storage area. Simulator only.
+  * @param row The row you want statistics for.
+  * @param stats A struct that will be populated with the row's counter values.
+  * @return true if the row is in range.
+  */
+bool watch_storage_get_block_stats(uint32_t row, watch_storage_block_stats_t *stats);
+#endif
+
+/** @brief Resets all flash operation counters to zero.
+  */
+void watch_storage_reset_stats(void);
 /// @}
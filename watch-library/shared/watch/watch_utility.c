@@ -109,81 +109,58 @@ uint16_t watch_utility_days_since_new_year(uint16_t year, uint8_t month, uint8_t
     return (is_leap(year) && (month > 2) ? 1 : 0) + DAYS_SO_FAR[month - 1] + day;
 }
 
-// Function taken from `src/time/__year_to_secs.c` of musl libc
-// https://musl.libc.org
-static uint32_t __year_to_secs(uint32_t year, int *is_leap)
-{
-	if (year-2ULL <= 136) {
-		int y = year;
-		int leaps = (y-68)>>2;
-		if (!((y-68)&3)) {
-			leaps--;
-			if (is_leap) *is_leap = 1;
-		} else if (is_leap) *is_leap = 0;
-		return 31536000*(y-70) + 86400*leaps;
-	}
+// Day numbers are counted from 1 March 1968, so that each leap day falls at the end of its four-year
+// cycle, and the only irregularity in range is the missing 29 February 2100. Every division below is by
+// a constant and is written out as a multiply and a shift, since the Cortex-M0+ has no divide instruction
+// and would otherwise call into libgcc. The constants are exact over the range 1970-01-01 to 2106-02-07;
+// see utils/date_bench, which checks every day in that range.
+#define DAYS_FROM_1968_TO_1970 (306 + 365)
+#define DAYS_FROM_1968_TO_2100 (132 * 365 + 32)
+
+uint32_t watch_utility_days_from_civil(uint16_t year, uint8_t month, uint8_t day) {
+    // treat January and February as the last months of the previous year.
+    uint32_t years = year - 1968;
+    uint32_t march_month;
+    if (month > 2) {
+        march_month = month - 3;
+    } else {
+        march_month = month + 9;
+        years--;
+    }
 
-	int cycles, centuries, leaps, rem, dummy;
+    uint32_t days = years * 365 + (years >> 2);
+    days += ((153 * march_month + 2) * 1639) >> 13;     // (153 * march_month + 2) / 5
+    days += day - 1;
+    // the formula above counts a 29 February 2100 that never happens.
+    if (days > DAYS_FROM_1968_TO_2100) days--;
 
-	if (!is_leap) is_leap = &dummy;
-	cycles = (year-100) / 400;
-	rem = (year-100) % 400;
-	if (rem < 0) {
-		cycles--;
-		rem += 400;
-	}
-	if (!rem) {
-		*is_leap = 1;
-		centuries = 0;
-		leaps = 0;
-	} else {
-		if (rem >= 200) {
-			if (rem >= 300) centuries = 3, rem -= 300;
-			else centuries = 2, rem -= 200;
-		} else {
-			if (rem >= 100) centuries = 1, rem -= 100;
-			else centuries = 0;
-		}
-		if (!rem) {
-			*is_leap = 0;
-			leaps = 0;
-		} else {
-			leaps = rem / 4U;
-			rem %= 4U;
-			*is_leap = !rem;
-		}
-	}
-
-	leaps += 97*cycles + 24*centuries - *is_leap;
+    return days - DAYS_FROM_1968_TO_1970;
+}
 
-	return (year-100) * 31536000LL + leaps * 86400LL + 946684800 + 86400;
+void watch_utility_civil_from_days(uint32_t days, uint16_t *year, uint8_t *month, uint8_t *day) {
+    days += DAYS_FROM_1968_TO_1970;
+    // pretend 2100 has a leap day, then skip over it.
+    if (days >= DAYS_FROM_1968_TO_2100) days++;
+
+    uint32_t cycles = (days * 22967) >> 25;             // days / 1461
+    uint32_t day_of_cycle = days - cycles * 1461;
+    uint32_t year_of_cycle = (day_of_cycle * 1437) >> 19; // day_of_cycle / 365
+    if (year_of_cycle == 4) year_of_cycle = 3;          // 29 February
+    uint32_t day_of_year = day_of_cycle - year_of_cycle * 365;
+    uint32_t march_month = ((5 * day_of_year + 2) * 857) >> 17; // (5 * day_of_year + 2) / 153
+
+    *day = day_of_year - (((153 * march_month + 2) * 1639) >> 13) + 1;
+    *month = march_month < 10 ? march_month + 3 : march_month - 9;
+    *year = 1968 + cycles * 4 + year_of_cycle + (march_month >= 10);
 }
 
-// Function taken from `src/time/__month_to_secs.c` of musl libc
-// https://musl.libc.org
-static int __month_to_secs(int month, int is_leap)
-{
-	static const int secs_through_month[] = {
-		0, 31*86400, 59*86400, 90*86400,
-		120*86400, 151*86400, 181*86400, 212*86400,
-		243*86400, 273*86400, 304*86400, 334*86400 };
-	int t = secs_through_month[month];
-	if (is_leap && month >= 2) t+=86400;
-	return t;
+uint32_t watch_utility_seconds_since_midnight(watch_date_time_t date_time) {
+    return date_time.unit.hour * 3600 + date_time.unit.minute * 60 + date_time.unit.second;
 }
 
-// Function adapted from `src/time/__tm_to_secs.c` of musl libc
-// https://musl.libc.org
 uint32_t watch_utility_convert_to_unix_time(uint16_t year, uint8_t month, uint8_t day, uint8_t hour, uint8_t minute, uint8_t second, int32_t utc_offset) {
-    int is_leap;
+    uint32_t timestamp = watch_utility_days_from_civil(year, month, day) * 86400;
 
-    // POSIX tm struct starts year at 1900 and month at 0
-    // https://pubs.opengroup.org/onlinepubs/9699919799/basedefs/time.h.html 
-    uint32_t timestamp = __year_to_secs(year - 1900, &is_leap);
-    timestamp += __month_to_secs(month - 1, is_leap);
-
-    // Regular conversion from musl libc
-    timestamp += (day - 1) * 86400;
     timestamp += hour * 3600;
     timestamp += minute * 60;
     timestamp += second;
@@ -196,82 +173,116 @@ uint32_t watch_utility_date_time_to_unix_time(watch_date_time_t date_time, int32
     return watch_utility_convert_to_unix_time(date_time.unit.year + WATCH_RTC_REFERENCE_YEAR, date_time.unit.month, date_time.unit.day, date_time.unit.hour, date_time.unit.minute, date_time.unit.second, utc_offset);
 }
 
-#define LEAPOCH (946684800LL + 86400*(31+29))
-
-#define DAYS_PER_400Y (365*400 + 97)
-#define DAYS_PER_100Y (365*100 + 24)
-#define DAYS_PER_4Y   (365*4   + 1)
-
-watch_date_time_t watch_utility_date_time_from_unix_time(uint32_t timestamp, int32_t utc_offset) {
+static watch_date_time_t _watch_utility_date_time_from_days(uint32_t days) {
     watch_date_time_t retval;
+    uint16_t year;
+    uint8_t month, day;
+
     retval.reg = 0;
-    int32_t days, secs;
-    int32_t remdays, remsecs, remyears;
-    int32_t qc_cycles, c_cycles, q_cycles;
-    int32_t years, months;
-    int32_t wday, yday, leap;
-    static const int8_t days_in_month[] = {31,30,31,30,31,31,30,31,30,31,31,29};
-    timestamp += utc_offset;
+    watch_utility_civil_from_days(days, &year, &month, &day);
+    if (year < WATCH_RTC_REFERENCE_YEAR || year > WATCH_RTC_REFERENCE_YEAR + 63) return retval;
 
-    secs = timestamp - LEAPOCH;
-    days = secs / 86400;
-    remsecs = secs % 86400;
-    if (remsecs < 0) {
-        remsecs += 86400;
-        days--;
-    }
+    retval.unit.year = year - WATCH_RTC_REFERENCE_YEAR;
+    retval.unit.month = month;
+    retval.unit.day = day;
 
-    wday = (3+days)%7;
-    if (wday < 0) wday += 7;
+    return retval;
+}
 
-    qc_cycles = (int)(days / DAYS_PER_400Y);
-    remdays = days % DAYS_PER_400Y;
-    if (remdays < 0) {
-        remdays += DAYS_PER_400Y;
-        qc_cycles--;
-    }
+static void _watch_utility_set_time_of_day(watch_date_time_t *date_time, uint32_t seconds) {
+    uint32_t hour = (seconds * 37283) >> 27;            // seconds / 3600
+    seconds -= hour * 3600;
+    uint32_t minute = (seconds * 2185) >> 17;           // seconds / 60
 
-    c_cycles = remdays / DAYS_PER_100Y;
-    if (c_cycles == 4) c_cycles--;
-    remdays -= c_cycles * DAYS_PER_100Y;
+    date_time->unit.hour = hour;
+    date_time->unit.minute = minute;
+    date_time->unit.second = seconds - minute * 60;
+}
 
-    q_cycles = remdays / DAYS_PER_4Y;
-    if (q_cycles == 25) q_cycles--;
-    remdays -= q_cycles * DAYS_PER_4Y;
+watch_date_time_t watch_utility_date_time_from_unix_time(uint32_t timestamp, int32_t utc_offset) {
+    timestamp += utc_offset;
 
-    remyears = remdays / 365;
-    if (remyears == 4) remyears--;
-    remdays -= remyears * 365;
+    // timestamp / 86400, as (timestamp / 128) / 675.
+    uint32_t days = ((uint64_t)(timestamp >> 7) * 3257812231u) >> 41;
+    watch_date_time_t retval = _watch_utility_date_time_from_days(days);
+    if (retval.reg) _watch_utility_set_time_of_day(&retval, timestamp - days * 86400);
 
-    leap = !remyears && (q_cycles || !c_cycles);
-    yday = remdays + 31 + 28 + leap;
-    if (yday >= 365+leap) yday -= 365+leap;
+    return retval;
+}
 
-    years = remyears + 4*q_cycles + 100*c_cycles + 400*qc_cycles;
+uint32_t watch_utility_date_time_to_unix_time_cached(watch_date_time_t date_time, int32_t utc_offset, watch_utility_day_cache_t *cache) {
+    uint32_t date = date_time.reg >> 17;
 
-    for (months=0; days_in_month[months] <= remdays; months++)
-        remdays -= days_in_month[months];
+    if (date != cache->date || utc_offset != cache->utc_offset) {
+        cache->date = date;
+        cache->utc_offset = utc_offset;
+        cache->midnight = watch_utility_convert_to_unix_time(date_time.unit.year + WATCH_RTC_REFERENCE_YEAR, date_time.unit.month, date_time.unit.day, 0, 0, 0, utc_offset);
+    }
 
-    years += 2000;
+    return cache->midnight + watch_utility_seconds_since_midnight(date_time);
+}
 
-    months += 2;
-    if (months >= 12) {
-        months -=12;
-        years++;
+watch_date_time_t watch_utility_date_time_from_unix_time_cached(uint32_t timestamp, int32_t utc_offset, watch_utility_day_cache_t *cache) {
+    watch_date_time_t retval;
+    uint32_t seconds = timestamp - cache->midnight;
+
+    if (cache->date == 0 || utc_offset != cache->utc_offset || seconds >= 86400) {
+        retval = watch_utility_date_time_from_unix_time(timestamp, utc_offset);
+        if (retval.reg == 0) return retval;
+        seconds = watch_utility_seconds_since_midnight(retval);
+        cache->date = retval.reg >> 17;
+        cache->utc_offset = utc_offset;
+        cache->midnight = timestamp - seconds;
+        return retval;
     }
 
-    if (years < 2020 || years > 2083) return retval;
-    retval.unit.year = years - WATCH_RTC_REFERENCE_YEAR;
-    retval.unit.month = months + 1;
-    retval.unit.day = remdays + 1;
-
-    retval.unit.hour = remsecs / 3600;
-    retval.unit.minute = remsecs / 60 % 60;
-    retval.unit.second = remsecs % 60;
+    retval.reg = cache->date << 17;
+    _watch_utility_set_time_of_day(&retval, seconds);
 
     return retval;
 }
 
+watch_date_time_t watch_utility_zone_clock_update(watch_utility_zone_clock_t *clock, uint32_t timestamp, int32_t utc_offset) {
+    watch_date_time_t *date_time = &clock->date_time;
+    uint32_t elapsed = timestamp - clock->timestamp;
+
+    if (date_time->reg == 0 || utc_offset != clock->utc_offset || elapsed >= 60) {
+        // first use, a change of offset, or a jump (the clock was set, or we slept): start over.
+        *date_time = watch_utility_date_time_from_unix_time(timestamp, utc_offset);
+    } else if (elapsed) {
+        // less than a minute has passed, so each field carries at most once.
+        uint32_t second = date_time->unit.second + elapsed;
+        if (second >= 60) {
+            second -= 60;
+            date_time->unit.minute++;
+            if (date_time->unit.minute == 60) {
+                date_time->unit.minute = 0;
+                date_time->unit.hour++;
+            }
+            if (date_time->unit.hour == 24) {
+                date_time->unit.hour = 0;
+                // day is only five bits wide, so check before incrementing rather than after.
+                if (date_time->unit.day == watch_utility_days_in_month(date_time->unit.month, date_time->unit.year + WATCH_RTC_REFERENCE_YEAR)) {
+                    date_time->unit.day = 1;
+                    date_time->unit.month++;
+                } else {
+                    date_time->unit.day++;
+                }
+            }
+            if (date_time->unit.month == 13) {
+                date_time->unit.month = 1;
+                date_time->unit.year++;
+            }
+        }
+        date_time->unit.second = second;
+    }
+
+    clock->timestamp = timestamp;
+    clock->utc_offset = utc_offset;
+
+    return *date_time;
+}
+
 watch_date_time_t watch_utility_date_time_convert_zone(watch_date_time_t date_time, uint32_t origin_utc_offset, uint32_t destination_utc_offset) {
     uint32_t timestamp = watch_utility_date_time_to_unix_time(date_time, origin_utc_offset);
     return watch_utility_date_time_from_unix_time(timestamp, destination_utc_offset);
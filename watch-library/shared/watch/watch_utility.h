@@ -92,8 +92,6 @@ uint8_t is_leap(uint16_t year);
   * @param second The second of the date you wish to convert.
   * @param utc_offset The number of seconds that date_time is offset from UTC, or 0 if the time is UTC.
   * @return A UNIX timestamp for the given date/time and UTC offset.
-  * @note Implemented by Wesley Ellis (tahnok) and based on BSD-licensed code by Josh Haberman:
-  *       https://blog.reverberate.org/2020/05/12/optimizing-date-algorithms.html
   */
 uint32_t watch_utility_convert_to_unix_time(uint16_t year, uint8_t month, uint8_t day, uint8_t hour, uint8_t minute, uint8_t second, int32_t utc_offset);
 
@@ -115,11 +113,76 @@ watch_duration_t watch_utility_seconds_to_duration(uint32_t seconds);
   * @param utc_offset The number of seconds that you wish date_time to be offset from UTC.
   * @return A watch_date_time_t for the given UNIX timestamp and UTC offset, or if outside the range that
   *         watch_date_time_t can represent, a watch_date_time_t with all fields set to 0.
-  * @note Adapted from MIT-licensed code from musl, Copyright © 2005-2014 Rich Felker, et al.:
-  *       https://github.com/esmil/musl/blob/1cc81f5cb0df2b66a795ff0c26d7bbc4d16e13c6/src/time/__secs_to_tm.c
   */
 watch_date_time_t watch_utility_date_time_from_unix_time(uint32_t timestamp, int32_t utc_offset);
 
+/** @brief Returns the number of days between 1 January 1970 and the given date.
+  * @param year The year of the date, from 1970 to 2106.
+  * @param month The month of the date (1-12).
+  * @param day The day of the month (1-31).
+  * @note Valid from 1970-01-01 to 2106-02-07, the last day a 32-bit UNIX timestamp can represent. Uses no
+  *       division, so it is cheap to call on the Cortex-M0+.
+  */
+uint32_t watch_utility_days_from_civil(uint16_t year, uint8_t month, uint8_t day);
+
+/** @brief Converts a number of days since 1 January 1970 to a year, month and day.
+  * @param days The number of days since 1 January 1970, from 0 to 49710 (2106-02-07).
+  * @param year Receives the year.
+  * @param month Receives the month (1-12).
+  * @param day Receives the day of the month (1-31).
+  */
+void watch_utility_civil_from_days(uint32_t days, uint16_t *year, uint8_t *month, uint8_t *day);
+
+/** @brief Returns the number of seconds since midnight for the time of day in a watch_date_time_t.
+  * @param date_time The watch_date_time_t whose time of day you want.
+  */
+uint32_t watch_utility_seconds_since_midnight(watch_date_time_t date_time);
+
+/** @brief Remembers the UNIX time of one local midnight, so that repeated conversions on the same day
+  *        cost a few multiplies instead of a full calendar conversion. Zero it before first use.
+  */
+typedef struct {
+    uint32_t midnight;      // UNIX time of the cached midnight
+    int32_t utc_offset;     // UTC offset the cached midnight was computed with
+    uint32_t date;          // year, month and day bits of the cached date (date_time.reg >> 17), or 0 if empty
+} watch_utility_day_cache_t;
+
+/** @brief Like watch_utility_date_time_to_unix_time, but only converts the date when it differs from the
+  *        one in the cache. Meant for faces that need the UNIX time on every tick.
+  * @param date_time The watch_date_time_t that you wish to convert.
+  * @param utc_offset The number of seconds that date_time is offset from UTC, or 0 if the time is UTC.
+  * @param cache A cache owned by the caller; it is updated when the date changes.
+  */
+uint32_t watch_utility_date_time_to_unix_time_cached(watch_date_time_t date_time, int32_t utc_offset, watch_utility_day_cache_t *cache);
+
+/** @brief Like watch_utility_date_time_from_unix_time, but skips the calendar conversion when the
+  *        timestamp falls on the day in the cache.
+  * @param timestamp The UNIX timestamp that you wish to convert.
+  * @param utc_offset The number of seconds that you wish date_time to be offset from UTC.
+  * @param cache A cache owned by the caller; it is updated when the date changes.
+  */
+watch_date_time_t watch_utility_date_time_from_unix_time_cached(uint32_t timestamp, int32_t utc_offset, watch_utility_day_cache_t *cache);
+
+/** @brief A local date and time that follows a UNIX time forward, for code that needs the time in some
+  *        zone on every tick. Zero it before first use.
+  */
+typedef struct {
+    uint32_t timestamp;             // UNIX time that date_time corresponds to
+    int32_t utc_offset;             // UTC offset that date_time was computed with
+    watch_date_time_t date_time;    // the broken-down local time, or 0 if not yet computed
+} watch_utility_zone_clock_t;
+
+/** @brief Brings a zone clock up to the given UNIX time and returns its local date and time.
+  * @details When less than a minute has passed since the last update, the seconds are added to the broken
+  *          down time and carried into the other fields, which costs a few compares. A change of offset
+  *          (say, for DST), a backwards step or a larger jump falls back to a full conversion.
+  * @param clock The zone clock to update.
+  * @param timestamp The current UNIX time.
+  * @param utc_offset The zone's current offset from UTC, in seconds.
+  * @return The local date and time in the zone.
+  */
+watch_date_time_t watch_utility_zone_clock_update(watch_utility_zone_clock_t *clock, uint32_t timestamp, int32_t utc_offset);
+
 /** @brief Converts a watch_date_time_t for 12-hour display.
   * @param date_time A pointer to the watch_date_time_t that you wish to convert for display. Note that this
   *                  function will OVERWRITE the original date/time, rendering it invalid for date/time
@@ -22,17 +22,44 @@
  * SOFTWARE.
  */
 
+#include <math.h>
 #include "watch_adc.h"
+#include "watch_sim_replay.h"
+#include "watch_sim_power.h"
+#include "thermistor_driver.h"
+
+static uint16_t adc_num_samples = 1;
 
 void watch_enable_adc(void) {}
 
 void watch_enable_analog_input(const uint16_t pin) {}
 
+/// Emulates the thermistor's voltage divider at the temperature from watch_sim_replay.
+static uint16_t watch_get_thermistor_level(void) {
+    // with the enable pin at its disabled level, both ends of the divider sit at that level.
+    if (HAL_GPIO_TS_ENABLE_read() != THERMISTOR_ENABLE_VALUE) return THERMISTOR_ENABLE_VALUE ? 0 : 65535;
+
+    double kelvin = watch_sim_replay_get_temperature() + 273.15;
+    double resistance = THERMISTOR_NOMINAL_RESISTANCE *
+        exp(THERMISTOR_B_COEFFICIENT * (1.0 / kelvin - 1.0 / (THERMISTOR_NOMINAL_TEMPERATURE + 273.15)));
+    double level;
+    // the inverse of the conversions in utils/thermistor_table/thermistor_table.py.
+    if (THERMISTOR_HIGH_SIDE) level = 65472.0 * THERMISTOR_SERIES_RESISTANCE / (resistance + THERMISTOR_SERIES_RESISTANCE);
+    else level = 65535.0 * resistance / (resistance + THERMISTOR_SERIES_RESISTANCE);
+
+    return level > 65535 ? 65535 : (uint16_t)level;
+}
+
 uint16_t watch_get_analog_pin_level(const uint16_t pin) {
+    watch_sim_power_busy(WATCH_SIM_POWER_ADC, adc_num_samples);
+    if (pin == HAL_GPIO_TEMPSENSE_pin()) return watch_get_thermistor_level();
+
     return 32767; // pretend it's half of VCC
 }
 
-void watch_set_analog_num_samples(uint16_t samples) {}
+void watch_set_analog_num_samples(uint16_t samples) {
+    adc_num_samples = samples;
+}
 
 void watch_set_analog_sampling_length(uint8_t cycles) {}
 
@@ -40,9 +67,23 @@ void watch_set_analog_reference_voltage(uint8_t reference) {}
 
 uint16_t watch_get_vcc_voltage(void) {
     // TODO: (a2) hook to UI
+    watch_sim_power_busy(WATCH_SIM_POWER_ADC, adc_num_samples);
     return 3000;
 }
 
+void watch_get_analog_levels(watch_adc_reading_t *readings, uint8_t count, uint16_t samples) {
+    uint16_t num_samples = adc_num_samples;
+
+    // one sample per reading is charged on the way through; charge the rest here.
+    watch_set_analog_num_samples(1);
+    for (uint8_t i = 0; i < count; i++) {
+        if (readings[i].pin == WATCH_ADC_VCC) readings[i].value = watch_get_vcc_voltage();
+        else readings[i].value = watch_get_analog_pin_level(readings[i].pin);
+    }
+    watch_set_analog_num_samples(num_samples);
+    watch_sim_power_busy(WATCH_SIM_POWER_ADC, (uint32_t)count * (samples > 1 ? samples - 1 : 0));
+}
+
 inline void watch_disable_analog_input(const uint16_t pin) {}
 
 inline void watch_disable_adc(void) {}
@@ -24,6 +24,11 @@
 
 #include <stddef.h>
 #include "watch_extint.h"
+#include "watch_adc.h"
+#include "watch_rtc.h"
+#include "watch_tcc.h"
+#include "watch_sim_clock.h"
+#include "watch_sim_power.h"
 #include "app.h"
 static uint32_t watch_backup_data[8];
 
@@ -57,13 +62,27 @@ uint32_t watch_get_backup_data(uint8_t reg) {
 void watch_enter_sleep_mode(void) {
     // TODO: (a2) hook to UI
 
-    // enter standby (4); we basically hang out here until an interrupt wakes us.
-    // sleep(4);
+    // disable what the watch would, so that only the RTC alarm and external interrupts wake us.
+    _watch_disable_tcc();
+    watch_disable_adc();
+    watch_rtc_disable_all_periodic_callbacks();
+
+    // enter standby (4); we basically hang out here until an interrupt wakes us. Only virtual time can do that;
+    // with wall-clock time, this returns right away.
+    watch_sim_power_set(WATCH_SIM_POWER_CPU, 0);
+    watch_sim_power_set_sleep_mode(true);
+    watch_sim_clock_sleep();
+    watch_sim_power_set_sleep_mode(false);
 
     // call app_setup so the app can re-enable everything we disabled.
     app_setup();
 }
 
+void watch_set_sleep_mode_external_interrupts(bool enabled) {
+    // the simulator never really sleeps, so its interrupts always run.
+    (void) enabled;
+}
+
 void watch_enter_deep_sleep_mode(void) {
     // identical to sleep mode except we disable the LCD first.
     // TODO: (a2) hook to UI
@@ -26,6 +26,8 @@
 
 #include "watch_extint.h"
 #include "watch_main_loop.h"
+#include "watch_sim_replay.h"
+#include "watch_sim_power.h"
 
 #include <emscripten.h>
 #include <emscripten/html5.h>
@@ -40,12 +42,18 @@ static eic_interrupt_trigger_t external_interrupt_light_trigger = INTERRUPT_TRIG
 static watch_cb_t external_interrupt_alarm_callback = NULL;
 static eic_interrupt_trigger_t external_interrupt_alarm_trigger = INTERRUPT_TRIGGER_NONE;
 
-#define BTN_ID_ALARM 3
-#define BTN_ID_LIGHT 1
-#define BTN_ID_MODE 2
+#define BTN_ID_ALARM WATCH_SIM_BUTTON_ALARM
+#define BTN_ID_LIGHT WATCH_SIM_BUTTON_LIGHT
+#define BTN_ID_MODE WATCH_SIM_BUTTON_MODE
 static const uint8_t BTN_IDS[] = { BTN_ID_ALARM, BTN_ID_LIGHT, BTN_ID_MODE };
 static EM_BOOL watch_invoke_interrupt_callback(const uint8_t button_id, eic_interrupt_trigger_t trigger);
 
+// input from the page, as opposed to a replayed trace, gets recorded.
+static EM_BOOL watch_invoke_page_interrupt_callback(const uint8_t button_id, eic_interrupt_trigger_t trigger) {
+    watch_sim_replay_record_button(button_id, trigger == INTERRUPT_TRIGGER_RISING);
+    return watch_invoke_interrupt_callback(button_id, trigger);
+}
+
 static EM_BOOL watch_invoke_key_callback(int eventType, const EmscriptenKeyboardEvent *keyEvent, void *userData) {
     if (debug_console_focused || keyEvent->repeat) return EM_FALSE;
 
@@ -91,20 +99,20 @@ static EM_BOOL watch_invoke_key_callback(int eventType, const EmscriptenKeyboard
     }
 
     eic_interrupt_trigger_t trigger = eventType == EMSCRIPTEN_EVENT_KEYDOWN ? INTERRUPT_TRIGGER_RISING : INTERRUPT_TRIGGER_FALLING;
-    return watch_invoke_interrupt_callback(button_id, trigger);
+    return watch_invoke_page_interrupt_callback(button_id, trigger);
 }
 
 static EM_BOOL watch_invoke_mouse_callback(int eventType, const EmscriptenMouseEvent *mouseEvent, void *userData) {
     if (eventType == EMSCRIPTEN_EVENT_MOUSEOUT && mouseEvent->buttons == 0) return EM_FALSE;
     uint8_t button_id = *(const char *)userData;
     eic_interrupt_trigger_t trigger = eventType == EMSCRIPTEN_EVENT_MOUSEDOWN ? INTERRUPT_TRIGGER_RISING : INTERRUPT_TRIGGER_FALLING;
-    return watch_invoke_interrupt_callback(button_id, trigger);
+    return watch_invoke_page_interrupt_callback(button_id, trigger);
 }
 
 static EM_BOOL watch_invoke_touch_callback(int eventType, const EmscriptenTouchEvent *touchEvent, void *userData) {
     uint8_t button_id = *(const char *)userData;
     eic_interrupt_trigger_t trigger = eventType == EMSCRIPTEN_EVENT_TOUCHSTART ? INTERRUPT_TRIGGER_RISING : INTERRUPT_TRIGGER_FALLING;
-    return watch_invoke_interrupt_callback(button_id, trigger);
+    return watch_invoke_page_interrupt_callback(button_id, trigger);
 }
 
 static EM_BOOL watch_invoke_focus_callback(int eventType, const EmscriptenFocusEvent *focusEvent, void *userData) {
@@ -113,6 +121,9 @@ static EM_BOOL watch_invoke_focus_callback(int eventType, const EmscriptenFocusE
 }
 
 static void watch_install_button_callbacks(void) {
+    // under node, there's no page to take input from.
+    if (EM_ASM_INT({ return typeof document === 'undefined'; })) return;
+
     emscripten_set_keydown_callback(EMSCRIPTEN_EVENT_TARGET_DOCUMENT, NULL, EM_FALSE, watch_invoke_key_callback);
     emscripten_set_keyup_callback(EMSCRIPTEN_EVENT_TARGET_DOCUMENT, NULL, EM_FALSE, watch_invoke_key_callback);
 
@@ -176,6 +187,7 @@ static EM_BOOL watch_invoke_interrupt_callback(const uint8_t button_id, eic_inte
     }
 
     EM_ASM({
+        if (typeof document === 'undefined') return;
         const classList = document.querySelector('#btn' + $0).classList;
         const highlight = 'highlight';
         $1 ? classList.add(highlight) : classList.remove(highlight);
@@ -186,6 +198,7 @@ static EM_BOOL watch_invoke_interrupt_callback(const uint8_t button_id, eic_inte
     }
 
     if (callback && (event & trigger) != 0) {
+        watch_sim_power_busy(WATCH_SIM_POWER_CPU, 1);
         callback();
         resume_main_loop();
     }
@@ -193,6 +206,10 @@ static EM_BOOL watch_invoke_interrupt_callback(const uint8_t button_id, eic_inte
     return EM_TRUE;
 }
 
+void watch_sim_set_button(watch_sim_button_t button, bool pressed) {
+    watch_invoke_interrupt_callback(button, pressed ? INTERRUPT_TRIGGER_RISING : INTERRUPT_TRIGGER_FALLING);
+}
+
 void watch_register_interrupt_callback(const uint8_t pin, watch_cb_t callback, eic_interrupt_trigger_t trigger) {
     if (pin == HAL_GPIO_BTN_MODE_pin()) {
         external_interrupt_mode_callback = callback;
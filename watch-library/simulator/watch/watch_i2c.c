@@ -22,30 +22,137 @@
  * SOFTWARE.
  */
 
+#include <string.h>
 #include "watch_i2c.h"
+#include "watch_sim_replay.h"
+#include "watch_sim_power.h"
+#include "lis2dw.h"
+
+// The bus has one device on it: an LIS2DW, and only when a replayed trace has accelerometer samples for it.
+// Registers read back what was written to them, except for identification, status, temperature and output,
+// which come from the trace. Enough for lis2dw.c to configure it, read samples and drain its FIFO.
+#define LIS2DW_FIFO_DEPTH 32
+
+static bool accelerometer_attached = false;
+static uint8_t lis2dw_registers[0x40];
+static uint8_t lis2dw_register_pointer;
+static int16_t lis2dw_latest[3];
+static int16_t lis2dw_output[3];
+static int16_t lis2dw_fifo[LIS2DW_FIFO_DEPTH][3];
+static uint8_t lis2dw_fifo_head;
+static uint8_t lis2dw_fifo_count;
+static bool lis2dw_fifo_overrun;
+
+void watch_sim_attach_accelerometer(void) {
+    accelerometer_attached = true;
+}
+
+void watch_sim_add_acceleration(int16_t x, int16_t y, int16_t z) {
+    lis2dw_latest[0] = x;
+    lis2dw_latest[1] = y;
+    lis2dw_latest[2] = z;
+    if ((lis2dw_registers[LIS2DW_REG_FIFO_CTRL] >> 5) == LIS2DW_FIFO_MODE_OFF) return;
+
+    if (lis2dw_fifo_count == LIS2DW_FIFO_DEPTH) {
+        // the oldest sample is overwritten.
+        lis2dw_fifo_overrun = true;
+        lis2dw_fifo_head = (lis2dw_fifo_head + 1) % LIS2DW_FIFO_DEPTH;
+        lis2dw_fifo_count--;
+    }
+    memcpy(lis2dw_fifo[(lis2dw_fifo_head + lis2dw_fifo_count++) % LIS2DW_FIFO_DEPTH], lis2dw_latest, sizeof(lis2dw_latest));
+}
+
+static uint8_t watch_i2c_read_register(int16_t addr, uint8_t reg) {
+    if (addr != LIS2DW_ADDRESS || !accelerometer_attached) return 0;
+    reg &= 0x3F;
+
+    switch (reg) {
+        case LIS2DW_REG_WHO_AM_I:
+            return LIS2DW_WHO_AM_I_VAL;
+        case LIS2DW_REG_STATUS:
+            return LIS2DW_STATUS_VAL_DRDY;
+        case LIS2DW_REG_OUT_TEMP_L:
+        case LIS2DW_REG_OUT_TEMP_H:
+            // 0 at 25 degrees, and 16 counts per degree, left-justified in 16 bits.
+            return ((uint16_t)(int16_t)((watch_sim_replay_get_temperature() - 25) * 256) >> (reg == LIS2DW_REG_OUT_TEMP_H ? 8 : 0)) & 0xFF;
+        case LIS2DW_REG_OUT_TEMP:
+            // 0 at 25 degrees, and one count per degree.
+            return (uint8_t)(int8_t)(watch_sim_replay_get_temperature() - 25);
+        case LIS2DW_REG_FIFO_SAMPLE:
+            return lis2dw_fifo_count | (lis2dw_fifo_overrun ? LIS2DW_FIFO_SAMPLE_OVERRUN : 0);
+        case LIS2DW_REG_OUT_X_L:
+            // a read of the output registers starts here, and takes the next sample: from the FIFO if it has any.
+            if (lis2dw_fifo_count) {
+                memcpy(lis2dw_output, lis2dw_fifo[lis2dw_fifo_head], sizeof(lis2dw_output));
+                lis2dw_fifo_head = (lis2dw_fifo_head + 1) % LIS2DW_FIFO_DEPTH;
+                lis2dw_fifo_count--;
+                lis2dw_fifo_overrun = false;
+            } else {
+                memcpy(lis2dw_output, lis2dw_latest, sizeof(lis2dw_output));
+            }
+            // fall through
+        case LIS2DW_REG_OUT_X_H:
+        case LIS2DW_REG_OUT_Y_L:
+        case LIS2DW_REG_OUT_Y_H:
+        case LIS2DW_REG_OUT_Z_L:
+        case LIS2DW_REG_OUT_Z_H:
+            return ((uint16_t)lis2dw_output[(reg - LIS2DW_REG_OUT_X_L) / 2] >> (8 * (reg & 1))) & 0xFF;
+        default:
+            return lis2dw_registers[reg];
+    }
+}
+
+static void watch_i2c_write_register(int16_t addr, uint8_t reg, uint8_t data) {
+    if (addr != LIS2DW_ADDRESS) return;
+    reg &= 0x3F;
+    lis2dw_registers[reg] = data;
+    // turning the FIFO off empties it.
+    if (reg == LIS2DW_REG_FIFO_CTRL && (data >> 5) == LIS2DW_FIFO_MODE_OFF) {
+        lis2dw_fifo_count = 0;
+        lis2dw_fifo_overrun = false;
+    }
+}
 
 void watch_enable_i2c(void) {}
 
 void watch_disable_i2c(void) {}
 
-void watch_i2c_send(int16_t addr, uint8_t *buf, uint16_t length) {}
+void watch_i2c_send(int16_t addr, uint8_t *buf, uint16_t length) {
+    // every transfer starts with the address byte.
+    watch_sim_power_busy(WATCH_SIM_POWER_I2C, length + 1);
+    if (length == 0) return;
+    // the first byte selects a register, and anything after it is written from there on.
+    lis2dw_register_pointer = buf[0];
+    for (uint16_t i = 1; i < length; i++) watch_i2c_write_register(addr, lis2dw_register_pointer++, buf[i]);
+}
 
-void watch_i2c_receive(int16_t addr, uint8_t *buf, uint16_t length) {}
+void watch_i2c_receive(int16_t addr, uint8_t *buf, uint16_t length) {
+    watch_sim_power_busy(WATCH_SIM_POWER_I2C, length + 1);
+    for (uint16_t i = 0; i < length; i++) buf[i] = watch_i2c_read_register(addr, lis2dw_register_pointer++);
+}
 
-void watch_i2c_write8(int16_t addr, uint8_t reg, uint8_t data) {}
+void watch_i2c_write8(int16_t addr, uint8_t reg, uint8_t data) {
+    watch_sim_power_busy(WATCH_SIM_POWER_I2C, 3);
+    watch_i2c_write_register(addr, reg, data);
+}
 
+// a register read is two transfers: the address and register out, then the address and data back.
 uint8_t watch_i2c_read8(int16_t addr, uint8_t reg) {
-    return 0;
+    watch_sim_power_busy(WATCH_SIM_POWER_I2C, 4);
+    return watch_i2c_read_register(addr, reg);
 }
 
 uint16_t watch_i2c_read16(int16_t addr, uint8_t reg) {
-    return 0;
+    watch_sim_power_busy(WATCH_SIM_POWER_I2C, 5);
+    return watch_i2c_read_register(addr, reg) | (uint16_t)watch_i2c_read_register(addr, reg + 1) << 8;
 }
 
 uint32_t watch_i2c_read24(int16_t addr, uint8_t reg) {
-    return 0;
+    watch_sim_power_busy(WATCH_SIM_POWER_I2C, 1);
+    return watch_i2c_read16(addr, reg) | (uint32_t)watch_i2c_read_register(addr, reg + 2) << 16;
 }
 
 uint32_t watch_i2c_read32(int16_t addr, uint8_t reg) {
-    return 0;
+    watch_sim_power_busy(WATCH_SIM_POWER_I2C, 1);
+    return watch_i2c_read24(addr, reg) | (uint32_t)watch_i2c_read_register(addr, reg + 3) << 24;
 }
@@ -25,6 +25,8 @@
 #include "watch_rtc.h"
 #include "watch_main_loop.h"
 #include "watch_utility.h"
+#include "watch_sim_clock.h"
+#include "watch_sim_power.h"
 
 #include <emscripten.h>
 #include <emscripten/html5.h>
@@ -47,8 +49,8 @@ bool _watch_rtc_is_enabled(void) {
 void _watch_rtc_init(void) {
     // Shifts the timezone so our local time is converted to UTC and set
     int32_t time_zone_offset = EM_ASM_INT({
-        return -new Date().getTimezoneOffset() * 60;
-    });
+        return -new Date($0).getTimezoneOffset() * 60;
+    }, watch_sim_clock_now());
     watch_date_time_t date_time = watch_rtc_get_date_time();
     watch_rtc_set_date_time(watch_utility_date_time_convert_zone(date_time, time_zone_offset, 0));
 }
@@ -62,21 +64,21 @@ void watch_rtc_set_date_time(watch_date_time_t date_time) {
         const minute = ($0 >> 6) & 0x3f;
         const second = $0 & 0x3f;
         const date = new Date(year, month - 1, day, hour, minute, second);
-        return date - Date.now();
-    }, date_time.reg);
+        return date - $1;
+    }, date_time.reg, watch_sim_clock_now());
 }
 
 watch_date_time_t watch_rtc_get_date_time(void) {
     watch_date_time_t retval;
     retval.reg = EM_ASM_INT({
-        const date = new Date(Date.now() + $0);
+        const date = new Date($1 + $0);
         return date.getSeconds() |
             (date.getMinutes() << 6) |
             (date.getHours() << 12) |
             (date.getDate() << 17) |
             ((date.getMonth() + 1) << 22) |
             ((date.getFullYear() - 2020) << 26);
-    }, time_offset);
+    }, time_offset, watch_sim_clock_now());
     return retval;
 }
 
@@ -90,6 +92,7 @@ void watch_rtc_disable_tick_callback(void) {
 
 static void watch_invoke_periodic_callback(void *userData) {
     watch_cb_t callback = userData;
+    watch_sim_power_busy(WATCH_SIM_POWER_CPU, 1);
     callback();
     resume_main_loop();
 }
@@ -106,15 +109,15 @@ void watch_rtc_register_periodic_callback(watch_cb_t callback, uint8_t frequency
 
     double interval = 1000.0 / frequency; // in msec
 
-    if (tick_callbacks[per_n] != -1) emscripten_clear_interval(tick_callbacks[per_n]);
-    tick_callbacks[per_n] = emscripten_set_interval(watch_invoke_periodic_callback, interval, (void *)callback);
+    if (tick_callbacks[per_n] != -1) watch_sim_clock_clear(tick_callbacks[per_n]);
+    tick_callbacks[per_n] = watch_sim_clock_set_interval(watch_invoke_periodic_callback, interval, (void *)callback, true);
 }
 
 void watch_rtc_disable_periodic_callback(uint8_t frequency) {
     if (__builtin_popcount(frequency) != 1) return;
     uint8_t per_n = __builtin_clz((frequency & 0xFF) << 24);
     if (tick_callbacks[per_n] != -1) {
-        emscripten_clear_interval(tick_callbacks[per_n]);
+        watch_sim_clock_clear(tick_callbacks[per_n]);
         tick_callbacks[per_n] = -1;
     }
 }
@@ -122,7 +125,7 @@ void watch_rtc_disable_periodic_callback(uint8_t frequency) {
 void watch_rtc_disable_matching_periodic_callbacks(uint8_t mask) {
     for (int i = 0; i < 8; i++) {
         if (tick_callbacks[i] != -1 && (mask & (1 << i)) != 0) {
-            emscripten_clear_interval(tick_callbacks[i]);
+            watch_sim_clock_clear(tick_callbacks[i]);
             tick_callbacks[i] = -1;
         }
     }
@@ -133,12 +136,14 @@ void watch_rtc_disable_all_periodic_callbacks(void) {
 }
 
 static void watch_invoke_alarm_interval_callback(void *userData) {
+    watch_sim_power_busy(WATCH_SIM_POWER_CPU, 1);
     if (alarm_callback) alarm_callback();
 }
 
 static void watch_invoke_alarm_callback(void *userData) {
+    watch_sim_power_busy(WATCH_SIM_POWER_CPU, 1);
     if (alarm_callback) alarm_callback();
-    alarm_interval_id = emscripten_set_interval(watch_invoke_alarm_interval_callback, alarm_interval, NULL);
+    alarm_interval_id = watch_sim_clock_set_interval(watch_invoke_alarm_interval_callback, alarm_interval, NULL, true);
 }
 
 void watch_rtc_register_alarm_callback(watch_cb_t callback, watch_date_time_t alarm_time, rtc_alarm_match_t mask) {
@@ -154,12 +159,12 @@ void watch_rtc_register_alarm_callback(watch_cb_t callback, watch_date_time_t al
             alarm_interval = 60 * 60 * 1000;
             break;
         case ALARM_MATCH_HHMMSS:
-            alarm_interval = 60 * 60 * 60 * 1000;
+            alarm_interval = 24 * 60 * 60 * 1000;
             break;
     }
 
     double timeout = EM_ASM_DOUBLE({
-        const now = Date.now();
+        const now = $2;
         const date = new Date(now);
 
         const hour = ($0 >> 12) & 0x1f;
@@ -183,10 +188,10 @@ void watch_rtc_register_alarm_callback(watch_cb_t callback, watch_date_time_t al
         }
 
         return date - now;
-    }, alarm_time.reg, mask);
+    }, alarm_time.reg, mask, watch_sim_clock_now());
 
     alarm_callback = callback;
-    alarm_timeout_id = emscripten_set_timeout(watch_invoke_alarm_callback, timeout, NULL);
+    alarm_timeout_id = watch_sim_clock_set_timeout(watch_invoke_alarm_callback, timeout, NULL, true);
 }
 
 void watch_rtc_disable_alarm_callback(void) {
@@ -194,12 +199,12 @@ void watch_rtc_disable_alarm_callback(void) {
     alarm_interval = 0;
 
     if (alarm_timeout_id != -1) {
-        emscripten_clear_timeout(alarm_timeout_id);
+        watch_sim_clock_clear(alarm_timeout_id);
         alarm_timeout_id = -1;
     }
 
     if (alarm_interval_id != -1) {
-        emscripten_clear_interval(alarm_interval_id);
+        watch_sim_clock_clear(alarm_interval_id);
         alarm_interval_id = -1;
     }
 }
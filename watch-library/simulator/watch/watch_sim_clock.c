@@ -0,0 +1,244 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 Second Movement contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include <stdio.h>
+#include "watch_sim_clock.h"
+#include "watch_sim_replay.h"
+#include "watch_sim_power.h"
+#include "watch_main_loop.h"
+#include "app.h"
+
+#include <emscripten.h>
+#include <emscripten/html5.h>
+
+// enough for every RTC frequency, the alarm, display blinking, the buzzer and a replay, with room to spare.
+#define WATCH_SIM_CLOCK_NUM_TIMERS 32
+// how long fast-forwarding runs before giving the JavaScript event loop a turn, in wall-clock milliseconds.
+#define WATCH_SIM_CLOCK_SLICE_MS 50
+#define WATCH_SIM_CLOCK_NUM_FINISH_CALLBACKS 4
+
+typedef struct {
+    long id;                        // 0 if this slot is free
+    double deadline;                // in virtual milliseconds since the epoch
+    double interval;                // 0 for a timeout
+    watch_sim_clock_cb_t callback;
+    void *user_data;
+    bool wakes;
+} watch_sim_clock_timer_t;
+
+static bool initialized = false;
+static bool is_virtual = false;
+static bool finished = false;
+static double virtual_now;
+static double virtual_start;
+static double virtual_end;          // 0 to run until the replay ends
+static double wall_start;
+static long next_id = 1;
+static uint32_t timers_fired;
+static watch_sim_clock_timer_t timers[WATCH_SIM_CLOCK_NUM_TIMERS];
+static void (*finish_callbacks[WATCH_SIM_CLOCK_NUM_FINISH_CALLBACKS])(void);
+static uint8_t num_finish_callbacks;
+
+static void watch_sim_clock_pump(void *user_data);
+
+static void watch_sim_clock_init(void) {
+    if (initialized) return;
+    initialized = true;
+
+    // without a page, define the globals that the page would, since shell.c and some faces read them.
+    EM_ASM({
+        if (typeof document !== 'undefined') return;
+        if (typeof globalThis.tx === 'undefined') globalThis.tx = "";
+        if (typeof globalThis.lat === 'undefined') globalThis.lat = 0;
+        if (typeof globalThis.lon === 'undefined') globalThis.lon = 0;
+        if (typeof globalThis.temp_c === 'undefined') globalThis.temp_c = 25.0;
+    });
+
+    // seconds of virtual time to run, or -1 for wall-clock time.
+    double fast_forward = EM_ASM_DOUBLE({
+        if (!ENVIRONMENT_IS_NODE || process.env.SIM_FAST_FORWARD === undefined) return -1;
+        return Math.max(0, Number(process.env.SIM_FAST_FORWARD) || 0);
+    });
+    double start = EM_ASM_DOUBLE({
+        if (!ENVIRONMENT_IS_NODE || process.env.SIM_START === undefined) return 0;
+        return (Number(process.env.SIM_START) || 0) * 1000;
+    });
+    double trace_start = watch_sim_replay_load();
+
+    if (fast_forward >= 0) {
+        is_virtual = true;
+        if (start == 0) start = trace_start;
+        if (start == 0) start = emscripten_date_now();
+        virtual_now = virtual_start = start;
+        virtual_end = fast_forward > 0 ? start + fast_forward * 1000 : 0;
+        wall_start = emscripten_get_now();
+        emscripten_set_timeout(watch_sim_clock_pump, 0, NULL);
+    }
+
+    watch_sim_replay_begin();
+}
+
+double watch_sim_clock_now(void) {
+    watch_sim_clock_init();
+    return is_virtual ? virtual_now : emscripten_date_now();
+}
+
+bool watch_sim_clock_is_virtual(void) {
+    watch_sim_clock_init();
+    return is_virtual;
+}
+
+static long watch_sim_clock_add(watch_sim_clock_cb_t callback, double delay_ms, double interval_ms, void *user_data, bool wakes) {
+    for (uint8_t i = 0; i < WATCH_SIM_CLOCK_NUM_TIMERS; i++) {
+        if (timers[i].id == 0) {
+            timers[i].id = next_id++;
+            timers[i].deadline = virtual_now + delay_ms;
+            timers[i].interval = interval_ms;
+            timers[i].callback = callback;
+            timers[i].user_data = user_data;
+            timers[i].wakes = wakes;
+            return timers[i].id;
+        }
+    }
+    printf("Simulator ran out of timers!\n");
+
+    return 0;
+}
+
+long watch_sim_clock_set_interval(watch_sim_clock_cb_t callback, double interval_ms, void *user_data, bool wakes) {
+    watch_sim_clock_init();
+    if (!is_virtual) return emscripten_set_interval(callback, interval_ms, user_data);
+
+    return watch_sim_clock_add(callback, interval_ms, interval_ms, user_data, wakes);
+}
+
+long watch_sim_clock_set_timeout(watch_sim_clock_cb_t callback, double timeout_ms, void *user_data, bool wakes) {
+    watch_sim_clock_init();
+    if (!is_virtual) return emscripten_set_timeout(callback, timeout_ms, user_data);
+
+    return watch_sim_clock_add(callback, timeout_ms < 0 ? 0 : timeout_ms, 0, user_data, wakes);
+}
+
+void watch_sim_clock_clear(long id) {
+    if (id <= 0) return;
+    // clearInterval and clearTimeout are interchangeable, in the browser and in node.
+    if (!is_virtual) {
+        emscripten_clear_interval(id);
+        return;
+    }
+    for (uint8_t i = 0; i < WATCH_SIM_CLOCK_NUM_TIMERS; i++) {
+        if (timers[i].id == id) timers[i].id = 0;
+    }
+}
+
+/// Fires the earliest timer (the oldest, among timers due at the same moment), moving the clock to its deadline.
+/// Returns false if there is nothing left to fire before the end of the run.
+static bool watch_sim_clock_fire_next(bool *wakes) {
+    watch_sim_clock_timer_t *next = NULL;
+
+    for (uint8_t i = 0; i < WATCH_SIM_CLOCK_NUM_TIMERS; i++) {
+        if (timers[i].id == 0) continue;
+        if (next == NULL || timers[i].deadline < next->deadline ||
+            (timers[i].deadline == next->deadline && timers[i].id < next->id)) next = &timers[i];
+    }
+    if (next == NULL) return false;
+    if (virtual_end != 0 && next->deadline > virtual_end) {
+        virtual_now = virtual_end;
+        return false;
+    }
+
+    if (next->deadline > virtual_now) virtual_now = next->deadline;
+    watch_sim_clock_cb_t callback = next->callback;
+    void *user_data = next->user_data;
+    *wakes = next->wakes;
+    // reschedule or free the slot first, since the callback may well clear or add timers of its own.
+    if (next->interval > 0) next->deadline += next->interval;
+    else next->id = 0;
+
+    timers_fired++;
+    callback(user_data);
+
+    return true;
+}
+
+static void watch_sim_clock_pump(void *user_data) {
+    (void) user_data;
+    double slice_end = emscripten_get_now() + WATCH_SIM_CLOCK_SLICE_MS;
+    bool wakes;
+
+    while (!finished && emscripten_get_now() < slice_end) {
+        if (!watch_sim_clock_fire_next(&wakes)) {
+            watch_sim_clock_finish();
+            return;
+        }
+        // on the watch, the main loop runs after every interrupt; do the same here rather than wait for the
+        // browser's main loop, which runs in wall-clock time. If it can't sleep, it stays awake until the next one.
+        watch_sim_power_set(WATCH_SIM_POWER_CPU, app_loop() ? 0 : 1);
+    }
+
+    if (!finished) emscripten_set_timeout(watch_sim_clock_pump, 0, NULL);
+}
+
+void watch_sim_clock_sleep(void) {
+    if (!watch_sim_clock_is_virtual()) return;
+
+    bool wakes = false;
+    while (!wakes && !finished) {
+        if (!watch_sim_clock_fire_next(&wakes)) watch_sim_clock_finish();
+    }
+}
+
+void watch_sim_clock_delay(uint32_t ms) {
+    if (watch_sim_clock_is_virtual()) {
+        double cpu = watch_sim_power_get(WATCH_SIM_POWER_CPU);
+        watch_sim_power_set(WATCH_SIM_POWER_CPU, 1);
+        virtual_now += ms;
+        watch_sim_power_set(WATCH_SIM_POWER_CPU, cpu);
+    } else {
+        main_loop_sleep(ms);
+    }
+}
+
+void watch_sim_clock_at_finish(void (*callback)(void)) {
+    if (num_finish_callbacks < WATCH_SIM_CLOCK_NUM_FINISH_CALLBACKS) finish_callbacks[num_finish_callbacks++] = callback;
+}
+
+void watch_sim_clock_finish(void) {
+    if (!is_virtual || finished) return;
+    finished = true;
+
+    for (uint8_t i = 0; i < num_finish_callbacks; i++) finish_callbacks[i]();
+
+    printf("Fast-forwarded %.0f s of simulated time in %.0f ms; %u timers fired.\n",
+           (virtual_now - virtual_start) / 1000, emscripten_get_now() - wall_start, (unsigned)timers_fired);
+
+    EM_ASM({
+        if (ENVIRONMENT_IS_NODE) process.exit(0);
+    });
+}
+
+void watch_sim_clock_input_ended(void) {
+    if (is_virtual && virtual_end == 0) watch_sim_clock_finish();
+}
@@ -0,0 +1,91 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 Second Movement contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// Simulator clock:
+// Everything in the simulator that happens "later" (RTC ticks and alarms, display blinking, buzzer sequences,
+// replayed input) goes through these timers rather than calling emscripten_set_interval directly. Normally they
+// are just wall-clock browser timers. When the simulator runs under node with SIM_FAST_FORWARD set, time is
+// virtual instead: nothing waits, the earliest timer fires immediately, the clock jumps to its deadline, and
+// app_loop runs after each one, the way the main loop would after an interrupt. A day of simulated time then
+// takes seconds. Environment variables read at startup, under node:
+//
+//   SIM_FAST_FORWARD=<seconds>  run this much virtual time, then exit. 0 runs until a replayed trace ends.
+//   SIM_START=<unix seconds>    the time the virtual clock starts at; otherwise the trace's start time, or now.
+//   SIM_REPLAY=<path>           replay an input trace; see watch_sim_replay.h.
+//   SIM_RECORD=<path>           record buttons and temperature changes from this session to a trace.
+//   SIM_FLASH=<path>            keep the storage area in this raw image file; see watch_storage.c.
+//   SIM_POWER_REPORT=<path>     write the power model's JSON report here at the end; see watch_sim_power.h.
+//
+// For reproducible dates, also set TZ; the simulated RTC runs in the process's local time zone, as it does in
+// the browser.
+
+typedef void (*watch_sim_clock_cb_t)(void *user_data);
+
+/** @brief Returns the current time in milliseconds since the Unix epoch: wall-clock or virtual. */
+double watch_sim_clock_now(void);
+
+/** @brief Returns true if the simulator is fast-forwarding through virtual time. */
+bool watch_sim_clock_is_virtual(void);
+
+/** @brief Calls a function every interval_ms milliseconds, until cleared.
+  * @param callback The function to call.
+  * @param interval_ms The period, in milliseconds.
+  * @param user_data Passed to the callback.
+  * @param wakes True if this timer stands in for an interrupt that would wake the watch from sleep (the RTC, a
+  *        button); false for peripherals that run on their own while it sleeps (display blinking, the buzzer).
+  * @return A nonzero ID for watch_sim_clock_clear.
+  */
+long watch_sim_clock_set_interval(watch_sim_clock_cb_t callback, double interval_ms, void *user_data, bool wakes);
+
+/** @brief Calls a function once, after timeout_ms milliseconds. Parameters are as for watch_sim_clock_set_interval.
+  */
+long watch_sim_clock_set_timeout(watch_sim_clock_cb_t callback, double timeout_ms, void *user_data, bool wakes);
+
+/** @brief Cancels an interval or timeout. IDs that have already fired or been cleared are ignored. */
+void watch_sim_clock_clear(long id);
+
+/** @brief Called by watch_enter_sleep_mode. In virtual time, this fires timers until one that wakes the watch
+  *        has run, since nothing else would happen while it sleeps. With wall-clock time, it returns immediately.
+  */
+void watch_sim_clock_sleep(void);
+
+/** @brief Passes time without firing timers, as a busy wait on the watch would. In virtual time, this just
+  *        moves the clock forward; with wall-clock time, it sleeps the main loop.
+  */
+void watch_sim_clock_delay(uint32_t ms);
+
+/** @brief Registers a function to call when a fast-forward run finishes, before the process exits. */
+void watch_sim_clock_at_finish(void (*callback)(void));
+
+/** @brief Ends the fast-forward run now. Does nothing with wall-clock time. */
+void watch_sim_clock_finish(void);
+
+/** @brief Called when a replayed trace runs out. Ends a fast-forward run that was told to run until then. */
+void watch_sim_clock_input_ended(void);
@@ -0,0 +1,249 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 Second Movement contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "watch_sim_power.h"
+#include "watch_sim_clock.h"
+
+#include <emscripten.h>
+
+// faces past this many share the last entry in the breakdown.
+#define WATCH_SIM_POWER_MAX_FACES 32
+// a CR2016's nominal capacity, in µAh, for the report's estimate of battery life.
+#define WATCH_SIM_POWER_BATTERY_UAH 90000.0
+#define WATCH_SIM_POWER_JSON_SIZE 4096
+
+typedef struct {
+    const char *name;
+    double current_ua;      // at level 1
+    double busy_ms;         // per operation, for watch_sim_power_busy; 0 if it has none
+} watch_sim_power_load_info_t;
+
+typedef struct {
+    const char *name;
+    watch_sim_power_load_info_t loads[WATCH_SIM_POWER_NUM_LOADS];
+} watch_sim_power_board_t;
+
+// Standby and the CPU are from the SAM L22 datasheet: standby with the RTC running and all RAM retained, and
+// active at 4 MHz from flash (about 40 µA/MHz), for half a millisecond per interrupt. The ADC samples in about 20 µs
+// and I2C runs at 100 kHz, 9 clocks a byte. The LEDs and piezo are for their series resistors at 3 V.
+static const watch_sim_power_board_t board =
+#ifdef WATCH_BLUE_TCC_CHANNEL
+{
+    .name = "sensorwatch_pro",
+    .loads = {
+        [WATCH_SIM_POWER_STANDBY] = { "standby", 1.8, 0 },
+        [WATCH_SIM_POWER_CPU] = { "cpu", 160.0, 0.5 },
+        [WATCH_SIM_POWER_ADC] = { "adc", 250.0, 0.02 },
+        [WATCH_SIM_POWER_I2C] = { "i2c", 50.0, 0.09 },
+        [WATCH_SIM_POWER_TCC] = { "tcc", 40.0, 0 },
+        [WATCH_SIM_POWER_BUZZER] = { "buzzer", 1500.0, 0 },
+        [WATCH_SIM_POWER_LED_RED] = { "led_red", 1500.0, 0 },
+        [WATCH_SIM_POWER_LED_GREEN] = { "led_green", 1500.0, 0 },
+        [WATCH_SIM_POWER_LED_BLUE] = { "led_blue", 1500.0, 0 },
+        [WATCH_SIM_POWER_SLCD] = { "slcd", 0.12, 0 },
+    },
+};
+#else
+{
+    .name = "sensorwatch_green",
+    .loads = {
+        [WATCH_SIM_POWER_STANDBY] = { "standby", 1.8, 0 },
+        [WATCH_SIM_POWER_CPU] = { "cpu", 160.0, 0.5 },
+        [WATCH_SIM_POWER_ADC] = { "adc", 250.0, 0.02 },
+        [WATCH_SIM_POWER_I2C] = { "i2c", 50.0, 0.09 },
+        [WATCH_SIM_POWER_TCC] = { "tcc", 40.0, 0 },
+        [WATCH_SIM_POWER_BUZZER] = { "buzzer", 1500.0, 0 },
+        [WATCH_SIM_POWER_LED_RED] = { "led_red", 2000.0, 0 },
+        [WATCH_SIM_POWER_LED_GREEN] = { "led_green", 2000.0, 0 },
+        [WATCH_SIM_POWER_LED_BLUE] = { "led_blue", 0, 0 },
+        [WATCH_SIM_POWER_SLCD] = { "slcd", 0.12, 0 },
+    },
+};
+#endif
+
+typedef struct {
+    double on_ms;           // time at a nonzero level, plus busy time
+    double charge;          // in µA·ms
+} watch_sim_power_total_t;
+
+static bool initialized = false;
+static double levels[WATCH_SIM_POWER_NUM_LOADS];
+static double start_ms;
+static double last_ms;
+static double sleep_mode_ms;
+static bool sleep_mode;
+static uint32_t wakes;
+static uint8_t face;
+static watch_sim_power_total_t loads[WATCH_SIM_POWER_NUM_LOADS];
+static watch_sim_power_total_t faces[WATCH_SIM_POWER_MAX_FACES];
+
+static void watch_sim_power_write_json(void);
+
+static void watch_sim_power_init(void) {
+    if (initialized) return;
+    initialized = true;
+
+    levels[WATCH_SIM_POWER_STANDBY] = 1;
+    start_ms = last_ms = watch_sim_clock_now();
+    watch_sim_clock_at_finish(watch_sim_power_write_json);
+}
+
+/// Accrues charge at the current levels, up to now.
+static void watch_sim_power_advance(void) {
+    watch_sim_power_init();
+    double now = watch_sim_clock_now();
+    double elapsed = now - last_ms;
+    if (elapsed <= 0) return;
+    last_ms = now;
+
+    for (uint8_t i = 0; i < WATCH_SIM_POWER_NUM_LOADS; i++) {
+        if (levels[i] == 0) continue;
+        double charge = levels[i] * board.loads[i].current_ua * elapsed;
+        loads[i].on_ms += elapsed;
+        loads[i].charge += charge;
+        faces[face].charge += charge;
+    }
+    faces[face].on_ms += elapsed;
+    if (sleep_mode) sleep_mode_ms += elapsed;
+}
+
+void watch_sim_power_set(watch_sim_power_load_t load, double level) {
+    watch_sim_power_advance();
+    levels[load] = level < 0 ? 0 : level;
+}
+
+double watch_sim_power_get(watch_sim_power_load_t load) {
+    return levels[load];
+}
+
+static void watch_sim_power_charge(watch_sim_power_load_t load, double ms) {
+    double charge = board.loads[load].current_ua * ms;
+    loads[load].on_ms += ms;
+    loads[load].charge += charge;
+    faces[face].charge += charge;
+}
+
+void watch_sim_power_busy(watch_sim_power_load_t load, uint32_t count) {
+    watch_sim_power_advance();
+    double ms = board.loads[load].busy_ms * count;
+
+    if (load == WATCH_SIM_POWER_CPU) wakes += count;
+    watch_sim_power_charge(load, ms);
+    // the CPU waits for the ADC and the bus, unless it was awake anyway.
+    if (load != WATCH_SIM_POWER_CPU && levels[WATCH_SIM_POWER_CPU] == 0) watch_sim_power_charge(WATCH_SIM_POWER_CPU, ms);
+}
+
+void watch_sim_power_set_sleep_mode(bool sleeping) {
+    watch_sim_power_advance();
+    sleep_mode = sleeping;
+}
+
+void watch_sim_power_set_face(uint8_t face_index) {
+    watch_sim_power_advance();
+    face = face_index < WATCH_SIM_POWER_MAX_FACES ? face_index : WATCH_SIM_POWER_MAX_FACES - 1;
+}
+
+void watch_sim_power_reset(void) {
+    watch_sim_power_advance();
+    start_ms = last_ms;
+    sleep_mode_ms = 0;
+    wakes = 0;
+    memset(loads, 0, sizeof(loads));
+    memset(faces, 0, sizeof(faces));
+}
+
+/// Converts µA·ms to µAh.
+static double watch_sim_power_uah(double charge) {
+    return charge / 3600000.0;
+}
+
+static double watch_sim_power_total_charge(void) {
+    double charge = 0;
+    for (uint8_t i = 0; i < WATCH_SIM_POWER_NUM_LOADS; i++) charge += loads[i].charge;
+
+    return charge;
+}
+
+void watch_sim_power_print_report(void) {
+    watch_sim_power_advance();
+    double elapsed = last_ms - start_ms;
+    if (elapsed <= 0) {
+        printf("No time has passed yet.\r\n");
+        return;
+    }
+    double average_ua = watch_sim_power_total_charge() / elapsed;
+
+    printf("%s, %.0f s (%.0f s in sleep mode), %u wakes\r\n", board.name, elapsed / 1000, sleep_mode_ms / 1000, (unsigned)wakes);
+    printf("average %.2f uA, or %.2f uAh per hour; about %.0f days on a CR2016\r\n",
+           average_ua, average_ua, WATCH_SIM_POWER_BATTERY_UAH / average_ua / 24);
+    printf("%-10s %10s %10s\r\n", "load", "on s", "uAh");
+    for (uint8_t i = 0; i < WATCH_SIM_POWER_NUM_LOADS; i++) {
+        if (loads[i].on_ms == 0) continue;
+        printf("%-10s %10.1f %10.3f\r\n", board.loads[i].name, loads[i].on_ms / 1000, watch_sim_power_uah(loads[i].charge));
+    }
+    printf("%-10s %10s %10s\r\n", "face", "s", "uAh/h");
+    for (uint8_t i = 0; i < WATCH_SIM_POWER_MAX_FACES; i++) {
+        if (faces[i].on_ms == 0) continue;
+        printf("%-10u %10.1f %10.2f\r\n", i, faces[i].on_ms / 1000, faces[i].charge / faces[i].on_ms);
+    }
+}
+
+static void watch_sim_power_write_json(void) {
+    static char json[WATCH_SIM_POWER_JSON_SIZE];
+    size_t len = 0;
+
+    watch_sim_power_advance();
+    double elapsed = last_ms - start_ms;
+    double average_ua = elapsed > 0 ? watch_sim_power_total_charge() / elapsed : 0;
+
+    len += snprintf(json + len, sizeof(json) - len,
+                    "{\"board\":\"%s\",\"seconds\":%.3f,\"sleep_mode_seconds\":%.3f,\"wakes\":%u,"
+                    "\"average_ua\":%.4f,\"uah_per_hour\":%.4f,\"uah\":%.4f,\"battery_days\":%.1f,\"loads\":{",
+                    board.name, elapsed / 1000, sleep_mode_ms / 1000, (unsigned)wakes, average_ua, average_ua,
+                    watch_sim_power_uah(watch_sim_power_total_charge()),
+                    average_ua > 0 ? WATCH_SIM_POWER_BATTERY_UAH / average_ua / 24 : 0);
+    for (uint8_t i = 0; i < WATCH_SIM_POWER_NUM_LOADS && len < sizeof(json); i++) {
+        len += snprintf(json + len, sizeof(json) - len, "%s\"%s\":{\"seconds\":%.3f,\"uah\":%.4f}",
+                        i ? "," : "", board.loads[i].name, loads[i].on_ms / 1000, watch_sim_power_uah(loads[i].charge));
+    }
+    if (len < sizeof(json)) len += snprintf(json + len, sizeof(json) - len, "},\"faces\":[");
+    bool first = true;
+    for (uint8_t i = 0; i < WATCH_SIM_POWER_MAX_FACES && len < sizeof(json); i++) {
+        if (faces[i].on_ms == 0) continue;
+        len += snprintf(json + len, sizeof(json) - len, "%s{\"face\":%u,\"seconds\":%.3f,\"uah\":%.4f,\"uah_per_hour\":%.4f}",
+                        first ? "" : ",", i, faces[i].on_ms / 1000, watch_sim_power_uah(faces[i].charge),
+                        faces[i].charge / faces[i].on_ms);
+        first = false;
+    }
+    if (len < sizeof(json)) snprintf(json + len, sizeof(json) - len, "]}");
+
+    bool written = EM_ASM_INT({
+        if (!ENVIRONMENT_IS_NODE || !process.env.SIM_POWER_REPORT) return 0;
+        require('fs').writeFileSync(process.env.SIM_POWER_REPORT, UTF8ToString($0) + "\n");
+        return 1;
+    }, json);
+    if (!written) printf("%s\n", json);
+}
@@ -0,0 +1,86 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 Second Movement contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// Simulator power model:
+// The simulated peripherals report what state they're in (the ADC and I2C bus sampling and transferring, the TCC
+// driving the LED or buzzer, the display's frame rate, the CPU awake or in standby), and this keeps a running
+// total of charge from a table of typical currents for the board. Time comes from the simulator clock, so with
+// SIM_FAST_FORWARD a day of use is estimated in seconds. Anything that takes time on the watch but none in the
+// simulator (an ADC sample, an I2C transfer, the CPU handling an interrupt) is charged a fixed duration per
+// operation instead.
+//
+// The currents are typical figures from the SAM L22 datasheet and rough ones for the LEDs and piezo, not
+// measurements; the estimates are for comparing one build or setting against another, more than for predicting
+// battery life to the day. Charge is also split by watch face, so a face that keeps the watch awake stands out.
+//
+// The `power` shell command prints a report, and `power reset` starts a new one. At the end of a fast-forward run
+// under node, a JSON report is written to the file named by SIM_POWER_REPORT, or to the console without it.
+
+typedef enum {
+    WATCH_SIM_POWER_STANDBY = 0,    // the floor: RTC, RAM retention and regulators, always on
+    WATCH_SIM_POWER_CPU,            // awake and running, rather than in standby
+    WATCH_SIM_POWER_ADC,
+    WATCH_SIM_POWER_I2C,
+    WATCH_SIM_POWER_TCC,            // enabled for the buzzer or LEDs
+    WATCH_SIM_POWER_BUZZER,         // level is the duty cycle, relative to the loud 25%
+    WATCH_SIM_POWER_LED_RED,        // levels are PWM duty cycles, 0 to 1
+    WATCH_SIM_POWER_LED_GREEN,
+    WATCH_SIM_POWER_LED_BLUE,
+    WATCH_SIM_POWER_SLCD,           // level is the frame rate in Hz; its current is per Hz
+    WATCH_SIM_POWER_NUM_LOADS
+} watch_sim_power_load_t;
+
+/** @brief Sets a load's level. Charge accrues at the level times the load's current in the table.
+  * @param load The load.
+  * @param level 0 for off, 1 for on, or as described for the load above.
+  */
+void watch_sim_power_set(watch_sim_power_load_t load, double level);
+
+/** @brief Returns a load's current level. */
+double watch_sim_power_get(watch_sim_power_load_t load);
+
+/** @brief Charges for operations that take time on the watch but none in the simulator: an interrupt's worth of CPU
+  *        time for WATCH_SIM_POWER_CPU, one sample for WATCH_SIM_POWER_ADC, one byte for WATCH_SIM_POWER_I2C. The
+  *        ADC and I2C block, so they keep the CPU awake for as long.
+  * @param load The load.
+  * @param count The number of operations.
+  */
+void watch_sim_power_busy(watch_sim_power_load_t load, uint32_t count);
+
+/** @brief Marks the time between watch_enter_sleep_mode and waking up, for the report. */
+void watch_sim_power_set_sleep_mode(bool sleeping);
+
+/** @brief Attributes charge from now on to a watch face. Called by Movement when the face changes. */
+void watch_sim_power_set_face(uint8_t face_index);
+
+/** @brief Starts over, as if the simulator had just started. */
+void watch_sim_power_reset(void);
+
+/** @brief Prints a report to the console. */
+void watch_sim_power_print_report(void);
@@ -0,0 +1,265 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 Second Movement contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdarg.h>
+#include "watch_sim_replay.h"
+#include "watch_sim_clock.h"
+
+#include <emscripten.h>
+
+typedef enum {
+    REPLAY_EVENT_BUTTON,
+    REPLAY_EVENT_ACCEL,
+    REPLAY_EVENT_TEMP,
+    REPLAY_EVENT_END,
+} replay_event_type_t;
+
+typedef struct {
+    double time;
+    replay_event_type_t type;
+    int16_t args[3];        // button and pressed, or x, y and z
+    double temperature;
+} replay_event_t;
+
+static replay_event_t *events = NULL;
+static size_t num_events = 0;
+static size_t next_event = 0;
+static double replay_origin;
+static long replay_timeout_id = 0;
+
+static bool has_replayed_temperature = false;
+static double replayed_temperature;
+static double recorded_temperature = -1000;
+static double record_origin;
+
+static const char *button_names[] = { NULL, "light", "mode", "alarm" };
+
+/// Parses a trace into events, replacing any loaded before. Returns the trace's start time, or 0.
+static double watch_sim_replay_parse(const char *trace) {
+    double start = 0;
+    size_t capacity = 0;
+    unsigned line_number = 0;
+
+    free(events);
+    events = NULL;
+    num_events = next_event = 0;
+
+    while (*trace) {
+        const char *line = trace;
+        size_t length = strcspn(line, "\n");
+        trace += length + (line[length] == '\n');
+        line_number++;
+
+        char buf[96], name[8], arg[8];
+        if (length >= sizeof(buf)) length = sizeof(buf) - 1;
+        memcpy(buf, line, length);
+        buf[length] = 0;
+
+        double time;
+        int n;
+        if (buf[strspn(buf, " \t\r")] == '#' || sscanf(buf, "%lf %7s %n", &time, name, &n) < 2) continue;
+
+        replay_event_t event = { .time = time };
+        const char *args = buf + n;
+        bool ok = true;
+        if (strcmp(name, "start") == 0) {
+            sscanf(args, "%lf", &start);
+            continue;
+        } else if (strcmp(name, "button") == 0) {
+            char edge[8];
+            event.type = REPLAY_EVENT_BUTTON;
+            ok = sscanf(args, "%7s %7s", arg, edge) == 2;
+            event.args[0] = 0;
+            for (uint8_t i = WATCH_SIM_BUTTON_LIGHT; ok && i <= WATCH_SIM_BUTTON_ALARM; i++) {
+                if (strcmp(arg, button_names[i]) == 0) event.args[0] = i;
+            }
+            event.args[1] = strcmp(edge, "down") == 0;
+            ok = ok && event.args[0] && (event.args[1] || strcmp(edge, "up") == 0);
+        } else if (strcmp(name, "accel") == 0) {
+            event.type = REPLAY_EVENT_ACCEL;
+            ok = sscanf(args, "%hd %hd %hd", &event.args[0], &event.args[1], &event.args[2]) == 3;
+        } else if (strcmp(name, "temp") == 0) {
+            event.type = REPLAY_EVENT_TEMP;
+            ok = sscanf(args, "%lf", &event.temperature) == 1;
+        } else if (strcmp(name, "end") == 0) {
+            event.type = REPLAY_EVENT_END;
+        } else {
+            ok = false;
+        }
+        if (ok && num_events && time < events[num_events - 1].time) ok = false;
+        if (!ok) {
+            printf("Trace line %u: skipping \"%s\"\n", line_number, buf);
+            continue;
+        }
+
+        if (num_events == capacity) {
+            capacity = capacity ? capacity * 2 : 256;
+            events = realloc(events, capacity * sizeof(replay_event_t));
+        }
+        events[num_events++] = event;
+    }
+
+    return start;
+}
+
+static bool watch_sim_replay_has_accelerometer_samples(void) {
+    for (size_t i = 0; i < num_events; i++) {
+        if (events[i].type == REPLAY_EVENT_ACCEL) return true;
+    }
+
+    return false;
+}
+
+static void watch_sim_replay_schedule(void);
+
+static void watch_sim_replay_fire(void *user_data) {
+    (void) user_data;
+    replay_timeout_id = 0;
+    if (next_event >= num_events) return;
+
+    // one event at a time, so that the main loop sees each button edge, even when two share a timestamp.
+    const replay_event_t *event = &events[next_event++];
+    switch (event->type) {
+        case REPLAY_EVENT_BUTTON:
+            watch_sim_set_button(event->args[0], event->args[1]);
+            break;
+        case REPLAY_EVENT_ACCEL:
+            watch_sim_add_acceleration(event->args[0], event->args[1], event->args[2]);
+            break;
+        case REPLAY_EVENT_TEMP:
+            has_replayed_temperature = true;
+            replayed_temperature = event->temperature;
+            break;
+        case REPLAY_EVENT_END:
+            next_event = num_events;
+            break;
+    }
+
+    if (next_event < num_events) {
+        watch_sim_replay_schedule();
+    } else {
+        printf("Replay finished.\n");
+        watch_sim_clock_input_ended();
+    }
+}
+
+static void watch_sim_replay_schedule(void) {
+    double delay = replay_origin + events[next_event].time - watch_sim_clock_now();
+    replay_timeout_id = watch_sim_clock_set_timeout(watch_sim_replay_fire, delay, NULL, true);
+}
+
+static void watch_sim_replay_play(void) {
+    watch_sim_clock_clear(replay_timeout_id);
+    replay_timeout_id = 0;
+    has_replayed_temperature = false;
+    replay_origin = watch_sim_clock_now();
+    if (num_events) watch_sim_replay_schedule();
+}
+
+static void watch_sim_replay_record(const char *format, ...) {
+    char line[64];
+    va_list args;
+    int length = snprintf(line, sizeof(line), "%.0f ", watch_sim_clock_now() - record_origin);
+
+    va_start(args, format);
+    vsnprintf(line + length, sizeof(line) - length, format, args);
+    va_end(args);
+
+    EM_ASM({
+        const line = UTF8ToString($0) + "\n";
+        if (Module.simRecordPath) require('fs').appendFileSync(Module.simRecordPath, line);
+        else if (Module.simRecording) Module.simRecording.push(line);
+    }, line);
+}
+
+double watch_sim_replay_load(void) {
+    char *trace = (char *)EM_ASM_INT({
+        if (!ENVIRONMENT_IS_NODE || !process.env.SIM_REPLAY) return 0;
+        const trace = require('fs').readFileSync(process.env.SIM_REPLAY, 'utf8');
+        const len = lengthBytesUTF8(trace) + 1;
+        const s = _malloc(len);
+        stringToUTF8(trace, s, len);
+        return s;
+    });
+    if (trace == NULL) return 0;
+
+    double start = watch_sim_replay_parse(trace);
+    free(trace);
+    printf("Loaded %u trace events.\n", (unsigned)num_events);
+    // the accelerometer has to be there from the start, because Movement only looks for it once.
+    if (watch_sim_replay_has_accelerometer_samples()) watch_sim_attach_accelerometer();
+
+    return start;
+}
+
+void watch_sim_replay_begin(void) {
+    record_origin = watch_sim_clock_now();
+
+    // the page always records, so that any session can be saved; under node, only if asked to.
+    EM_ASM({
+        if (ENVIRONMENT_IS_NODE) {
+            if (process.env.SIM_RECORD) {
+                Module.simRecordPath = process.env.SIM_RECORD;
+                require('fs').writeFileSync(Module.simRecordPath, "# Sensor Watch simulator input trace\n");
+            }
+        } else {
+            Module.simRecording = ["# Sensor Watch simulator input trace\n"];
+            Module.simRecordStart = Date.now();
+        }
+    });
+    watch_sim_replay_record("start %.0f", record_origin);
+
+    watch_sim_replay_play();
+}
+
+EMSCRIPTEN_KEEPALIVE
+void watch_sim_replay_start(const char *trace) {
+    watch_sim_replay_parse(trace);
+    printf("Replaying %u trace events.\n", (unsigned)num_events);
+    watch_sim_replay_play();
+}
+
+void watch_sim_replay_record_button(watch_sim_button_t button, bool pressed) {
+    if (button < WATCH_SIM_BUTTON_LIGHT || button > WATCH_SIM_BUTTON_ALARM) return;
+    watch_sim_replay_record("button %s %s", button_names[button], pressed ? "down" : "up");
+}
+
+double watch_sim_replay_get_temperature(void) {
+    if (has_replayed_temperature) return replayed_temperature;
+
+    double temperature = EM_ASM_DOUBLE({
+        return typeof temp_c === 'number' && !isNaN(temp_c) ? temp_c : 25.0;
+    });
+    // record changes to the page's setting as the watch sees them.
+    if (temperature != recorded_temperature) {
+        recorded_temperature = temperature;
+        watch_sim_replay_record("temp %.2f", temperature);
+    }
+
+    return temperature;
+}
@@ -0,0 +1,82 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 Second Movement contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// Simulator input traces:
+// A trace is a text file with one event per line: a time in milliseconds from the start of the session, the
+// event, and its arguments. Blank lines and lines starting with # are ignored.
+//
+//   0 start 1729339200000      when the session started, in milliseconds since the epoch
+//   1500 button mode down      a button edge: light, mode or alarm; down or up
+//   1620 button mode up
+//   2000 accel 120 -340 16200  an accelerometer sample, in raw LIS2DW counts at ±2 g (16384 per g)
+//   2000 temp 21.5             the temperature at the thermistor, in degrees Celsius
+//   90000 end                  the end of the session
+//
+// Samples feed an emulated LIS2DW, which fills its FIFO as the real one would in a FIFO mode and otherwise just
+// holds the latest sample; it only answers on the bus if the trace was loaded at startup (with SIM_REPLAY) and
+// has samples in it, and its interrupt pins aren't emulated. Temperatures feed an emulated thermistor; without
+// a trace, it reads the page's Temp. setting.
+//
+// The page records every session, which its Session controls can save, and they can also replay a trace from
+// the current moment. Under node, SIM_RECORD and SIM_REPLAY do the same from startup; see watch_sim_clock.h.
+
+typedef enum {
+    WATCH_SIM_BUTTON_LIGHT = 1,
+    WATCH_SIM_BUTTON_MODE = 2,
+    WATCH_SIM_BUTTON_ALARM = 3,
+} watch_sim_button_t;
+
+/** @brief Called by the simulator clock at startup: loads the trace named by SIM_REPLAY, if any.
+  * @return The time the trace was recorded, in milliseconds since the epoch, or 0 if unknown.
+  */
+double watch_sim_replay_load(void);
+
+/** @brief Called by the simulator clock once it's running: starts recording, and replaying what was loaded. */
+void watch_sim_replay_begin(void);
+
+/** @brief Replays a trace from the current moment, replacing any replay in progress. Called from the page.
+  * @param trace The text of the trace.
+  */
+void watch_sim_replay_start(const char *trace);
+
+/** @brief Records a button edge that came from the page, rather than a replay. */
+void watch_sim_replay_record_button(watch_sim_button_t button, bool pressed);
+
+/** @brief Returns the temperature at the thermistor, in degrees Celsius: replayed, or set on the page. */
+double watch_sim_replay_get_temperature(void);
+
+/** @brief Presses or releases a button; implemented in watch_extint.c. */
+void watch_sim_set_button(watch_sim_button_t button, bool pressed);
+
+/** @brief Connects the emulated LIS2DW to the I2C bus; implemented in watch_i2c.c. */
+void watch_sim_attach_accelerometer(void);
+
+/** @brief Hands the emulated LIS2DW a new sample; implemented in watch_i2c.c. */
+void watch_sim_add_acceleration(int16_t x, int16_t y, int16_t z);
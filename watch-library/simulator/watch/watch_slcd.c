@@ -22,8 +22,11 @@
  * SOFTWARE.
  */
 
+#include <string.h>
 #include "watch_slcd.h"
 #include "watch_common_display.h"
+#include "watch_sim_clock.h"
+#include "watch_sim_power.h"
 
 #include <emscripten.h>
 #include <emscripten/html5.h>
@@ -37,33 +40,82 @@ static long blink_interval_id = - 1;
 static bool tick_state;
 static long tick_interval_id = -1;
 
+// Segment state, one bit per SLCD_SEGID: what the firmware has drawn, and what the SVG currently shows. Drawing
+// only touches the first; the SVG catches up once per animation frame, with one style change per segment that
+// actually changed, so a face ticking faster than the browser paints doesn't pay for a DOM update on every pixel.
+#define SLCD_NUM_COMS 8
+static uint32_t segments[SLCD_NUM_COMS];
+static uint32_t shown_segments[SLCD_NUM_COMS];
+static bool flush_pending;
+
+static EM_BOOL watch_slcd_flush(double time, void *userData) {
+    (void) time;
+    (void) userData;
+    flush_pending = false;
+
+    EM_ASM({
+        if (typeof document === 'undefined') return;
+        // find the SVG element(s) for each segment once, rather than querying for them on every change.
+        if (!Module.slcdElements) {
+            Module.slcdElements = [];
+            document.querySelectorAll("[data-com][data-seg]").forEach((e) => {
+                const segid = (parseInt(e.dataset.com) << 5) | parseInt(e.dataset.seg);
+                (Module.slcdElements[segid] = Module.slcdElements[segid] || []).push(e);
+            });
+        }
+        for (let com = 0; com < $2; com++) {
+            const now = HEAPU32[($0 >> 2) + com];
+            let changed = now ^ HEAPU32[($1 >> 2) + com];
+            while (changed) {
+                const seg = 31 - Math.clz32(changed);
+                changed &= ~(1 << seg);
+                const opacity = (now >>> seg) & 1;
+                (Module.slcdElements[(com << 5) | seg] || []).forEach((e) => e.style.opacity = opacity);
+            }
+        }
+    }, segments, shown_segments, SLCD_NUM_COMS);
+
+    memcpy(shown_segments, segments, sizeof(segments));
+
+    return EM_FALSE;
+}
+
+static void watch_slcd_schedule_flush(void) {
+    // under node, there's no SVG to update, nor animation frames to do it in.
+    static int8_t has_page = -1;
+    if (has_page == -1) has_page = EM_ASM_INT({ return typeof requestAnimationFrame === 'function'; });
+    if (flush_pending || !has_page) return;
+    flush_pending = true;
+    emscripten_request_animation_frame(watch_slcd_flush, NULL);
+}
+
 watch_lcd_type_t watch_get_lcd_type(void) {
     return WATCH_LCD_TYPE_CLASSIC;
 }
 
 void watch_enable_display(void) {
+    // the SVG starts out with every segment visible; mark them all as shown so the first flush hides them.
+    memset(shown_segments, 0xFF, sizeof(shown_segments));
     watch_clear_display();
+    // the frame rates the watch library sets up: about 34 Hz for the classic LCD, 32 for the custom one.
+    watch_sim_power_set(WATCH_SIM_POWER_SLCD, watch_get_lcd_type() == WATCH_LCD_TYPE_CUSTOM ? 32 : 34);
 }
 
 void watch_set_pixel(uint8_t com, uint8_t seg) {
-    EM_ASM({
-        document.querySelectorAll("[data-com='" + $0 + "'][data-seg='" + $1 + "']")
-            .forEach((e) => e.style.opacity = 1);
-    }, com, seg);
+    if (com >= SLCD_NUM_COMS || seg > 31) return;
+    segments[com] |= (uint32_t)1 << seg;
+    watch_slcd_schedule_flush();
 }
 
 void watch_clear_pixel(uint8_t com, uint8_t seg) {
-    EM_ASM({
-        document.querySelectorAll("[data-com='" + $0 + "'][data-seg='" + $1 + "']")
-            .forEach((e) => e.style.opacity = 0);
-    }, com, seg);
+    if (com >= SLCD_NUM_COMS || seg > 31) return;
+    segments[com] &= ~((uint32_t)1 << seg);
+    watch_slcd_schedule_flush();
 }
 
 void watch_clear_display(void) {
-    EM_ASM({
-        document.querySelectorAll("[data-com][data-seg]")
-            .forEach((e) => e.style.opacity = 0);
-    });
+    memset(segments, 0, sizeof(segments));
+    watch_slcd_schedule_flush();
 }
 
 static void watch_invoke_blink_callback(void *userData) {
@@ -79,7 +131,7 @@ void watch_start_character_blink(char character, uint32_t duration) {
 
     blink_state = true;
     blink_character = character;
-    blink_interval_id = emscripten_set_interval(watch_invoke_blink_callback, (double)duration, NULL);
+    blink_interval_id = watch_sim_clock_set_interval(watch_invoke_blink_callback, (double)duration, NULL, false);
 }
 
 void watch_start_indicator_blink_if_possible(watch_indicator_t indicator, uint32_t duration) {
@@ -87,7 +139,7 @@ void watch_start_indicator_blink_if_possible(watch_indicator_t indicator, uint32
 }
 
 void watch_stop_blink(void) {
-    emscripten_clear_timeout(blink_interval_id);
+    watch_sim_clock_clear(blink_interval_id);
     blink_interval_id = -1;
     blink_state = false;
 }
@@ -108,7 +160,7 @@ void watch_start_sleep_animation(uint32_t duration) {
     watch_display_character(' ', 8);
 
     tick_state = true;
-    tick_interval_id = emscripten_set_interval(watch_invoke_tick_callback, (double)duration, NULL);
+    tick_interval_id = watch_sim_clock_set_interval(watch_invoke_tick_callback, (double)duration, NULL, false);
 }
 
 bool watch_sleep_animation_is_running(void) {
@@ -116,7 +168,7 @@ bool watch_sleep_animation_is_running(void) {
 }
 
 void watch_stop_sleep_animation(void) {
-    emscripten_clear_timeout(tick_interval_id);
+    watch_sim_clock_clear(tick_interval_id);
     tick_interval_id = -1;
     tick_state = false;
 
@@ -3,25 +3,132 @@
 #include <string.h>
 #include "watch_storage.h"
 
+#include <emscripten.h>
+
+#define WATCH_STORAGE_NUM_ROWS (NVMCTRL_RWWEE_PAGES / 4)
+#define WATCH_STORAGE_IMAGE_SIZE (WATCH_STORAGE_NUM_ROWS * NVMCTRL_ROW_SIZE)
+
+// The storage area persists as a raw 8 KB image, the same layout as the watch's own (see the shell's nvmdump
+// command): under node, in the file named by SIM_FLASH, created if it doesn't exist; in the browser, in
+// IndexedDB, which the page reads before startup and can import and export from. Writes don't go out one by
+// one; the first write after a save schedules the next one, which takes everything written in the meantime.
+#define WATCH_STORAGE_SAVE_DELAY_MS 500
+
+// Rough latency model, so we can compare littlefs configurations without hardware.
+// Program and erase times are the NVM timing maximums from the SAM L22 datasheet; read
+// time assumes a memory-mapped word copy at 4 MHz, plus some call overhead.
+#define WATCH_STORAGE_READ_US_PER_CALL 2
+#define WATCH_STORAGE_READ_BYTES_PER_US 4
+#define WATCH_STORAGE_PAGE_PROGRAM_US 2500
+#define WATCH_STORAGE_ROW_ERASE_US 6000
+
 uint8_t storage[NVMCTRL_ROW_SIZE * NVMCTRL_RWWEE_PAGES];
+static watch_storage_stats_t _storage_stats = {0};
+static watch_storage_block_stats_t _block_stats[WATCH_STORAGE_NUM_ROWS] = {0};
+static bool _image_loaded = false;
+static bool _save_pending = false;
+
+static void _watch_storage_load_image(void) {
+    if (_image_loaded) return;
+    _image_loaded = true;
+
+    // erased flash reads as all ones.
+    memset(storage, 0xff, sizeof(storage));
+    int length = EM_ASM_INT({
+        let image = null;
+        if (ENVIRONMENT_IS_NODE) {
+            const fs = require('fs');
+            const path = process.env.SIM_FLASH;
+            if (!path) return 0;
+            Module.simFlashPath = path;
+            if (fs.existsSync(path)) image = fs.readFileSync(path);
+            // save whatever is still pending when the process exits, including when a fast-forward run ends.
+            process.on('exit', () => {
+                if (Module.simFlashDirty) fs.writeFileSync(path, HEAPU8.slice($0, $0 + $1));
+            });
+        } else {
+            image = Module.simFlashImage;
+        }
+        if (!image) return 0;
+        if (image.length == $1) HEAPU8.set(image, $0);
+        return image.length;
+    }, storage, WATCH_STORAGE_IMAGE_SIZE);
+
+    if (length == WATCH_STORAGE_IMAGE_SIZE) printf("Loaded flash image.\n");
+    else if (length) printf("Flash image is %d bytes, not %d; starting with blank flash.\n", length, WATCH_STORAGE_IMAGE_SIZE);
+}
+
+EMSCRIPTEN_KEEPALIVE
+void watch_storage_save_image(void) {
+    _save_pending = false;
+    EM_ASM({
+        const image = HEAPU8.slice($0, $0 + $1);
+        Module.simFlashDirty = false;
+        if (ENVIRONMENT_IS_NODE) {
+            if (Module.simFlashPath) require('fs').writeFile(Module.simFlashPath, image, (e) => { if (e) console.warn(e); });
+        } else {
+            Module.simFlashImage = image;
+            if (Module.simSaveFlashImage) Module.simSaveFlashImage(image);
+        }
+    }, storage, WATCH_STORAGE_IMAGE_SIZE);
+}
+
+static void _watch_storage_save_image_callback(void *user_data) {
+    (void) user_data;
+    watch_storage_save_image();
+}
+
+static void _watch_storage_schedule_save(void) {
+    if (_save_pending) return;
+    _save_pending = true;
+    EM_ASM({
+        Module.simFlashDirty = true;
+    });
+    // a wall-clock timer, even when fast-forwarding: this is the host's disk, not the watch's.
+    emscripten_set_timeout(_watch_storage_save_image_callback, WATCH_STORAGE_SAVE_DELAY_MS, NULL);
+}
 
 bool watch_storage_read(uint32_t row, uint32_t offset, uint8_t *buffer, uint32_t size) {
+    _watch_storage_load_image();
     // printf("read row %ld offset %ld size %ld\n", row, offset, size);
     memcpy(buffer, storage + row * NVMCTRL_ROW_SIZE + offset, size);
+    _storage_stats.reads++;
+    _storage_stats.bytes_read += size;
+    if (row < WATCH_STORAGE_NUM_ROWS) {
+        _block_stats[row].reads++;
+        _block_stats[row].busy_us += WATCH_STORAGE_READ_US_PER_CALL + size / WATCH_STORAGE_READ_BYTES_PER_US;
+    }
 
     return true;
 }
 
 bool watch_storage_write(uint32_t row, uint32_t offset, const uint8_t *buffer, uint32_t size) {
     // printf("write row %ld offset %ld size %ld\n", row, offset, size);
+    _watch_storage_load_image();
     memcpy(storage + row * NVMCTRL_ROW_SIZE + offset, buffer, size);
+    _watch_storage_schedule_save();
+    _storage_stats.writes++;
+    _storage_stats.bytes_written += size;
+    if (row < WATCH_STORAGE_NUM_ROWS) {
+        // each page touched costs one page program cycle.
+        uint32_t pages = (offset % NVMCTRL_PAGE_SIZE + size + NVMCTRL_PAGE_SIZE - 1) / NVMCTRL_PAGE_SIZE;
+        _block_stats[row].writes++;
+        _block_stats[row].busy_us += pages * WATCH_STORAGE_PAGE_PROGRAM_US;
+    }
 
     return true;
 }
 
 bool watch_storage_erase(uint32_t row) {
     // printf("erase row %ld\n", row);
+    _watch_storage_load_image();
     memset(storage + row * NVMCTRL_ROW_SIZE, 0xff, NVMCTRL_ROW_SIZE);
+    _watch_storage_schedule_save();
+    _storage_stats.erases++;
+    if (row < WATCH_STORAGE_NUM_ROWS) {
+        _block_stats[row].erases++;
+        _block_stats[row].busy_us += WATCH_STORAGE_ROW_ERASE_US;
+    }
 
     return true;
 }
@@ -30,3 +137,19 @@ bool watch_storage_sync(void) {
     // nothing to do here!
     return true;
 }
+
+void watch_storage_get_stats(watch_storage_stats_t *stats) {
+    *stats = _storage_stats;
+}
+
+bool watch_storage_get_block_stats(uint32_t row, watch_storage_block_stats_t *stats) {
+    if (row >= WATCH_STORAGE_NUM_ROWS) return false;
+    *stats = _block_stats[row];
+
+    return true;
+}
+
+void watch_storage_reset_stats(void) {
+    memset(&_storage_stats, 0, sizeof(_storage_stats));
+    memset(_block_stats, 0, sizeof(_block_stats));
+}
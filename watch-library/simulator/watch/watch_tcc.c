@@ -23,13 +23,16 @@
  */
 
 #include "watch_tcc.h"
-#include "watch_main_loop.h"
+#include "watch_sim_clock.h"
+#include "watch_sim_power.h"
 
 #include <emscripten.h>
 #include <emscripten/html5.h>
 
 static bool buzzer_enabled = false;
+static bool leds_enabled = false;
 static uint32_t buzzer_period;
+static uint8_t buzzer_duty_cycle = 25;
 
 void cb_watch_buzzer_seq(void *userData);
 
@@ -41,8 +44,19 @@ static void (*_cb_finished)(void);
 
 void _watch_enable_tcc(void) {}
 
+void _watch_disable_tcc(void) {
+    // stopping the TCC stops the buzzer and LEDs with it.
+    watch_set_led_off();
+    watch_disable_leds();
+    watch_disable_buzzer();
+}
+
+static void watch_tcc_update_power(void) {
+    watch_sim_power_set(WATCH_SIM_POWER_TCC, buzzer_enabled || leds_enabled);
+}
+
 static inline void _em_interval_stop() {
-    emscripten_clear_interval(_em_interval_id);
+    watch_sim_clock_clear(_em_interval_id);
     _em_interval_id = 0;
 }
 
@@ -57,7 +71,7 @@ void watch_buzzer_play_sequence(int8_t *note_sequence, void (*callback_on_end)(v
     // prepare buzzer
     watch_enable_buzzer();
     // initiate 64 hz callback
-    _em_interval_id = emscripten_set_interval(cb_watch_buzzer_seq, (double)(1000/64), (void *)NULL);
+    _em_interval_id = watch_sim_clock_set_interval(cb_watch_buzzer_seq, (double)(1000/64), (void *)NULL, false);
 }
 
 void cb_watch_buzzer_seq(void *userData) {
@@ -111,21 +125,25 @@ void watch_buzzer_abort_sequence(void) {
 void watch_enable_buzzer(void) {
     buzzer_enabled = true;
     buzzer_period = NotePeriods[BUZZER_NOTE_A4];
+    watch_tcc_update_power();
 
     EM_ASM({
+        if (typeof window === 'undefined') return;
         Module['audioContext'] = new (window.AudioContext || window.webkitAudioContext)();
     });
 }
 
 void watch_set_buzzer_period_and_duty_cycle(uint32_t period, uint8_t duty_cycle) {
-    (void) duty_cycle;
     if (!buzzer_enabled) return;
     buzzer_period = period;
+    buzzer_duty_cycle = duty_cycle;
 }
 
 void watch_disable_buzzer(void) {
     buzzer_enabled = false;
     buzzer_period = NotePeriods[BUZZER_NOTE_A4];
+    watch_sim_power_set(WATCH_SIM_POWER_BUZZER, 0);
+    watch_tcc_update_power();
 
     EM_ASM({
         if (Module['audioContext']) {
@@ -137,6 +155,7 @@ void watch_disable_buzzer(void) {
 
 void watch_set_buzzer_on(void) {
     if (!buzzer_enabled) return;
+    watch_sim_power_set(WATCH_SIM_POWER_BUZZER, buzzer_duty_cycle / 25.0);
 
     EM_ASM({
         const audioContext = Module['audioContext'];
@@ -161,6 +180,7 @@ void watch_set_buzzer_on(void) {
 
 void watch_set_buzzer_off(void) {
     if (!buzzer_enabled) return;
+    watch_sim_power_set(WATCH_SIM_POWER_BUZZER, 0);
 
     EM_ASM({
         const audioContext = Module['audioContext'];
@@ -182,16 +202,29 @@ void watch_buzzer_play_note_with_volume(watch_buzzer_note_t note, uint16_t durat
         watch_set_buzzer_on();
     }
 
-    main_loop_sleep(duration_ms);
+    watch_sim_clock_delay(duration_ms);
     watch_set_buzzer_off();
 }
 
-void watch_enable_leds(void) {}
+void watch_enable_leds(void) {
+    leds_enabled = true;
+    watch_tcc_update_power();
+}
 
-void watch_disable_leds(void) {}
+void watch_disable_leds(void) {
+    leds_enabled = false;
+    watch_sim_power_set(WATCH_SIM_POWER_LED_RED, 0);
+    watch_sim_power_set(WATCH_SIM_POWER_LED_GREEN, 0);
+    watch_sim_power_set(WATCH_SIM_POWER_LED_BLUE, 0);
+    watch_tcc_update_power();
+}
 
 void watch_set_led_color(uint8_t red, uint8_t green) {
+    watch_sim_power_set(WATCH_SIM_POWER_LED_RED, red / 255.0);
+    watch_sim_power_set(WATCH_SIM_POWER_LED_GREEN, green / 255.0);
+    watch_sim_power_set(WATCH_SIM_POWER_LED_BLUE, 0);
     EM_ASM({
+        if (typeof document === 'undefined') return;
         // the watch svg contains an feColorMatrix filter with id ledcolor
         // and a green svg gradient that mimics the led being on
         // https://developer.mozilla.org/en-US/docs/Web/SVG/Element/feColorMatrix
@@ -205,8 +238,8 @@ void watch_set_led_color(uint8_t red, uint8_t green) {
 }
 
 void watch_set_led_color_rgb(uint8_t red, uint8_t green, uint8_t blue) {
-    (void) blue;
     watch_set_led_color(red, green);
+    watch_sim_power_set(WATCH_SIM_POWER_LED_BLUE, blue / 255.0);
 }
 
 void watch_set_led_red(void) {